@@ -41,9 +41,14 @@ fossil_tofu_array_t* fossil_tofu_array_create_container(char* type) {
         fossil_tofu_free(array);
         return NULL;
     }
+    array->type = fossil_tofu_strdup(type);
+    if (array->type == NULL) {
+        fossil_tofu_free(array->data);
+        fossil_tofu_free(array);
+        return NULL;
+    }
     array->size = 0;
     array->capacity = INITIAL_CAPACITY;
-    array->type = type;
     return array;
 }
 
@@ -66,10 +71,16 @@ fossil_tofu_array_t* fossil_tofu_array_create_copy(const fossil_tofu_array_t* ot
     }
     array->size = other->size;
     array->capacity = other->capacity;
-    array->type = other->type;
+    array->type = fossil_tofu_strdup(other->type);
+    if (array->type == NULL) {
+        fossil_tofu_free(array->data);
+        fossil_tofu_free(array);
+        return NULL;
+    }
     for (size_t i = 0; i < other->size; i++) {
         if (fossil_tofu_get_type(&other->data[i]) != fossil_tofu_validate_type(other->type)) {
             // Type mismatch encountered
+            fossil_tofu_free(array->type);
             fossil_tofu_free(array->data);
             fossil_tofu_free(array);
             return NULL;
@@ -103,6 +114,7 @@ void fossil_tofu_array_destroy(fossil_tofu_array_t* array) {
         return;
     }
     fossil_tofu_free(array->data);
+    fossil_tofu_free(array->type);
     fossil_tofu_free(array);
 }
 
@@ -282,3 +294,127 @@ void fossil_tofu_array_set_at(fossil_tofu_array_t* array, size_t index, char *el
     }
     fossil_tofu_set_value(&array->data[index], element);
 }
+
+// *****************************************************************************
+// Aggregation functions
+// *****************************************************************************
+
+int32_t fossil_tofu_array_stats(const fossil_tofu_array_t* array, fossil_tofu_stats_t* stats) {
+    if (array == NULL || stats == NULL) {
+        return FOSSIL_TOFU_ERROR_NULL_POINTER;
+    }
+    fossil_tofu_stats_init(stats);
+    if (!fossil_tofu_type_is_numeric(fossil_tofu_validate_type(array->type))) {
+        return FOSSIL_TOFU_ERROR_TYPE_MISMATCH;
+    }
+    fossil_tofu_stats_add_tofu(stats, array->data, array->size);
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+int32_t fossil_tofu_array_sum(const fossil_tofu_array_t* array, double* out) {
+    if (out == NULL) {
+        return FOSSIL_TOFU_ERROR_NULL_POINTER;
+    }
+    fossil_tofu_stats_t stats;
+    int32_t rc = fossil_tofu_array_stats(array, &stats);
+    if (rc != FOSSIL_TOFU_SUCCESS) {
+        return rc;
+    }
+    *out = stats.sum;
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+int32_t fossil_tofu_array_min(const fossil_tofu_array_t* array, double* out) {
+    if (out == NULL) {
+        return FOSSIL_TOFU_ERROR_NULL_POINTER;
+    }
+    fossil_tofu_stats_t stats;
+    int32_t rc = fossil_tofu_array_stats(array, &stats);
+    if (rc != FOSSIL_TOFU_SUCCESS) {
+        return rc;
+    }
+    if (stats.count == 0) {
+        return FOSSIL_TOFU_ERROR_NOT_FOUND;
+    }
+    *out = stats.min;
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+int32_t fossil_tofu_array_max(const fossil_tofu_array_t* array, double* out) {
+    if (out == NULL) {
+        return FOSSIL_TOFU_ERROR_NULL_POINTER;
+    }
+    fossil_tofu_stats_t stats;
+    int32_t rc = fossil_tofu_array_stats(array, &stats);
+    if (rc != FOSSIL_TOFU_SUCCESS) {
+        return rc;
+    }
+    if (stats.count == 0) {
+        return FOSSIL_TOFU_ERROR_NOT_FOUND;
+    }
+    *out = stats.max;
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+int32_t fossil_tofu_array_mean(const fossil_tofu_array_t* array, double* out) {
+    if (out == NULL) {
+        return FOSSIL_TOFU_ERROR_NULL_POINTER;
+    }
+    fossil_tofu_stats_t stats;
+    int32_t rc = fossil_tofu_array_stats(array, &stats);
+    if (rc != FOSSIL_TOFU_SUCCESS) {
+        return rc;
+    }
+    if (stats.count == 0) {
+        return FOSSIL_TOFU_ERROR_NOT_FOUND;
+    }
+    *out = stats.sum / (double)stats.count;
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+int32_t fossil_tofu_array_variance(const fossil_tofu_array_t* array, double* out) {
+    if (out == NULL) {
+        return FOSSIL_TOFU_ERROR_NULL_POINTER;
+    }
+    fossil_tofu_stats_t stats;
+    int32_t rc = fossil_tofu_array_stats(array, &stats);
+    if (rc != FOSSIL_TOFU_SUCCESS) {
+        return rc;
+    }
+    if (stats.count == 0) {
+        return FOSSIL_TOFU_ERROR_NOT_FOUND;
+    }
+    *out = fossil_tofu_stats_variance(&stats);
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+size_t fossil_tofu_array_count_if(const fossil_tofu_array_t* array, fossil_tofu_predicate_t predicate, void* context) {
+    if (array == NULL || predicate == NULL) {
+        return 0;
+    }
+    if (!fossil_tofu_type_is_numeric(fossil_tofu_validate_type(array->type))) {
+        return 0;
+    }
+    return fossil_tofu_count_if_tofu(array->data, array->size, predicate, context);
+}
+
+// *****************************************************************************
+// Search functions
+// *****************************************************************************
+
+int32_t fossil_tofu_array_index_of(const fossil_tofu_array_t* array, char *element, size_t* index) {
+    if (array == NULL || element == NULL || index == NULL) {
+        return FOSSIL_TOFU_ERROR_NULL_POINTER;
+    }
+    size_t found = fossil_tofu_search(array->data, array->size, fossil_tofu_validate_type(array->type), element);
+    if (found >= array->size) {
+        return FOSSIL_TOFU_ERROR_NOT_FOUND;
+    }
+    *index = found;
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+bool fossil_tofu_array_contains(const fossil_tofu_array_t* array, char *element) {
+    size_t index = 0;
+    return fossil_tofu_array_index_of(array, element, &index) == FOSSIL_TOFU_SUCCESS;
+}
@@ -177,3 +177,27 @@ void fossil_tofu_arraylist_set_back(fossil_tofu_arraylist_t* alist, char *elemen
     if (alist == NULL || alist->size == 0) return;
     fossil_tofu_set_value(&alist->items[alist->size - 1].data, element);
 }
+
+// *****************************************************************************
+// Search functions
+// *****************************************************************************
+
+// Nodes wrap a single tofu, so the item array can be scanned as tofu.
+_Static_assert(sizeof(fossil_tofu_arraylist_node_t) == sizeof(fossil_tofu_t), "arraylist node must wrap a single tofu");
+
+int32_t fossil_tofu_arraylist_index_of(const fossil_tofu_arraylist_t* alist, char *element, size_t* index) {
+    if (alist == NULL || element == NULL || index == NULL) {
+        return FOSSIL_TOFU_ERROR_NULL_POINTER;
+    }
+    size_t found = fossil_tofu_search((const fossil_tofu_t*)alist->items, alist->size, fossil_tofu_validate_type(alist->type), element);
+    if (found >= alist->size) {
+        return FOSSIL_TOFU_ERROR_NOT_FOUND;
+    }
+    *index = found;
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+bool fossil_tofu_arraylist_contains(const fossil_tofu_arraylist_t* alist, char *element) {
+    size_t index = 0;
+    return fossil_tofu_arraylist_index_of(alist, element, &index) == FOSSIL_TOFU_SUCCESS;
+}
@@ -0,0 +1,228 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include "fossil/tofu/bag.h"
+
+// *****************************************************************************
+// Hash table helpers
+// *****************************************************************************
+
+// Grow once the table is 7/8 full.
+#define FOSSIL_TOFU_BAG_MAX_LOAD ((double)FOSSIL_TOFU_BAG_LOAD_NUM / FOSSIL_TOFU_BAG_LOAD_DEN)
+
+static inline fossil_tofu_bag_node_t* fossil_tofu_bag_node(const fossil_tofu_bag_t* bag, size_t i) {
+    return (fossil_tofu_bag_node_t*)bag->table.slots[i].node;
+}
+
+static void* fossil_tofu_bag_clone_node(const void* node, void* context) {
+    const fossil_tofu_bag_node_t* source = (const fossil_tofu_bag_node_t*)node;
+    fossil_tofu_bag_t* bag = (fossil_tofu_bag_t*)context;
+    fossil_tofu_bag_node_t* copy = (fossil_tofu_bag_node_t*)fossil_tofu_alloc(sizeof(fossil_tofu_bag_node_t));
+    if (!copy) return NULL;
+    copy->item = fossil_tofu_create(bag->type, fossil_tofu_get_value(&source->item));
+    copy->count = source->count;
+    bag->size += copy->count;
+    return copy;
+}
+
+// Remove the element in slot `i` and free it.
+static void fossil_tofu_bag_drop(fossil_tofu_bag_t* bag, size_t i) {
+    fossil_tofu_bag_node_t* node = (fossil_tofu_bag_node_t*)fossil_tofu_hashtable_vacate(&bag->table, i);
+    bag->size -= node->count;
+    fossil_tofu_destroy(&node->item);
+    fossil_tofu_free(node);
+}
+
+// *****************************************************************************
+// Function definitions
+// *****************************************************************************
+
+fossil_tofu_bag_t* fossil_tofu_bag_create_container(char* type) {
+    if (!type) return NULL;
+    if (fossil_tofu_validate_type(type) == FOSSIL_TOFU_TYPE_CNULL) return NULL;
+
+    fossil_tofu_bag_t* bag = (fossil_tofu_bag_t*)fossil_tofu_alloc(sizeof(fossil_tofu_bag_t));
+    if (!bag) return NULL;
+    bag->type = fossil_tofu_strdup(type);
+    if (!bag->type) {
+        fossil_tofu_free(bag);
+        return NULL;
+    }
+    fossil_tofu_hashtable_init(&bag->table, fossil_tofu_validate_type(type), offsetof(fossil_tofu_bag_node_t, item));
+    bag->size = 0;
+    return bag;
+}
+
+fossil_tofu_bag_t* fossil_tofu_bag_create_default(void) {
+    return fossil_tofu_bag_create_container("any");
+}
+
+fossil_tofu_bag_t* fossil_tofu_bag_create_copy(const fossil_tofu_bag_t* other) {
+    if (!other) return NULL;
+
+    fossil_tofu_bag_t* bag = fossil_tofu_bag_create_container(other->type);
+    if (!bag) return NULL;
+    if (fossil_tofu_hashtable_clone(&bag->table, &other->table, fossil_tofu_bag_clone_node, bag) != FOSSIL_TOFU_SUCCESS) {
+        fossil_tofu_bag_destroy(bag);
+        return NULL;
+    }
+    return bag;
+}
+
+fossil_tofu_bag_t* fossil_tofu_bag_create_move(fossil_tofu_bag_t* other) {
+    if (!other) return NULL;
+
+    fossil_tofu_bag_t* bag = fossil_tofu_bag_create_container(other->type);
+    if (!bag) return NULL;
+
+    fossil_tofu_hashtable_move(&bag->table, &other->table);
+    bag->size = other->size;
+    other->size = 0;
+    return bag;
+}
+
+void fossil_tofu_bag_destroy(fossil_tofu_bag_t* bag) {
+    if (!bag) return;
+
+    for (size_t i = 0; i < bag->table.capacity; i++) {
+        fossil_tofu_bag_node_t* node = fossil_tofu_bag_node(bag, i);
+        if (!node) continue;
+        fossil_tofu_destroy(&node->item);
+        fossil_tofu_free(node);
+    }
+    fossil_tofu_hashtable_release(&bag->table);
+    fossil_tofu_free(bag->type);
+    fossil_tofu_free(bag);
+}
+
+int32_t fossil_tofu_bag_add_count(fossil_tofu_bag_t* bag, char *item, size_t count) {
+    if (!bag || !item) return FOSSIL_TOFU_FAILURE;
+    if (count == 0) return FOSSIL_TOFU_SUCCESS;
+    if (bag->size > SIZE_MAX - count) return FOSSIL_TOFU_ERROR_OVERFLOW;
+
+    size_t len = strlen(item);
+    uint64_t hash = fossil_tofu_hashtable_hash(&bag->table, item, len);
+    size_t i = fossil_tofu_hashtable_probe(&bag->table, hash, item, len);
+    if (i != SIZE_MAX) {
+        fossil_tofu_bag_node(bag, i)->count += count;
+        bag->size += count;
+        return FOSSIL_TOFU_SUCCESS;
+    }
+
+    if (fossil_tofu_hashtable_grow(&bag->table, FOSSIL_TOFU_BAG_MAX_LOAD) != FOSSIL_TOFU_SUCCESS) {
+        return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+    }
+
+    fossil_tofu_bag_node_t* node = (fossil_tofu_bag_node_t*)fossil_tofu_alloc(sizeof(fossil_tofu_bag_node_t));
+    if (!node) return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+    node->item = fossil_tofu_create(bag->type, item);
+    node->count = count;
+
+    fossil_tofu_hashtable_place(&bag->table, hash, node);
+    bag->size += count;
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+int32_t fossil_tofu_bag_add(fossil_tofu_bag_t* bag, char *item) {
+    return fossil_tofu_bag_add_count(bag, item, 1);
+}
+
+int32_t fossil_tofu_bag_remove(fossil_tofu_bag_t* bag, char *item) {
+    if (!bag || !item) return FOSSIL_TOFU_FAILURE;
+
+    size_t i = fossil_tofu_hashtable_lookup(&bag->table, item, strlen(item));
+    if (i == SIZE_MAX) return FOSSIL_TOFU_ERROR_NOT_FOUND;
+
+    fossil_tofu_bag_node_t* node = fossil_tofu_bag_node(bag, i);
+    if (node->count == 1) {
+        fossil_tofu_bag_drop(bag, i);
+    } else {
+        node->count--;
+        bag->size--;
+    }
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+size_t fossil_tofu_bag_remove_all(fossil_tofu_bag_t* bag, char *item) {
+    if (!bag || !item) return 0;
+
+    size_t i = fossil_tofu_hashtable_lookup(&bag->table, item, strlen(item));
+    if (i == SIZE_MAX) return 0;
+
+    size_t count = fossil_tofu_bag_node(bag, i)->count;
+    fossil_tofu_bag_drop(bag, i);
+    return count;
+}
+
+size_t fossil_tofu_bag_count_key(const fossil_tofu_bag_t* bag, const char* item, size_t len) {
+    if (!bag || !item) return 0;
+
+    size_t i = fossil_tofu_hashtable_lookup(&bag->table, item, len);
+    return i == SIZE_MAX ? 0 : fossil_tofu_bag_node(bag, i)->count;
+}
+
+size_t fossil_tofu_bag_count(const fossil_tofu_bag_t* bag, char *item) {
+    if (!item) return 0;
+
+    return fossil_tofu_bag_count_key(bag, item, strlen(item));
+}
+
+bool fossil_tofu_bag_contains(const fossil_tofu_bag_t* bag, char *item) {
+    return fossil_tofu_bag_count(bag, item) != 0;
+}
+
+int32_t fossil_tofu_bag_reserve(fossil_tofu_bag_t* bag, size_t distinct) {
+    if (!bag) return FOSSIL_TOFU_ERROR_NULL_POINTER;
+
+    return fossil_tofu_hashtable_reserve(&bag->table, distinct, FOSSIL_TOFU_BAG_MAX_LOAD);
+}
+
+size_t fossil_tofu_bag_for_each(const fossil_tofu_bag_t* bag, fossil_tofu_bag_visit_fn visit, void* context) {
+    if (!bag || !visit) return 0;
+
+    size_t visited = 0;
+    for (size_t i = 0; i < bag->table.capacity; i++) {
+        const fossil_tofu_bag_node_t* node = fossil_tofu_bag_node(bag, i);
+        if (!node) continue;
+        visited++;
+        if (!visit(&node->item, node->count, context)) break;
+    }
+    return visited;
+}
+
+size_t fossil_tofu_bag_distinct(const fossil_tofu_bag_t* bag) {
+    return bag ? bag->table.count : 0;
+}
+
+size_t fossil_tofu_bag_size(const fossil_tofu_bag_t* bag) {
+    return bag ? bag->size : 0;
+}
+
+bool fossil_tofu_bag_not_empty(const fossil_tofu_bag_t* bag) {
+    return bag && bag->size != 0;
+}
+
+bool fossil_tofu_bag_is_empty(const fossil_tofu_bag_t* bag) {
+    return !bag || bag->size == 0;
+}
@@ -0,0 +1,175 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include "fossil/tofu/bloom.h"
+
+#define FOSSIL_TOFU_BLOOM_BLOCK_WORDS (FOSSIL_TOFU_BLOOM_BLOCK_BITS / 64)
+#define FOSSIL_TOFU_BLOOM_MAX_HASHES 16
+
+// *****************************************************************************
+// Helpers
+// *****************************************************************************
+
+// Blocks needed for `expected` keys at `bits_per_key`, at least one.
+static size_t fossil_tofu_bloom_blocks_for(size_t expected, size_t bits_per_key) {
+    if (expected == 0) expected = 1;
+    if (expected > SIZE_MAX / bits_per_key) return 0;
+    return (expected * bits_per_key + FOSSIL_TOFU_BLOOM_BLOCK_BITS - 1) / FOSSIL_TOFU_BLOOM_BLOCK_BITS;
+}
+
+static uint64_t* fossil_tofu_bloom_words(size_t blocks) {
+    if (blocks == 0 || blocks > SIZE_MAX / (FOSSIL_TOFU_BLOOM_BLOCK_WORDS * sizeof(uint64_t))) return NULL;
+    size_t bytes = blocks * FOSSIL_TOFU_BLOOM_BLOCK_WORDS * sizeof(uint64_t);
+    uint64_t* words = (uint64_t*)fossil_tofu_alloc(bytes);
+    if (words) memset(words, 0, bytes);
+    return words;
+}
+
+// The block comes from a multiplied copy of the hash, whose high bits
+// depend on every input bit; containers that split on the raw high or low
+// bits (slots, shards) still spread over all blocks. Bit positions within
+// the block step by an odd stride, so the k bits are always distinct.
+static inline uint64_t* fossil_tofu_bloom_block(const fossil_tofu_bloom_t* bloom, uint64_t hash, uint32_t* start, uint32_t* step) {
+    uint64_t mix = hash * 0x9E3779B97F4A7C15ULL;
+    *start = (uint32_t)(hash ^ (hash >> 32));
+    *step = (uint32_t)(mix >> 16) | 1u;
+    return &bloom->words[(size_t)((mix >> 32) % bloom->blocks) * FOSSIL_TOFU_BLOOM_BLOCK_WORDS];
+}
+
+// *****************************************************************************
+// Function definitions
+// *****************************************************************************
+
+fossil_tofu_bloom_t* fossil_tofu_bloom_create(size_t expected, size_t bits_per_key) {
+    if (bits_per_key == 0) bits_per_key = FOSSIL_TOFU_BLOOM_BITS_PER_KEY;
+
+    fossil_tofu_bloom_t* bloom = (fossil_tofu_bloom_t*)fossil_tofu_alloc(sizeof(fossil_tofu_bloom_t));
+    if (!bloom) return NULL;
+
+    bloom->blocks = fossil_tofu_bloom_blocks_for(expected, bits_per_key);
+    bloom->words = fossil_tofu_bloom_words(bloom->blocks);
+    if (!bloom->words) {
+        fossil_tofu_free(bloom);
+        return NULL;
+    }
+    // k = bits_per_key * ln 2 minimises the false positive rate.
+    bloom->bits_per_key = bits_per_key;
+    bloom->hashes = (bits_per_key * 69 + 50) / 100;
+    if (bloom->hashes == 0) bloom->hashes = 1;
+    if (bloom->hashes > FOSSIL_TOFU_BLOOM_MAX_HASHES) bloom->hashes = FOSSIL_TOFU_BLOOM_MAX_HASHES;
+    bloom->count = 0;
+    return bloom;
+}
+
+fossil_tofu_bloom_t* fossil_tofu_bloom_create_copy(const fossil_tofu_bloom_t* other) {
+    if (!other) return NULL;
+
+    fossil_tofu_bloom_t* bloom = (fossil_tofu_bloom_t*)fossil_tofu_alloc(sizeof(fossil_tofu_bloom_t));
+    if (!bloom) return NULL;
+
+    *bloom = *other;
+    bloom->words = fossil_tofu_bloom_words(other->blocks);
+    if (!bloom->words) {
+        fossil_tofu_free(bloom);
+        return NULL;
+    }
+    memcpy(bloom->words, other->words, other->blocks * FOSSIL_TOFU_BLOOM_BLOCK_WORDS * sizeof(uint64_t));
+    return bloom;
+}
+
+void fossil_tofu_bloom_destroy(fossil_tofu_bloom_t* bloom) {
+    if (!bloom) return;
+
+    fossil_tofu_free(bloom->words);
+    fossil_tofu_free(bloom);
+}
+
+void fossil_tofu_bloom_add_hash(fossil_tofu_bloom_t* bloom, uint64_t hash) {
+    if (!bloom) return;
+
+    uint32_t bit, step;
+    uint64_t* block = fossil_tofu_bloom_block(bloom, hash, &bit, &step);
+    for (size_t i = 0; i < bloom->hashes; i++, bit += step) {
+        uint32_t b = bit % FOSSIL_TOFU_BLOOM_BLOCK_BITS;
+        block[b / 64] |= (uint64_t)1 << (b % 64);
+    }
+    bloom->count++;
+}
+
+void fossil_tofu_bloom_add(fossil_tofu_bloom_t* bloom, const char* key, size_t len) {
+    if (!bloom || !key) return;
+
+    fossil_tofu_bloom_add_hash(bloom, fossil_tofu_hash64_seed(key, len, 0));
+}
+
+bool fossil_tofu_bloom_may_contain_hash(const fossil_tofu_bloom_t* bloom, uint64_t hash) {
+    if (!bloom) return true;
+
+    uint32_t bit, step;
+    const uint64_t* block = fossil_tofu_bloom_block(bloom, hash, &bit, &step);
+    for (size_t i = 0; i < bloom->hashes; i++, bit += step) {
+        uint32_t b = bit % FOSSIL_TOFU_BLOOM_BLOCK_BITS;
+        if (!(block[b / 64] & ((uint64_t)1 << (b % 64)))) return false;
+    }
+    return true;
+}
+
+bool fossil_tofu_bloom_may_contain(const fossil_tofu_bloom_t* bloom, const char* key, size_t len) {
+    if (!key) return false;
+
+    return fossil_tofu_bloom_may_contain_hash(bloom, fossil_tofu_hash64_seed(key, len, 0));
+}
+
+int32_t fossil_tofu_bloom_reset(fossil_tofu_bloom_t* bloom, size_t expected) {
+    if (!bloom) return FOSSIL_TOFU_ERROR_NULL_POINTER;
+
+    size_t blocks = fossil_tofu_bloom_blocks_for(expected, bloom->bits_per_key);
+    if (blocks == bloom->blocks) {
+        fossil_tofu_bloom_clear(bloom);
+        return FOSSIL_TOFU_SUCCESS;
+    }
+    uint64_t* words = fossil_tofu_bloom_words(blocks);
+    if (!words) return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+
+    fossil_tofu_free(bloom->words);
+    bloom->words = words;
+    bloom->blocks = blocks;
+    bloom->count = 0;
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+void fossil_tofu_bloom_clear(fossil_tofu_bloom_t* bloom) {
+    if (!bloom) return;
+
+    memset(bloom->words, 0, bloom->blocks * FOSSIL_TOFU_BLOOM_BLOCK_WORDS * sizeof(uint64_t));
+    bloom->count = 0;
+}
+
+size_t fossil_tofu_bloom_count(const fossil_tofu_bloom_t* bloom) {
+    return bloom ? bloom->count : 0;
+}
+
+size_t fossil_tofu_bloom_bits(const fossil_tofu_bloom_t* bloom) {
+    return bloom ? bloom->blocks * FOSSIL_TOFU_BLOOM_BLOCK_BITS : 0;
+}
@@ -0,0 +1,240 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include "fossil/tofu/bqueue.h"
+#include "fossil/tofu/threads.h"
+
+// *****************************************************************************
+// Synchronization
+// *****************************************************************************
+
+struct fossil_tofu_bqueue_sync_t {
+    fossil_tofu_mutex_t lock;
+    fossil_tofu_cond_t not_empty;
+    fossil_tofu_cond_t not_full;
+};
+
+// Wait on 'cond' until 'ready' holds or the timeout passes; called with the
+// lock held. Returns whether the condition is met. The deadline is kept on
+// the monotonic clock, so wall-clock jumps neither cut the wait short nor
+// stretch it, and spurious wakeups only wait out what is left.
+static bool fossil_tofu_bqueue_wait(fossil_tofu_bqueue_t* queue, fossil_tofu_cond_t* cond, bool (*ready)(const fossil_tofu_cqueue_t*), int64_t timeout_ms) {
+    if (ready(queue->ring)) {
+        return true;
+    }
+    if (timeout_ms == 0) {
+        return false;
+    }
+    uint64_t deadline = timeout_ms > 0 ? fossil_tofu_clock_ms() + (uint64_t)timeout_ms : 0;
+    while (!ready(queue->ring)) {
+        if (timeout_ms < 0) {
+            fossil_tofu_cond_wait(cond, &queue->sync->lock);
+            continue;
+        }
+        uint64_t now = fossil_tofu_clock_ms();
+        if (now >= deadline) {
+            return false;
+        }
+        fossil_tofu_cond_wait_ms(cond, &queue->sync->lock, deadline - now);
+    }
+    return true;
+}
+
+static bool fossil_tofu_bqueue_has_room(const fossil_tofu_cqueue_t* ring) {
+    return !fossil_tofu_cqueue_is_full(ring);
+}
+
+static bool fossil_tofu_bqueue_has_data(const fossil_tofu_cqueue_t* ring) {
+    return fossil_tofu_cqueue_not_empty(ring);
+}
+
+// *****************************************************************************
+// Function prototypes
+// *****************************************************************************
+
+fossil_tofu_bqueue_t* fossil_tofu_bqueue_create_container(char* type, size_t capacity) {
+    if (type == NULL || capacity == 0) {
+        return NULL;
+    }
+    fossil_tofu_bqueue_t* queue = (fossil_tofu_bqueue_t*)fossil_tofu_alloc(sizeof(fossil_tofu_bqueue_t));
+    if (queue == NULL) {
+        return NULL;
+    }
+    queue->ring = fossil_tofu_cqueue_create_container(type, capacity);
+    queue->sync = (fossil_tofu_bqueue_sync_t*)fossil_tofu_alloc(sizeof(fossil_tofu_bqueue_sync_t));
+    if (queue->ring == NULL || queue->sync == NULL) {
+        fossil_tofu_cqueue_destroy(queue->ring);
+        fossil_tofu_free(queue->sync);
+        fossil_tofu_free(queue);
+        return NULL;
+    }
+    if (fossil_tofu_mutex_init(&queue->sync->lock) != FOSSIL_TOFU_SUCCESS) {
+        fossil_tofu_cqueue_destroy(queue->ring);
+        fossil_tofu_free(queue->sync);
+        fossil_tofu_free(queue);
+        return NULL;
+    }
+    if (fossil_tofu_cond_init(&queue->sync->not_empty) != FOSSIL_TOFU_SUCCESS) {
+        fossil_tofu_mutex_destroy(&queue->sync->lock);
+        fossil_tofu_cqueue_destroy(queue->ring);
+        fossil_tofu_free(queue->sync);
+        fossil_tofu_free(queue);
+        return NULL;
+    }
+    if (fossil_tofu_cond_init(&queue->sync->not_full) != FOSSIL_TOFU_SUCCESS) {
+        fossil_tofu_cond_destroy(&queue->sync->not_empty);
+        fossil_tofu_mutex_destroy(&queue->sync->lock);
+        fossil_tofu_cqueue_destroy(queue->ring);
+        fossil_tofu_free(queue->sync);
+        fossil_tofu_free(queue);
+        return NULL;
+    }
+    return queue;
+}
+
+void fossil_tofu_bqueue_destroy(fossil_tofu_bqueue_t* queue) {
+    if (queue == NULL) {
+        return;
+    }
+    fossil_tofu_cond_destroy(&queue->sync->not_full);
+    fossil_tofu_cond_destroy(&queue->sync->not_empty);
+    fossil_tofu_mutex_destroy(&queue->sync->lock);
+    fossil_tofu_free(queue->sync);
+    fossil_tofu_cqueue_destroy(queue->ring);
+    fossil_tofu_free(queue);
+}
+
+// *****************************************************************************
+// Utility functions
+// *****************************************************************************
+
+int32_t fossil_tofu_bqueue_put(fossil_tofu_bqueue_t* queue, char* data, int64_t timeout_ms) {
+    if (queue == NULL || data == NULL) {
+        return FOSSIL_TOFU_ERROR_INVALID_ARGUMENT;
+    }
+    fossil_tofu_mutex_lock(&queue->sync->lock);
+    if (!fossil_tofu_bqueue_wait(queue, &queue->sync->not_full, fossil_tofu_bqueue_has_room, timeout_ms)) {
+        fossil_tofu_mutex_unlock(&queue->sync->lock);
+        return FOSSIL_TOFU_FAILURE;  // Timed out while full
+    }
+    int32_t result = fossil_tofu_cqueue_insert(queue->ring, data);
+    fossil_tofu_mutex_unlock(&queue->sync->lock);
+    if (result == FOSSIL_TOFU_SUCCESS) {
+        fossil_tofu_cond_signal(&queue->sync->not_empty);
+    }
+    return result;
+}
+
+int32_t fossil_tofu_bqueue_take(fossil_tofu_bqueue_t* queue, fossil_tofu_t* out, int64_t timeout_ms) {
+    if (queue == NULL || out == NULL) {
+        return FOSSIL_TOFU_ERROR_INVALID_ARGUMENT;
+    }
+    fossil_tofu_mutex_lock(&queue->sync->lock);
+    if (!fossil_tofu_bqueue_wait(queue, &queue->sync->not_empty, fossil_tofu_bqueue_has_data, timeout_ms)) {
+        fossil_tofu_mutex_unlock(&queue->sync->lock);
+        return FOSSIL_TOFU_FAILURE;  // Timed out while empty
+    }
+    int32_t result = fossil_tofu_cqueue_take(queue->ring, out);
+    fossil_tofu_mutex_unlock(&queue->sync->lock);
+    fossil_tofu_cond_signal(&queue->sync->not_full);
+    return result;
+}
+
+size_t fossil_tofu_bqueue_drain(fossil_tofu_bqueue_t* queue, fossil_tofu_t out[], size_t max) {
+    if (queue == NULL || out == NULL || max == 0) {
+        return 0;
+    }
+    size_t taken = 0;
+    fossil_tofu_mutex_lock(&queue->sync->lock);
+    while (taken < max && fossil_tofu_cqueue_take(queue->ring, &out[taken]) == FOSSIL_TOFU_SUCCESS) {
+        taken++;
+    }
+    fossil_tofu_mutex_unlock(&queue->sync->lock);
+    if (taken > 0) {
+        fossil_tofu_cond_broadcast(&queue->sync->not_full);
+    }
+    return taken;
+}
+
+size_t fossil_tofu_bqueue_drain_to(fossil_tofu_bqueue_t* queue, fossil_tofu_vector_t* vector, size_t max) {
+    if (queue == NULL || vector == NULL || max == 0) {
+        return 0;
+    }
+    // Each element is copied out before it is removed, so one the vector
+    // could not take stays at the front of the queue instead of being lost.
+    size_t moved = 0;
+    fossil_tofu_mutex_lock(&queue->sync->lock);
+    while (moved < max) {
+        char* front = fossil_tofu_cqueue_get_front(queue->ring);
+        if (front == NULL) {
+            break;
+        }
+        size_t size = fossil_tofu_vector_size(vector);
+        fossil_tofu_vector_push_back(vector, front);
+        if (fossil_tofu_vector_size(vector) == size) {
+            break;  // Out of memory
+        }
+        fossil_tofu_cqueue_remove(queue->ring);
+        moved++;
+    }
+    fossil_tofu_mutex_unlock(&queue->sync->lock);
+    if (moved > 0) {
+        fossil_tofu_cond_broadcast(&queue->sync->not_full);
+    }
+    return moved;
+}
+
+size_t fossil_tofu_bqueue_size(const fossil_tofu_bqueue_t* queue) {
+    if (queue == NULL) {
+        return 0;
+    }
+    fossil_tofu_mutex_lock(&queue->sync->lock);
+    size_t size = fossil_tofu_cqueue_size(queue->ring);
+    fossil_tofu_mutex_unlock(&queue->sync->lock);
+    return size;
+}
+
+size_t fossil_tofu_bqueue_capacity(const fossil_tofu_bqueue_t* queue) {
+    return (queue != NULL) ? fossil_tofu_cqueue_capacity(queue->ring) : 0;
+}
+
+bool fossil_tofu_bqueue_not_empty(const fossil_tofu_bqueue_t* queue) {
+    return fossil_tofu_bqueue_size(queue) > 0;
+}
+
+bool fossil_tofu_bqueue_not_cnullptr(const fossil_tofu_bqueue_t* queue) {
+    return queue != NULL;
+}
+
+bool fossil_tofu_bqueue_is_empty(const fossil_tofu_bqueue_t* queue) {
+    return fossil_tofu_bqueue_size(queue) == 0;
+}
+
+bool fossil_tofu_bqueue_is_full(const fossil_tofu_bqueue_t* queue) {
+    return (queue != NULL) && (fossil_tofu_bqueue_size(queue) >= fossil_tofu_bqueue_capacity(queue));
+}
+
+bool fossil_tofu_bqueue_is_cnullptr(const fossil_tofu_bqueue_t* queue) {
+    return queue == NULL;
+}
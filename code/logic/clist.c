@@ -39,6 +39,7 @@ fossil_tofu_clist_t* fossil_tofu_clist_create_container(char* type) {
         return NULL;
     }
     clist->head = NULL;
+    clist->size = 0;
     clist->type = fossil_tofu_strdup(type);
     return clist;
 }
@@ -57,6 +58,7 @@ fossil_tofu_clist_t* fossil_tofu_clist_create_copy(const fossil_tofu_clist_t* ot
     }
     clist->type = fossil_tofu_strdup(other->type);
     clist->head = NULL;
+    clist->size = 0;
     fossil_tofu_clist_node_t* current = other->head;
     if (current != NULL) {
         do {
@@ -84,20 +86,22 @@ fossil_tofu_clist_t* fossil_tofu_clist_create_move(fossil_tofu_clist_t* other) {
     }
     clist->type = other->type;
     clist->head = other->head;
+    clist->size = other->size;
     other->type = NULL; // Prevent double free of type
     other->head = NULL;
+    other->size = 0;
     return clist;
 }
 
 void fossil_tofu_clist_destroy(fossil_tofu_clist_t* clist) {
-    if (clist == NULL || clist->head == NULL) return;
+    if (clist == NULL) return;
     fossil_tofu_clist_node_t* current = clist->head;
-    do {
+    for (size_t i = 0; i < clist->size; i++) {
         fossil_tofu_clist_node_t* next = current->next;
         fossil_tofu_destroy(&current->data);
         fossil_tofu_free(current);
         current = next;
-    } while (current != clist->head);
+    }
     fossil_tofu_free(clist->type);
     fossil_tofu_free(clist);
 }
@@ -122,6 +126,8 @@ int32_t fossil_tofu_clist_insert(fossil_tofu_clist_t* clist, char* data) {
         clist->head->prev->next = node;
         clist->head->prev = node;
     }
+    clist->size++;
+    FOSSIL_TOFU_DEBUG_CHECK(fossil_tofu_clist_verify(clist));
     return FOSSIL_TOFU_SUCCESS;
 }
 
@@ -137,8 +143,10 @@ int32_t fossil_tofu_clist_remove(fossil_tofu_clist_t* clist) {
         clist->head->next->prev = clist->head->prev;
         clist->head = clist->head->next;
     }
+    clist->size--;
     fossil_tofu_destroy(&node->data);
     fossil_tofu_free(node);
+    FOSSIL_TOFU_DEBUG_CHECK(fossil_tofu_clist_verify(clist));
     return FOSSIL_TOFU_SUCCESS;
 }
 
@@ -155,22 +163,36 @@ void fossil_tofu_clist_reverse(fossil_tofu_clist_t* clist) {
         current = temp;
     } while (current != clist->head);
     clist->head = clist->head->prev;  // Move head to the new start
+    FOSSIL_TOFU_DEBUG_CHECK(fossil_tofu_clist_verify(clist));
 }
 
 size_t fossil_tofu_clist_size(const fossil_tofu_clist_t* clist) {
-    size_t size = 0;
-    if (clist->head != NULL) {
-        fossil_tofu_clist_node_t* current = clist->head;
-        do {
-            size++;
-            current = current->next;
-        } while (current != clist->head);
+    return (clist == NULL) ? 0 : clist->size;
+}
+
+bool fossil_tofu_clist_verify(const fossil_tofu_clist_t* clist) {
+    if (clist == NULL) {
+        return false;
+    }
+    if (clist->head == NULL) {
+        return clist->size == 0;
     }
-    return size;
+    // Walk exactly size links; the ring must close back on the head.
+    const fossil_tofu_clist_node_t* current = clist->head;
+    for (size_t i = 0; i < clist->size; i++) {
+        if (current->next == NULL || current->next->prev != current) {
+            return false;
+        }
+        current = current->next;
+        if (current == clist->head && i + 1 != clist->size) {
+            return false;
+        }
+    }
+    return clist->size > 0 && current == clist->head;
 }
 
 bool fossil_tofu_clist_not_empty(const fossil_tofu_clist_t* clist) {
-    return (clist != NULL) && (clist->head != NULL);
+    return (clist != NULL) && (clist->size > 0);
 }
 
 bool fossil_tofu_clist_not_cnullptr(const fossil_tofu_clist_t* clist) {
@@ -178,7 +200,7 @@ bool fossil_tofu_clist_not_cnullptr(const fossil_tofu_clist_t* clist) {
 }
 
 bool fossil_tofu_clist_is_empty(const fossil_tofu_clist_t* clist) {
-    return (clist == NULL) || (clist->head == NULL);
+    return (clist == NULL) || (clist->size == 0);
 }
 
 bool fossil_tofu_clist_is_cnullptr(const fossil_tofu_clist_t* clist) {
@@ -189,19 +211,27 @@ bool fossil_tofu_clist_is_cnullptr(const fossil_tofu_clist_t* clist) {
 // Getter and setter functions
 // *****************************************************************************
 
-char* fossil_tofu_clist_get(const fossil_tofu_clist_t* clist, size_t index) {
-    size_t i = 0;
-    if (clist->head != NULL) {
-        fossil_tofu_clist_node_t* current = clist->head;
-        do {
-            if (i == index) {
-                return fossil_tofu_get_value(&current->data);
-            }
-            i++;
+// Locate the node at index, going backwards from the head when that is shorter.
+static fossil_tofu_clist_node_t* fossil_tofu_clist_node_at(const fossil_tofu_clist_t* clist, size_t index) {
+    if (clist == NULL || index >= clist->size) {
+        return NULL;
+    }
+    fossil_tofu_clist_node_t* current = clist->head;
+    if (index <= clist->size / 2) {
+        for (size_t i = 0; i < index; i++) {
             current = current->next;
-        } while (current != clist->head);
+        }
+    } else {
+        for (size_t i = clist->size; i > index; i--) {
+            current = current->prev;
+        }
     }
-    return NULL;
+    return current;
+}
+
+char* fossil_tofu_clist_get(const fossil_tofu_clist_t* clist, size_t index) {
+    fossil_tofu_clist_node_t* node = fossil_tofu_clist_node_at(clist, index);
+    return (node == NULL) ? NULL : fossil_tofu_get_value(&node->data);
 }
 
 char* fossil_tofu_clist_get_front(const fossil_tofu_clist_t* clist) {
@@ -219,17 +249,9 @@ char* fossil_tofu_clist_get_back(const fossil_tofu_clist_t* clist) {
 }
 
 void fossil_tofu_clist_set(fossil_tofu_clist_t* clist, size_t index, char* element) {
-    size_t i = 0;
-    if (clist->head != NULL) {
-        fossil_tofu_clist_node_t* current = clist->head;
-        do {
-            if (i == index) {
-                fossil_tofu_set_value(&current->data, element);
-                return;
-            }
-            i++;
-            current = current->next;
-        } while (current != clist->head);
+    fossil_tofu_clist_node_t* node = fossil_tofu_clist_node_at(clist, index);
+    if (node != NULL) {
+        fossil_tofu_set_value(&node->data, element);
     }
 }
 
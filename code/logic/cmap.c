@@ -0,0 +1,271 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include "fossil/tofu/cmap.h"
+#include "fossil/tofu/threads.h"
+
+// *****************************************************************************
+// Shards
+// *****************************************************************************
+
+struct fossil_tofu_cmap_shard_t {
+    fossil_tofu_rwlock_t lock;
+    fossil_tofu_mapof_t* map;
+    char pad[64]; // Keeps neighbouring locks off the same cache line
+};
+
+static inline size_t fossil_tofu_cmap_index(const fossil_tofu_cmap_t* map, const char* key) {
+    // The shard tables index slots with the low hash bits; the shard is
+    // picked with the high bits so the two stay independent. Numeric keys
+    // hash by value, as in the shards, so "5" and "05" share a shard.
+    if (map->shard_count == 1) return 0;
+    return (size_t)(fossil_tofu_hash_key(map->key_id, key, strlen(key)) >> map->shard_shift);
+}
+
+static inline fossil_tofu_cmap_shard_t* fossil_tofu_cmap_shard(const fossil_tofu_cmap_t* map, const char* key) {
+    return &map->shards[fossil_tofu_cmap_index(map, key)];
+}
+
+// Carries the caller's visitor across shards so an early stop ends the whole walk.
+typedef struct {
+    fossil_tofu_mapof_visit_fn visit;
+    void* context;
+    bool stopped;
+} fossil_tofu_cmap_walk_t;
+
+static bool fossil_tofu_cmap_visit(const fossil_tofu_t* key, const fossil_tofu_t* value, void* context) {
+    fossil_tofu_cmap_walk_t* walk = (fossil_tofu_cmap_walk_t*)context;
+    if (walk->visit(key, value, walk->context)) return true;
+    walk->stopped = true;
+    return false;
+}
+
+// *****************************************************************************
+// Function definitions
+// *****************************************************************************
+
+fossil_tofu_cmap_t* fossil_tofu_cmap_create_sharded(char* key_type, char* value_type, size_t shards) {
+    if (!key_type || !value_type) return NULL;
+    if (shards == 0) shards = FOSSIL_TOFU_CMAP_SHARDS;
+
+    size_t count = 1;
+    unsigned bits = 0;
+    while (count < shards && bits < 16) {
+        count <<= 1;
+        bits++;
+    }
+
+    fossil_tofu_cmap_t* map = (fossil_tofu_cmap_t*)fossil_tofu_alloc(sizeof(fossil_tofu_cmap_t));
+    if (!map) return NULL;
+    map->key_type = fossil_tofu_strdup(key_type);
+    map->value_type = fossil_tofu_strdup(value_type);
+    map->key_id = fossil_tofu_validate_type(key_type);
+    map->shards = (fossil_tofu_cmap_shard_t*)fossil_tofu_alloc(count * sizeof(fossil_tofu_cmap_shard_t));
+    map->shard_count = 0;
+    map->shard_shift = 64 - bits;
+    if (!map->key_type || !map->value_type || !map->shards) {
+        fossil_tofu_cmap_destroy(map);
+        return NULL;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        fossil_tofu_cmap_shard_t* shard = &map->shards[i];
+        shard->map = fossil_tofu_mapof_create_container(key_type, value_type);
+        if (!shard->map) {
+            fossil_tofu_cmap_destroy(map);
+            return NULL;
+        }
+        if (fossil_tofu_rwlock_init(&shard->lock) != FOSSIL_TOFU_SUCCESS) {
+            fossil_tofu_mapof_destroy(shard->map);
+            fossil_tofu_cmap_destroy(map);
+            return NULL;
+        }
+        map->shard_count++;
+    }
+    return map;
+}
+
+fossil_tofu_cmap_t* fossil_tofu_cmap_create_container(char* key_type, char* value_type) {
+    return fossil_tofu_cmap_create_sharded(key_type, value_type, FOSSIL_TOFU_CMAP_SHARDS);
+}
+
+fossil_tofu_cmap_t* fossil_tofu_cmap_create_default(void) {
+    return fossil_tofu_cmap_create_container("any", "any");
+}
+
+fossil_tofu_cmap_t* fossil_tofu_cmap_create_copy(const fossil_tofu_cmap_t* other) {
+    if (!other) return NULL;
+
+    fossil_tofu_cmap_t* map = fossil_tofu_cmap_create_sharded(other->key_type, other->value_type, other->shard_count);
+    if (!map) return NULL;
+
+    // Same shard count, so each shard maps onto its twin.
+    for (size_t i = 0; i < map->shard_count; i++) {
+        fossil_tofu_cmap_shard_t* source = &other->shards[i];
+        fossil_tofu_rwlock_read_lock(&source->lock);
+        fossil_tofu_mapof_t* copy = fossil_tofu_mapof_create_copy(source->map);
+        fossil_tofu_rwlock_read_unlock(&source->lock);
+        if (!copy) {
+            fossil_tofu_cmap_destroy(map);
+            return NULL;
+        }
+        fossil_tofu_mapof_destroy(map->shards[i].map);
+        map->shards[i].map = copy;
+    }
+    return map;
+}
+
+fossil_tofu_cmap_t* fossil_tofu_cmap_create_move(fossil_tofu_cmap_t* other) {
+    if (!other) return NULL;
+
+    fossil_tofu_cmap_t* map = (fossil_tofu_cmap_t*)fossil_tofu_alloc(sizeof(fossil_tofu_cmap_t));
+    if (!map) return NULL;
+    *map = *other;
+    other->key_type = NULL;
+    other->value_type = NULL;
+    other->shards = NULL;
+    other->shard_count = 0;
+    return map;
+}
+
+void fossil_tofu_cmap_destroy(fossil_tofu_cmap_t* map) {
+    if (!map) return;
+
+    for (size_t i = 0; i < map->shard_count; i++) {
+        fossil_tofu_rwlock_destroy(&map->shards[i].lock);
+        fossil_tofu_mapof_destroy(map->shards[i].map);
+    }
+    fossil_tofu_free(map->shards);
+    fossil_tofu_free(map->key_type);
+    fossil_tofu_free(map->value_type);
+    fossil_tofu_free(map);
+}
+
+int32_t fossil_tofu_cmap_insert(fossil_tofu_cmap_t* map, char *key, char *value) {
+    if (!map || !key || !value || map->shard_count == 0) return FOSSIL_TOFU_FAILURE;
+
+    fossil_tofu_cmap_shard_t* shard = fossil_tofu_cmap_shard(map, key);
+    fossil_tofu_rwlock_write_lock(&shard->lock);
+    int32_t result = fossil_tofu_mapof_insert(shard->map, key, value);
+    fossil_tofu_rwlock_write_unlock(&shard->lock);
+    return result;
+}
+
+int32_t fossil_tofu_cmap_remove(fossil_tofu_cmap_t* map, char *key) {
+    if (!map || !key || map->shard_count == 0) return FOSSIL_TOFU_FAILURE;
+
+    fossil_tofu_cmap_shard_t* shard = fossil_tofu_cmap_shard(map, key);
+    fossil_tofu_rwlock_write_lock(&shard->lock);
+    int32_t result = fossil_tofu_mapof_remove(shard->map, key);
+    fossil_tofu_rwlock_write_unlock(&shard->lock);
+    return result;
+}
+
+bool fossil_tofu_cmap_contains(const fossil_tofu_cmap_t* map, char *key) {
+    if (!map || !key || map->shard_count == 0) return false;
+
+    fossil_tofu_cmap_shard_t* shard = fossil_tofu_cmap_shard(map, key);
+    fossil_tofu_rwlock_read_lock(&shard->lock);
+    bool found = fossil_tofu_mapof_contains(shard->map, key);
+    fossil_tofu_rwlock_read_unlock(&shard->lock);
+    return found;
+}
+
+fossil_tofu_t fossil_tofu_cmap_get(const fossil_tofu_cmap_t* map, char *key) {
+    if (!map || !key || map->shard_count == 0) return (fossil_tofu_t){0};
+
+    fossil_tofu_t copy = {0};
+    fossil_tofu_cmap_shard_t* shard = fossil_tofu_cmap_shard(map, key);
+    fossil_tofu_rwlock_read_lock(&shard->lock);
+    const fossil_tofu_t* value = fossil_tofu_mapof_find(shard->map, key, strlen(key));
+    if (value && value->value.data) {
+        copy = fossil_tofu_create(map->value_type, value->value.data);
+    }
+    fossil_tofu_rwlock_read_unlock(&shard->lock);
+    return copy;
+}
+
+int32_t fossil_tofu_cmap_set(fossil_tofu_cmap_t* map, char *key, char *value) {
+    if (!map || !key || !value || map->shard_count == 0) return FOSSIL_TOFU_FAILURE;
+
+    fossil_tofu_cmap_shard_t* shard = fossil_tofu_cmap_shard(map, key);
+    fossil_tofu_rwlock_write_lock(&shard->lock);
+    int32_t result = fossil_tofu_mapof_set(shard->map, key, value);
+    fossil_tofu_rwlock_write_unlock(&shard->lock);
+    return result;
+}
+
+int32_t fossil_tofu_cmap_reserve(fossil_tofu_cmap_t* map, size_t keys) {
+    if (!map) return FOSSIL_TOFU_ERROR_NULL_POINTER;
+
+    // Hashing spreads keys evenly; leave a little slack for the unlucky shard.
+    size_t per_shard = keys / map->shard_count + keys / (map->shard_count * 8) + 1;
+    for (size_t i = 0; i < map->shard_count; i++) {
+        fossil_tofu_cmap_shard_t* shard = &map->shards[i];
+        fossil_tofu_rwlock_write_lock(&shard->lock);
+        int32_t result = fossil_tofu_mapof_reserve(shard->map, per_shard);
+        fossil_tofu_rwlock_write_unlock(&shard->lock);
+        if (result != FOSSIL_TOFU_SUCCESS) return result;
+    }
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+size_t fossil_tofu_cmap_for_each(const fossil_tofu_cmap_t* map, fossil_tofu_mapof_visit_fn visit, void* context) {
+    if (!map || !visit) return 0;
+
+    fossil_tofu_cmap_walk_t walk = { visit, context, false };
+    size_t visited = 0;
+    for (size_t i = 0; i < map->shard_count && !walk.stopped; i++) {
+        fossil_tofu_cmap_shard_t* shard = &map->shards[i];
+        fossil_tofu_rwlock_read_lock(&shard->lock);
+        visited += fossil_tofu_mapof_for_each(shard->map, fossil_tofu_cmap_visit, &walk);
+        fossil_tofu_rwlock_read_unlock(&shard->lock);
+    }
+    return visited;
+}
+
+size_t fossil_tofu_cmap_size(const fossil_tofu_cmap_t* map) {
+    if (!map) return 0;
+
+    size_t size = 0;
+    for (size_t i = 0; i < map->shard_count; i++) {
+        fossil_tofu_cmap_shard_t* shard = &map->shards[i];
+        fossil_tofu_rwlock_read_lock(&shard->lock);
+        size += fossil_tofu_mapof_size(shard->map);
+        fossil_tofu_rwlock_read_unlock(&shard->lock);
+    }
+    return size;
+}
+
+size_t fossil_tofu_cmap_shard_count(const fossil_tofu_cmap_t* map) {
+    return map ? map->shard_count : 0;
+}
+
+bool fossil_tofu_cmap_not_empty(const fossil_tofu_cmap_t* map) {
+    return fossil_tofu_cmap_size(map) != 0;
+}
+
+bool fossil_tofu_cmap_is_empty(const fossil_tofu_cmap_t* map) {
+    return fossil_tofu_cmap_size(map) == 0;
+}
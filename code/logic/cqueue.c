@@ -24,23 +24,83 @@
  */
 #include "fossil/tofu/cqueue.h"
 
+// *****************************************************************************
+// Ring helpers
+// *****************************************************************************
+
+// Physical slot of the element 'offset' positions behind the head.
+static size_t fossil_tofu_cqueue_index(const fossil_tofu_cqueue_t* queue, size_t offset) {
+    size_t index = queue->head + offset;
+    if (index >= queue->capacity) {
+        index -= queue->capacity;
+    }
+    return index;
+}
+
+// Write 'data' into a slot, reusing its value buffer when it is large enough.
+static int32_t fossil_tofu_cqueue_store(const fossil_tofu_cqueue_t* queue, fossil_tofu_cqueue_slot_t* slot, const char* data) {
+    size_t length = strlen(data) + 1;
+    if (slot->data.value.data == NULL) {
+        slot->data = fossil_tofu_create(queue->type, data);
+        if (slot->data.value.data == NULL) {
+            return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+        }
+        slot->room = length;
+        return FOSSIL_TOFU_SUCCESS;
+    }
+    if (length > slot->room) {
+        char* buffer = (char*)fossil_tofu_realloc(slot->data.value.data, length);
+        if (buffer == NULL) {
+            return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+        }
+        slot->data.value.data = buffer;
+        slot->room = length;
+    }
+    memcpy(slot->data.value.data, data, length);
+    slot->data.value.hash = fossil_tofu_hash64(data);
+    return FOSSIL_TOFU_SUCCESS;
+}
+
 // *****************************************************************************
 // Function prototypes
 // *****************************************************************************
 
-fossil_tofu_cqueue_t* fossil_tofu_cqueue_create_container(char* type, size_t capacity) {
+fossil_tofu_cqueue_t* fossil_tofu_cqueue_create_mode(char* type, size_t capacity, fossil_tofu_cqueue_mode_t mode) {
     fossil_tofu_cqueue_t* queue = (fossil_tofu_cqueue_t*)fossil_tofu_alloc(sizeof(fossil_tofu_cqueue_t));
     if (queue == NULL) {
         return NULL;
     }
-    queue->front = NULL;
-    queue->rear = NULL;
+    queue->slots = NULL;
+    if (capacity > 0) {
+        if (capacity > SIZE_MAX / sizeof(fossil_tofu_cqueue_slot_t)) {
+            fossil_tofu_free(queue);
+            return NULL;
+        }
+        queue->slots = (fossil_tofu_cqueue_slot_t*)fossil_tofu_alloc(capacity * sizeof(fossil_tofu_cqueue_slot_t));
+        if (queue->slots == NULL) {
+            fossil_tofu_free(queue);
+            return NULL;
+        }
+        memset(queue->slots, 0, capacity * sizeof(fossil_tofu_cqueue_slot_t));
+    }
     queue->type = fossil_tofu_strdup(type);
+    if (queue->type == NULL) {
+        fossil_tofu_free(queue->slots);
+        fossil_tofu_free(queue);
+        return NULL;
+    }
+    queue->head = 0;
     queue->capacity = capacity;
     queue->size = 0;
+    queue->overwritten = 0;
+    queue->mode = mode;
     return queue;
 }
 
+fossil_tofu_cqueue_t* fossil_tofu_cqueue_create_container(char* type, size_t capacity) {
+    return fossil_tofu_cqueue_create_mode(type, capacity, FOSSIL_TOFU_CQUEUE_REJECT);
+}
+
 fossil_tofu_cqueue_t* fossil_tofu_cqueue_create_default(void) {
     return fossil_tofu_cqueue_create_container("any", 0);
 }
@@ -49,40 +109,22 @@ fossil_tofu_cqueue_t* fossil_tofu_cqueue_create_copy(const fossil_tofu_cqueue_t*
     if (other == NULL) {
         return NULL;  // Cannot copy a null queue
     }
-    fossil_tofu_cqueue_t* queue = (fossil_tofu_cqueue_t*)fossil_tofu_alloc(sizeof(fossil_tofu_cqueue_t));
+    fossil_tofu_cqueue_t* queue = fossil_tofu_cqueue_create_mode(other->type, other->capacity, other->mode);
     if (queue == NULL) {
         return NULL;  // Memory allocation failed
     }
-    queue->type = fossil_tofu_strdup(other->type);
-    queue->capacity = other->capacity;
-    queue->size = other->size;
-    queue->front = NULL;
-    queue->rear = NULL;
-
-    // Copy nodes
-    if (other->front != NULL) {
-        fossil_tofu_cqueue_node_t* current = other->front;
-        do {
-            fossil_tofu_cqueue_node_t* node = (fossil_tofu_cqueue_node_t*)fossil_tofu_alloc(sizeof(fossil_tofu_cqueue_node_t));
-            if (node == NULL) {
-                fossil_tofu_cqueue_destroy(queue);
-                return NULL;  // Memory allocation failed
-            }
-            node->data = fossil_tofu_create(queue->type, fossil_tofu_get_value(&current->data));
-            node->next = NULL;
-
-            if (queue->front == NULL) {
-                queue->front = node;
-                queue->rear = node;
-                node->next = node;  // Circular link
-            } else {
-                queue->rear->next = node;
-                queue->rear = node;
-                node->next = queue->front;  // Circular link
-            }
-            current = current->next;
-        } while (current != other->front);
+
+    // Copy live elements, packed from slot 0
+    for (size_t i = 0; i < other->size; i++) {
+        const fossil_tofu_cqueue_slot_t* source = &other->slots[fossil_tofu_cqueue_index(other, i)];
+        if (fossil_tofu_cqueue_store(queue, &queue->slots[i], source->data.value.data) != FOSSIL_TOFU_SUCCESS) {
+            fossil_tofu_cqueue_destroy(queue);
+            return NULL;  // Memory allocation failed
+        }
+        queue->slots[i].data.value.mutable_flag = source->data.value.mutable_flag;
+        queue->size++;
     }
+    queue->overwritten = other->overwritten;
     return queue;
 }
 
@@ -94,18 +136,15 @@ fossil_tofu_cqueue_t* fossil_tofu_cqueue_create_move(fossil_tofu_cqueue_t* other
     if (queue == NULL) {
         return NULL;
     }
-    queue->type = other->type;
-    queue->capacity = other->capacity;
-    queue->size = other->size;
-    queue->front = other->front;
-    queue->rear = other->rear;
+    *queue = *other;
 
     // Empty the old queue
+    other->slots = NULL;
+    other->head = 0;
     other->type = NULL;
     other->capacity = 0;
     other->size = 0;
-    other->front = NULL;
-    other->rear = NULL;
+    other->overwritten = 0;
 
     return queue;
 }
@@ -114,16 +153,13 @@ void fossil_tofu_cqueue_destroy(fossil_tofu_cqueue_t* queue) {
     if (queue == NULL) {
         return;
     }
-    if (queue->front != NULL) {
-        queue->rear->next = NULL;  // Break the circular link
-    }
-    fossil_tofu_cqueue_node_t* current = queue->front;
-    while (current != NULL) {
-        fossil_tofu_cqueue_node_t* next = current->next;
-        fossil_tofu_destroy(&current->data);
-        fossil_tofu_free(current);
-        current = next;
+    // Removed elements keep their tofu until the slot is reused, so free every slot
+    for (size_t i = 0; i < queue->capacity; i++) {
+        if (queue->slots[i].data.value.data != NULL) {
+            fossil_tofu_destroy(&queue->slots[i].data);
+        }
     }
+    fossil_tofu_free(queue->slots);
     fossil_tofu_free(queue->type);
     fossil_tofu_free(queue);
 }
@@ -133,42 +169,49 @@ void fossil_tofu_cqueue_destroy(fossil_tofu_cqueue_t* queue) {
 // *****************************************************************************
 
 int32_t fossil_tofu_cqueue_insert(fossil_tofu_cqueue_t* queue, char *data) {
+    if (queue == NULL || data == NULL) {
+        return FOSSIL_TOFU_ERROR_INVALID_ARGUMENT;
+    }
     if (queue->size >= queue->capacity) {
-        return FOSSIL_TOFU_FAILURE;  // Queue is full
-    }
-    fossil_tofu_cqueue_node_t* node = (fossil_tofu_cqueue_node_t*)fossil_tofu_alloc(sizeof(fossil_tofu_cqueue_node_t));
-    if (node == NULL) {
-        return FOSSIL_TOFU_FAILURE;  // Memory allocation failed
-    }
-    node->data = fossil_tofu_create(queue->type, data);
-    node->next = NULL;
-    if (queue->front == NULL) {
-        queue->front = node;
-        queue->rear = node;
-        node->next = node;  // Circular link
-    } else {
-        queue->rear->next = node;
-        queue->rear = node;
-        node->next = queue->front;  // Circular link
+        if (queue->mode != FOSSIL_TOFU_CQUEUE_OVERWRITE || queue->capacity == 0) {
+            return FOSSIL_TOFU_FAILURE;  // Queue is full
+        }
+        // Drop the oldest element; its slot becomes the new rear
+        queue->head = fossil_tofu_cqueue_index(queue, 1);
+        queue->size--;
+        queue->overwritten++;
+    }
+    fossil_tofu_cqueue_slot_t* slot = &queue->slots[fossil_tofu_cqueue_index(queue, queue->size)];
+    int32_t result = fossil_tofu_cqueue_store(queue, slot, data);
+    if (result != FOSSIL_TOFU_SUCCESS) {
+        return result;
     }
+    slot->data.value.mutable_flag = true;
     queue->size++;
     return FOSSIL_TOFU_SUCCESS;
 }
 
 int32_t fossil_tofu_cqueue_remove(fossil_tofu_cqueue_t* queue) {
-    if (queue->front == NULL) {
+    if (queue == NULL || queue->size == 0) {
         return FOSSIL_TOFU_FAILURE;  // Queue is empty
     }
-    fossil_tofu_cqueue_node_t* node = queue->front;
-    if (queue->front == queue->rear) {  // Only one node in the queue
-        queue->front = NULL;
-        queue->rear = NULL;
-    } else {
-        queue->front = queue->front->next;
-        queue->rear->next = queue->front;  // Maintain circular link
+    queue->head = fossil_tofu_cqueue_index(queue, 1);
+    queue->size--;
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+int32_t fossil_tofu_cqueue_take(fossil_tofu_cqueue_t* queue, fossil_tofu_t* out) {
+    if (queue == NULL || out == NULL) {
+        return FOSSIL_TOFU_ERROR_INVALID_ARGUMENT;
     }
-    fossil_tofu_destroy(&node->data);
-    fossil_tofu_free(node);
+    if (queue->size == 0) {
+        return FOSSIL_TOFU_FAILURE;  // Queue is empty
+    }
+    fossil_tofu_cqueue_slot_t* slot = &queue->slots[queue->head];
+    *out = slot->data;
+    memset(&slot->data, 0, sizeof(slot->data));
+    slot->room = 0;
+    queue->head = fossil_tofu_cqueue_index(queue, 1);
     queue->size--;
     return FOSSIL_TOFU_SUCCESS;
 }
@@ -193,30 +236,60 @@ bool fossil_tofu_cqueue_is_cnullptr(const fossil_tofu_cqueue_t* queue) {
     return queue == NULL;
 }
 
+bool fossil_tofu_cqueue_is_full(const fossil_tofu_cqueue_t* queue) {
+    return (queue != NULL) && (queue->size >= queue->capacity);
+}
+
+size_t fossil_tofu_cqueue_capacity(const fossil_tofu_cqueue_t* queue) {
+    return (queue != NULL) ? queue->capacity : 0;
+}
+
+fossil_tofu_cqueue_mode_t fossil_tofu_cqueue_get_mode(const fossil_tofu_cqueue_t* queue) {
+    return (queue != NULL) ? queue->mode : FOSSIL_TOFU_CQUEUE_REJECT;
+}
+
+size_t fossil_tofu_cqueue_overwritten(const fossil_tofu_cqueue_t* queue) {
+    return (queue != NULL) ? queue->overwritten : 0;
+}
+
+// *****************************************************************************
+// Getter and setter functions
+// *****************************************************************************
+
 char *fossil_tofu_cqueue_get_front(const fossil_tofu_cqueue_t* queue) {
-    if (queue->front == NULL) {
-        return NULL;  // Queue is empty
-    }
-    return fossil_tofu_get_value(&queue->front->data);
+    return fossil_tofu_cqueue_get_at(queue, 0);
 }
 
 char *fossil_tofu_cqueue_get_rear(const fossil_tofu_cqueue_t* queue) {
-    if (queue->rear == NULL) {
+    if (queue == NULL || queue->size == 0) {
         return NULL;  // Queue is empty
     }
-    return fossil_tofu_get_value(&queue->rear->data);
+    return fossil_tofu_cqueue_get_at(queue, queue->size - 1);
+}
+
+char *fossil_tofu_cqueue_get_at(const fossil_tofu_cqueue_t* queue, size_t index) {
+    if (queue == NULL || index >= queue->size) {
+        return NULL;  // Out of range
+    }
+    return fossil_tofu_get_value(&queue->slots[fossil_tofu_cqueue_index(queue, index)].data);
 }
 
 void fossil_tofu_cqueue_set_front(fossil_tofu_cqueue_t* queue, char *element) {
-    if (queue->front == NULL) {
+    if (queue == NULL || queue->size == 0 || element == NULL) {
         return;  // Queue is empty
     }
-    fossil_tofu_set_value(&queue->front->data, element);
+    fossil_tofu_cqueue_slot_t* slot = &queue->slots[queue->head];
+    if (slot->data.value.mutable_flag) {
+        fossil_tofu_cqueue_store(queue, slot, element);
+    }
 }
 
 void fossil_tofu_cqueue_set_rear(fossil_tofu_cqueue_t* queue, char *element) {
-    if (queue->rear == NULL) {
+    if (queue == NULL || queue->size == 0 || element == NULL) {
         return;  // Queue is empty
     }
-    fossil_tofu_set_value(&queue->rear->data, element);
+    fossil_tofu_cqueue_slot_t* slot = &queue->slots[fossil_tofu_cqueue_index(queue, queue->size - 1)];
+    if (slot->data.value.mutable_flag) {
+        fossil_tofu_cqueue_store(queue, slot, element);
+    }
 }
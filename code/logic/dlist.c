@@ -38,6 +38,7 @@ fossil_tofu_dlist_t* fossil_tofu_dlist_create_container(char* type) {
     }
     dlist->head = NULL;
     dlist->tail = NULL;
+    dlist->size = 0;
     dlist->type = fossil_tofu_strdup(type);
     return dlist;
 }
@@ -57,6 +58,7 @@ fossil_tofu_dlist_t* fossil_tofu_dlist_create_copy(const fossil_tofu_dlist_t* ot
     dlist->type = fossil_tofu_strdup(other->type);
     dlist->head = NULL;
     dlist->tail = NULL;
+    dlist->size = 0;
     fossil_tofu_dlist_node_t* current = other->head;
     while (current != NULL) {
         // Type check: ensure type matches
@@ -82,9 +84,11 @@ fossil_tofu_dlist_t* fossil_tofu_dlist_create_move(fossil_tofu_dlist_t* other) {
     dlist->type = other->type;
     dlist->head = other->head;
     dlist->tail = other->tail;
+    dlist->size = other->size;
     other->type = NULL;
     other->head = NULL;
     other->tail = NULL;
+    other->size = 0;
     return dlist;
 }
 
@@ -123,6 +127,8 @@ int32_t fossil_tofu_dlist_insert(fossil_tofu_dlist_t* dlist, char *data) {
         dlist->tail->next = node;
         dlist->tail = node;
     }
+    dlist->size++;
+    FOSSIL_TOFU_DEBUG_CHECK(fossil_tofu_dlist_verify(dlist));
     return FOSSIL_TOFU_SUCCESS;
 }
 
@@ -134,9 +140,13 @@ int32_t fossil_tofu_dlist_remove(fossil_tofu_dlist_t* dlist) {
     dlist->head = node->next;
     if (dlist->head != NULL) {
         dlist->head->prev = NULL;
+    } else {
+        dlist->tail = NULL;
     }
+    dlist->size--;
     fossil_tofu_destroy(&node->data);
     fossil_tofu_free(node);
+    FOSSIL_TOFU_DEBUG_CHECK(fossil_tofu_dlist_verify(dlist));
     return FOSSIL_TOFU_SUCCESS;
 }
 
@@ -155,6 +165,7 @@ void fossil_tofu_dlist_reverse_forward(fossil_tofu_dlist_t* dlist) {
     temp = dlist->head;
     dlist->head = dlist->tail;
     dlist->tail = temp;
+    FOSSIL_TOFU_DEBUG_CHECK(fossil_tofu_dlist_verify(dlist));
 }
 
 void fossil_tofu_dlist_reverse_backward(fossil_tofu_dlist_t* dlist) {
@@ -172,24 +183,30 @@ void fossil_tofu_dlist_reverse_backward(fossil_tofu_dlist_t* dlist) {
     temp = dlist->tail;
     dlist->tail = dlist->head;
     dlist->head = temp;
+    FOSSIL_TOFU_DEBUG_CHECK(fossil_tofu_dlist_verify(dlist));
 }
 
 size_t fossil_tofu_dlist_size(const fossil_tofu_dlist_t* dlist) {
+    return dlist == NULL ? 0 : dlist->size;
+}
+
+bool fossil_tofu_dlist_verify(const fossil_tofu_dlist_t* dlist) {
     if (dlist == NULL) {
-        return 0;
+        return false;
     }
-    size_t size = 0;
-    fossil_tofu_dlist_node_t* current = dlist->head;
-    while (current != NULL) {
-        size++;
-        current = current->next;
+    size_t count = 0;
+    const fossil_tofu_dlist_node_t* prev = NULL;
+    for (const fossil_tofu_dlist_node_t* current = dlist->head; current != NULL; current = current->next) {
+        if (++count > dlist->size || current->prev != prev) {
+            return false;
+        }
+        prev = current;
     }
-    // Each node is counted exactly once, no duplicates.
-    return size;
+    return count == dlist->size && dlist->tail == prev;
 }
 
 bool fossil_tofu_dlist_not_empty(const fossil_tofu_dlist_t* dlist) {
-    return dlist->head != NULL;
+    return dlist != NULL && dlist->size > 0;
 }
 
 bool fossil_tofu_dlist_not_cnullptr(const fossil_tofu_dlist_t* dlist) {
@@ -197,7 +214,7 @@ bool fossil_tofu_dlist_not_cnullptr(const fossil_tofu_dlist_t* dlist) {
 }
 
 bool fossil_tofu_dlist_is_empty(const fossil_tofu_dlist_t* dlist) {
-    return dlist->head == NULL;
+    return dlist == NULL || dlist->size == 0;
 }
 
 bool fossil_tofu_dlist_is_cnullptr(const fossil_tofu_dlist_t* dlist) {
@@ -208,17 +225,29 @@ bool fossil_tofu_dlist_is_cnullptr(const fossil_tofu_dlist_t* dlist) {
 // Getter and setter functions
 // *****************************************************************************
 
-char *fossil_tofu_dlist_get(const fossil_tofu_dlist_t* dlist, size_t index) {
-    size_t i = 0;
-    fossil_tofu_dlist_node_t* current = dlist->head;
-    while (current != NULL) {
-        if (i == index) {
-            return fossil_tofu_get_value(&current->data);
+// Locate the node at index, walking from whichever end is closer.
+static fossil_tofu_dlist_node_t* fossil_tofu_dlist_node_at(const fossil_tofu_dlist_t* dlist, size_t index) {
+    if (dlist == NULL || index >= dlist->size) {
+        return NULL;
+    }
+    fossil_tofu_dlist_node_t* current;
+    if (index < dlist->size / 2) {
+        current = dlist->head;
+        for (size_t i = 0; i < index; i++) {
+            current = current->next;
+        }
+    } else {
+        current = dlist->tail;
+        for (size_t i = dlist->size - 1; i > index; i--) {
+            current = current->prev;
         }
-        i++;
-        current = current->next;
     }
-    return NULL;
+    return current;
+}
+
+char *fossil_tofu_dlist_get(const fossil_tofu_dlist_t* dlist, size_t index) {
+    fossil_tofu_dlist_node_t* node = fossil_tofu_dlist_node_at(dlist, index);
+    return node == NULL ? NULL : fossil_tofu_get_value(&node->data);
 }
 
 char *fossil_tofu_dlist_get_front(const fossil_tofu_dlist_t* dlist) {
@@ -230,15 +259,9 @@ char *fossil_tofu_dlist_get_back(const fossil_tofu_dlist_t* dlist) {
 }
 
 void fossil_tofu_dlist_set(fossil_tofu_dlist_t* dlist, size_t index, char *element) {
-    size_t i = 0;
-    fossil_tofu_dlist_node_t* current = dlist->head;
-    while (current != NULL) {
-        if (i == index) {
-            fossil_tofu_set_value(&current->data, element);
-            return;
-        }
-        i++;
-        current = current->next;
+    fossil_tofu_dlist_node_t* node = fossil_tofu_dlist_node_at(dlist, index);
+    if (node != NULL) {
+        fossil_tofu_set_value(&node->data, element);
     }
 }
 
@@ -38,6 +38,7 @@ fossil_tofu_dqueue_t* fossil_tofu_dqueue_create_container(char* type) {
     }
     dqueue->front = NULL;
     dqueue->rear = NULL;
+    dqueue->size = 0;
     dqueue->type = fossil_tofu_strdup(type);
     return dqueue;
 }
@@ -57,6 +58,7 @@ fossil_tofu_dqueue_t* fossil_tofu_dqueue_create_copy(const fossil_tofu_dqueue_t*
     dqueue->type = fossil_tofu_strdup(other->type);
     dqueue->front = NULL;
     dqueue->rear = NULL;
+    dqueue->size = 0;
     fossil_tofu_dqueue_node_t* current = other->front;
     while (current != NULL) {
         // Check type match before insert
@@ -83,10 +85,12 @@ fossil_tofu_dqueue_t* fossil_tofu_dqueue_create_move(fossil_tofu_dqueue_t* other
     dqueue->type = other->type;
     dqueue->front = other->front;
     dqueue->rear = other->rear;
+    dqueue->size = other->size;
 
     other->type = NULL;
     other->front = NULL;
     other->rear = NULL;
+    other->size = 0;
 
     return dqueue;
 }
@@ -127,6 +131,8 @@ int32_t fossil_tofu_dqueue_insert(fossil_tofu_dqueue_t* dqueue, char *data) {
         node->prev = dqueue->rear;
         dqueue->rear = node;
     }
+    dqueue->size++;
+    FOSSIL_TOFU_DEBUG_CHECK(fossil_tofu_dqueue_verify(dqueue));
     return FOSSIL_TOFU_SUCCESS;
 }
 
@@ -141,23 +147,34 @@ int32_t fossil_tofu_dqueue_remove(fossil_tofu_dqueue_t* dqueue) {
     } else {
         dqueue->front->prev = NULL;
     }
+    dqueue->size--;
     fossil_tofu_destroy(&node->data);
     fossil_tofu_free(node);
+    FOSSIL_TOFU_DEBUG_CHECK(fossil_tofu_dqueue_verify(dqueue));
     return FOSSIL_TOFU_SUCCESS;
 }
 
 size_t fossil_tofu_dqueue_size(const fossil_tofu_dqueue_t* dqueue) {
-    size_t size = 0;
-    fossil_tofu_dqueue_node_t* current = dqueue->front;
-    while (current != NULL) {
-        size++;
-        current = current->next;
+    return dqueue == NULL ? 0 : dqueue->size;
+}
+
+bool fossil_tofu_dqueue_verify(const fossil_tofu_dqueue_t* dqueue) {
+    if (dqueue == NULL) {
+        return false;
     }
-    return size;
+    size_t count = 0;
+    const fossil_tofu_dqueue_node_t* prev = NULL;
+    for (const fossil_tofu_dqueue_node_t* current = dqueue->front; current != NULL; current = current->next) {
+        if (++count > dqueue->size || current->prev != prev) {
+            return false;
+        }
+        prev = current;
+    }
+    return count == dqueue->size && dqueue->rear == prev;
 }
 
 bool fossil_tofu_dqueue_not_empty(const fossil_tofu_dqueue_t* dqueue) {
-    return dqueue != NULL && dqueue->front != NULL;
+    return dqueue != NULL && dqueue->size > 0;
 }
 
 bool fossil_tofu_dqueue_not_cnullptr(const fossil_tofu_dqueue_t* dqueue) {
@@ -165,7 +182,7 @@ bool fossil_tofu_dqueue_not_cnullptr(const fossil_tofu_dqueue_t* dqueue) {
 }
 
 bool fossil_tofu_dqueue_is_empty(const fossil_tofu_dqueue_t* dqueue) {
-    return dqueue == NULL || dqueue->front == NULL;
+    return dqueue == NULL || dqueue->size == 0;
 }
 
 bool fossil_tofu_dqueue_is_cnullptr(const fossil_tofu_dqueue_t* dqueue) {
@@ -176,17 +193,29 @@ bool fossil_tofu_dqueue_is_cnullptr(const fossil_tofu_dqueue_t* dqueue) {
 // Getter and setter functions
 // *****************************************************************************
 
-char *fossil_tofu_dqueue_get(const fossil_tofu_dqueue_t* dqueue, size_t index) {
-    size_t i = 0;
-    fossil_tofu_dqueue_node_t* current = dqueue->front;
-    while (current != NULL) {
-        if (i == index) {
-            return fossil_tofu_get_value(&current->data);
+// Locate the node at index, walking from whichever end is closer.
+static fossil_tofu_dqueue_node_t* fossil_tofu_dqueue_node_at(const fossil_tofu_dqueue_t* dqueue, size_t index) {
+    if (dqueue == NULL || index >= dqueue->size) {
+        return NULL;
+    }
+    fossil_tofu_dqueue_node_t* current;
+    if (index < dqueue->size / 2) {
+        current = dqueue->front;
+        for (size_t i = 0; i < index; i++) {
+            current = current->next;
+        }
+    } else {
+        current = dqueue->rear;
+        for (size_t i = dqueue->size - 1; i > index; i--) {
+            current = current->prev;
         }
-        i++;
-        current = current->next;
     }
-    return NULL;
+    return current;
+}
+
+char *fossil_tofu_dqueue_get(const fossil_tofu_dqueue_t* dqueue, size_t index) {
+    fossil_tofu_dqueue_node_t* node = fossil_tofu_dqueue_node_at(dqueue, index);
+    return node == NULL ? NULL : fossil_tofu_get_value(&node->data);
 }
 
 char *fossil_tofu_dqueue_get_front(const fossil_tofu_dqueue_t* dqueue) {
@@ -198,15 +227,9 @@ char *fossil_tofu_dqueue_get_back(const fossil_tofu_dqueue_t* dqueue) {
 }
 
 void fossil_tofu_dqueue_set(fossil_tofu_dqueue_t* dqueue, size_t index, char *element) {
-    size_t i = 0;
-    fossil_tofu_dqueue_node_t* current = dqueue->front;
-    while (current != NULL) {
-        if (i == index) {
-            fossil_tofu_set_value(&current->data, element);
-            return;
-        }
-        i++;
-        current = current->next;
+    fossil_tofu_dqueue_node_t* node = fossil_tofu_dqueue_node_at(dqueue, index);
+    if (node != NULL) {
+        fossil_tofu_set_value(&node->data, element);
     }
 }
 
@@ -30,6 +30,7 @@ fossil_tofu_flist_t* fossil_tofu_flist_create_container(char* type) {
         return NULL;
     }
     flist->head = NULL;
+    flist->size = 0;
     flist->type = fossil_tofu_strdup(type);
     return flist;
 }
@@ -65,7 +66,9 @@ fossil_tofu_flist_t* fossil_tofu_flist_create_move(fossil_tofu_flist_t* other) {
         return NULL;
     }
     new_list->head = other->head;
+    new_list->size = other->size;
     other->head = NULL;
+    other->size = 0;
     return new_list;
 }
 
@@ -122,6 +125,8 @@ int32_t fossil_tofu_flist_insert(fossil_tofu_flist_t* flist, char *data) {
         }
         current->next = new_node;
     }
+    flist->size++;
+    FOSSIL_TOFU_DEBUG_CHECK(fossil_tofu_flist_verify(flist));
     return 0;  // Success
 }
 
@@ -131,8 +136,10 @@ int32_t fossil_tofu_flist_remove(fossil_tofu_flist_t* flist) {
     }
     fossil_tofu_flist_node_t* to_remove = flist->head;
     flist->head = to_remove->next;
+    flist->size--;
     fossil_tofu_free(to_remove->data.value.data);
     fossil_tofu_free(to_remove);
+    FOSSIL_TOFU_DEBUG_CHECK(fossil_tofu_flist_verify(flist));
     return 0;  // Success
 }
 
@@ -149,6 +156,7 @@ void fossil_tofu_flist_reverse_forward(fossil_tofu_flist_t* flist) {
         current = next;
     }
     flist->head = prev;
+    FOSSIL_TOFU_DEBUG_CHECK(fossil_tofu_flist_verify(flist));
 }
 
 void fossil_tofu_flist_reverse_backward(fossil_tofu_flist_t* flist) {
@@ -164,23 +172,31 @@ void fossil_tofu_flist_reverse_backward(fossil_tofu_flist_t* flist) {
         current = next;
     }
     flist->head = prev;
+    FOSSIL_TOFU_DEBUG_CHECK(fossil_tofu_flist_verify(flist));
 }
 
 size_t fossil_tofu_flist_size(const fossil_tofu_flist_t* flist) {
     if (!flist) {
         return 0;
     }
-    size_t size = 0;
-    fossil_tofu_flist_node_t* current = flist->head;
-    while (current) {
-        size++;
-        current = current->next;
+    return flist->size;
+}
+
+bool fossil_tofu_flist_verify(const fossil_tofu_flist_t* flist) {
+    if (!flist) {
+        return false;
     }
-    return size;
+    size_t count = 0;
+    for (const fossil_tofu_flist_node_t* current = flist->head; current; current = current->next) {
+        if (++count > flist->size) {
+            return false;  // Cycle or undercounted size
+        }
+    }
+    return count == flist->size;
 }
 
 bool fossil_tofu_flist_not_empty(const fossil_tofu_flist_t* flist) {
-    return flist && flist->head != NULL;
+    return flist && flist->size > 0;
 }
 
 bool fossil_tofu_flist_not_cnullptr(const fossil_tofu_flist_t* flist) {
@@ -196,7 +212,7 @@ bool fossil_tofu_flist_is_cnullptr(const fossil_tofu_flist_t* flist) {
 }
 
 char *fossil_tofu_flist_get(const fossil_tofu_flist_t* flist, size_t index) {
-    if (!flist) {
+    if (!flist || index >= flist->size) {
         return NULL;  // Error
     }
     fossil_tofu_flist_node_t* current = flist->head;
@@ -230,7 +246,7 @@ char *fossil_tofu_flist_get_back(const fossil_tofu_flist_t* flist) {
 }
 
 void fossil_tofu_flist_set(fossil_tofu_flist_t* flist, size_t index, char *element) {
-    if (!flist) {
+    if (!flist || index >= flist->size) {
         return;  // Error
     }
     fossil_tofu_flist_node_t* current = flist->head;
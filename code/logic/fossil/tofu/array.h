@@ -39,7 +39,7 @@ typedef struct {
     fossil_tofu_t* data;
     size_t size;
     size_t capacity;
-    char* type;
+    char* type; // Owned copy of the element type
 } fossil_tofu_array_t;
 
 /**
@@ -326,6 +326,105 @@ void fossil_tofu_array_set_back(fossil_tofu_array_t* array, char *element);
  */
 void fossil_tofu_array_set_at(fossil_tofu_array_t* array, size_t index, char *element);
 
+// *****************************************************************************
+// Aggregation functions
+// *****************************************************************************
+
+/**
+ * Folds every numeric element of the array into a stats accumulator in a
+ * single pass.
+ *
+ * @param array  The array to reduce.
+ * @param stats  Receives count, sum, min, max and squared deviations.
+ * @return       FOSSIL_TOFU_SUCCESS, or an error code on failure.
+ */
+int32_t fossil_tofu_array_stats(const fossil_tofu_array_t* array, fossil_tofu_stats_t* stats);
+
+/**
+ * Computes the sum of the numeric elements in the array.
+ *
+ * @param array  The array to reduce.
+ * @param out    Receives the sum (0 for an empty array).
+ * @return       FOSSIL_TOFU_SUCCESS, or an error code on failure.
+ */
+int32_t fossil_tofu_array_sum(const fossil_tofu_array_t* array, double* out);
+
+/**
+ * Finds the smallest numeric element in the array.
+ *
+ * @param array  The array to reduce.
+ * @param out    Receives the minimum.
+ * @return       FOSSIL_TOFU_SUCCESS, FOSSIL_TOFU_ERROR_NOT_FOUND if the array holds
+ *               no numeric elements, or another error code on failure.
+ */
+int32_t fossil_tofu_array_min(const fossil_tofu_array_t* array, double* out);
+
+/**
+ * Finds the largest numeric element in the array.
+ *
+ * @param array  The array to reduce.
+ * @param out    Receives the maximum.
+ * @return       FOSSIL_TOFU_SUCCESS, FOSSIL_TOFU_ERROR_NOT_FOUND if the array holds
+ *               no numeric elements, or another error code on failure.
+ */
+int32_t fossil_tofu_array_max(const fossil_tofu_array_t* array, double* out);
+
+/**
+ * Computes the arithmetic mean of the numeric elements in the array.
+ *
+ * @param array  The array to reduce.
+ * @param out    Receives the mean.
+ * @return       FOSSIL_TOFU_SUCCESS, FOSSIL_TOFU_ERROR_NOT_FOUND if the array holds
+ *               no numeric elements, or another error code on failure.
+ */
+int32_t fossil_tofu_array_mean(const fossil_tofu_array_t* array, double* out);
+
+/**
+ * Computes the population variance of the numeric elements in the array.
+ *
+ * @param array  The array to reduce.
+ * @param out    Receives the variance.
+ * @return       FOSSIL_TOFU_SUCCESS, FOSSIL_TOFU_ERROR_NOT_FOUND if the array holds
+ *               no numeric elements, or another error code on failure.
+ */
+int32_t fossil_tofu_array_variance(const fossil_tofu_array_t* array, double* out);
+
+/**
+ * Counts the numeric elements of the array that satisfy a predicate.
+ *
+ * @param array     The array to scan.
+ * @param predicate Called with each numeric element.
+ * @param context   Passed through to the predicate.
+ * @return          The number of matching elements.
+ */
+size_t fossil_tofu_array_count_if(const fossil_tofu_array_t* array, fossil_tofu_predicate_t predicate, void* context);
+
+// *****************************************************************************
+// Search functions
+// *****************************************************************************
+
+/**
+ * Finds the index of the first element equal to the given value.
+ *
+ * Elements are screened by their cached value hash and only hash hits are
+ * confirmed with fossil_tofu_compare.
+ *
+ * @param array   Pointer to the array.
+ * @param element The value to search for.
+ * @param index   Receives the index of the first match.
+ * @return        FOSSIL_TOFU_SUCCESS, FOSSIL_TOFU_ERROR_NOT_FOUND, or an error code.
+ */
+int32_t fossil_tofu_array_index_of(const fossil_tofu_array_t* array, char *element, size_t* index);
+
+/**
+ * Checks if the array holds an element equal to the given value.
+ *
+ * @param array   Pointer to the array.
+ * @param element The value to search for.
+ * @return        True if a match exists, false otherwise.
+ */
+bool fossil_tofu_array_contains(const fossil_tofu_array_t* array, char *element);
+
 #ifdef __cplusplus
 }
 #include <stdexcept>
@@ -628,6 +727,108 @@ namespace fossil {
                 fossil_tofu_array_set_at(array, index, const_cast<char*>(element.c_str()));
             }
 
+            /**
+             * Computes the sum of the numeric elements.
+             *
+             * @return The result of the reduction.
+             * @throws std::runtime_error If the container holds no numeric elements.
+             */
+            double sum() const {
+                double result = 0.0;
+                if (fossil_tofu_array_sum(array, &result) != FOSSIL_TOFU_SUCCESS) {
+                    throw std::runtime_error("Failed to compute sum");
+                }
+                return result;
+            }
+
+            /**
+             * Finds the smallest numeric element.
+             *
+             * @return The result of the reduction.
+             * @throws std::runtime_error If the container holds no numeric elements.
+             */
+            double min() const {
+                double result = 0.0;
+                if (fossil_tofu_array_min(array, &result) != FOSSIL_TOFU_SUCCESS) {
+                    throw std::runtime_error("Failed to compute min");
+                }
+                return result;
+            }
+
+            /**
+             * Finds the largest numeric element.
+             *
+             * @return The result of the reduction.
+             * @throws std::runtime_error If the container holds no numeric elements.
+             */
+            double max() const {
+                double result = 0.0;
+                if (fossil_tofu_array_max(array, &result) != FOSSIL_TOFU_SUCCESS) {
+                    throw std::runtime_error("Failed to compute max");
+                }
+                return result;
+            }
+
+            /**
+             * Computes the arithmetic mean of the numeric elements.
+             *
+             * @return The result of the reduction.
+             * @throws std::runtime_error If the container holds no numeric elements.
+             */
+            double mean() const {
+                double result = 0.0;
+                if (fossil_tofu_array_mean(array, &result) != FOSSIL_TOFU_SUCCESS) {
+                    throw std::runtime_error("Failed to compute mean");
+                }
+                return result;
+            }
+
+            /**
+             * Computes the population variance of the numeric elements.
+             *
+             * @return The result of the reduction.
+             * @throws std::runtime_error If the container holds no numeric elements.
+             */
+            double variance() const {
+                double result = 0.0;
+                if (fossil_tofu_array_variance(array, &result) != FOSSIL_TOFU_SUCCESS) {
+                    throw std::runtime_error("Failed to compute variance");
+                }
+                return result;
+            }
+
+            /**
+             * Counts the numeric elements that satisfy a predicate.
+             *
+             * @param predicate Called with each numeric element.
+             * @param context   Passed through to the predicate.
+             * @return          The number of matching elements.
+             */
+            size_t count_if(fossil_tofu_predicate_t predicate, void* context = nullptr) const {
+                return fossil_tofu_array_count_if(array, predicate, context);
+            }
+
+            /**
+             * Finds the index of the first element equal to the given value.
+             *
+             * @param element The value to search for.
+             * @param index   Receives the index of the first match.
+             * @return        True if a match was found, false otherwise.
+             */
+            bool index_of(const std::string& element, size_t& index) const {
+                return fossil_tofu_array_index_of(array, const_cast<char*>(element.c_str()), &index) == FOSSIL_TOFU_SUCCESS;
+            }
+
+            /**
+             * Checks if an element equal to the given value is present.
+             *
+             * @param element The value to search for.
+             * @return        True if a match exists, false otherwise.
+             */
+            bool contains(const std::string& element) const {
+                return fossil_tofu_array_contains(array, const_cast<char*>(element.c_str()));
+            }
+
         private:
             /**
              * Pointer to the underlying fossil_tofu_array_t structure.
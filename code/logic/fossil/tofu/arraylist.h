@@ -283,6 +283,34 @@ void fossil_tofu_arraylist_set_front(fossil_tofu_arraylist_t* alist, char *eleme
  */
 void fossil_tofu_arraylist_set_back(fossil_tofu_arraylist_t* alist, char *element);
 
+// *****************************************************************************
+// Search functions
+// *****************************************************************************
+
+/**
+ * @brief Find the index of the first element equal to the given value.
+ *
+ * Elements are screened by their cached value hash and only hash hits are
+ * confirmed with fossil_tofu_compare.
+ *
+ * @param alist   Pointer to the array list.
+ * @param element The value to search for.
+ * @param index   Receives the index of the first match.
+ * @return        FOSSIL_TOFU_SUCCESS, FOSSIL_TOFU_ERROR_NOT_FOUND, or an error code.
+ * @complexity    O(n)
+ */
+int32_t fossil_tofu_arraylist_index_of(const fossil_tofu_arraylist_t* alist, char *element, size_t* index);
+
+/**
+ * @brief Check if the array list holds an element equal to the given value.
+ *
+ * @param alist   Pointer to the array list.
+ * @param element The value to search for.
+ * @return        True if a match exists, false otherwise.
+ * @complexity    O(n)
+ */
+bool fossil_tofu_arraylist_contains(const fossil_tofu_arraylist_t* alist, char *element);
+
 #ifdef __cplusplus
 }
 #include <stdexcept>
@@ -577,6 +605,27 @@ namespace fossil {
              */
             const fossil_tofu_arraylist_t* raw() const { return alist; }
 
+            /**
+             * @brief Finds the index of the first element equal to the given value.
+             *
+             * @param element The value to search for.
+             * @param index   Receives the index of the first match.
+             * @return        True if a match was found, false otherwise.
+             */
+            bool index_of(const std::string& element, size_t& index) const {
+                return fossil_tofu_arraylist_index_of(alist, const_cast<char*>(element.c_str()), &index) == FOSSIL_TOFU_SUCCESS;
+            }
+
+            /**
+             * @brief Checks if an element equal to the given value is present.
+             *
+             * @param element The value to search for.
+             * @return        True if a match exists, false otherwise.
+             */
+            bool contains(const std::string& element) const {
+                return fossil_tofu_arraylist_contains(alist, const_cast<char*>(element.c_str()));
+            }
+
         private:
             /**
              * @brief Pointer to the underlying fossil_tofu_arraylist_t structure.
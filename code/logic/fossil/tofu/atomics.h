@@ -0,0 +1,239 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef FOSSIL_TOFU_ATOMICS_H
+#define FOSSIL_TOFU_ATOMICS_H
+
+#include "tofu.h"
+
+// Internal atomics for the lock-free containers. C11 <stdatomic.h> is used
+// wherever the compiler has it. MSVC's C mode does not, so there relaxed
+// accesses are plain volatile ones and every ordered access goes through an
+// Interlocked call, which is a full barrier: stronger than asked, never
+// weaker. Not part of framework.h.
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#define FOSSIL_TOFU_ATOMICS_WIN32 1
+#else
+#include <stdatomic.h>
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// *****************************************************************************
+// Type definitions
+// *****************************************************************************
+
+#if defined(FOSSIL_TOFU_ATOMICS_WIN32)
+typedef volatile size_t fossil_tofu_atomic_size_t;
+typedef volatile int64_t fossil_tofu_atomic_i64_t;
+typedef void* volatile fossil_tofu_atomic_ptr_t;
+
+typedef enum {
+    FOSSIL_TOFU_RELAXED,
+    FOSSIL_TOFU_ACQUIRE,
+    FOSSIL_TOFU_RELEASE,
+    FOSSIL_TOFU_SEQ_CST
+} fossil_tofu_memory_order_t;
+#else
+typedef atomic_size_t fossil_tofu_atomic_size_t;
+typedef _Atomic int64_t fossil_tofu_atomic_i64_t;
+typedef _Atomic(void*) fossil_tofu_atomic_ptr_t;
+
+typedef memory_order fossil_tofu_memory_order_t;
+#define FOSSIL_TOFU_RELAXED memory_order_relaxed
+#define FOSSIL_TOFU_ACQUIRE memory_order_acquire
+#define FOSSIL_TOFU_RELEASE memory_order_release
+#define FOSSIL_TOFU_SEQ_CST memory_order_seq_cst
+#endif
+
+// *****************************************************************************
+// Operations
+// *****************************************************************************
+
+#if defined(FOSSIL_TOFU_ATOMICS_WIN32)
+
+// size_t is pointer-sized on Windows, so the pointer Interlocked calls
+// cover both 32- and 64-bit targets.
+static inline void fossil_tofu_atomic_size_init(fossil_tofu_atomic_size_t* a, size_t value) {
+    *a = value;
+}
+
+static inline size_t fossil_tofu_atomic_size_load(const fossil_tofu_atomic_size_t* a, fossil_tofu_memory_order_t order) {
+    if (order == FOSSIL_TOFU_RELAXED) {
+        return *a;
+    }
+    return (size_t)InterlockedCompareExchangePointer((PVOID volatile*)a, NULL, NULL);
+}
+
+static inline void fossil_tofu_atomic_size_store(fossil_tofu_atomic_size_t* a, size_t value, fossil_tofu_memory_order_t order) {
+    if (order == FOSSIL_TOFU_RELAXED) {
+        *a = value;
+        return;
+    }
+    InterlockedExchangePointer((PVOID volatile*)a, (PVOID)value);
+}
+
+static inline bool fossil_tofu_atomic_size_cas_weak(fossil_tofu_atomic_size_t* a, size_t* expected, size_t desired, fossil_tofu_memory_order_t order) {
+    (void)order;
+    size_t seen = (size_t)InterlockedCompareExchangePointer((PVOID volatile*)a, (PVOID)desired, (PVOID)*expected);
+    if (seen == *expected) {
+        return true;
+    }
+    *expected = seen;
+    return false;
+}
+
+// 64-bit plain accesses can tear on 32-bit targets, so only _WIN64 takes
+// the volatile shortcut for relaxed ones.
+static inline void fossil_tofu_atomic_i64_init(fossil_tofu_atomic_i64_t* a, int64_t value) {
+    *a = value;
+}
+
+static inline int64_t fossil_tofu_atomic_i64_load(const fossil_tofu_atomic_i64_t* a, fossil_tofu_memory_order_t order) {
+#if defined(_WIN64)
+    if (order == FOSSIL_TOFU_RELAXED) {
+        return *a;
+    }
+#else
+    (void)order;
+#endif
+    return InterlockedCompareExchange64((volatile LONG64*)a, 0, 0);
+}
+
+static inline void fossil_tofu_atomic_i64_store(fossil_tofu_atomic_i64_t* a, int64_t value, fossil_tofu_memory_order_t order) {
+#if defined(_WIN64)
+    if (order == FOSSIL_TOFU_RELAXED) {
+        *a = value;
+        return;
+    }
+#else
+    (void)order;
+#endif
+    InterlockedExchange64((volatile LONG64*)a, value);
+}
+
+static inline bool fossil_tofu_atomic_i64_cas(fossil_tofu_atomic_i64_t* a, int64_t* expected, int64_t desired, fossil_tofu_memory_order_t order) {
+    (void)order;
+    int64_t seen = InterlockedCompareExchange64((volatile LONG64*)a, desired, *expected);
+    if (seen == *expected) {
+        return true;
+    }
+    *expected = seen;
+    return false;
+}
+
+static inline void fossil_tofu_atomic_ptr_init(fossil_tofu_atomic_ptr_t* a, void* value) {
+    *a = value;
+}
+
+static inline void* fossil_tofu_atomic_ptr_load(const fossil_tofu_atomic_ptr_t* a, fossil_tofu_memory_order_t order) {
+    if (order == FOSSIL_TOFU_RELAXED) {
+        return *a;
+    }
+    return InterlockedCompareExchangePointer((PVOID volatile*)a, NULL, NULL);
+}
+
+static inline void fossil_tofu_atomic_ptr_store(fossil_tofu_atomic_ptr_t* a, void* value, fossil_tofu_memory_order_t order) {
+    if (order == FOSSIL_TOFU_RELAXED) {
+        *a = value;
+        return;
+    }
+    InterlockedExchangePointer((PVOID volatile*)a, value);
+}
+
+static inline void fossil_tofu_atomic_fence(void) {
+    MemoryBarrier();
+}
+
+#else
+
+static inline void fossil_tofu_atomic_size_init(fossil_tofu_atomic_size_t* a, size_t value) {
+    atomic_init(a, value);
+}
+
+static inline size_t fossil_tofu_atomic_size_load(const fossil_tofu_atomic_size_t* a, fossil_tofu_memory_order_t order) {
+    return atomic_load_explicit((fossil_tofu_atomic_size_t*)a, order);
+}
+
+static inline void fossil_tofu_atomic_size_store(fossil_tofu_atomic_size_t* a, size_t value, fossil_tofu_memory_order_t order) {
+    atomic_store_explicit(a, value, order);
+}
+
+// Replace *a with 'desired' if it still holds *expected; on failure *expected
+// receives the current value. May fail spuriously. 'order' applies on
+// success, a failed attempt is relaxed.
+static inline bool fossil_tofu_atomic_size_cas_weak(fossil_tofu_atomic_size_t* a, size_t* expected, size_t desired, fossil_tofu_memory_order_t order) {
+    return atomic_compare_exchange_weak_explicit(a, expected, desired, order, memory_order_relaxed);
+}
+
+static inline void fossil_tofu_atomic_i64_init(fossil_tofu_atomic_i64_t* a, int64_t value) {
+    atomic_init(a, value);
+}
+
+static inline int64_t fossil_tofu_atomic_i64_load(const fossil_tofu_atomic_i64_t* a, fossil_tofu_memory_order_t order) {
+    return atomic_load_explicit((fossil_tofu_atomic_i64_t*)a, order);
+}
+
+static inline void fossil_tofu_atomic_i64_store(fossil_tofu_atomic_i64_t* a, int64_t value, fossil_tofu_memory_order_t order) {
+    atomic_store_explicit(a, value, order);
+}
+
+// Strong compare-and-swap; same contract as the weak one minus the
+// spurious failures.
+static inline bool fossil_tofu_atomic_i64_cas(fossil_tofu_atomic_i64_t* a, int64_t* expected, int64_t desired, fossil_tofu_memory_order_t order) {
+    return atomic_compare_exchange_strong_explicit(a, expected, desired, order, memory_order_relaxed);
+}
+
+static inline void fossil_tofu_atomic_ptr_init(fossil_tofu_atomic_ptr_t* a, void* value) {
+    atomic_init(a, value);
+}
+
+static inline void* fossil_tofu_atomic_ptr_load(const fossil_tofu_atomic_ptr_t* a, fossil_tofu_memory_order_t order) {
+    return atomic_load_explicit((fossil_tofu_atomic_ptr_t*)a, order);
+}
+
+static inline void fossil_tofu_atomic_ptr_store(fossil_tofu_atomic_ptr_t* a, void* value, fossil_tofu_memory_order_t order) {
+    atomic_store_explicit(a, value, order);
+}
+
+// Sequentially consistent fence.
+static inline void fossil_tofu_atomic_fence(void) {
+    atomic_thread_fence(memory_order_seq_cst);
+}
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FOSSIL_TOFU_FRAMEWORK_H */
@@ -0,0 +1,409 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef FOSSIL_TOFU_BAG_H
+#define FOSSIL_TOFU_BAG_H
+
+#include "hashtable.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// *****************************************************************************
+// Type definitions
+// *****************************************************************************
+
+#define FOSSIL_TOFU_BAG_MIN_SLOTS 16
+#define FOSSIL_TOFU_BAG_LOAD_NUM  7   // grow once the table is 7/8 full
+#define FOSSIL_TOFU_BAG_LOAD_DEN  8
+
+// One node per distinct element, carrying its multiplicity.
+typedef struct fossil_tofu_bag_node_t {
+    fossil_tofu_t item;
+    size_t count;
+} fossil_tofu_bag_node_t;
+
+// A counting set (multiset). Equal elements share one node and a count,
+// so adding or removing one occurrence is a single probe.
+typedef struct fossil_tofu_bag_t {
+    char* type;
+    fossil_tofu_hashtable_t table; // One node per distinct element
+    size_t size;                   // Number of occurrences over all elements
+} fossil_tofu_bag_t;
+
+// Visitor for iteration; return false to stop early.
+typedef bool (*fossil_tofu_bag_visit_fn)(const fossil_tofu_t* item, size_t count, void* context);
+
+// *****************************************************************************
+// Function prototypes
+// *****************************************************************************
+
+/**
+ * @brief Create a new bag with the specified element type.
+ *
+ * @param type The type of the elements.
+ * @return A pointer to the newly created bag, or NULL on failure.
+ */
+fossil_tofu_bag_t* fossil_tofu_bag_create_container(char* type);
+
+/**
+ * @brief Create a new bag with the default element type.
+ *
+ * @return A pointer to the newly created bag, or NULL on failure.
+ */
+fossil_tofu_bag_t* fossil_tofu_bag_create_default(void);
+
+/**
+ * @brief Create a copy of an existing bag.
+ *
+ * @param other The bag to copy.
+ * @return A pointer to the newly created bag, or NULL on failure.
+ * @note Time complexity: O(n)
+ */
+fossil_tofu_bag_t* fossil_tofu_bag_create_copy(const fossil_tofu_bag_t* other);
+
+/**
+ * @brief Create a new bag by taking over the contents of another.
+ *
+ * @param other The bag to move from; left empty.
+ * @return A pointer to the newly created bag, or NULL on failure.
+ * @note Time complexity: O(1)
+ */
+fossil_tofu_bag_t* fossil_tofu_bag_create_move(fossil_tofu_bag_t* other);
+
+/**
+ * @brief Destroy a bag and free its elements.
+ *
+ * @param bag The bag to destroy.
+ */
+void fossil_tofu_bag_destroy(fossil_tofu_bag_t* bag);
+
+/**
+ * @brief Add one occurrence of an element.
+ *
+ * @param bag The bag.
+ * @param item The element.
+ * @return 0 on success, non-zero on failure.
+ * @note Time complexity: O(1) expected
+ */
+int32_t fossil_tofu_bag_add(fossil_tofu_bag_t* bag, char *item);
+
+/**
+ * @brief Add several occurrences of an element at once.
+ *
+ * @param bag The bag.
+ * @param item The element.
+ * @param count The number of occurrences to add; 0 is a no-op.
+ * @return 0 on success, FOSSIL_TOFU_ERROR_OVERFLOW if the count would wrap,
+ *         non-zero on other failures.
+ * @note Time complexity: O(1) expected
+ */
+int32_t fossil_tofu_bag_add_count(fossil_tofu_bag_t* bag, char *item, size_t count);
+
+/**
+ * @brief Remove one occurrence of an element.
+ *
+ * The element goes away with its last occurrence.
+ *
+ * @param bag The bag.
+ * @param item The element.
+ * @return 0 on success, FOSSIL_TOFU_ERROR_NOT_FOUND if the element is absent.
+ * @note Time complexity: O(1) expected
+ */
+int32_t fossil_tofu_bag_remove(fossil_tofu_bag_t* bag, char *item);
+
+/**
+ * @brief Remove every occurrence of an element.
+ *
+ * @param bag The bag.
+ * @param item The element.
+ * @return The number of occurrences removed, zero if the element was absent.
+ * @note Time complexity: O(1) expected
+ */
+size_t fossil_tofu_bag_remove_all(fossil_tofu_bag_t* bag, char *item);
+
+/**
+ * @brief Get the number of occurrences of an element.
+ *
+ * @param bag The bag.
+ * @param item The element.
+ * @return The count, zero if the element is absent.
+ * @note Time complexity: O(1) expected
+ */
+size_t fossil_tofu_bag_count(const fossil_tofu_bag_t* bag, char *item);
+
+/**
+ * @brief Get the number of occurrences of an element given as borrowed
+ * text, without allocating.
+ *
+ * @param bag The bag.
+ * @param item The element text; need not be NUL-terminated.
+ * @param len Length of the element text in bytes.
+ * @return The count, zero if the element is absent.
+ * @note Time complexity: O(1) expected
+ */
+size_t fossil_tofu_bag_count_key(const fossil_tofu_bag_t* bag, const char* item, size_t len);
+
+/**
+ * @brief Check whether an element occurs at least once.
+ *
+ * @param bag The bag.
+ * @param item The element.
+ * @return True if the element is present.
+ * @note Time complexity: O(1) expected
+ */
+bool fossil_tofu_bag_contains(const fossil_tofu_bag_t* bag, char *item);
+
+/**
+ * @brief Grow the table to hold at least `distinct` distinct elements.
+ *
+ * @param bag The bag.
+ * @param distinct The number of distinct elements to make room for.
+ * @return 0 on success, non-zero on failure.
+ * @note Time complexity: O(n)
+ */
+int32_t fossil_tofu_bag_reserve(fossil_tofu_bag_t* bag, size_t distinct);
+
+/**
+ * @brief Visit every distinct element with its count, in table order.
+ *
+ * @param bag The bag.
+ * @param visit Called once per element; return false to stop.
+ * @param context Passed through to the visitor.
+ * @return The number of elements visited.
+ * @note Time complexity: O(n)
+ */
+size_t fossil_tofu_bag_for_each(const fossil_tofu_bag_t* bag, fossil_tofu_bag_visit_fn visit, void* context);
+
+/**
+ * @brief Get the number of distinct elements.
+ *
+ * @param bag The bag.
+ * @return The number of distinct elements.
+ * @note Time complexity: O(1)
+ */
+size_t fossil_tofu_bag_distinct(const fossil_tofu_bag_t* bag);
+
+/**
+ * @brief Get the total number of occurrences.
+ *
+ * @param bag The bag.
+ * @return The sum of all counts.
+ * @note Time complexity: O(1)
+ */
+size_t fossil_tofu_bag_size(const fossil_tofu_bag_t* bag);
+
+/**
+ * @brief Check if the bag is not empty.
+ *
+ * @param bag The bag.
+ * @return True if the bag has elements, false otherwise.
+ * @note Time complexity: O(1)
+ */
+bool fossil_tofu_bag_not_empty(const fossil_tofu_bag_t* bag);
+
+/**
+ * @brief Check if the bag is empty.
+ *
+ * @param bag The bag.
+ * @return True if the bag is empty, false otherwise.
+ * @note Time complexity: O(1)
+ */
+bool fossil_tofu_bag_is_empty(const fossil_tofu_bag_t* bag);
+
+#ifdef __cplusplus
+}
+#include <stdexcept>
+#include <string>
+
+namespace fossil {
+
+    namespace tofu {
+
+        class Bag {
+        public:
+            /**
+             * @brief Construct a new Bag with the specified element type.
+             *
+             * @param type The type of the elements.
+             */
+            Bag(const std::string& type) {
+                bag = fossil_tofu_bag_create_container(const_cast<char*>(type.c_str()));
+                if (bag == nullptr) {
+                    throw std::runtime_error("Failed to create bag container");
+                }
+            }
+
+            /**
+             * @brief Construct a new Bag with the default element type.
+             */
+            Bag() {
+                bag = fossil_tofu_bag_create_default();
+                if (bag == nullptr) {
+                    throw std::runtime_error("Failed to create bag container");
+                }
+            }
+
+            /**
+             * @brief Construct a new Bag by copying another.
+             *
+             * @param other The Bag to copy.
+             */
+            Bag(const Bag& other) {
+                bag = fossil_tofu_bag_create_copy(other.bag);
+                if (bag == nullptr) {
+                    throw std::runtime_error("Failed to create bag container");
+                }
+            }
+
+            /**
+             * @brief Construct a new Bag by moving another.
+             *
+             * @param other The Bag to move.
+             */
+            Bag(Bag&& other) {
+                bag = fossil_tofu_bag_create_move(other.bag);
+                if (bag == nullptr) {
+                    throw std::runtime_error("Failed to create bag container");
+                }
+            }
+
+            /**
+             * @brief Destroy the Bag and free its memory.
+             */
+            ~Bag() {
+                fossil_tofu_bag_destroy(bag);
+            }
+
+            /**
+             * @brief Add occurrences of an element.
+             *
+             * @param item The element.
+             * @param count The number of occurrences to add.
+             * @return 0 on success, non-zero on failure.
+             */
+            int32_t add(const std::string& item, size_t count = 1) {
+                return fossil_tofu_bag_add_count(bag, const_cast<char*>(item.c_str()), count);
+            }
+
+            /**
+             * @brief Remove one occurrence of an element.
+             *
+             * @param item The element.
+             * @return 0 on success, non-zero if the element is absent.
+             */
+            int32_t remove(const std::string& item) {
+                return fossil_tofu_bag_remove(bag, const_cast<char*>(item.c_str()));
+            }
+
+            /**
+             * @brief Remove every occurrence of an element.
+             *
+             * @param item The element.
+             * @return The number of occurrences removed.
+             */
+            size_t remove_all(const std::string& item) {
+                return fossil_tofu_bag_remove_all(bag, const_cast<char*>(item.c_str()));
+            }
+
+            /**
+             * @brief Get the number of occurrences of an element.
+             *
+             * @param item The element.
+             * @return The count, zero if absent.
+             */
+            size_t count(const std::string& item) const {
+                return fossil_tofu_bag_count_key(bag, item.data(), item.size());
+            }
+
+            /**
+             * @brief Check whether an element occurs at least once.
+             *
+             * @param item The element.
+             * @return True if the element is present.
+             */
+            bool contains(const std::string& item) const {
+                return count(item) != 0;
+            }
+
+            /**
+             * @brief Grow the table to hold at least `distinct` distinct elements.
+             *
+             * @param distinct The number of distinct elements to make room for.
+             */
+            void reserve(size_t distinct) {
+                if (fossil_tofu_bag_reserve(bag, distinct) != FOSSIL_TOFU_SUCCESS) {
+                    throw std::runtime_error("Failed to reserve bag capacity");
+                }
+            }
+
+            /**
+             * @brief Get the number of distinct elements.
+             *
+             * @return The number of distinct elements.
+             */
+            size_t distinct() const {
+                return fossil_tofu_bag_distinct(bag);
+            }
+
+            /**
+             * @brief Get the total number of occurrences.
+             *
+             * @return The sum of all counts.
+             */
+            size_t size() const {
+                return fossil_tofu_bag_size(bag);
+            }
+
+            /**
+             * @brief Check if the bag is not empty.
+             *
+             * @return True if the bag has elements, false otherwise.
+             */
+            bool not_empty() const {
+                return fossil_tofu_bag_not_empty(bag);
+            }
+
+            /**
+             * @brief Check if the bag is empty.
+             *
+             * @return True if the bag is empty, false otherwise.
+             */
+            bool is_empty() const {
+                return fossil_tofu_bag_is_empty(bag);
+            }
+
+        private:
+            fossil_tofu_bag_t* bag;
+        };
+
+    } // namespace tofu
+
+} // namespace fossil
+
+#endif
+
+#endif /* FOSSIL_TOFU_FRAMEWORK_H */
@@ -0,0 +1,292 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef FOSSIL_TOFU_BLOOM_H
+#define FOSSIL_TOFU_BLOOM_H
+
+#include "tofu.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// *****************************************************************************
+// Type definitions
+// *****************************************************************************
+
+// Default filter size per expected key; about a 1% false positive rate.
+#define FOSSIL_TOFU_BLOOM_BITS_PER_KEY 10
+
+// Bits per block. Every key sets and tests bits in a single block, so a
+// query costs at most one cache miss however many hashes it uses.
+#define FOSSIL_TOFU_BLOOM_BLOCK_BITS 512
+
+/**
+ * A blocked Bloom filter over key text. It answers "definitely absent" or
+ * "possibly present", and is meant to sit in front of a larger table so
+ * that most misses never touch it.
+ *
+ * Keys are hashed with fossil_tofu_hash64_seed (seed 0). The hashed
+ * containers feed in the fossil_tofu_hash_key hashes they cache per slot
+ * through the *_hash calls instead. Further bit positions come from double
+ * hashing.
+ * Keys cannot be removed; rebuild the filter with fossil_tofu_bloom_reset.
+ */
+typedef struct {
+    uint64_t* words;       // Bit array, FOSSIL_TOFU_BLOOM_BLOCK_BITS / 64 words per block
+    size_t blocks;         // Number of blocks
+    size_t bits_per_key;   // Sizing used by create and reset
+    size_t hashes;         // Bits set per key
+    size_t count;          // Keys added since the last reset
+} fossil_tofu_bloom_t;
+
+// *****************************************************************************
+// Function prototypes
+// *****************************************************************************
+
+/**
+ * Create a filter sized for the given number of keys.
+ *
+ * Time complexity: O(n) in the filter size
+ *
+ * @param expected     Number of keys the filter should hold.
+ * @param bits_per_key Filter bits per key; 0 selects FOSSIL_TOFU_BLOOM_BITS_PER_KEY.
+ *                     More bits lower the false positive rate.
+ * @return             The created filter, or NULL on failure.
+ */
+fossil_tofu_bloom_t* fossil_tofu_bloom_create(size_t expected, size_t bits_per_key);
+
+/**
+ * Create a copy of a filter.
+ *
+ * Time complexity: O(n) in the filter size
+ *
+ * @param other The filter to copy.
+ * @return      The copy, or NULL on failure.
+ */
+fossil_tofu_bloom_t* fossil_tofu_bloom_create_copy(const fossil_tofu_bloom_t* other);
+
+/**
+ * Destroy a filter and free its memory.
+ *
+ * Time complexity: O(1)
+ *
+ * @param bloom The filter to destroy.
+ */
+void fossil_tofu_bloom_destroy(fossil_tofu_bloom_t* bloom);
+
+/**
+ * Add a key given as text.
+ *
+ * Time complexity: O(k) for k hashes
+ *
+ * @param bloom The filter.
+ * @param key   The key text; need not be NUL-terminated.
+ * @param len   Length of the key text in bytes.
+ */
+void fossil_tofu_bloom_add(fossil_tofu_bloom_t* bloom, const char* key, size_t len);
+
+/**
+ * Add a key by its fossil_tofu_hash64_seed(key, len, 0) hash.
+ *
+ * Time complexity: O(k) for k hashes
+ *
+ * @param bloom The filter.
+ * @param hash  The key hash.
+ */
+void fossil_tofu_bloom_add_hash(fossil_tofu_bloom_t* bloom, uint64_t hash);
+
+/**
+ * Test a key given as text.
+ *
+ * Time complexity: O(k) for k hashes
+ *
+ * @param bloom The filter.
+ * @param key   The key text; need not be NUL-terminated.
+ * @param len   Length of the key text in bytes.
+ * @return      False if the key was never added, true if it may have been.
+ */
+bool fossil_tofu_bloom_may_contain(const fossil_tofu_bloom_t* bloom, const char* key, size_t len);
+
+/**
+ * Test a key by its fossil_tofu_hash64_seed(key, len, 0) hash.
+ *
+ * Time complexity: O(k) for k hashes
+ *
+ * @param bloom The filter; NULL rules nothing out.
+ * @param hash  The key hash.
+ * @return      False if the key was never added, true if it may have been.
+ */
+bool fossil_tofu_bloom_may_contain_hash(const fossil_tofu_bloom_t* bloom, uint64_t hash);
+
+/**
+ * Empty the filter and resize it for a new number of keys, keeping its
+ * bits per key. Used to rebuild a filter after its keys changed.
+ *
+ * Time complexity: O(n) in the filter size
+ *
+ * @param bloom    The filter.
+ * @param expected Number of keys the filter should hold.
+ * @return         FOSSIL_TOFU_SUCCESS, or an error code if the filter could not be resized.
+ */
+int32_t fossil_tofu_bloom_reset(fossil_tofu_bloom_t* bloom, size_t expected);
+
+/**
+ * Empty the filter, keeping its size.
+ *
+ * Time complexity: O(n) in the filter size
+ *
+ * @param bloom The filter.
+ */
+void fossil_tofu_bloom_clear(fossil_tofu_bloom_t* bloom);
+
+/**
+ * Get the number of keys added since the filter was created or last emptied.
+ *
+ * Time complexity: O(1)
+ *
+ * @param bloom The filter.
+ * @return      The number of keys added.
+ */
+size_t fossil_tofu_bloom_count(const fossil_tofu_bloom_t* bloom);
+
+/**
+ * Get the size of the bit array in bits.
+ *
+ * Time complexity: O(1)
+ *
+ * @param bloom The filter.
+ * @return      The number of bits.
+ */
+size_t fossil_tofu_bloom_bits(const fossil_tofu_bloom_t* bloom);
+
+#ifdef __cplusplus
+}
+#include <stdexcept>
+#include <string>
+
+namespace fossil {
+
+    namespace tofu {
+
+        class Bloom {
+        public:
+            /**
+             * Constructor that creates a filter for the given number of keys.
+             * Throws a runtime_error if the filter creation fails.
+             *
+             * @param expected     Number of keys the filter should hold.
+             * @param bits_per_key Filter bits per key; 0 selects the default.
+             */
+            Bloom(size_t expected, size_t bits_per_key = 0) : bloom(fossil_tofu_bloom_create(expected, bits_per_key)) {
+                if (bloom == nullptr) {
+                    throw std::runtime_error("Failed to create bloom filter");
+                }
+            }
+
+            /**
+             * Copy constructor. Throws a runtime_error if the copy fails.
+             *
+             * @param other The filter to copy.
+             */
+            Bloom(const Bloom& other) : bloom(fossil_tofu_bloom_create_copy(other.bloom)) {
+                if (bloom == nullptr) {
+                    throw std::runtime_error("Failed to create bloom filter");
+                }
+            }
+
+            /**
+             * Move constructor. Takes ownership of the other filter.
+             *
+             * @param other The filter to move from.
+             */
+            Bloom(Bloom&& other) noexcept : bloom(other.bloom) {
+                other.bloom = nullptr;
+            }
+
+            Bloom& operator=(const Bloom&) = delete;
+            Bloom& operator=(Bloom&&) = delete;
+
+            /**
+             * Destructor. Destroys the filter.
+             */
+            ~Bloom() {
+                fossil_tofu_bloom_destroy(bloom);
+            }
+
+            /**
+             * Add a key.
+             *
+             * @param key The key to add.
+             */
+            void add(const std::string& key) {
+                fossil_tofu_bloom_add(bloom, key.data(), key.size());
+            }
+
+            /**
+             * Test a key.
+             *
+             * @param key The key to test.
+             * @return False if the key was never added, true if it may have been.
+             */
+            bool may_contain(const std::string& key) const {
+                return fossil_tofu_bloom_may_contain(bloom, key.data(), key.size());
+            }
+
+            /**
+             * Empty the filter, keeping its size.
+             */
+            void clear() {
+                fossil_tofu_bloom_clear(bloom);
+            }
+
+            /**
+             * Get the number of keys added.
+             *
+             * @return The number of keys added.
+             */
+            size_t count() const {
+                return fossil_tofu_bloom_count(bloom);
+            }
+
+            /**
+             * Get the size of the bit array in bits.
+             *
+             * @return The number of bits.
+             */
+            size_t bits() const {
+                return fossil_tofu_bloom_bits(bloom);
+            }
+
+        private:
+            fossil_tofu_bloom_t* bloom;
+        };
+
+    } // namespace tofu
+
+} // namespace fossil
+
+#endif
+
+#endif /* FOSSIL_TOFU_FRAMEWORK_H */
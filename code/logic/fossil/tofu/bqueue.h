@@ -0,0 +1,325 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef FOSSIL_TOFU_BQUEUE_H
+#define FOSSIL_TOFU_BQUEUE_H
+
+#include "cqueue.h"
+#include "vector.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// *****************************************************************************
+// Type definitions
+// *****************************************************************************
+
+#define FOSSIL_TOFU_BQUEUE_FOREVER (-1) // Timeout that waits without limit
+
+// Mutex and the not-empty/not-full condition variables; defined in bqueue.c.
+typedef struct fossil_tofu_bqueue_sync_t fossil_tofu_bqueue_sync_t;
+
+// Bounded blocking queue for producer/consumer threads. Elements live in a
+// circular queue guarded by one mutex; put waits while it is full and take
+// waits while it is empty, each up to a timeout in milliseconds (0 to fail
+// immediately, FOSSIL_TOFU_BQUEUE_FOREVER to wait without limit). Every
+// function below is thread-safe except create_container and destroy.
+typedef struct fossil_tofu_bqueue_t {
+    fossil_tofu_cqueue_t* ring;
+    fossil_tofu_bqueue_sync_t* sync;
+} fossil_tofu_bqueue_t;
+
+// *****************************************************************************
+// Function prototypes
+// *****************************************************************************
+
+/**
+ * Create a new blocking queue.
+ *
+ * @param type     The type of data the queue will store.
+ * @param capacity Maximum number of queued elements; must be non-zero.
+ * @return         The new queue, or NULL on failure.
+ * @note           Time complexity: O(capacity)
+ */
+fossil_tofu_bqueue_t* fossil_tofu_bqueue_create_container(char* type, size_t capacity);
+
+/**
+ * Destroy the queue and any elements left in it.
+ *
+ * @param queue The queue to destroy.
+ * @note        Time complexity: O(capacity)
+ * @details     No thread may be waiting on the queue.
+ */
+void fossil_tofu_bqueue_destroy(fossil_tofu_bqueue_t* queue);
+
+// *****************************************************************************
+// Utility functions
+// *****************************************************************************
+
+/**
+ * Insert data at the rear, waiting while the queue is full.
+ *
+ * @param queue      The queue to insert into.
+ * @param data       The data to insert.
+ * @param timeout_ms How long to wait for space: 0 to fail at once,
+ *                   FOSSIL_TOFU_BQUEUE_FOREVER to wait without limit.
+ * @return           FOSSIL_TOFU_SUCCESS, FOSSIL_TOFU_FAILURE on timeout,
+ *                   or a negative error code.
+ * @note             Time complexity: O(1) plus waiting
+ */
+int32_t fossil_tofu_bqueue_put(fossil_tofu_bqueue_t* queue, char* data, int64_t timeout_ms);
+
+/**
+ * Move the front element out, waiting while the queue is empty.
+ *
+ * @param queue      The queue to take from.
+ * @param out        Receives the tofu; the caller must fossil_tofu_destroy it.
+ * @param timeout_ms How long to wait for an element: 0 to fail at once,
+ *                   FOSSIL_TOFU_BQUEUE_FOREVER to wait without limit.
+ * @return           FOSSIL_TOFU_SUCCESS, FOSSIL_TOFU_FAILURE on timeout,
+ *                   or FOSSIL_TOFU_ERROR_INVALID_ARGUMENT.
+ * @note             Time complexity: O(1) plus waiting
+ */
+int32_t fossil_tofu_bqueue_take(fossil_tofu_bqueue_t* queue, fossil_tofu_t* out, int64_t timeout_ms);
+
+/**
+ * Move up to 'max' elements out under a single lock acquisition.
+ *
+ * @param queue The queue to drain.
+ * @param out   Array of at least 'max' tofus; filled entries must be destroyed by the caller.
+ * @param max   Maximum number of elements to move.
+ * @return      Number of elements moved, in queue order. Never waits.
+ * @note        Time complexity: O(k) for k elements moved
+ */
+size_t fossil_tofu_bqueue_drain(fossil_tofu_bqueue_t* queue, fossil_tofu_t out[], size_t max);
+
+/**
+ * Append up to 'max' elements to a vector under a single lock acquisition.
+ *
+ * @param queue  The queue to drain.
+ * @param vector The vector the elements are pushed onto, in queue order.
+ * @param max    Maximum number of elements to move.
+ * @return       Number of elements moved. Never waits.
+ * @note         Time complexity: O(k) for k elements moved
+ * @details      Each element is removed from the queue only once the vector
+ *               has taken it. If the vector cannot grow, draining stops and
+ *               the remaining elements stay queued, in order.
+ */
+size_t fossil_tofu_bqueue_drain_to(fossil_tofu_bqueue_t* queue, fossil_tofu_vector_t* vector, size_t max);
+
+/**
+ * Get the number of elements in the queue.
+ *
+ * @param queue The queue.
+ * @return      The element count, or 0 for NULL.
+ * @note        Time complexity: O(1)
+ */
+size_t fossil_tofu_bqueue_size(const fossil_tofu_bqueue_t* queue);
+
+/**
+ * Get the capacity of the queue.
+ *
+ * @param queue The queue.
+ * @return      The capacity, or 0 for NULL.
+ * @note        Time complexity: O(1)
+ */
+size_t fossil_tofu_bqueue_capacity(const fossil_tofu_bqueue_t* queue);
+
+/**
+ * Check if the queue is not empty.
+ *
+ * @param queue The queue to check.
+ * @return      True if the queue holds at least one element.
+ * @note        Time complexity: O(1)
+ */
+bool fossil_tofu_bqueue_not_empty(const fossil_tofu_bqueue_t* queue);
+
+/**
+ * Check if the queue is not a null pointer.
+ *
+ * @param queue The queue to check.
+ * @return      True if the queue pointer is valid.
+ * @note        Time complexity: O(1)
+ */
+bool fossil_tofu_bqueue_not_cnullptr(const fossil_tofu_bqueue_t* queue);
+
+/**
+ * Check if the queue is empty.
+ *
+ * @param queue The queue to check.
+ * @return      True if the queue holds no elements or is NULL.
+ * @note        Time complexity: O(1)
+ */
+bool fossil_tofu_bqueue_is_empty(const fossil_tofu_bqueue_t* queue);
+
+/**
+ * Check if the queue is full.
+ *
+ * @param queue The queue to check.
+ * @return      True if the queue holds 'capacity' elements.
+ * @note        Time complexity: O(1)
+ */
+bool fossil_tofu_bqueue_is_full(const fossil_tofu_bqueue_t* queue);
+
+/**
+ * Check if the queue is a null pointer.
+ *
+ * @param queue The queue to check.
+ * @return      True if the queue pointer is NULL.
+ * @note        Time complexity: O(1)
+ */
+bool fossil_tofu_bqueue_is_cnullptr(const fossil_tofu_bqueue_t* queue);
+
+#ifdef __cplusplus
+}
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace fossil {
+
+    namespace tofu {
+
+        /**
+         * @class BQueue
+         * @brief C++ wrapper for the bounded blocking queue.
+         */
+        class BQueue {
+        public:
+            /**
+             * @brief Create a blocking queue.
+             *
+             * @param type     The type of data the queue will store.
+             * @param capacity Maximum number of queued elements.
+             * @throws std::runtime_error If the queue creation fails.
+             */
+            BQueue(const std::string& type, size_t capacity) {
+                queue = fossil_tofu_bqueue_create_container(const_cast<char*>(type.c_str()), capacity);
+                if (queue == nullptr) {
+                    throw std::runtime_error("Failed to create blocking queue.");
+                }
+            }
+
+            BQueue(const BQueue&) = delete;
+            BQueue& operator=(const BQueue&) = delete;
+
+            /**
+             * @brief Destroy the queue and any elements left in it.
+             */
+            ~BQueue() {
+                fossil_tofu_bqueue_destroy(queue);
+            }
+
+            /**
+             * @brief Insert data, waiting up to 'timeout_ms' while the queue is full.
+             *
+             * @return 0 on success, FOSSIL_TOFU_FAILURE on timeout.
+             */
+            int32_t put(const std::string& data, int64_t timeout_ms = FOSSIL_TOFU_BQUEUE_FOREVER) {
+                return fossil_tofu_bqueue_put(queue, const_cast<char*>(data.c_str()), timeout_ms);
+            }
+
+            /**
+             * @brief Take the front element, waiting up to 'timeout_ms' while the queue is empty.
+             *
+             * @param out Receives the value.
+             * @return True if an element was taken, false on timeout.
+             */
+            bool take(std::string& out, int64_t timeout_ms = FOSSIL_TOFU_BQUEUE_FOREVER) {
+                fossil_tofu_t tofu;
+                if (fossil_tofu_bqueue_take(queue, &tofu, timeout_ms) != FOSSIL_TOFU_SUCCESS) {
+                    return false;
+                }
+                out = tofu.value.data;
+                fossil_tofu_destroy(&tofu);
+                return true;
+            }
+
+            /**
+             * @brief Append up to 'max' elements to 'out' under one lock acquisition.
+             *
+             * @return Number of elements moved.
+             */
+            size_t drain_to(std::vector<std::string>& out, size_t max) {
+                size_t room = max < capacity() ? max : capacity();
+                // Grow 'out' before anything leaves the queue.
+                out.reserve(out.size() + room);
+                std::vector<fossil_tofu_t> tofus(room);
+                size_t taken = fossil_tofu_bqueue_drain(queue, tofus.data(), room);
+                size_t i = 0;
+                try {
+                    for (; i < taken; i++) {
+                        out.emplace_back(tofus[i].value.data);
+                        fossil_tofu_destroy(&tofus[i]);
+                    }
+                } catch (...) {
+                    for (; i < taken; i++) {
+                        fossil_tofu_destroy(&tofus[i]);
+                    }
+                    throw;
+                }
+                return taken;
+            }
+
+            /**
+             * @brief Get the number of elements in the queue.
+             */
+            size_t size() const {
+                return fossil_tofu_bqueue_size(queue);
+            }
+
+            /**
+             * @brief Get the capacity of the queue.
+             */
+            size_t capacity() const {
+                return fossil_tofu_bqueue_capacity(queue);
+            }
+
+            /**
+             * @brief Check if the queue is empty.
+             */
+            bool is_empty() const {
+                return fossil_tofu_bqueue_is_empty(queue);
+            }
+
+            /**
+             * @brief Check if the queue is full.
+             */
+            bool is_full() const {
+                return fossil_tofu_bqueue_is_full(queue);
+            }
+
+        private:
+            fossil_tofu_bqueue_t* queue;
+        };
+
+    } // namespace tofu
+
+} // namespace fossil
+
+#endif
+
+#endif /* FOSSIL_TOFU_FRAMEWORK_H */
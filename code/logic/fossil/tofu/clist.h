@@ -47,6 +47,7 @@ typedef struct fossil_tofu_clist_node_t {
 typedef struct fossil_tofu_clist_t {
     fossil_tofu_clist_node_t* head;  // Head node
     char* type;                 // Data type string
+    size_t size;                // Number of nodes in the ring
 } fossil_tofu_clist_t;
 
 // *****************************************************************************
@@ -127,9 +128,22 @@ void fossil_tofu_clist_reverse(fossil_tofu_clist_t* clist);
  * 
  * @param clist Pointer to the circular linked list container.
  * @return The number of elements in the list.
+ * @note Time complexity: O(1)
  */
 size_t fossil_tofu_clist_size(const fossil_tofu_clist_t* clist);
 
+/**
+ * Check the internal invariants of the circular linked list: following size
+ * next links from the head closes the ring exactly once and every prev link
+ * mirrors its next link. Debug builds (FOSSIL_TOFU_DEBUG) run this after
+ * every mutation.
+ * 
+ * @param clist Pointer to the circular linked list container.
+ * @return True if the list is consistent, false otherwise.
+ * @note Time complexity: O(n)
+ */
+bool fossil_tofu_clist_verify(const fossil_tofu_clist_t* clist);
+
 /**
  * Check if the circular linked list contains any elements.
  * 
@@ -329,6 +343,14 @@ namespace fossil {
                 return fossil_tofu_clist_size(clist_);
             }
 
+            /**
+             * @brief Check the internal invariants of the circular linked list.
+             * @return True if the list is consistent, false otherwise.
+             */
+            bool verify() const {
+                return fossil_tofu_clist_verify(clist_);
+            }
+
             /**
              * @brief Check if the circular linked list contains any elements.
              * @return true if not empty, false otherwise.
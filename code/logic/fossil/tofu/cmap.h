@@ -0,0 +1,368 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef FOSSIL_TOFU_CMAP_H
+#define FOSSIL_TOFU_CMAP_H
+
+#include "mapof.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// *****************************************************************************
+// Type definitions
+// *****************************************************************************
+
+#define FOSSIL_TOFU_CMAP_SHARDS 64 // Default shard count
+
+// One hashed mapof behind its own reader/writer lock; defined in cmap.c.
+typedef struct fossil_tofu_cmap_shard_t fossil_tofu_cmap_shard_t;
+
+// Concurrent map: keys are spread over a power-of-two number of shards by
+// the high bits of their hash, so threads touching different keys rarely
+// contend on the same lock. Every function below is thread-safe except
+// create_move and destroy.
+typedef struct fossil_tofu_cmap_t {
+    char* key_type;
+    char* value_type;
+    fossil_tofu_type_t key_id;       // Parsed key_type, hashed the way the shards hash
+    fossil_tofu_cmap_shard_t* shards;
+    size_t shard_count;
+    unsigned shard_shift; // 64 - log2(shard_count)
+} fossil_tofu_cmap_t;
+
+// *****************************************************************************
+// Function prototypes
+// *****************************************************************************
+
+/**
+ * @brief Create a new concurrent map with the default number of shards.
+ *
+ * @param key_type The type of the keys.
+ * @param value_type The type of the values.
+ * @return A pointer to the newly created map, or NULL on failure.
+ */
+fossil_tofu_cmap_t* fossil_tofu_cmap_create_container(char* key_type, char* value_type);
+
+/**
+ * @brief Create a new concurrent map with a chosen number of shards.
+ *
+ * More shards lower contention at the cost of memory; a few times the
+ * number of threads sharing the map is a good starting point.
+ *
+ * @param key_type The type of the keys.
+ * @param value_type The type of the values.
+ * @param shards Number of shards, rounded up to a power of two; 0 selects
+ *               FOSSIL_TOFU_CMAP_SHARDS.
+ * @return A pointer to the newly created map, or NULL on failure.
+ */
+fossil_tofu_cmap_t* fossil_tofu_cmap_create_sharded(char* key_type, char* value_type, size_t shards);
+
+/**
+ * @brief Create a new concurrent map with "any" keys and values.
+ *
+ * @return A pointer to the newly created map, or NULL on failure.
+ */
+fossil_tofu_cmap_t* fossil_tofu_cmap_create_default(void);
+
+/**
+ * @brief Create a copy of a concurrent map. Each source shard is read-locked
+ * while it is copied, so the copy is consistent per shard, not globally.
+ *
+ * @param other The map to copy.
+ * @return A pointer to the copy, or NULL on failure.
+ */
+fossil_tofu_cmap_t* fossil_tofu_cmap_create_copy(const fossil_tofu_cmap_t* other);
+
+/**
+ * @brief Move a concurrent map into a new container. Not thread-safe: no
+ * other thread may use `other` during or after the move.
+ *
+ * @param other The map to move from.
+ * @return A pointer to the new map, or NULL on failure.
+ */
+fossil_tofu_cmap_t* fossil_tofu_cmap_create_move(fossil_tofu_cmap_t* other);
+
+/**
+ * @brief Destroy a concurrent map. Not thread-safe.
+ *
+ * @param map The map to destroy.
+ */
+void fossil_tofu_cmap_destroy(fossil_tofu_cmap_t* map);
+
+/**
+ * @brief Insert a key-value pair, shadowing any previous value for the key
+ * as fossil_tofu_mapof_insert does.
+ *
+ * @param map The map.
+ * @param key The key to insert.
+ * @param value The value to insert.
+ * @return 0 on success, non-zero on failure.
+ * @note Time complexity: O(1) expected; takes one shard write lock
+ */
+int32_t fossil_tofu_cmap_insert(fossil_tofu_cmap_t* map, char *key, char *value);
+
+/**
+ * @brief Remove the newest value for a key.
+ *
+ * @param map The map.
+ * @param key The key to remove.
+ * @return 0 on success, non-zero if the key is absent.
+ * @note Time complexity: O(1) expected; takes one shard write lock
+ */
+int32_t fossil_tofu_cmap_remove(fossil_tofu_cmap_t* map, char *key);
+
+/**
+ * @brief Check whether the map contains a key.
+ *
+ * @param map The map.
+ * @param key The key to check.
+ * @return True if the key is found, false otherwise.
+ * @note Time complexity: O(1) expected; takes one shard read lock
+ */
+bool fossil_tofu_cmap_contains(const fossil_tofu_cmap_t* map, char *key);
+
+/**
+ * @brief Get a copy of the value associated with a key.
+ *
+ * The stored value may be replaced by another thread at any time, so the
+ * result is an independent copy that the caller releases with
+ * fossil_tofu_destroy.
+ *
+ * @param map The map.
+ * @param key The key to look up.
+ * @return A copy of the value, or a zeroed tofu if the key is absent.
+ * @note Time complexity: O(1) expected; takes one shard read lock
+ */
+fossil_tofu_t fossil_tofu_cmap_get(const fossil_tofu_cmap_t* map, char *key);
+
+/**
+ * @brief Replace the value associated with an existing key.
+ *
+ * @param map The map.
+ * @param key The key to set.
+ * @param value The new value.
+ * @return 0 on success, non-zero if the key is absent.
+ * @note Time complexity: O(1) expected; takes one shard write lock
+ */
+int32_t fossil_tofu_cmap_set(fossil_tofu_cmap_t* map, char *key, char *value);
+
+/**
+ * @brief Grow every shard so the map can hold about `keys` distinct keys
+ * without rehashing.
+ *
+ * @param map The map.
+ * @param keys The expected number of distinct keys.
+ * @return 0 on success, non-zero on failure.
+ * @note Time complexity: O(n)
+ */
+int32_t fossil_tofu_cmap_reserve(fossil_tofu_cmap_t* map, size_t keys);
+
+/**
+ * @brief Visit every key with its newest value, one shard at a time. Each
+ * shard is read-locked while it is visited, so the visitor must not modify
+ * the map.
+ *
+ * @param map The map.
+ * @param visit Called for each key; returning false stops the walk.
+ * @param context Passed through to the visitor.
+ * @return The number of keys visited.
+ * @note Time complexity: O(n)
+ */
+size_t fossil_tofu_cmap_for_each(const fossil_tofu_cmap_t* map, fossil_tofu_mapof_visit_fn visit, void* context);
+
+/**
+ * @brief Get the number of entries in the map, summed over the shards. Under
+ * concurrent writes this is a snapshot, not an exact count.
+ *
+ * @param map The map.
+ * @return The number of entries.
+ * @note Time complexity: O(shards)
+ */
+size_t fossil_tofu_cmap_size(const fossil_tofu_cmap_t* map);
+
+/**
+ * @brief Get the number of shards.
+ *
+ * @param map The map.
+ * @return The shard count.
+ * @note Time complexity: O(1)
+ */
+size_t fossil_tofu_cmap_shard_count(const fossil_tofu_cmap_t* map);
+
+/**
+ * @brief Check if the map is not empty.
+ *
+ * @param map The map.
+ * @return True if the map is not empty, false otherwise.
+ * @note Time complexity: O(shards)
+ */
+bool fossil_tofu_cmap_not_empty(const fossil_tofu_cmap_t* map);
+
+/**
+ * @brief Check if the map is empty.
+ *
+ * @param map The map.
+ * @return True if the map is empty, false otherwise.
+ * @note Time complexity: O(shards)
+ */
+bool fossil_tofu_cmap_is_empty(const fossil_tofu_cmap_t* map);
+
+#ifdef __cplusplus
+}
+#include <stdexcept>
+#include <string>
+
+namespace fossil {
+
+    namespace tofu {
+
+        /**
+         * @brief A C++ wrapper class for the fossil_tofu_cmap_t structure.
+         */
+        class CMap {
+        public:
+            /**
+             * @brief Construct a new concurrent map.
+             *
+             * @param key_type The type of the keys.
+             * @param value_type The type of the values.
+             * @param shards Number of shards; 0 selects the default.
+             */
+            CMap(const std::string& key_type, const std::string& value_type, size_t shards = 0) {
+                map = fossil_tofu_cmap_create_sharded(const_cast<char*>(key_type.c_str()), const_cast<char*>(value_type.c_str()), shards);
+                if (map == nullptr) {
+                    throw std::runtime_error("Failed to create concurrent map");
+                }
+            }
+
+            CMap(const CMap&) = delete;
+            CMap& operator=(const CMap&) = delete;
+
+            /**
+             * @brief Destroy the CMap object and free its memory.
+             */
+            ~CMap() {
+                fossil_tofu_cmap_destroy(map);
+            }
+
+            /**
+             * @brief Insert a key-value pair into the map.
+             *
+             * @param key The key to insert.
+             * @param value The value to insert.
+             * @return 0 on success, non-zero on failure.
+             */
+            int32_t insert(const std::string& key, const std::string& value) {
+                return fossil_tofu_cmap_insert(map, const_cast<char*>(key.c_str()), const_cast<char*>(value.c_str()));
+            }
+
+            /**
+             * @brief Remove a key from the map.
+             *
+             * @param key The key to remove.
+             * @return 0 on success, non-zero on failure.
+             */
+            int32_t remove(const std::string& key) {
+                return fossil_tofu_cmap_remove(map, const_cast<char*>(key.c_str()));
+            }
+
+            /**
+             * @brief Check if the map contains a key.
+             *
+             * @param key The key to check.
+             * @return True if the key is found, false otherwise.
+             */
+            bool contains(const std::string& key) const {
+                return fossil_tofu_cmap_contains(map, const_cast<char*>(key.c_str()));
+            }
+
+            /**
+             * @brief Get a copy of the value associated with a key.
+             *
+             * @param key The key to look up.
+             * @return The value text.
+             * @throws std::runtime_error If the key is absent.
+             */
+            std::string get(const std::string& key) const {
+                fossil_tofu_t value = fossil_tofu_cmap_get(map, const_cast<char*>(key.c_str()));
+                if (value.value.data == nullptr) {
+                    throw std::runtime_error("Key not found in concurrent map");
+                }
+                std::string result(value.value.data);
+                fossil_tofu_destroy(&value);
+                return result;
+            }
+
+            /**
+             * @brief Set the value associated with an existing key.
+             *
+             * @param key The key to set.
+             * @param value The value to set.
+             * @return 0 on success, non-zero on failure.
+             */
+            int32_t set(const std::string& key, const std::string& value) {
+                return fossil_tofu_cmap_set(map, const_cast<char*>(key.c_str()), const_cast<char*>(value.c_str()));
+            }
+
+            /**
+             * @brief Get the number of entries in the map.
+             *
+             * @return The number of entries.
+             */
+            size_t size() const {
+                return fossil_tofu_cmap_size(map);
+            }
+
+            /**
+             * @brief Get the number of shards.
+             *
+             * @return The shard count.
+             */
+            size_t shard_count() const {
+                return fossil_tofu_cmap_shard_count(map);
+            }
+
+            /**
+             * @brief Check if the map is empty.
+             *
+             * @return True if the map is empty, false otherwise.
+             */
+            bool is_empty() const {
+                return fossil_tofu_cmap_is_empty(map);
+            }
+
+        private:
+            fossil_tofu_cmap_t* map; ///< Pointer to the underlying C map structure.
+        };
+
+    } // namespace tofu
+
+} // namespace fossil
+
+#endif
+
+#endif /* FOSSIL_TOFU_FRAMEWORK_H */
@@ -36,19 +36,28 @@ extern "C"
 // Type definitions
 // *****************************************************************************
 
-// Node structure for the circular queue
-typedef struct fossil_tofu_cqueue_node_t {
+// Behaviour of a full circular queue on insert
+typedef enum fossil_tofu_cqueue_mode_t {
+    FOSSIL_TOFU_CQUEUE_REJECT = 0,   // Insert fails while the queue is full
+    FOSSIL_TOFU_CQUEUE_OVERWRITE     // Insert replaces the oldest element
+} fossil_tofu_cqueue_mode_t;
+
+// Ring slot; a slot keeps its tofu after removal so later inserts can reuse
+// the value buffer ('room' bytes) instead of allocating a new one.
+typedef struct fossil_tofu_cqueue_slot_t {
     fossil_tofu_t data;
-    struct fossil_tofu_cqueue_node_t* next;
-} fossil_tofu_cqueue_node_t;
+    size_t room;
+} fossil_tofu_cqueue_slot_t;
 
-// Circular queue structure
+// Circular queue structure, a fixed ring of 'capacity' slots starting at 'head'
 typedef struct fossil_tofu_cqueue_t {
-    fossil_tofu_cqueue_node_t* front;
-    fossil_tofu_cqueue_node_t* rear;
+    fossil_tofu_cqueue_slot_t* slots;
+    size_t head;
     char* type;
     size_t capacity;
     size_t size;
+    size_t overwritten;
+    fossil_tofu_cqueue_mode_t mode;
 } fossil_tofu_cqueue_t;
 
 // *****************************************************************************
@@ -61,12 +70,27 @@ typedef struct fossil_tofu_cqueue_t {
  * @param type     The type of data the queue will store as a string.
  * @param capacity The maximum number of elements the queue can hold.
  * @return         Pointer to the created circular queue structure, or NULL on failure.
- * @note           Time complexity: O(1)
+ * @note           Time complexity: O(capacity)
  * @details        Allocates memory for a circular queue and initializes its members.
  *                 The queue will be able to store up to 'capacity' elements of the specified type.
+ *                 The ring of slots is allocated once here and never resized.
  */
 fossil_tofu_cqueue_t* fossil_tofu_cqueue_create_container(char* type, size_t capacity);
 
+/**
+ * Create a new circular queue with an explicit full-queue policy.
+ *
+ * @param type     The type of data the queue will store as a string.
+ * @param capacity The maximum number of elements the queue can hold.
+ * @param mode     FOSSIL_TOFU_CQUEUE_REJECT or FOSSIL_TOFU_CQUEUE_OVERWRITE.
+ * @return         Pointer to the created circular queue structure, or NULL on failure.
+ * @note           Time complexity: O(capacity)
+ * @details        In overwrite mode an insert into a full queue drops the oldest
+ *                 element and succeeds, which suits fixed-size telemetry buffers
+ *                 that only care about the most recent samples.
+ */
+fossil_tofu_cqueue_t* fossil_tofu_cqueue_create_mode(char* type, size_t capacity, fossil_tofu_cqueue_mode_t mode);
+
 /**
  * Create a new circular queue with default values.
  *
@@ -82,8 +106,9 @@ fossil_tofu_cqueue_t* fossil_tofu_cqueue_create_default(void);
  *
  * @param other Pointer to the circular queue to copy.
  * @return      Pointer to the newly created circular queue, or NULL on failure.
- * @note        Time complexity: O(n)
+ * @note        Time complexity: O(capacity)
  * @details     Performs a deep copy of the source queue, duplicating all elements and metadata.
+ *              The copy keeps the capacity and mode of the source.
  */
 fossil_tofu_cqueue_t* fossil_tofu_cqueue_create_copy(const fossil_tofu_cqueue_t* other);
 
@@ -102,8 +127,8 @@ fossil_tofu_cqueue_t* fossil_tofu_cqueue_create_move(fossil_tofu_cqueue_t* other
  * Erase the contents of the circular queue and free allocated memory.
  *
  * @param queue Pointer to the circular queue to erase.
- * @note        Time complexity: O(n)
- * @details     Frees all memory associated with the queue, including all nodes and metadata.
+ * @note        Time complexity: O(capacity)
+ * @details     Frees all memory associated with the queue, including all slots and metadata.
  *              After calling this function, the queue pointer should not be used.
  */
 void fossil_tofu_cqueue_destroy(fossil_tofu_cqueue_t* queue);
@@ -121,6 +146,9 @@ void fossil_tofu_cqueue_destroy(fossil_tofu_cqueue_t* queue);
  * @note        Time complexity: O(1)
  * @details     Adds the specified data to the rear of the queue.
  *              Returns 0 on success, or a negative error code on failure (e.g., if the queue is full).
+ *              A full queue in overwrite mode drops its front element instead of failing.
+ *              No memory is allocated when the target slot already holds a value
+ *              buffer large enough for 'data'.
  */
 int32_t fossil_tofu_cqueue_insert(fossil_tofu_cqueue_t* queue, char *data);
 
@@ -132,9 +160,23 @@ int32_t fossil_tofu_cqueue_insert(fossil_tofu_cqueue_t* queue, char *data);
  * @note        Time complexity: O(1)
  * @details     Removes the front element from the queue.
  *              Returns 0 on success, or a negative error code on failure (e.g., if the queue is empty).
+ *              The slot keeps its buffer for reuse by a later insert.
  */
 int32_t fossil_tofu_cqueue_remove(fossil_tofu_cqueue_t* queue);
 
+/**
+ * Move the front element out of the circular queue.
+ *
+ * @param queue Pointer to the circular queue to take data from.
+ * @param out   Receives the front tofu; the caller must fossil_tofu_destroy it.
+ * @return      Error code indicating the success or failure of the operation.
+ * @note        Time complexity: O(1)
+ * @details     Like remove, but hands the element's storage to the caller
+ *              instead of keeping it in the slot, so nothing is copied.
+ *              Returns FOSSIL_TOFU_FAILURE if the queue is empty.
+ */
+int32_t fossil_tofu_cqueue_take(fossil_tofu_cqueue_t* queue, fossil_tofu_t* out);
+
 /**
  * Get the size of the circular queue.
  *
@@ -185,6 +227,45 @@ bool fossil_tofu_cqueue_is_empty(const fossil_tofu_cqueue_t* queue);
  */
 bool fossil_tofu_cqueue_is_cnullptr(const fossil_tofu_cqueue_t* queue);
 
+/**
+ * Check if the circular queue is full.
+ *
+ * @param queue Pointer to the circular queue to check.
+ * @return      True if the queue holds 'capacity' elements, false otherwise.
+ * @note        Time complexity: O(1)
+ * @details     Returns false for a NULL queue. An overwrite-mode queue still
+ *              accepts inserts while full.
+ */
+bool fossil_tofu_cqueue_is_full(const fossil_tofu_cqueue_t* queue);
+
+/**
+ * Get the capacity of the circular queue.
+ *
+ * @param queue Pointer to the circular queue.
+ * @return      The maximum number of elements the queue can hold, or 0 for NULL.
+ * @note        Time complexity: O(1)
+ */
+size_t fossil_tofu_cqueue_capacity(const fossil_tofu_cqueue_t* queue);
+
+/**
+ * Get the full-queue policy of the circular queue.
+ *
+ * @param queue Pointer to the circular queue.
+ * @return      The mode given at creation, or FOSSIL_TOFU_CQUEUE_REJECT for NULL.
+ * @note        Time complexity: O(1)
+ */
+fossil_tofu_cqueue_mode_t fossil_tofu_cqueue_get_mode(const fossil_tofu_cqueue_t* queue);
+
+/**
+ * Get the number of elements dropped by overwrite-mode inserts.
+ *
+ * @param queue Pointer to the circular queue.
+ * @return      Count of elements overwritten since creation, or 0 for NULL.
+ * @note        Time complexity: O(1)
+ * @details     Lets telemetry consumers detect that they fell behind the producer.
+ */
+size_t fossil_tofu_cqueue_overwritten(const fossil_tofu_cqueue_t* queue);
+
 // *****************************************************************************
 // Getter and setter functions
 // *****************************************************************************
@@ -209,6 +290,18 @@ char *fossil_tofu_cqueue_get_front(const fossil_tofu_cqueue_t* queue);
  */
 char *fossil_tofu_cqueue_get_rear(const fossil_tofu_cqueue_t* queue);
 
+/**
+ * Get the element at a position counted from the front of the circular queue.
+ *
+ * @param queue Pointer to the circular queue.
+ * @param index Zero-based position, 0 being the front.
+ * @return      Pointer to the element as a string, or NULL if out of range.
+ * @note        Time complexity: O(1)
+ * @details     Reads the ring directly, so a consumer can scan the buffered
+ *              elements oldest to newest without removing them.
+ */
+char *fossil_tofu_cqueue_get_at(const fossil_tofu_cqueue_t* queue, size_t index);
+
 /**
  * Set the element at the front of the circular queue.
  *
@@ -264,6 +357,23 @@ namespace fossil {
             }
             }
 
+            /**
+             * @brief Create a new circular queue with an explicit full-queue policy.
+             *
+             * @param type     The type of data the queue will store as a string.
+             * @param capacity The maximum number of elements the queue can hold.
+             * @param mode     FOSSIL_TOFU_CQUEUE_REJECT or FOSSIL_TOFU_CQUEUE_OVERWRITE.
+             * @throws std::runtime_error If the queue creation fails.
+             *
+             * In overwrite mode inserts into a full queue drop the oldest element.
+             */
+            CQueue(const std::string& type, size_t capacity, fossil_tofu_cqueue_mode_t mode) {
+            queue = fossil_tofu_cqueue_create_mode(const_cast<char*>(type.c_str()), capacity, mode);
+            if (queue == nullptr) {
+                throw std::runtime_error("Failed to create circular queue.");
+            }
+            }
+
             /**
              * @brief Create a new circular queue with default values.
              *
@@ -339,6 +449,22 @@ namespace fossil {
             return fossil_tofu_cqueue_remove(queue);
             }
 
+            /**
+             * @brief Move the front element out of the circular queue.
+             *
+             * @param out Receives the front value.
+             * @return    True if an element was taken, false if the queue is empty.
+             */
+            bool take(std::string& out) {
+            fossil_tofu_t tofu;
+            if (fossil_tofu_cqueue_take(queue, &tofu) != FOSSIL_TOFU_SUCCESS) {
+                return false;
+            }
+            out = tofu.value.data;
+            fossil_tofu_destroy(&tofu);
+            return true;
+            }
+
             /**
              * @brief Get the size of the circular queue.
              *
@@ -394,6 +520,33 @@ namespace fossil {
             return fossil_tofu_cqueue_is_cnullptr(queue);
             }
 
+            /**
+             * @brief Check if the circular queue is full.
+             *
+             * @return True if the queue holds 'capacity' elements, false otherwise.
+             */
+            bool is_full() const {
+            return fossil_tofu_cqueue_is_full(queue);
+            }
+
+            /**
+             * @brief Get the full-queue policy of the circular queue.
+             *
+             * @return The mode given at construction.
+             */
+            fossil_tofu_cqueue_mode_t mode() const {
+            return fossil_tofu_cqueue_get_mode(queue);
+            }
+
+            /**
+             * @brief Get the number of elements dropped by overwrite-mode inserts.
+             *
+             * @return Count of overwritten elements since construction.
+             */
+            size_t overwritten() const {
+            return fossil_tofu_cqueue_overwritten(queue);
+            }
+
             /**
              * @brief Get the element at the front of the circular queue.
              *
@@ -418,6 +571,21 @@ namespace fossil {
             return result ? std::string(result) : std::string();
             }
 
+            /**
+             * @brief Get the element at a position counted from the front.
+             *
+             * @param index Zero-based position, 0 being the front.
+             * @return The element as std::string.
+             * @throws std::out_of_range If the index is past the rear.
+             */
+            std::string get_at(size_t index) const {
+            char* result = fossil_tofu_cqueue_get_at(queue, index);
+            if (result == nullptr) {
+                throw std::out_of_range("Circular queue index out of range.");
+            }
+            return std::string(result);
+            }
+
             /**
              * @brief Set the element at the front of the circular queue.
              *
@@ -459,7 +627,7 @@ namespace fossil {
              * Returns the capacity value of the queue.
              */
             size_t capacity() const {
-            return queue ? queue->capacity : 0;
+            return fossil_tofu_cqueue_capacity(queue);
             }
 
         private:
@@ -48,6 +48,7 @@ typedef struct fossil_tofu_dlist_t {
     fossil_tofu_dlist_node_t* head;
     fossil_tofu_dlist_node_t* tail;
     char* type;
+    size_t size;
 } fossil_tofu_dlist_t;
 
 // *****************************************************************************
@@ -141,10 +142,22 @@ void fossil_tofu_dlist_reverse_backward(fossil_tofu_dlist_t* dlist);
  *
  * @param dlist Pointer to the doubly linked list.
  * @return      Number of elements in the list.
- * @note        Time complexity: O(n)
+ * @note        Time complexity: O(1)
  */
 size_t fossil_tofu_dlist_size(const fossil_tofu_dlist_t* dlist);
 
+/**
+ * Check the internal invariants of the doubly linked list: the node count
+ * matches the stored size, every prev link mirrors its next link, and the
+ * tail is the last node reached from the head. Debug builds
+ * (FOSSIL_TOFU_DEBUG) run this after every mutation.
+ *
+ * @param dlist Pointer to the doubly linked list.
+ * @return      True if the list is consistent, false otherwise.
+ * @note        Time complexity: O(n)
+ */
+bool fossil_tofu_dlist_verify(const fossil_tofu_dlist_t* dlist);
+
 /**
  * Check if the doubly linked list is not empty.
  *
@@ -191,7 +204,7 @@ bool fossil_tofu_dlist_is_cnullptr(const fossil_tofu_dlist_t* dlist);
  * @param dlist Pointer to the doubly linked list.
  * @param index Index of the element to retrieve.
  * @return      Pointer to the element at the specified index, or NULL if out of bounds.
- * @note        Time complexity: O(n)
+ * @note        Time complexity: O(n), walking from the nearer end
  */
 char *fossil_tofu_dlist_get(const fossil_tofu_dlist_t* dlist, size_t index);
 
@@ -219,7 +232,7 @@ char *fossil_tofu_dlist_get_back(const fossil_tofu_dlist_t* dlist);
  * @param dlist   Pointer to the doubly linked list.
  * @param index   Index at which to set the element.
  * @param element Pointer to the element to set.
- * @note         Time complexity: O(n)
+ * @note          Time complexity: O(n), walking from the nearer end
  */
 void fossil_tofu_dlist_set(fossil_tofu_dlist_t* dlist, size_t index, char *element);
 
@@ -388,6 +401,15 @@ namespace fossil {
             return fossil_tofu_dlist_size(dlist);
             }
 
+            /**
+             * @brief Check the internal invariants of the doubly linked list.
+             *
+             * @return True if the list is consistent, false otherwise.
+             */
+            bool verify() const {
+            return fossil_tofu_dlist_verify(dlist);
+            }
+
             /**
              * @brief Check if the doubly linked list is not empty.
              *
@@ -47,6 +47,7 @@ typedef struct fossil_tofu_dqueue_t {
     fossil_tofu_dqueue_node_t* front;
     fossil_tofu_dqueue_node_t* rear;
     char *type;
+    size_t size;
 } fossil_tofu_dqueue_t;
 
 // *****************************************************************************
@@ -128,6 +129,18 @@ int32_t fossil_tofu_dqueue_remove(fossil_tofu_dqueue_t* dqueue);
  */
 size_t fossil_tofu_dqueue_size(const fossil_tofu_dqueue_t* dqueue);
 
+/**
+ * Check the internal invariants of the double-ended queue: the node count
+ * matches the stored size, every prev link mirrors its next link, and the
+ * rear pointer is the last node reached from the front. Debug builds
+ * (FOSSIL_TOFU_DEBUG) run this after every mutation.
+ *
+ * @param dqueue The double-ended queue to check.
+ * @return       True if the queue is consistent, false otherwise.
+ * @note         Time complexity: O(n)
+ */
+bool fossil_tofu_dqueue_verify(const fossil_tofu_dqueue_t* dqueue);
+
 /**
  * Check if the dynamic queue is not empty.
  *
@@ -173,8 +186,8 @@ bool fossil_tofu_dqueue_is_cnullptr(const fossil_tofu_dqueue_t* dqueue);
  *
  * @param dqueue The double-ended queue from which to get the element.
  * @param index  The index of the element to get.
- * @return       The element at the specified index.
- * @note         Time complexity: O(n)
+ * @return       The element at the specified index, or NULL if out of range.
+ * @note         Time complexity: O(n), walking from the nearer end
  */
 char *fossil_tofu_dqueue_get(const fossil_tofu_dqueue_t* dqueue, size_t index);
 
@@ -202,7 +215,7 @@ char *fossil_tofu_dqueue_get_back(const fossil_tofu_dqueue_t* dqueue);
  * @param dqueue  The double-ended queue in which to set the element.
  * @param index   The index at which to set the element.
  * @param element The element to set.
- * @note         Time complexity: O(n)
+ * @note          Time complexity: O(n), walking from the nearer end
  */
 void fossil_tofu_dqueue_set(fossil_tofu_dqueue_t* dqueue, size_t index, char *element);
 
@@ -362,6 +375,15 @@ namespace fossil {
                 return fossil_tofu_dqueue_size(dqueue);
             }
 
+            /**
+             * Checks the internal invariants of the queue.
+             * 
+             * @return True if the queue is consistent, false otherwise.
+             */
+            bool verify() const {
+                return fossil_tofu_dqueue_verify(dqueue);
+            }
+
             /**
              * Checks if the queue is not empty.
              * 
@@ -46,6 +46,7 @@ typedef struct fossil_tofu_flist_node_t {
 typedef struct fossil_tofu_flist_t {
     fossil_tofu_flist_node_t* head;
     char* type;
+    size_t size;
 } fossil_tofu_flist_t;
 
 // *****************************************************************************
@@ -142,10 +143,21 @@ void fossil_tofu_flist_reverse_backward(fossil_tofu_flist_t* flist);
  *
  * @param flist The forward list for which to get the size.
  * @return      The size of the forward list.
- * @complexity  O(n)
+ * @complexity  O(1)
  */
 size_t fossil_tofu_flist_size(const fossil_tofu_flist_t* flist);
 
+/**
+ * Check the internal invariants of the forward list: the number of nodes
+ * reachable from the head matches the stored size. Debug builds
+ * (FOSSIL_TOFU_DEBUG) run this after every mutation.
+ *
+ * @param flist The forward list to check.
+ * @return      True if the list is consistent, false otherwise.
+ * @complexity  O(n)
+ */
+bool fossil_tofu_flist_verify(const fossil_tofu_flist_t* flist);
+
 /**
  * Check if the forward list is not empty.
  *
@@ -343,6 +355,15 @@ namespace fossil {
             size_t size() const {
                 return fossil_tofu_flist_size(flist);
             }
+
+            /**
+             * Check the internal invariants of the forward list.
+             *
+             * @return True if the list is consistent, false otherwise.
+             */
+            bool verify() const {
+                return fossil_tofu_flist_verify(flist);
+            }
         
             /**
              * Check if the forward list is not empty.
@@ -30,22 +30,32 @@
 
 // array family
 #include "vector.h"
+#include "segvector.h"
 #include "tuple.h"
 #include "array.h"
 #include "arraylist.h"
 
 // queue family
 #include "dqueue.h"
+#include "wsdeque.h"
 #include "pqueue.h"
+#include "timerq.h"
 #include "cqueue.h"
+#include "spscq.h"
+#include "mpmcq.h"
+#include "bqueue.h"
 #include "queue.h"
 
 // stack family
 #include "stack.h"
 
 // key-value family
+#include "bloom.h"
 #include "setof.h"
 #include "mapof.h"
+#include "cmap.h"
+#include "multimap.h"
+#include "bag.h"
 
 // linked list family
 #include "clist.h"
@@ -0,0 +1,214 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef FOSSIL_TOFU_HASHTABLE_H
+#define FOSSIL_TOFU_HASHTABLE_H
+
+#include "tofu.h"
+#include "bloom.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// *****************************************************************************
+// Type definitions
+// *****************************************************************************
+
+#define FOSSIL_TOFU_HASHTABLE_MIN_SLOTS 16
+
+// Open-addressing slot. Probing only touches the cached key hash until it
+// matches, so a miss never dereferences a node.
+typedef struct {
+    uint64_t hash;
+    void* node; // NULL marks an empty slot
+} fossil_tofu_hashtable_slot_t;
+
+/**
+ * The Robin Hood hash table behind setof, mapof, multimap and bag.
+ *
+ * Slots point at nodes owned by the container; the table places, finds and
+ * moves them but never allocates or frees one. Each node holds its key as a
+ * fossil_tofu_t `key_offset` bytes in, and keys hash and compare with
+ * fossil_tofu_hash_key and fossil_tofu_equals_key for `key_type`. Deletion
+ * shifts the following slots back, so there are no tombstones.
+ */
+typedef struct {
+    fossil_tofu_hashtable_slot_t* slots; // Power-of-two sized
+    size_t capacity;                     // Number of slots
+    size_t count;                        // Occupied slots
+    size_t key_offset;                   // Offset of the key inside a node
+    fossil_tofu_type_t key_type;         // Decides how keys hash and compare
+    fossil_tofu_bloom_t* filter;         // Optional filter consulted before probing
+} fossil_tofu_hashtable_t;
+
+// Copies one node for fossil_tofu_hashtable_clone; NULL on failure.
+typedef void* (*fossil_tofu_hashtable_clone_fn)(const void* node, void* context);
+
+// *****************************************************************************
+// Function prototypes
+// *****************************************************************************
+
+/**
+ * Initialize an empty table. No slots are allocated until the first grow.
+ *
+ * @param table      The table.
+ * @param key_type   Type of the keys.
+ * @param key_offset Offset of the key fossil_tofu_t inside each node.
+ */
+void fossil_tofu_hashtable_init(fossil_tofu_hashtable_t* table, fossil_tofu_type_t key_type, size_t key_offset);
+
+/**
+ * Free the slots and the filter. The nodes belong to the container and
+ * must be freed first.
+ */
+void fossil_tofu_hashtable_release(fossil_tofu_hashtable_t* table);
+
+/**
+ * Hand the slots and filter of `source` to `table`, leaving `source` empty.
+ * `table` must be empty.
+ */
+void fossil_tofu_hashtable_move(fossil_tofu_hashtable_t* table, fossil_tofu_hashtable_t* source);
+
+/**
+ * Fill the empty `table` with copies of the nodes of `source`. The slot
+ * count and hashes are the same, so each slot is cloned in place without
+ * probing.
+ *
+ * Time complexity: O(n)
+ *
+ * @return FOSSIL_TOFU_SUCCESS, or FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION. On
+ *         failure `table` holds the nodes cloned so far, for the container
+ *         to free as usual.
+ */
+int32_t fossil_tofu_hashtable_clone(fossil_tofu_hashtable_t* table, const fossil_tofu_hashtable_t* source,
+                                    fossil_tofu_hashtable_clone_fn clone, void* context);
+
+/**
+ * Hash key text the way the table does.
+ *
+ * Time complexity: O(n) in the key length
+ */
+uint64_t fossil_tofu_hashtable_hash(const fossil_tofu_hashtable_t* table, const char* key, size_t len);
+
+/**
+ * Find the slot holding a key whose hash is already known.
+ *
+ * Time complexity: O(1) expected
+ *
+ * @return The slot index, or SIZE_MAX when the key is absent.
+ */
+size_t fossil_tofu_hashtable_probe(const fossil_tofu_hashtable_t* table, uint64_t hash, const char* key, size_t len);
+
+/**
+ * Find the slot holding a key.
+ *
+ * Time complexity: O(1) expected
+ *
+ * @return The slot index, or SIZE_MAX when the key is absent.
+ */
+size_t fossil_tofu_hashtable_lookup(const fossil_tofu_hashtable_t* table, const char* key, size_t len);
+
+/**
+ * Place a node whose key is not in the table yet. The caller makes room
+ * first with fossil_tofu_hashtable_grow or fossil_tofu_hashtable_reserve.
+ *
+ * Time complexity: O(1) expected
+ */
+void fossil_tofu_hashtable_place(fossil_tofu_hashtable_t* table, uint64_t hash, void* node);
+
+/**
+ * Empty slot `i` and return the node it held. Later slots shift back, so
+ * slot `i` may hold another node afterwards.
+ *
+ * Time complexity: O(1) expected
+ */
+void* fossil_tofu_hashtable_vacate(fossil_tofu_hashtable_t* table, size_t i);
+
+/**
+ * Empty every slot without touching the nodes, which the caller has
+ * already freed.
+ *
+ * Time complexity: O(n) in the slot count
+ */
+void fossil_tofu_hashtable_clear(fossil_tofu_hashtable_t* table);
+
+/**
+ * Move every node into a new slot array of `capacity` slots, a power of two
+ * larger than the node count. The filter is rebuilt alongside.
+ *
+ * Time complexity: O(n)
+ *
+ * @return FOSSIL_TOFU_SUCCESS, or FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION with
+ *         the table unchanged.
+ */
+int32_t fossil_tofu_hashtable_rehash(fossil_tofu_hashtable_t* table, size_t capacity);
+
+/**
+ * Smallest power-of-two slot count that keeps `count` nodes within
+ * `max_load`, or 0 when no such count fits in a size_t.
+ */
+size_t fossil_tofu_hashtable_slots_for(size_t count, double max_load);
+
+/**
+ * Make room for one more node, doubling the slots once the load limit
+ * would be passed.
+ *
+ * Time complexity: O(1) amortized
+ *
+ * @return FOSSIL_TOFU_SUCCESS, or FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION.
+ */
+int32_t fossil_tofu_hashtable_grow(fossil_tofu_hashtable_t* table, double max_load);
+
+/**
+ * Grow the slots so `count` nodes fit within `max_load`. Never shrinks.
+ *
+ * Time complexity: O(n)
+ *
+ * @return FOSSIL_TOFU_SUCCESS, FOSSIL_TOFU_ERROR_OVERFLOW, or
+ *         FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION.
+ */
+int32_t fossil_tofu_hashtable_reserve(fossil_tofu_hashtable_t* table, size_t count, double max_load);
+
+/**
+ * Put a Bloom filter in front of the slots, replacing any current one. It
+ * is sized per slot and rebuilt on every rehash.
+ *
+ * Time complexity: O(n)
+ *
+ * @param bits_per_key Filter bits per slot; 0 selects the filter default.
+ * @return FOSSIL_TOFU_SUCCESS, or FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION.
+ */
+int32_t fossil_tofu_hashtable_attach_filter(fossil_tofu_hashtable_t* table, size_t bits_per_key);
+
+/**
+ * Remove the filter, if any.
+ */
+void fossil_tofu_hashtable_detach_filter(fossil_tofu_hashtable_t* table);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FOSSIL_TOFU_FRAMEWORK_H */
@@ -25,7 +25,7 @@
 #ifndef FOSSIL_TOFU_MAPOF_H
 #define FOSSIL_TOFU_MAPOF_H
 
-#include "tofu.h"
+#include "hashtable.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -36,19 +36,68 @@ extern "C"
 // Type definitions
 // *****************************************************************************
 
+#define FOSSIL_TOFU_MAPOF_MIN_SLOTS 16
+#define FOSSIL_TOFU_MAPOF_LOAD_NUM  7   // grow once the table is 7/8 full
+#define FOSSIL_TOFU_MAPOF_LOAD_DEN  8
+#define FOSSIL_TOFU_MAPOF_BTREE_T   16  // B-tree minimum degree: nodes hold 15..31 keys
+#define FOSSIL_TOFU_MAPOF_BTREE_MAX (2 * FOSSIL_TOFU_MAPOF_BTREE_T - 1)
+
+// Storage layout of a map, chosen at creation.
+typedef enum {
+    FOSSIL_TOFU_MAPOF_HASHED = 0, // Open-addressing hash table, unordered
+    FOSSIL_TOFU_MAPOF_ORDERED,    // B-tree ordered by fossil_tofu_compare on the keys
+    FOSSIL_TOFU_MAPOF_INSERTION   // Dense entry array in insertion order behind a compact hash index
+} fossil_tofu_mapof_mode_t;
+
+// One entry per inserted value. The slot owns the newest entry for a key;
+// inserting the same key again pushes the previous entry down `next`, so
+// only the head entry carries a live key.
 typedef struct fossil_tofu_mapof_node_t {
     fossil_tofu_t key;
     fossil_tofu_t value;
     struct fossil_tofu_mapof_node_t* next;
 } fossil_tofu_mapof_node_t;
 
+// Element of the dense array of insertion-ordered maps. The head entry of a
+// key lives in the array itself, so iteration is a linear scan; shadowed
+// values still hang off `node.next`. Removed keys leave a dead entry behind
+// until the next rebuild compacts the array.
+typedef struct fossil_tofu_mapof_entry_t {
+    uint64_t hash;
+    bool live;
+    fossil_tofu_mapof_node_t node;
+} fossil_tofu_mapof_entry_t;
+
+// B-tree node for ordered maps. Keys are the head entries themselves, so a
+// node is two flat pointer arrays and a binary search touches one line of
+// pointers per step.
+typedef struct fossil_tofu_mapof_bnode_t {
+    size_t count;
+    bool leaf;
+    fossil_tofu_mapof_node_t* entries[FOSSIL_TOFU_MAPOF_BTREE_MAX];
+    struct fossil_tofu_mapof_bnode_t* children[FOSSIL_TOFU_MAPOF_BTREE_MAX + 1];
+} fossil_tofu_mapof_bnode_t;
+
 typedef struct fossil_tofu_mapof_t {
     char* key_type;
     char* value_type;
-    fossil_tofu_mapof_node_t* head;
-    size_t size;
+    fossil_tofu_mapof_mode_t mode;
+    fossil_tofu_type_t key_id;       // Parsed key_type, used to build lookup needles
+    fossil_tofu_hashtable_t table;   // Hashed maps only, with an optional filter in front
+    fossil_tofu_mapof_bnode_t* root; // Ordered maps only
+    fossil_tofu_mapof_entry_t* entries; // Insertion-ordered maps: entries, dead ones included
+    size_t entry_count;              // Entries in use, dead ones included
+    size_t entry_capacity;           // Entries allocated
+    uint32_t* index;                 // Insertion-ordered maps: entry number + 1 per slot, 0 when empty
+    size_t index_capacity;           // Number of index slots, power-of-two sized
+    size_t keys;                     // Number of distinct keys
+    size_t size;                     // Number of entries, shadowed ones included
 } fossil_tofu_mapof_t;
 
+// Visitor for iteration and range queries; return false to stop early.
+// Each key is visited once, with its newest value.
+typedef bool (*fossil_tofu_mapof_visit_fn)(const fossil_tofu_t* key, const fossil_tofu_t* value, void* context);
+
 // *****************************************************************************
 // Function prototypes
 // *****************************************************************************
@@ -62,6 +111,35 @@ typedef struct fossil_tofu_mapof_t {
  */
 fossil_tofu_mapof_t* fossil_tofu_mapof_create_container(char* key_type, char* value_type);
 
+/**
+ * @brief Create a new ordered map container.
+ *
+ * The keys are kept in a B-tree sorted with fossil_tofu_compare, so numeric
+ * and datetime keys sort by value rather than by text. Ordered maps support
+ * the range functions below; lookups are O(log n).
+ *
+ * @param key_type The type of the keys.
+ * @param value_type The type of the values.
+ * @return A pointer to the newly created map container.
+ */
+fossil_tofu_mapof_t* fossil_tofu_mapof_create_ordered(char* key_type, char* value_type);
+
+/**
+ * @brief Create a new insertion-ordered map container.
+ *
+ * Entries are stored in one dense array in the order their keys were first
+ * inserted, behind a hash index of 32-bit entry numbers. Iteration, first
+ * and last follow insertion order and walk contiguous memory. Lookups are
+ * O(1) expected, like hashed maps. Removing a key leaves a hole that the
+ * next growth compacts. Pointers into the map are invalidated by inserts
+ * of new keys.
+ *
+ * @param key_type The type of the keys.
+ * @param value_type The type of the values.
+ * @return A pointer to the newly created map container.
+ */
+fossil_tofu_mapof_t* fossil_tofu_mapof_create_insertion_ordered(char* key_type, char* value_type);
+
 /**
  * @brief Create a new map container with default key and value types.
  *
@@ -95,21 +173,43 @@ void fossil_tofu_mapof_destroy(fossil_tofu_mapof_t* map);
 /**
  * @brief Insert a key-value pair into the map.
  *
+ * Inserting a key that is already present shadows the previous value:
+ * `get` returns the newest one and `remove` uncovers the older one again.
+ *
  * @param map The map container.
  * @param key The key to insert.
  * @param value The value to insert.
  * @return 0 on success, non-zero on failure.
- * @note Time complexity: O(n)
+ * @note Time complexity: O(1) expected, amortized over table growth;
+ *       O(log n) for ordered maps
  */
 int32_t fossil_tofu_mapof_insert(fossil_tofu_mapof_t* map, char *key, char *value);
 
+/**
+ * @brief Insert a batch of key-value pairs.
+ *
+ * Same as calling fossil_tofu_mapof_insert for each pair in order, but the
+ * table grows once for the whole batch and the buckets are prefetched
+ * ahead of the inserts.
+ *
+ * @param map The map container.
+ * @param keys The keys to insert.
+ * @param values The values, one per key.
+ * @param n Number of pairs.
+ * @return 0 on success, non-zero on failure. A NULL key or value fails the
+ *         call before anything is inserted; if memory runs out part way,
+ *         the pairs before the failing one stay inserted.
+ * @note Time complexity: O(n) expected; O(n log m) for ordered maps
+ */
+int32_t fossil_tofu_mapof_insert_many(fossil_tofu_mapof_t* map, char* const keys[], char* const values[], size_t n);
+
 /**
  * @brief Remove a key-value pair from the map.
  *
  * @param map The map container.
  * @param key The key to remove.
  * @return 0 on success, non-zero on failure.
- * @note Time complexity: O(n)
+ * @note Time complexity: O(1) expected; O(log n) for ordered maps
  */
 int32_t fossil_tofu_mapof_remove(fossil_tofu_mapof_t* map, char *key);
 
@@ -119,7 +219,7 @@ int32_t fossil_tofu_mapof_remove(fossil_tofu_mapof_t* map, char *key);
  * @param map The map container.
  * @param key The key to check.
  * @return True if the key is found, false otherwise.
- * @note Time complexity: O(n)
+ * @note Time complexity: O(1) expected; O(log n) for ordered maps
  */
 bool fossil_tofu_mapof_contains(const fossil_tofu_mapof_t* map, char *key);
 
@@ -129,10 +229,69 @@ bool fossil_tofu_mapof_contains(const fossil_tofu_mapof_t* map, char *key);
  * @param map The map container.
  * @param key The key to look up.
  * @return The value associated with the key.
- * @note Time complexity: O(n)
+ * @note Time complexity: O(1) expected; O(log n) for ordered maps
  */
 fossil_tofu_t fossil_tofu_mapof_get(const fossil_tofu_mapof_t* map, char *key);
 
+/**
+ * @brief Look up a batch of keys in one call.
+ *
+ * All keys in a batch are hashed and their buckets prefetched before any of
+ * them is probed, so the cache misses overlap instead of being paid one
+ * after another. Worth it for tens of keys or more against a large table.
+ *
+ * @param map The map container.
+ * @param keys The keys to look up; NULL entries are treated as absent.
+ * @param n Number of keys.
+ * @param out Receives the value for each key, as fossil_tofu_mapof_get
+ *            would return it, or a zeroed tofu when the key is absent.
+ * @return The number of keys found.
+ * @note Time complexity: O(n) expected; O(n log m) for ordered maps
+ */
+size_t fossil_tofu_mapof_get_many(const fossil_tofu_mapof_t* map, char* const keys[], size_t n, fossil_tofu_t out[]);
+
+/**
+ * @brief Look up a key given as borrowed text, without allocating.
+ *
+ * The key is hashed and compared in place against the stored keys, so
+ * `key` need not be NUL-terminated. Numeric keys match by value, as
+ * fossil_tofu_compare orders them ("7" and "07" are the same i32 key);
+ * other keys, and text that is not entirely a number, match exactly.
+ * Numeric key text of FOSSIL_TOFU_KEY_TEXT_MAX bytes or more is not parsed:
+ * hashed maps match it exactly and ordered maps never find it.
+ *
+ * @param map The map container.
+ * @param key The key text.
+ * @param len Length of the key text in bytes.
+ * @return Pointer to the stored value, or NULL if the key is absent. The
+ *         pointer is valid until the key is next modified.
+ * @note Time complexity: O(1) expected; O(log n) for ordered maps
+ */
+const fossil_tofu_t* fossil_tofu_mapof_find(const fossil_tofu_mapof_t* map, const char* key, size_t len);
+
+/**
+ * @brief Look up an integer key without allocating.
+ *
+ * The key is formatted in decimal on the stack and looked up as text.
+ *
+ * @param map The map container.
+ * @param key The integer key.
+ * @return Pointer to the stored value, or NULL if the key is absent.
+ * @note Time complexity: O(1) expected
+ */
+const fossil_tofu_t* fossil_tofu_mapof_find_i64(const fossil_tofu_mapof_t* map, int64_t key);
+
+/**
+ * @brief Check for a key given as borrowed text, without allocating.
+ *
+ * @param map The map container.
+ * @param key The key text.
+ * @param len Length of the key text in bytes.
+ * @return True if the key is found, false otherwise.
+ * @note Time complexity: O(1) expected
+ */
+bool fossil_tofu_mapof_contains_key(const fossil_tofu_mapof_t* map, const char* key, size_t len);
+
 /**
  * @brief Set the value associated with a key in the map.
  *
@@ -140,10 +299,161 @@ fossil_tofu_t fossil_tofu_mapof_get(const fossil_tofu_mapof_t* map, char *key);
  * @param key The key to set.
  * @param value The value to set.
  * @return 0 on success, non-zero on failure.
- * @note Time complexity: O(n)
+ * @note Time complexity: O(1) expected; O(log n) for ordered maps
  */
 int32_t fossil_tofu_mapof_set(fossil_tofu_mapof_t* map, char *key, char *value);
 
+/**
+ * @brief Grow the hash table so it can hold at least `keys` distinct keys
+ * without rehashing. Ordered maps have no table; this is a no-op for them.
+ *
+ * @param map The map container.
+ * @param keys The number of distinct keys to make room for.
+ * @return FOSSIL_TOFU_SUCCESS, or an error code on allocation failure.
+ * @note Time complexity: O(n)
+ */
+int32_t fossil_tofu_mapof_reserve(fossil_tofu_mapof_t* map, size_t keys);
+
+/**
+ * @brief Get the number of slots in the hash table.
+ *
+ * @param map The map container.
+ * @return The slot count, zero before the first insert.
+ * @note Time complexity: O(1)
+ */
+size_t fossil_tofu_mapof_capacity(const fossil_tofu_mapof_t* map);
+
+/**
+ * @brief Put a Bloom filter in front of the hash table of a hashed map.
+ *
+ * Lookups test the filter before probing, so most misses return without
+ * touching the slots. The filter is kept up to date by inserts and rebuilt
+ * whenever the table grows; removed keys linger in it until then, which
+ * only costs an extra probe. Attaching again rebuilds the filter.
+ *
+ * @param map The hashed map container.
+ * @param bits_per_key Filter bits per slot; 0 selects FOSSIL_TOFU_BLOOM_BITS_PER_KEY.
+ * @return 0 on success, FOSSIL_TOFU_ERROR_UNSUPPORTED for other modes, or
+ *         another error code on failure.
+ * @note Time complexity: O(n)
+ */
+int32_t fossil_tofu_mapof_attach_filter(fossil_tofu_mapof_t* map, size_t bits_per_key);
+
+/**
+ * @brief Drop the map's Bloom filter, if any.
+ *
+ * @param map The map container.
+ * @note Time complexity: O(1)
+ */
+void fossil_tofu_mapof_detach_filter(fossil_tofu_mapof_t* map);
+
+/**
+ * @brief Check whether the map has a Bloom filter attached.
+ *
+ * @param map The map container.
+ * @return True if a filter is attached.
+ * @note Time complexity: O(1)
+ */
+bool fossil_tofu_mapof_has_filter(const fossil_tofu_mapof_t* map);
+
+/**
+ * @brief Check whether the map keeps its keys in sorted order.
+ *
+ * @param map The map container.
+ * @return True for maps created with fossil_tofu_mapof_create_ordered.
+ * @note Time complexity: O(1)
+ */
+bool fossil_tofu_mapof_is_ordered(const fossil_tofu_mapof_t* map);
+
+/**
+ * @brief Get the storage layout the map was created with.
+ *
+ * @param map The map container.
+ * @return The map's mode; FOSSIL_TOFU_MAPOF_HASHED for NULL.
+ * @note Time complexity: O(1)
+ */
+fossil_tofu_mapof_mode_t fossil_tofu_mapof_get_mode(const fossil_tofu_mapof_t* map);
+
+/**
+ * @brief Visit every key with its newest value.
+ *
+ * Ordered maps are visited in ascending key order, insertion-ordered maps
+ * in the order keys were first inserted, and hashed maps in table order.
+ *
+ * @param map The map container.
+ * @param visit Called for each key; returning false stops the walk.
+ * @param context Passed through to the visitor.
+ * @return The number of keys visited.
+ * @note Time complexity: O(n)
+ */
+size_t fossil_tofu_mapof_for_each(const fossil_tofu_mapof_t* map, fossil_tofu_mapof_visit_fn visit, void* context);
+
+/**
+ * @brief Visit the keys in [begin, end) in ascending order.
+ *
+ * @param map The ordered map container.
+ * @param begin Inclusive lower bound, or NULL for no lower bound.
+ * @param end Exclusive upper bound, or NULL for no upper bound.
+ * @param visit Called for each key; returning false stops the walk.
+ * @param context Passed through to the visitor.
+ * @return The number of keys visited; 0 for hashed maps.
+ * @note Time complexity: O(log n + k) for k visited keys
+ */
+size_t fossil_tofu_mapof_range(const fossil_tofu_mapof_t* map, char* begin, char* end, fossil_tofu_mapof_visit_fn visit, void* context);
+
+/**
+ * @brief Find the first entry whose key is not less than `key`.
+ *
+ * @param map The ordered map container.
+ * @param key The key to search for.
+ * @return The entry, or NULL if every key is smaller or the map is hashed.
+ *         Read `key` and `value` from it; `next` is internal.
+ * @note Time complexity: O(log n)
+ */
+const fossil_tofu_mapof_node_t* fossil_tofu_mapof_lower_bound(const fossil_tofu_mapof_t* map, char* key);
+
+/**
+ * @brief Find the entry with the smallest key that is greater than or equal
+ * to `key`. This is the same entry as fossil_tofu_mapof_lower_bound.
+ *
+ * @param map The ordered map container.
+ * @param key The key to search for.
+ * @return The entry, or NULL if there is none.
+ * @note Time complexity: O(log n)
+ */
+const fossil_tofu_mapof_node_t* fossil_tofu_mapof_ceiling(const fossil_tofu_mapof_t* map, char* key);
+
+/**
+ * @brief Find the entry with the largest key that is less than or equal to
+ * `key`.
+ *
+ * @param map The ordered map container.
+ * @param key The key to search for.
+ * @return The entry, or NULL if there is none.
+ * @note Time complexity: O(log n)
+ */
+const fossil_tofu_mapof_node_t* fossil_tofu_mapof_floor(const fossil_tofu_mapof_t* map, char* key);
+
+/**
+ * @brief Get the entry with the smallest key, or for insertion-ordered
+ * maps the oldest key.
+ *
+ * @param map The ordered or insertion-ordered map container.
+ * @return The entry, or NULL if the map is empty or hashed.
+ * @note Time complexity: O(log n); O(1) for insertion order, plus any holes left by removals
+ */
+const fossil_tofu_mapof_node_t* fossil_tofu_mapof_first(const fossil_tofu_mapof_t* map);
+
+/**
+ * @brief Get the entry with the largest key, or for insertion-ordered
+ * maps the newest key.
+ *
+ * @param map The ordered or insertion-ordered map container.
+ * @return The entry, or NULL if the map is empty or hashed.
+ * @note Time complexity: O(log n); O(1) for insertion order, plus any holes left by removals
+ */
+const fossil_tofu_mapof_node_t* fossil_tofu_mapof_last(const fossil_tofu_mapof_t* map);
+
 /**
  * @brief Get the number of elements in the map.
  *
@@ -174,6 +484,8 @@ bool fossil_tofu_mapof_is_empty(const fossil_tofu_mapof_t* map);
 #ifdef __cplusplus
 }
 #include <stdexcept>
+#include <string>
+#include <vector>
 
 namespace fossil {
 
@@ -207,6 +519,36 @@ namespace fossil {
                 }
             }
 
+            /**
+             * @brief Create an ordered map whose keys are kept sorted in a B-tree.
+             *
+             * @param key_type The type of the keys.
+             * @param value_type The type of the values.
+             * @return The created map.
+             */
+            static MapOf ordered(const std::string& key_type, const std::string& value_type) {
+                fossil_tofu_mapof_t* raw = fossil_tofu_mapof_create_ordered(const_cast<char*>(key_type.c_str()), const_cast<char*>(value_type.c_str()));
+                if (raw == nullptr) {
+                    throw std::runtime_error("Failed to create map container");
+                }
+                return MapOf(raw);
+            }
+
+            /**
+             * @brief Create a map that remembers the order its keys were inserted in.
+             *
+             * @param key_type The type of the keys.
+             * @param value_type The type of the values.
+             * @return The created map.
+             */
+            static MapOf insertion_ordered(const std::string& key_type, const std::string& value_type) {
+                fossil_tofu_mapof_t* raw = fossil_tofu_mapof_create_insertion_ordered(const_cast<char*>(key_type.c_str()), const_cast<char*>(value_type.c_str()));
+                if (raw == nullptr) {
+                    throw std::runtime_error("Failed to create map container");
+                }
+                return MapOf(raw);
+            }
+
             /**
              * @brief Construct a new MapOf object by copying an existing MapOf object.
              *
@@ -249,6 +591,23 @@ namespace fossil {
                 return fossil_tofu_mapof_insert(map, const_cast<char*>(key.c_str()), const_cast<char*>(value.c_str()));
             }
 
+            /**
+             * @brief Insert a batch of key-value pairs.
+             *
+             * @param pairs The pairs to insert, in order.
+             * @return 0 on success, non-zero on failure.
+             */
+            int32_t insert_many(const std::vector<std::pair<std::string, std::string>>& pairs) {
+                std::vector<char*> keys, values;
+                keys.reserve(pairs.size());
+                values.reserve(pairs.size());
+                for (const auto& pair : pairs) {
+                    keys.push_back(const_cast<char*>(pair.first.c_str()));
+                    values.push_back(const_cast<char*>(pair.second.c_str()));
+                }
+                return fossil_tofu_mapof_insert_many(map, keys.data(), values.data(), pairs.size());
+            }
+
             /**
              * @brief Remove a key-value pair from the map.
              *
@@ -279,6 +638,41 @@ namespace fossil {
                 return fossil_tofu_mapof_get(map, const_cast<char*>(key.c_str()));
             }
 
+            /**
+             * @brief Look up a batch of keys with their buckets prefetched.
+             *
+             * @param keys The keys to look up.
+             * @return One value per key, zeroed where the key is absent.
+             */
+            std::vector<fossil_tofu_t> get_many(const std::vector<std::string>& keys) const {
+                std::vector<char*> raw;
+                raw.reserve(keys.size());
+                for (const auto& key : keys) raw.push_back(const_cast<char*>(key.c_str()));
+                std::vector<fossil_tofu_t> out(keys.size());
+                fossil_tofu_mapof_get_many(map, raw.data(), raw.size(), out.data());
+                return out;
+            }
+
+            /**
+             * @brief Look up a key without allocating.
+             *
+             * @param key The key to look up.
+             * @return Pointer to the stored value, or nullptr if absent.
+             */
+            const fossil_tofu_t* find(const std::string& key) const {
+                return fossil_tofu_mapof_find(map, key.data(), key.size());
+            }
+
+            /**
+             * @brief Look up an integer key without allocating.
+             *
+             * @param key The key to look up.
+             * @return Pointer to the stored value, or nullptr if absent.
+             */
+            const fossil_tofu_t* find(int64_t key) const {
+                return fossil_tofu_mapof_find_i64(map, key);
+            }
+
             /**
              * @brief Set the value associated with a key in the map.
              *
@@ -290,6 +684,53 @@ namespace fossil {
                 return fossil_tofu_mapof_set(map, const_cast<char*>(key.c_str()), const_cast<char*>(value.c_str()));
             }
 
+            /**
+             * @brief Grow the hash table to hold at least `keys` distinct keys.
+             *
+             * @param keys The number of distinct keys to make room for.
+             */
+            void reserve(size_t keys) {
+                if (fossil_tofu_mapof_reserve(map, keys) != FOSSIL_TOFU_SUCCESS) {
+                    throw std::runtime_error("Failed to reserve map capacity");
+                }
+            }
+
+            /**
+             * @brief Put a Bloom filter in front of the hash table.
+             *
+             * @param bits_per_key Filter bits per slot; 0 selects the default.
+             */
+            void attach_filter(size_t bits_per_key = 0) {
+                if (fossil_tofu_mapof_attach_filter(map, bits_per_key) != FOSSIL_TOFU_SUCCESS) {
+                    throw std::runtime_error("Failed to attach map filter");
+                }
+            }
+
+            /**
+             * @brief Drop the Bloom filter, if any.
+             */
+            void detach_filter() {
+                fossil_tofu_mapof_detach_filter(map);
+            }
+
+            /**
+             * @brief Check whether a Bloom filter is attached.
+             *
+             * @return True if a filter is attached.
+             */
+            bool has_filter() const {
+                return fossil_tofu_mapof_has_filter(map);
+            }
+
+            /**
+             * @brief Get the number of slots in the hash table.
+             *
+             * @return The slot count.
+             */
+            size_t capacity() {
+                return fossil_tofu_mapof_capacity(map);
+            }
+
             /**
              * @brief Get the number of elements in the map.
              *
@@ -317,7 +758,106 @@ namespace fossil {
                 return fossil_tofu_mapof_is_empty(map);
             }
 
+            /**
+             * @brief Check whether the map keeps its keys sorted.
+             *
+             * @return True for ordered maps.
+             */
+            bool is_ordered() const {
+                return fossil_tofu_mapof_is_ordered(map);
+            }
+
+            /**
+             * @brief Get the storage layout of the map.
+             *
+             * @return The map's mode.
+             */
+            fossil_tofu_mapof_mode_t mode() const {
+                return fossil_tofu_mapof_get_mode(map);
+            }
+
+            /**
+             * @brief Get the entry with the smallest key (ordered maps), or the oldest key (insertion-ordered maps).
+             *
+             * @return The entry, or nullptr if there is none.
+             */
+            const fossil_tofu_mapof_node_t* first() const {
+                return fossil_tofu_mapof_first(map);
+            }
+
+            /**
+             * @brief Get the entry with the largest key (ordered maps), or the newest key (insertion-ordered maps).
+             *
+             * @return The entry, or nullptr if there is none.
+             */
+            const fossil_tofu_mapof_node_t* last() const {
+                return fossil_tofu_mapof_last(map);
+            }
+
+            /**
+             * @brief Find the first entry whose key is not less than `key` (ordered maps).
+             *
+             * @param key The key to search for.
+             * @return The entry, or nullptr if there is none.
+             */
+            const fossil_tofu_mapof_node_t* lower_bound(const std::string& key) const {
+                return fossil_tofu_mapof_lower_bound(map, const_cast<char*>(key.c_str()));
+            }
+
+            /**
+             * @brief Find the entry with the smallest key >= `key` (ordered maps).
+             *
+             * @param key The key to search for.
+             * @return The entry, or nullptr if there is none.
+             */
+            const fossil_tofu_mapof_node_t* ceiling(const std::string& key) const {
+                return fossil_tofu_mapof_ceiling(map, const_cast<char*>(key.c_str()));
+            }
+
+            /**
+             * @brief Find the entry with the largest key <= `key` (ordered maps).
+             *
+             * @param key The key to search for.
+             * @return The entry, or nullptr if there is none.
+             */
+            const fossil_tofu_mapof_node_t* floor(const std::string& key) const {
+                return fossil_tofu_mapof_floor(map, const_cast<char*>(key.c_str()));
+            }
+
+            /**
+             * @brief Call a function for every key with its newest value.
+             *
+             * @param fn Callable taking (const fossil_tofu_t& key, const fossil_tofu_t& value).
+             * @return The number of keys visited.
+             */
+            template <typename F>
+            size_t for_each(F fn) const {
+                return fossil_tofu_mapof_for_each(map, &MapOf::visit_trampoline<F>, &fn);
+            }
+
+            /**
+             * @brief Call a function for the keys in [begin, end), in order (ordered maps).
+             *
+             * @param begin Inclusive lower bound.
+             * @param end Exclusive upper bound.
+             * @param fn Callable taking (const fossil_tofu_t& key, const fossil_tofu_t& value).
+             * @return The number of keys visited.
+             */
+            template <typename F>
+            size_t range(const std::string& begin, const std::string& end, F fn) const {
+                return fossil_tofu_mapof_range(map, const_cast<char*>(begin.c_str()), const_cast<char*>(end.c_str()),
+                                               &MapOf::visit_trampoline<F>, &fn);
+            }
+
         private:
+            explicit MapOf(fossil_tofu_mapof_t* raw) : map(raw) {}
+
+            template <typename F>
+            static bool visit_trampoline(const fossil_tofu_t* key, const fossil_tofu_t* value, void* context) {
+                (*static_cast<F*>(context))(*key, *value);
+                return true;
+            }
+
             fossil_tofu_mapof_t* map; ///< Pointer to the underlying C map structure.
         };
 
@@ -0,0 +1,393 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef FOSSIL_TOFU_MPMCQ_H
+#define FOSSIL_TOFU_MPMCQ_H
+
+#include "tofu.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// *****************************************************************************
+// Type definitions
+// *****************************************************************************
+
+// Ring cell (sequence number plus tofu) and the padded producer/consumer
+// positions; both defined in mpmcq.c.
+typedef struct fossil_tofu_mpmcq_cell_t fossil_tofu_mpmcq_cell_t;
+typedef struct fossil_tofu_mpmcq_ring_t fossil_tofu_mpmcq_ring_t;
+
+// Bounded multi-producer/multi-consumer queue after Dmitry Vyukov's design:
+// every cell carries a sequence number that tells producers and consumers
+// whether it is free or published for the current lap, so each operation
+// costs one CAS on the shared position and no locks. Capacity is rounded up
+// to a power of two. Every function below is thread-safe except
+// create_container, destroy and get_front.
+typedef struct fossil_tofu_mpmcq_t {
+    char* type;
+    fossil_tofu_mpmcq_cell_t* cells;
+    size_t capacity;
+    size_t mask;
+    fossil_tofu_mpmcq_ring_t* ring;
+} fossil_tofu_mpmcq_t;
+
+// *****************************************************************************
+// Function prototypes
+// *****************************************************************************
+
+/**
+ * Create a new multi-producer/multi-consumer queue.
+ *
+ * @param type     The type of data the queue will store.
+ * @param capacity Minimum number of elements, rounded up to a power of two.
+ * @return         The new queue, or NULL on failure or zero capacity.
+ * @note           Time complexity: O(capacity)
+ */
+fossil_tofu_mpmcq_t* fossil_tofu_mpmcq_create_container(char* type, size_t capacity);
+
+/**
+ * Destroy the queue and any elements left in it.
+ *
+ * @param queue The queue to destroy.
+ * @note        Time complexity: O(capacity)
+ */
+void fossil_tofu_mpmcq_destroy(fossil_tofu_mpmcq_t* queue);
+
+// *****************************************************************************
+// Utility functions
+// *****************************************************************************
+
+/**
+ * Insert data into the queue, waiting while it is full.
+ *
+ * @param queue The queue to insert data into.
+ * @param data  The data to insert.
+ * @return      FOSSIL_TOFU_SUCCESS or a negative error code.
+ * @note        Time complexity: O(1) when a slot is free
+ * @details     Yields the CPU between attempts; use try_insert to fail fast.
+ */
+int32_t fossil_tofu_mpmcq_insert(fossil_tofu_mpmcq_t* queue, char* data);
+
+/**
+ * Insert data into the queue without waiting.
+ *
+ * @param queue The queue to insert data into.
+ * @param data  The data to insert.
+ * @return      FOSSIL_TOFU_SUCCESS, FOSSIL_TOFU_FAILURE if full, or a negative error code.
+ * @note        Time complexity: O(1)
+ */
+int32_t fossil_tofu_mpmcq_try_insert(fossil_tofu_mpmcq_t* queue, char* data);
+
+/**
+ * Insert up to 'count' strings without waiting.
+ *
+ * @param queue The queue to insert data into.
+ * @param data  Strings to insert in order.
+ * @param count Number of entries in 'data'.
+ * @return      Number of elements inserted; fewer than 'count' when the queue fills.
+ * @note        Time complexity: O(count)
+ * @details     Free cells are claimed in runs with one CAS per run instead of
+ *              one per element. Elements keep their order relative to each other.
+ */
+size_t fossil_tofu_mpmcq_insert_batch(fossil_tofu_mpmcq_t* queue, char* const data[], size_t count);
+
+/**
+ * Remove and discard the front element.
+ *
+ * @param queue The queue to remove data from.
+ * @return      FOSSIL_TOFU_SUCCESS, or FOSSIL_TOFU_FAILURE if empty.
+ * @note        Time complexity: O(1)
+ */
+int32_t fossil_tofu_mpmcq_remove(fossil_tofu_mpmcq_t* queue);
+
+/**
+ * Move the front element out of the queue, waiting while it is empty.
+ *
+ * @param queue The queue to take from.
+ * @param out   Receives the tofu; the caller must fossil_tofu_destroy it.
+ * @return      FOSSIL_TOFU_SUCCESS or FOSSIL_TOFU_ERROR_INVALID_ARGUMENT.
+ * @note        Time complexity: O(1) when an element is ready
+ */
+int32_t fossil_tofu_mpmcq_take(fossil_tofu_mpmcq_t* queue, fossil_tofu_t* out);
+
+/**
+ * Move the front element out of the queue without waiting.
+ *
+ * @param queue The queue to take from.
+ * @param out   Receives the tofu; the caller must fossil_tofu_destroy it.
+ * @return      FOSSIL_TOFU_SUCCESS, FOSSIL_TOFU_FAILURE if empty, or
+ *              FOSSIL_TOFU_ERROR_INVALID_ARGUMENT.
+ * @note        Time complexity: O(1)
+ */
+int32_t fossil_tofu_mpmcq_try_take(fossil_tofu_mpmcq_t* queue, fossil_tofu_t* out);
+
+/**
+ * Move up to 'max' ready elements out with one claim on the consumer position.
+ *
+ * @param queue The queue to take from.
+ * @param out   Array of at least 'max' tofus; filled entries must be destroyed by the caller.
+ * @param max   Maximum number of elements to take.
+ * @return      Number of elements taken, in queue order.
+ * @note        Time complexity: O(max)
+ */
+size_t fossil_tofu_mpmcq_take_batch(fossil_tofu_mpmcq_t* queue, fossil_tofu_t out[], size_t max);
+
+/**
+ * Get the number of elements in the queue.
+ *
+ * @param queue The queue for which to get the size.
+ * @return      The element count, or 0 for NULL.
+ * @note        Time complexity: O(1)
+ * @details     A snapshot while other threads are active.
+ */
+size_t fossil_tofu_mpmcq_size(const fossil_tofu_mpmcq_t* queue);
+
+/**
+ * Get the capacity of the queue.
+ *
+ * @param queue The queue.
+ * @return      The power-of-two capacity, or 0 for NULL.
+ * @note        Time complexity: O(1)
+ */
+size_t fossil_tofu_mpmcq_capacity(const fossil_tofu_mpmcq_t* queue);
+
+/**
+ * Check if the queue is not empty.
+ *
+ * @param queue The queue to check.
+ * @return      True if the queue holds at least one element.
+ * @note        Time complexity: O(1)
+ */
+bool fossil_tofu_mpmcq_not_empty(const fossil_tofu_mpmcq_t* queue);
+
+/**
+ * Check if the queue is not a null pointer.
+ *
+ * @param queue The queue to check.
+ * @return      True if the queue pointer is valid.
+ * @note        Time complexity: O(1)
+ */
+bool fossil_tofu_mpmcq_not_cnullptr(const fossil_tofu_mpmcq_t* queue);
+
+/**
+ * Check if the queue is empty.
+ *
+ * @param queue The queue to check.
+ * @return      True if the queue holds no elements or is NULL.
+ * @note        Time complexity: O(1)
+ */
+bool fossil_tofu_mpmcq_is_empty(const fossil_tofu_mpmcq_t* queue);
+
+/**
+ * Check if the queue is a null pointer.
+ *
+ * @param queue The queue to check.
+ * @return      True if the queue pointer is NULL.
+ * @note        Time complexity: O(1)
+ */
+bool fossil_tofu_mpmcq_is_cnullptr(const fossil_tofu_mpmcq_t* queue);
+
+// *****************************************************************************
+// Getter and setter functions
+// *****************************************************************************
+
+/**
+ * Get the element at the front of the queue.
+ *
+ * @param queue The queue from which to get the front element.
+ * @return      The front value, or NULL if the queue is empty.
+ * @note        Time complexity: O(1)
+ * @details     Not thread-safe: another consumer could free the element while
+ *              it is being read. Use it only while no other thread removes.
+ */
+char* fossil_tofu_mpmcq_get_front(const fossil_tofu_mpmcq_t* queue);
+
+#ifdef __cplusplus
+}
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace fossil {
+
+    namespace tofu {
+
+        /**
+         * @class MPMCQueue
+         * @brief C++ wrapper for the lock-free multi-producer/multi-consumer queue.
+         */
+        class MPMCQueue {
+        public:
+            /**
+             * @brief Create a queue holding at least 'capacity' elements.
+             *
+             * @param type     The type of data the queue will store.
+             * @param capacity Minimum capacity, rounded up to a power of two.
+             * @throws std::runtime_error If the queue creation fails.
+             */
+            MPMCQueue(const std::string& type, size_t capacity) {
+                queue = fossil_tofu_mpmcq_create_container(const_cast<char*>(type.c_str()), capacity);
+                if (queue == nullptr) {
+                    throw std::runtime_error("Failed to create MPMC queue.");
+                }
+            }
+
+            MPMCQueue(const MPMCQueue&) = delete;
+            MPMCQueue& operator=(const MPMCQueue&) = delete;
+
+            /**
+             * @brief Destroy the queue and any elements left in it.
+             */
+            ~MPMCQueue() {
+                fossil_tofu_mpmcq_destroy(queue);
+            }
+
+            /**
+             * @brief Insert data, waiting while the queue is full.
+             */
+            int32_t insert(const std::string& data) {
+                return fossil_tofu_mpmcq_insert(queue, const_cast<char*>(data.c_str()));
+            }
+
+            /**
+             * @brief Insert data without waiting.
+             *
+             * @return 0 on success, FOSSIL_TOFU_FAILURE if full.
+             */
+            int32_t try_insert(const std::string& data) {
+                return fossil_tofu_mpmcq_try_insert(queue, const_cast<char*>(data.c_str()));
+            }
+
+            /**
+             * @brief Insert a contiguous batch without waiting.
+             *
+             * @return Number of values inserted.
+             */
+            size_t insert_batch(const std::vector<std::string>& data) {
+                std::vector<char*> raw;
+                raw.reserve(data.size());
+                for (const std::string& item : data) {
+                    raw.push_back(const_cast<char*>(item.c_str()));
+                }
+                return fossil_tofu_mpmcq_insert_batch(queue, raw.data(), raw.size());
+            }
+
+            /**
+             * @brief Remove the front element.
+             *
+             * @return 0 on success, FOSSIL_TOFU_FAILURE if empty.
+             */
+            int32_t remove() {
+                return fossil_tofu_mpmcq_remove(queue);
+            }
+
+            /**
+             * @brief Take the front element, waiting while the queue is empty.
+             */
+            std::string take() {
+                fossil_tofu_t tofu;
+                if (fossil_tofu_mpmcq_take(queue, &tofu) != FOSSIL_TOFU_SUCCESS) {
+                    throw std::runtime_error("Failed to take from MPMC queue.");
+                }
+                std::string result(tofu.value.data);
+                fossil_tofu_destroy(&tofu);
+                return result;
+            }
+
+            /**
+             * @brief Take the front element without waiting.
+             *
+             * @param out Receives the value.
+             * @return True if an element was taken.
+             */
+            bool try_take(std::string& out) {
+                fossil_tofu_t tofu;
+                if (fossil_tofu_mpmcq_try_take(queue, &tofu) != FOSSIL_TOFU_SUCCESS) {
+                    return false;
+                }
+                out = tofu.value.data;
+                fossil_tofu_destroy(&tofu);
+                return true;
+            }
+
+            /**
+             * @brief Take up to 'max' elements without waiting.
+             *
+             * @param out Vector the values are appended to.
+             * @param max Maximum number of elements to take.
+             * @return Number of elements taken.
+             */
+            size_t take_batch(std::vector<std::string>& out, size_t max) {
+                std::vector<fossil_tofu_t> tofus(max);
+                size_t taken = fossil_tofu_mpmcq_take_batch(queue, tofus.data(), max);
+                for (size_t i = 0; i < taken; i++) {
+                    out.emplace_back(tofus[i].value.data);
+                    fossil_tofu_destroy(&tofus[i]);
+                }
+                return taken;
+            }
+
+            /**
+             * @brief Get the front element; only safe while no other thread removes.
+             */
+            std::string get_front() const {
+                char* result = fossil_tofu_mpmcq_get_front(queue);
+                return result ? std::string(result) : std::string();
+            }
+
+            /**
+             * @brief Get the number of elements in the queue.
+             */
+            size_t size() const {
+                return fossil_tofu_mpmcq_size(queue);
+            }
+
+            /**
+             * @brief Get the power-of-two capacity of the queue.
+             */
+            size_t capacity() const {
+                return fossil_tofu_mpmcq_capacity(queue);
+            }
+
+            /**
+             * @brief Check if the queue is empty.
+             */
+            bool is_empty() const {
+                return fossil_tofu_mpmcq_is_empty(queue);
+            }
+
+        private:
+            fossil_tofu_mpmcq_t* queue;
+        };
+
+    } // namespace tofu
+
+} // namespace fossil
+
+#endif
+
+#endif /* FOSSIL_TOFU_FRAMEWORK_H */
@@ -0,0 +1,436 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef FOSSIL_TOFU_MULTIMAP_H
+#define FOSSIL_TOFU_MULTIMAP_H
+
+#include "hashtable.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// *****************************************************************************
+// Type definitions
+// *****************************************************************************
+
+#define FOSSIL_TOFU_MULTIMAP_MIN_SLOTS 16
+#define FOSSIL_TOFU_MULTIMAP_LOAD_NUM  7   // grow once the table is 7/8 full
+#define FOSSIL_TOFU_MULTIMAP_LOAD_DEN  8
+
+// One entry per distinct key. Its values sit in one contiguous array in
+// insertion order, so a single probe yields all of them.
+typedef struct fossil_tofu_multimap_entry_t {
+    fossil_tofu_t key;
+    fossil_tofu_t* values;
+    size_t count;    // Values in use
+    size_t capacity; // Values allocated
+} fossil_tofu_multimap_entry_t;
+
+typedef struct fossil_tofu_multimap_t {
+    char* key_type;
+    char* value_type;
+    fossil_tofu_hashtable_t table;      // One entry per distinct key
+    size_t size;                        // Number of values over all keys
+} fossil_tofu_multimap_t;
+
+// Visitor for iteration; receives every value of a key at once. Return
+// false to stop early.
+typedef bool (*fossil_tofu_multimap_visit_fn)(const fossil_tofu_t* key, const fossil_tofu_t* values, size_t count, void* context);
+
+// *****************************************************************************
+// Function prototypes
+// *****************************************************************************
+
+/**
+ * @brief Create a new multimap with specified key and value types.
+ *
+ * @param key_type The type of the keys.
+ * @param value_type The type of the values.
+ * @return A pointer to the newly created multimap, or NULL on failure.
+ */
+fossil_tofu_multimap_t* fossil_tofu_multimap_create_container(char* key_type, char* value_type);
+
+/**
+ * @brief Create a new multimap with default key and value types.
+ *
+ * @return A pointer to the newly created multimap, or NULL on failure.
+ */
+fossil_tofu_multimap_t* fossil_tofu_multimap_create_default(void);
+
+/**
+ * @brief Create a copy of an existing multimap.
+ *
+ * @param other The multimap to copy.
+ * @return A pointer to the newly created multimap, or NULL on failure.
+ * @note Time complexity: O(n)
+ */
+fossil_tofu_multimap_t* fossil_tofu_multimap_create_copy(const fossil_tofu_multimap_t* other);
+
+/**
+ * @brief Create a new multimap by taking over the contents of another.
+ *
+ * @param other The multimap to move from; left empty.
+ * @return A pointer to the newly created multimap, or NULL on failure.
+ * @note Time complexity: O(1)
+ */
+fossil_tofu_multimap_t* fossil_tofu_multimap_create_move(fossil_tofu_multimap_t* other);
+
+/**
+ * @brief Destroy a multimap and free all of its values.
+ *
+ * @param map The multimap to destroy.
+ */
+void fossil_tofu_multimap_destroy(fossil_tofu_multimap_t* map);
+
+/**
+ * @brief Append a value to the values of a key.
+ *
+ * @param map The multimap.
+ * @param key The key.
+ * @param value The value to append.
+ * @return 0 on success, non-zero on failure.
+ * @note Time complexity: O(1) amortized
+ */
+int32_t fossil_tofu_multimap_insert(fossil_tofu_multimap_t* map, char *key, char *value);
+
+/**
+ * @brief Remove a key together with all of its values.
+ *
+ * @param map The multimap.
+ * @param key The key to remove.
+ * @return 0 on success, FOSSIL_TOFU_ERROR_NOT_FOUND if the key is absent.
+ * @note Time complexity: O(k) for k values
+ */
+int32_t fossil_tofu_multimap_remove(fossil_tofu_multimap_t* map, char *key);
+
+/**
+ * @brief Remove the first value of a key whose text equals `value`.
+ *
+ * The remaining values keep their order. The key goes away with its last
+ * value.
+ *
+ * @param map The multimap.
+ * @param key The key.
+ * @param value The value to remove.
+ * @return 0 on success, FOSSIL_TOFU_ERROR_NOT_FOUND if there is no such pair.
+ * @note Time complexity: O(k) for k values
+ */
+int32_t fossil_tofu_multimap_remove_value(fossil_tofu_multimap_t* map, char *key, char *value);
+
+/**
+ * @brief Check whether a key has any values.
+ *
+ * @param map The multimap.
+ * @param key The key.
+ * @return True if the key is present.
+ * @note Time complexity: O(1) expected
+ */
+bool fossil_tofu_multimap_contains(const fossil_tofu_multimap_t* map, char *key);
+
+/**
+ * @brief Get all values of a key.
+ *
+ * @param map The multimap.
+ * @param key The key.
+ * @param count Receives the number of values; may be NULL.
+ * @return The values in insertion order, or NULL if the key is absent. The
+ *         array stays valid until the key is next modified.
+ * @note Time complexity: O(1) expected
+ */
+const fossil_tofu_t* fossil_tofu_multimap_get_all(const fossil_tofu_multimap_t* map, char *key, size_t* count);
+
+/**
+ * @brief Get all values of a key given as borrowed text, without allocating.
+ *
+ * @param map The multimap.
+ * @param key The key text; need not be NUL-terminated.
+ * @param len Length of the key text in bytes.
+ * @param count Receives the number of values; may be NULL.
+ * @return The values in insertion order, or NULL if the key is absent.
+ * @note Time complexity: O(1) expected
+ */
+const fossil_tofu_t* fossil_tofu_multimap_find(const fossil_tofu_multimap_t* map, const char* key, size_t len, size_t* count);
+
+/**
+ * @brief Get the number of values of a key.
+ *
+ * @param map The multimap.
+ * @param key The key.
+ * @return The number of values, zero if the key is absent.
+ * @note Time complexity: O(1) expected
+ */
+size_t fossil_tofu_multimap_count(const fossil_tofu_multimap_t* map, char *key);
+
+/**
+ * @brief Grow the table to hold at least `keys` distinct keys.
+ *
+ * @param map The multimap.
+ * @param keys The number of distinct keys to make room for.
+ * @return 0 on success, non-zero on failure.
+ * @note Time complexity: O(n)
+ */
+int32_t fossil_tofu_multimap_reserve(fossil_tofu_multimap_t* map, size_t keys);
+
+/**
+ * @brief Visit every key with its values, in table order.
+ *
+ * @param map The multimap.
+ * @param visit Called once per key; return false to stop.
+ * @param context Passed through to the visitor.
+ * @return The number of keys visited.
+ * @note Time complexity: O(n)
+ */
+size_t fossil_tofu_multimap_for_each(const fossil_tofu_multimap_t* map, fossil_tofu_multimap_visit_fn visit, void* context);
+
+/**
+ * @brief Get the number of distinct keys.
+ *
+ * @param map The multimap.
+ * @return The number of keys.
+ * @note Time complexity: O(1)
+ */
+size_t fossil_tofu_multimap_key_count(const fossil_tofu_multimap_t* map);
+
+/**
+ * @brief Get the number of values over all keys.
+ *
+ * @param map The multimap.
+ * @return The number of values.
+ * @note Time complexity: O(1)
+ */
+size_t fossil_tofu_multimap_size(const fossil_tofu_multimap_t* map);
+
+/**
+ * @brief Check if the multimap is not empty.
+ *
+ * @param map The multimap.
+ * @return True if the multimap has values, false otherwise.
+ * @note Time complexity: O(1)
+ */
+bool fossil_tofu_multimap_not_empty(const fossil_tofu_multimap_t* map);
+
+/**
+ * @brief Check if the multimap is empty.
+ *
+ * @param map The multimap.
+ * @return True if the multimap is empty, false otherwise.
+ * @note Time complexity: O(1)
+ */
+bool fossil_tofu_multimap_is_empty(const fossil_tofu_multimap_t* map);
+
+#ifdef __cplusplus
+}
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace fossil {
+
+    namespace tofu {
+
+        class MultiMap {
+        public:
+            /**
+             * @brief Construct a new MultiMap with specified key and value types.
+             *
+             * @param key_type The type of the keys.
+             * @param value_type The type of the values.
+             */
+            MultiMap(const std::string& key_type, const std::string& value_type) {
+                map = fossil_tofu_multimap_create_container(const_cast<char*>(key_type.c_str()), const_cast<char*>(value_type.c_str()));
+                if (map == nullptr) {
+                    throw std::runtime_error("Failed to create multimap container");
+                }
+            }
+
+            /**
+             * @brief Construct a new MultiMap with default key and value types.
+             */
+            MultiMap() {
+                map = fossil_tofu_multimap_create_default();
+                if (map == nullptr) {
+                    throw std::runtime_error("Failed to create multimap container");
+                }
+            }
+
+            /**
+             * @brief Construct a new MultiMap by copying another.
+             *
+             * @param other The MultiMap to copy.
+             */
+            MultiMap(const MultiMap& other) {
+                map = fossil_tofu_multimap_create_copy(other.map);
+                if (map == nullptr) {
+                    throw std::runtime_error("Failed to create multimap container");
+                }
+            }
+
+            /**
+             * @brief Construct a new MultiMap by moving another.
+             *
+             * @param other The MultiMap to move.
+             */
+            MultiMap(MultiMap&& other) {
+                map = fossil_tofu_multimap_create_move(other.map);
+                if (map == nullptr) {
+                    throw std::runtime_error("Failed to create multimap container");
+                }
+            }
+
+            /**
+             * @brief Destroy the MultiMap and free its memory.
+             */
+            ~MultiMap() {
+                fossil_tofu_multimap_destroy(map);
+            }
+
+            /**
+             * @brief Append a value to the values of a key.
+             *
+             * @param key The key.
+             * @param value The value to append.
+             * @return 0 on success, non-zero on failure.
+             */
+            int32_t insert(const std::string& key, const std::string& value) {
+                return fossil_tofu_multimap_insert(map, const_cast<char*>(key.c_str()), const_cast<char*>(value.c_str()));
+            }
+
+            /**
+             * @brief Remove a key together with all of its values.
+             *
+             * @param key The key to remove.
+             * @return 0 on success, non-zero if the key is absent.
+             */
+            int32_t remove(const std::string& key) {
+                return fossil_tofu_multimap_remove(map, const_cast<char*>(key.c_str()));
+            }
+
+            /**
+             * @brief Remove the first value of a key whose text equals `value`.
+             *
+             * @param key The key.
+             * @param value The value to remove.
+             * @return 0 on success, non-zero if there is no such pair.
+             */
+            int32_t remove_value(const std::string& key, const std::string& value) {
+                return fossil_tofu_multimap_remove_value(map, const_cast<char*>(key.c_str()), const_cast<char*>(value.c_str()));
+            }
+
+            /**
+             * @brief Check whether a key has any values.
+             *
+             * @param key The key.
+             * @return True if the key is present.
+             */
+            bool contains(const std::string& key) const {
+                return fossil_tofu_multimap_contains(map, const_cast<char*>(key.c_str()));
+            }
+
+            /**
+             * @brief Get all values of a key.
+             *
+             * @param key The key.
+             * @return The values as text in insertion order; empty if the key is absent.
+             */
+            std::vector<std::string> get_all(const std::string& key) const {
+                size_t count = 0;
+                const fossil_tofu_t* values = fossil_tofu_multimap_find(map, key.data(), key.size(), &count);
+                std::vector<std::string> result;
+                result.reserve(count);
+                for (size_t i = 0; i < count; i++) {
+                    result.emplace_back(values[i].value.data);
+                }
+                return result;
+            }
+
+            /**
+             * @brief Get the number of values of a key.
+             *
+             * @param key The key.
+             * @return The number of values.
+             */
+            size_t count(const std::string& key) const {
+                return fossil_tofu_multimap_count(map, const_cast<char*>(key.c_str()));
+            }
+
+            /**
+             * @brief Grow the table to hold at least `keys` distinct keys.
+             *
+             * @param keys The number of distinct keys to make room for.
+             */
+            void reserve(size_t keys) {
+                if (fossil_tofu_multimap_reserve(map, keys) != FOSSIL_TOFU_SUCCESS) {
+                    throw std::runtime_error("Failed to reserve multimap capacity");
+                }
+            }
+
+            /**
+             * @brief Get the number of distinct keys.
+             *
+             * @return The number of keys.
+             */
+            size_t key_count() const {
+                return fossil_tofu_multimap_key_count(map);
+            }
+
+            /**
+             * @brief Get the number of values over all keys.
+             *
+             * @return The number of values.
+             */
+            size_t size() const {
+                return fossil_tofu_multimap_size(map);
+            }
+
+            /**
+             * @brief Check if the multimap is not empty.
+             *
+             * @return True if the multimap has values, false otherwise.
+             */
+            bool not_empty() const {
+                return fossil_tofu_multimap_not_empty(map);
+            }
+
+            /**
+             * @brief Check if the multimap is empty.
+             *
+             * @return True if the multimap is empty, false otherwise.
+             */
+            bool is_empty() const {
+                return fossil_tofu_multimap_is_empty(map);
+            }
+
+        private:
+            fossil_tofu_multimap_t* map;
+        };
+
+    } // namespace tofu
+
+} // namespace fossil
+
+#endif
+
+#endif /* FOSSIL_TOFU_FRAMEWORK_H */
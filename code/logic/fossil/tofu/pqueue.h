@@ -36,14 +36,54 @@ extern "C"
 // Type definitions
 // *****************************************************************************
 
+/**
+ * Default number of children per heap node. A 4-ary heap is half as deep as
+ * a binary one and its sibling groups share a cache line, which makes
+ * sift-down cheaper in practice.
+ */
+#define FOSSIL_TOFU_PQUEUE_ARITY 4
+
+/**
+ * Stable reference to an element in a priority queue. It stays valid while
+ * the element is queued, whatever the heap does to its position, and is
+ * rejected once the element has been popped or removed.
+ */
+typedef uint64_t fossil_tofu_pqueue_handle_t;
+
+#define FOSSIL_TOFU_PQUEUE_HANDLE_INVALID UINT64_MAX
+
 typedef struct fossil_tofu_pqueue_node_t {
     fossil_tofu_t data;
     int32_t priority;
-    struct fossil_tofu_pqueue_node_t* next;
+    uint32_t slot; // index into the handle table
+    uint64_t seq;  // insertion stamp, breaks ties between equal priorities
 } fossil_tofu_pqueue_node_t;
 
+/**
+ * Handle table entry. A live slot records where its element sits in the
+ * heap; a free slot links to the next free one through position.
+ */
+typedef struct fossil_tofu_pqueue_slot_t {
+    size_t position;
+    uint32_t generation;
+    bool live;
+} fossil_tofu_pqueue_slot_t;
+
+/**
+ * Priority queue stored as an implicit d-ary min-heap. The element with the
+ * lowest priority value is at the front; equal priorities leave in the order
+ * they were inserted.
+ */
 typedef struct fossil_tofu_pqueue_t {
-    fossil_tofu_pqueue_node_t* front;
+    fossil_tofu_pqueue_node_t* nodes;
+    size_t size;
+    size_t capacity;
+    size_t arity;
+    uint64_t seq;
+    fossil_tofu_pqueue_slot_t* slots;
+    size_t slot_count;
+    size_t slot_capacity;
+    size_t free_slot;
     char* type;
 } fossil_tofu_pqueue_t;
 
@@ -69,6 +109,17 @@ fossil_tofu_pqueue_t* fossil_tofu_pqueue_create_container(char* type);
  */
 fossil_tofu_pqueue_t* fossil_tofu_pqueue_create_default(void);
 
+/**
+ * Create a new priority queue whose heap nodes have the given number of
+ * children.
+ *
+ * @param type  The type of data the priority queue will store.
+ * @param arity Children per heap node; must be at least 2.
+ * @return      The created priority queue, or NULL on invalid input.
+ * @note        Time complexity: O(1)
+ */
+fossil_tofu_pqueue_t* fossil_tofu_pqueue_create_arity(char* type, size_t arity);
+
 /**
  * Create a new priority queue by copying an existing priority queue.
  * 
@@ -108,20 +159,99 @@ void fossil_tofu_pqueue_destroy(fossil_tofu_pqueue_t* pqueue);
  * @param data     The data to insert.
  * @param priority The priority of the data.
  * @return         The error code indicating the success or failure of the operation.
- * @note           Time complexity: O(n)
+ * @note           Time complexity: O(log n) amortized
  */
 int32_t fossil_tofu_pqueue_insert(fossil_tofu_pqueue_t* pqueue, char *data, int32_t priority);
 
 /**
- * Remove data from the priority queue.
+ * Insert data and return a handle that can later re-prioritize or remove it.
+ *
+ * @param pqueue   The priority queue to insert data into.
+ * @param data     The data to insert.
+ * @param priority The priority of the data.
+ * @param handle   Receives the handle of the new element; may be NULL.
+ * @return         The error code indicating the success or failure of the operation.
+ * @note           Time complexity: O(log n) amortized
+ */
+int32_t fossil_tofu_pqueue_insert_handle(fossil_tofu_pqueue_t* pqueue, char *data, int32_t priority, fossil_tofu_pqueue_handle_t* handle);
+
+/**
+ * Change the priority of a queued element. The element moves towards the
+ * front or back as needed and is ordered after any element that already
+ * holds the new priority.
+ *
+ * @param pqueue   The priority queue holding the element.
+ * @param handle   The handle returned when the element was inserted.
+ * @param priority The new priority.
+ * @return         The error code indicating the success or failure of the operation.
+ * @note           Time complexity: O(log n)
+ */
+int32_t fossil_tofu_pqueue_update_priority(fossil_tofu_pqueue_t* pqueue, fossil_tofu_pqueue_handle_t handle, int32_t priority);
+
+/**
+ * Remove a queued element by handle.
+ *
+ * @param pqueue The priority queue holding the element.
+ * @param handle The handle returned when the element was inserted.
+ * @return       The error code indicating the success or failure of the operation.
+ * @note         Time complexity: O(log n)
+ */
+int32_t fossil_tofu_pqueue_remove_handle(fossil_tofu_pqueue_t* pqueue, fossil_tofu_pqueue_handle_t handle);
+
+/**
+ * Check whether a handle still refers to a queued element.
+ *
+ * @param pqueue The priority queue to check.
+ * @param handle The handle to check.
+ * @return       True if the element is still queued, false otherwise.
+ * @note         Time complexity: O(1)
+ */
+bool fossil_tofu_pqueue_contains_handle(const fossil_tofu_pqueue_t* pqueue, fossil_tofu_pqueue_handle_t handle);
+
+/**
+ * Insert a batch of elements and restore the heap in a single bottom-up pass.
+ * Elements keep the order of the input array among equal priorities.
+ *
+ * @param pqueue     The priority queue to insert data into.
+ * @param data       The data to insert.
+ * @param priorities The priority of each element in data.
+ * @param count      Number of elements in data and priorities.
+ * @return           The error code indicating the success or failure of the operation.
+ * @note             Time complexity: O(n + count)
+ */
+int32_t fossil_tofu_pqueue_heapify(fossil_tofu_pqueue_t* pqueue, char* const data[], const int32_t priorities[], size_t count);
+
+/**
+ * Remove the element at the front of the priority queue.
+ *
+ * @param pqueue The priority queue to remove data from.
+ * @return       The error code indicating the success or failure of the operation.
+ * @note         Time complexity: O(log n)
+ */
+int32_t fossil_tofu_pqueue_pop(fossil_tofu_pqueue_t* pqueue);
+
+/**
+ * Remove data from the priority queue. When several elements share the
+ * priority, the one inserted first is removed.
  *
  * @param pqueue   The priority queue to remove data from.
  * @param priority The priority of the data.
  * @return         The error code indicating the success or failure of the operation.
- * @note           Time complexity: O(1)
+ * @note           Time complexity: O(log n) when priority is at the front, O(n) otherwise
  */
 int32_t fossil_tofu_pqueue_remove(fossil_tofu_pqueue_t* pqueue, int32_t priority);
 
+/**
+ * Ensure the priority queue can hold at least capacity elements without
+ * reallocating.
+ *
+ * @param pqueue   The priority queue to reserve space in.
+ * @param capacity The number of elements to reserve space for.
+ * @return         The error code indicating the success or failure of the operation.
+ * @note           Time complexity: O(n)
+ */
+int32_t fossil_tofu_pqueue_reserve(fossil_tofu_pqueue_t* pqueue, size_t capacity);
+
 /**
  * Get the size of the priority queue.
  *
@@ -182,10 +312,22 @@ bool fossil_tofu_pqueue_is_cnullptr(const fossil_tofu_pqueue_t* pqueue);
 char *fossil_tofu_pqueue_get_front(const fossil_tofu_pqueue_t* pqueue);
 
 /**
- * Get the element with the lowest priority in the priority queue.
+ * Get the priority of the element at the front of the priority queue.
  * 
  * Time complexity: O(1)
  *
+ * @param pqueue   The priority queue to inspect.
+ * @param priority Receives the front priority.
+ * @return         The error code indicating the success or failure of the operation.
+ */
+int32_t fossil_tofu_pqueue_front_priority(const fossil_tofu_pqueue_t* pqueue, int32_t* priority);
+
+/**
+ * Get the element with the lowest priority in the priority queue. The heap
+ * only orders parents before children, so this scans the leaf level.
+ * 
+ * Time complexity: O(n)
+ *
  * @param pqueue The priority queue from which to get the element.
  * @return       The element with the lowest priority.
  */
@@ -202,6 +344,18 @@ char *fossil_tofu_pqueue_get_back(const fossil_tofu_pqueue_t* pqueue);
  */
 char *fossil_tofu_pqueue_get_at(const fossil_tofu_pqueue_t* pqueue, int32_t priority);
 
+/**
+ * Get the element and priority referred to by a handle.
+ * 
+ * Time complexity: O(1)
+ *
+ * @param pqueue   The priority queue holding the element.
+ * @param handle   The handle returned when the element was inserted.
+ * @param priority Receives the element's priority; may be NULL.
+ * @return         The element, or NULL if the handle is stale.
+ */
+char *fossil_tofu_pqueue_get_handle(const fossil_tofu_pqueue_t* pqueue, fossil_tofu_pqueue_handle_t handle, int32_t* priority);
+
 /**
  * Set the element with the highest priority in the priority queue.
  * 
@@ -215,7 +369,7 @@ void fossil_tofu_pqueue_set_front(fossil_tofu_pqueue_t* pqueue, char *element);
 /**
  * Set the element with the lowest priority in the priority queue.
  * 
- * Time complexity: O(1)
+ * Time complexity: O(n)
  *
  * @param pqueue  The priority queue in which to set the element.
  * @param element The element to set.
@@ -237,6 +391,8 @@ void fossil_tofu_pqueue_set_at(fossil_tofu_pqueue_t* pqueue, int32_t priority, c
 }
 #include <stdexcept>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace fossil {
 
@@ -256,6 +412,19 @@ namespace fossil {
                 }
             }
 
+            /**
+             * Create a new priority queue with the given heap arity.
+             *
+             * @param type  The type of data the priority queue will store.
+             * @param arity Children per heap node; must be at least 2.
+             */
+            PQueue(const std::string& type, size_t arity) {
+                pqueue = fossil_tofu_pqueue_create_arity(const_cast<char*>(type.c_str()), arity);
+                if (pqueue == nullptr) {
+                    throw std::runtime_error("Failed to create priority queue.");
+                }
+            }
+
             /**
              * Create a new priority queue with default values.
              */
@@ -304,6 +473,91 @@ namespace fossil {
                 fossil_tofu_pqueue_insert(pqueue, const_cast<char*>(data.c_str()), priority);
             }
 
+            /**
+             * Insert data and return a handle to it.
+             *
+             * @param data     The data to insert.
+             * @param priority The priority of the data.
+             * @return         The handle of the new element.
+             */
+            fossil_tofu_pqueue_handle_t insert_handle(const std::string& data, int32_t priority) {
+                fossil_tofu_pqueue_handle_t handle = FOSSIL_TOFU_PQUEUE_HANDLE_INVALID;
+                if (fossil_tofu_pqueue_insert_handle(pqueue, const_cast<char*>(data.c_str()), priority, &handle) != FOSSIL_TOFU_SUCCESS) {
+                    throw std::runtime_error("Failed to insert into priority queue.");
+                }
+                return handle;
+            }
+
+            /**
+             * Change the priority of a queued element.
+             *
+             * @param handle   The handle returned by insert_handle.
+             * @param priority The new priority.
+             */
+            void update_priority(fossil_tofu_pqueue_handle_t handle, int32_t priority) {
+                if (fossil_tofu_pqueue_update_priority(pqueue, handle, priority) != FOSSIL_TOFU_SUCCESS) {
+                    throw std::runtime_error("Stale priority queue handle.");
+                }
+            }
+
+            /**
+             * Remove a queued element by handle.
+             *
+             * @param handle The handle returned by insert_handle.
+             */
+            void remove_handle(fossil_tofu_pqueue_handle_t handle) {
+                if (fossil_tofu_pqueue_remove_handle(pqueue, handle) != FOSSIL_TOFU_SUCCESS) {
+                    throw std::runtime_error("Stale priority queue handle.");
+                }
+            }
+
+            /**
+             * Check whether a handle still refers to a queued element.
+             *
+             * @param handle The handle to check.
+             * @return       True if the element is still queued.
+             */
+            bool contains_handle(fossil_tofu_pqueue_handle_t handle) const {
+                return fossil_tofu_pqueue_contains_handle(pqueue, handle);
+            }
+
+            /**
+             * Get the element referred to by a handle.
+             *
+             * @param handle The handle returned by insert_handle.
+             * @return       The element, or an empty string if the handle is stale.
+             */
+            std::string get_handle(fossil_tofu_pqueue_handle_t handle) const {
+                char* result = fossil_tofu_pqueue_get_handle(pqueue, handle, nullptr);
+                return result ? std::string(result) : std::string();
+            }
+
+            /**
+             * Insert a batch of elements with a single heap rebuild.
+             *
+             * @param items The data and priority pairs to insert.
+             */
+            void heapify(const std::vector<std::pair<std::string, int32_t>>& items) {
+                std::vector<char*> data;
+                std::vector<int32_t> priorities;
+                data.reserve(items.size());
+                priorities.reserve(items.size());
+                for (const auto& item : items) {
+                    data.push_back(const_cast<char*>(item.first.c_str()));
+                    priorities.push_back(item.second);
+                }
+                if (fossil_tofu_pqueue_heapify(pqueue, data.data(), priorities.data(), items.size()) != FOSSIL_TOFU_SUCCESS) {
+                    throw std::runtime_error("Failed to heapify priority queue.");
+                }
+            }
+
+            /**
+             * Remove the element at the front of the priority queue.
+             */
+            void pop() {
+                fossil_tofu_pqueue_pop(pqueue);
+            }
+
             /**
              * Remove data from the priority queue.
              *
@@ -313,6 +567,17 @@ namespace fossil {
                 fossil_tofu_pqueue_remove(pqueue, priority);
             }
 
+            /**
+             * Reserve space for at least capacity elements.
+             *
+             * @param capacity The number of elements to reserve space for.
+             */
+            void reserve(size_t capacity) {
+                if (fossil_tofu_pqueue_reserve(pqueue, capacity) != FOSSIL_TOFU_SUCCESS) {
+                    throw std::runtime_error("Failed to reserve priority queue.");
+                }
+            }
+
             /**
              * Get the size of the priority queue.
              *
@@ -368,6 +633,19 @@ namespace fossil {
                 return result ? std::string(result) : std::string();
             }
 
+            /**
+             * Get the priority of the element at the front of the queue.
+             * 
+             * @return The front priority.
+             */
+            int32_t front_priority() const {
+                int32_t priority = 0;
+                if (fossil_tofu_pqueue_front_priority(pqueue, &priority) != FOSSIL_TOFU_SUCCESS) {
+                    throw std::runtime_error("Priority queue is empty.");
+                }
+                return priority;
+            }
+
             /**
              * Get the element with the lowest priority in the priority queue.
              * 
@@ -47,6 +47,7 @@ typedef struct fossil_tofu_queue_t {
     fossil_tofu_queue_node_t* front;
     fossil_tofu_queue_node_t* rear;
     char* type;
+    size_t size;
 } fossil_tofu_queue_t;
 
 // *****************************************************************************
@@ -127,10 +128,21 @@ int32_t fossil_tofu_queue_remove(fossil_tofu_queue_t* queue);
  *
  * @param queue The queue for which to get the size.
  * @return      The size of the queue.
- * @note        Time complexity: O(n)
+ * @note        Time complexity: O(1)
  */
 size_t fossil_tofu_queue_size(const fossil_tofu_queue_t* queue);
 
+/**
+ * Check the internal invariants of the queue: the node count matches the
+ * stored size and the rear pointer is the last node reached from the front.
+ * Debug builds (FOSSIL_TOFU_DEBUG) run this after every mutation.
+ *
+ * @param queue The queue to check.
+ * @return      True if the queue is consistent, false otherwise.
+ * @note        Time complexity: O(n)
+ */
+bool fossil_tofu_queue_verify(const fossil_tofu_queue_t* queue);
+
 /**
  * Check if the queue is not empty.
  *
@@ -300,6 +312,15 @@ namespace fossil {
                 return fossil_tofu_queue_size(queue);
             }
 
+            /**
+             * Check the internal invariants of the queue.
+             *
+             * @return True if the queue is consistent, false otherwise.
+             */
+            bool verify() const {
+                return fossil_tofu_queue_verify(queue);
+            }
+
             /**
              * Check if the queue is not empty.
              *
@@ -0,0 +1,480 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef FOSSIL_TOFU_SEGVECTOR_H
+#define FOSSIL_TOFU_SEGVECTOR_H
+
+#include "tofu.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// *****************************************************************************
+// Type definitions
+// *****************************************************************************
+
+// Default number of elements per chunk.
+#define FOSSIL_TOFU_SEGVECTOR_CHUNK 64
+
+/**
+ * A segmented vector stores its elements in fixed-size chunks reached
+ * through a chunk index. Growing the vector allocates a new chunk and at
+ * most reallocates the index of chunk pointers, so elements never move
+ * once written and pointers returned by fossil_tofu_segvector_at stay
+ * valid until the element is popped or the vector is destroyed.
+ */
+typedef struct {
+    fossil_tofu_t** chunks;   // Chunk index; every chunk holds chunk_size elements
+    size_t chunk_count;       // Number of allocated chunks
+    size_t index_capacity;    // Slots available in the chunk index
+    size_t chunk_shift;       // log2(chunk_size)
+    size_t size;              // Number of elements
+    char* type;               // Expected type of the elements
+} fossil_tofu_segvector_t;
+
+// *****************************************************************************
+// Function prototypes
+// *****************************************************************************
+
+/**
+ * Create a new segmented vector with the specified expected type and the
+ * default chunk size.
+ * 
+ * Time complexity: O(1)
+ *
+ * @param type The expected type of elements in the vector.
+ * @return     The created vector, or NULL on failure.
+ */
+fossil_tofu_segvector_t* fossil_tofu_segvector_create_container(char* type);
+
+/**
+ * Create a new segmented vector with a custom chunk size.
+ * 
+ * The chunk size is rounded up to a power of two so that indexing is a
+ * shift and a mask. A chunk size that is zero, or too large for a chunk to
+ * fit in memory once rounded, is rejected.
+ * 
+ * Time complexity: O(1)
+ *
+ * @param type       The expected type of elements in the vector.
+ * @param chunk_size Number of elements per chunk.
+ * @return           The created vector, or NULL on failure.
+ */
+fossil_tofu_segvector_t* fossil_tofu_segvector_create_chunked(char* type, size_t chunk_size);
+
+/**
+ * Create a new segmented vector with default values.
+ * 
+ * Time complexity: O(1)
+ *
+ * @return The created vector, or NULL on failure.
+ */
+fossil_tofu_segvector_t* fossil_tofu_segvector_create_default(void);
+
+/**
+ * Create a new segmented vector by copying an existing one.
+ * 
+ * Time complexity: O(n)
+ *
+ * @param other The vector to copy.
+ * @return      The created vector, or NULL on failure.
+ */
+fossil_tofu_segvector_t* fossil_tofu_segvector_create_copy(const fossil_tofu_segvector_t* other);
+
+/**
+ * Create a new segmented vector by moving an existing one.
+ * 
+ * Time complexity: O(1)
+ *
+ * @param other The vector to move.
+ * @return      The created vector, or NULL on failure.
+ */
+fossil_tofu_segvector_t* fossil_tofu_segvector_create_move(fossil_tofu_segvector_t* other);
+
+/**
+ * Destroy the segmented vector and all of its elements.
+ * 
+ * Time complexity: O(n)
+ *
+ * @param vector The vector to destroy.
+ */
+void fossil_tofu_segvector_destroy(fossil_tofu_segvector_t* vector);
+
+// *****************************************************************************
+// Utility functions
+// *****************************************************************************
+
+/**
+ * Append an element. Existing elements are never moved.
+ * 
+ * Time complexity: O(1), amortized over the growth of the chunk index
+ *
+ * @param vector  The vector to append to.
+ * @param element The element to append.
+ * @return        FOSSIL_TOFU_SUCCESS, or an error code on failure.
+ */
+int32_t fossil_tofu_segvector_push_back(fossil_tofu_segvector_t* vector, char *element);
+
+/**
+ * Remove the last element. Chunks are kept for reuse.
+ * 
+ * Time complexity: O(1)
+ *
+ * @param vector The vector to pop from.
+ */
+void fossil_tofu_segvector_pop_back(fossil_tofu_segvector_t* vector);
+
+/**
+ * Remove all elements. Chunks are kept for reuse.
+ * 
+ * Time complexity: O(n)
+ *
+ * @param vector The vector to erase.
+ */
+void fossil_tofu_segvector_erase(fossil_tofu_segvector_t* vector);
+
+/**
+ * Make room for at least the given number of elements by allocating chunks
+ * up front.
+ * 
+ * Time complexity: O(n / chunk_size)
+ *
+ * @param vector   The vector to reserve space in.
+ * @param capacity The number of elements to make room for.
+ * @return         FOSSIL_TOFU_SUCCESS, or an error code on failure.
+ */
+int32_t fossil_tofu_segvector_reserve(fossil_tofu_segvector_t* vector, size_t capacity);
+
+/**
+ * Check if the vector is a null pointer.
+ * 
+ * Time complexity: O(1)
+ *
+ * @param vector The vector to check.
+ * @return       True if the vector is a null pointer, false otherwise.
+ */
+bool fossil_tofu_segvector_is_cnullptr(const fossil_tofu_segvector_t* vector);
+
+/**
+ * Check if the vector is not a null pointer.
+ * 
+ * Time complexity: O(1)
+ *
+ * @param vector The vector to check.
+ * @return       True if the vector is not a null pointer, false otherwise.
+ */
+bool fossil_tofu_segvector_not_cnullptr(const fossil_tofu_segvector_t* vector);
+
+/**
+ * Check if the vector is empty.
+ * 
+ * Time complexity: O(1)
+ *
+ * @param vector The vector to check.
+ * @return       True if the vector is empty, false otherwise.
+ */
+bool fossil_tofu_segvector_is_empty(const fossil_tofu_segvector_t* vector);
+
+/**
+ * Check if the vector is not empty.
+ * 
+ * Time complexity: O(1)
+ *
+ * @param vector The vector to check.
+ * @return       True if the vector is not empty, false otherwise.
+ */
+bool fossil_tofu_segvector_not_empty(const fossil_tofu_segvector_t* vector);
+
+/**
+ * Get the number of elements in the vector.
+ * 
+ * Time complexity: O(1)
+ *
+ * @param vector The vector.
+ * @return       The number of elements.
+ */
+size_t fossil_tofu_segvector_size(const fossil_tofu_segvector_t* vector);
+
+/**
+ * Get the number of elements the allocated chunks can hold.
+ * 
+ * Time complexity: O(1)
+ *
+ * @param vector The vector.
+ * @return       The capacity of the vector.
+ */
+size_t fossil_tofu_segvector_capacity(const fossil_tofu_segvector_t* vector);
+
+/**
+ * Get the number of elements per chunk.
+ * 
+ * Time complexity: O(1)
+ *
+ * @param vector The vector.
+ * @return       The chunk size.
+ */
+size_t fossil_tofu_segvector_chunk_size(const fossil_tofu_segvector_t* vector);
+
+// *****************************************************************************
+// Getter and setter functions
+// *****************************************************************************
+
+/**
+ * Get a stable pointer to the element at the specified index.
+ * 
+ * The pointer stays valid across later appends; it is invalidated only
+ * when the element is popped or erased or the vector is destroyed.
+ * 
+ * Time complexity: O(1)
+ *
+ * @param vector The vector.
+ * @param index  The index of the element.
+ * @return       The element, or NULL if the index is out of bounds.
+ */
+fossil_tofu_t* fossil_tofu_segvector_at(const fossil_tofu_segvector_t* vector, size_t index);
+
+/**
+ * Get the value of the element at the specified index.
+ * 
+ * Time complexity: O(1)
+ *
+ * @param vector The vector.
+ * @param index  The index of the element.
+ * @return       The element value, or NULL if the index is out of bounds.
+ */
+char *fossil_tofu_segvector_get(const fossil_tofu_segvector_t* vector, size_t index);
+
+/**
+ * Get the value of the first element.
+ * 
+ * Time complexity: O(1)
+ *
+ * @param vector The vector.
+ * @return       The first element value, or NULL if the vector is empty.
+ */
+char *fossil_tofu_segvector_get_front(const fossil_tofu_segvector_t* vector);
+
+/**
+ * Get the value of the last element.
+ * 
+ * Time complexity: O(1)
+ *
+ * @param vector The vector.
+ * @return       The last element value, or NULL if the vector is empty.
+ */
+char *fossil_tofu_segvector_get_back(const fossil_tofu_segvector_t* vector);
+
+/**
+ * Replace the value of the element at the specified index in place.
+ * 
+ * Time complexity: O(1)
+ *
+ * @param vector  The vector.
+ * @param index   The index of the element.
+ * @param element The new value.
+ * @return        FOSSIL_TOFU_SUCCESS, or an error code on failure.
+ */
+int32_t fossil_tofu_segvector_set(fossil_tofu_segvector_t* vector, size_t index, char *element);
+
+#ifdef __cplusplus
+}
+#include <stdexcept>
+#include <string>
+
+namespace fossil {
+
+    namespace tofu {
+
+        /**
+         * A wrapper class for the fossil_tofu_segvector_t structure, providing a
+         * C++ interface for append-only sequences with stable element addresses.
+         */
+        class SegVector {
+        public:
+            /**
+             * Default constructor. Creates a new segmented vector with default values.
+             * Throws a runtime_error if the vector creation fails.
+             */
+            SegVector() : vector(fossil_tofu_segvector_create_default()) {
+                if (fossil_tofu_segvector_is_cnullptr(vector)) {
+                    throw std::runtime_error("Failed to create segmented vector");
+                }
+            }
+
+            /**
+             * Constructor that creates a new segmented vector with the specified type.
+             * Throws a runtime_error if the vector creation fails.
+             *
+             * @param type       The expected type of elements in the vector.
+             * @param chunk_size Number of elements per chunk.
+             */
+            SegVector(const std::string& type, size_t chunk_size = FOSSIL_TOFU_SEGVECTOR_CHUNK)
+                : vector(fossil_tofu_segvector_create_chunked(const_cast<char*>(type.c_str()), chunk_size)) {
+                if (fossil_tofu_segvector_is_cnullptr(vector)) {
+                    throw std::runtime_error("Failed to create segmented vector");
+                }
+            }
+
+            /**
+             * Copy constructor. Creates a new segmented vector by copying an existing one.
+             * Throws a runtime_error if the vector creation fails.
+             *
+             * @param other The vector to copy.
+             */
+            SegVector(const SegVector& other) : vector(fossil_tofu_segvector_create_copy(other.vector)) {
+                if (fossil_tofu_segvector_is_cnullptr(vector)) {
+                    throw std::runtime_error("Failed to create segmented vector");
+                }
+            }
+
+            /**
+             * Move constructor. Takes ownership of the other vector's storage.
+             *
+             * @param other The vector to move.
+             */
+            SegVector(SegVector&& other) noexcept : vector(other.vector) {
+                other.vector = nullptr;
+            }
+
+            /**
+             * Destructor. Destroys the vector and frees allocated memory.
+             */
+            ~SegVector() {
+                fossil_tofu_segvector_destroy(vector);
+            }
+
+            /**
+             * Appends an element. Throws a runtime_error on allocation failure.
+             *
+             * @param element The element to append.
+             */
+            void push_back(const std::string& element) {
+                if (fossil_tofu_segvector_push_back(vector, const_cast<char*>(element.c_str())) != FOSSIL_TOFU_SUCCESS) {
+                    throw std::runtime_error("Failed to append to segmented vector");
+                }
+            }
+
+            /**
+             * Removes the last element.
+             */
+            void pop_back() {
+                fossil_tofu_segvector_pop_back(vector);
+            }
+
+            /**
+             * Removes all elements.
+             */
+            void erase() {
+                fossil_tofu_segvector_erase(vector);
+            }
+
+            /**
+             * Makes room for at least the given number of elements.
+             *
+             * @param capacity The number of elements to make room for.
+             */
+            void reserve(size_t capacity) {
+                if (fossil_tofu_segvector_reserve(vector, capacity) != FOSSIL_TOFU_SUCCESS) {
+                    throw std::runtime_error("Failed to reserve segmented vector");
+                }
+            }
+
+            /**
+             * Checks if the vector is empty.
+             *
+             * @return True if the vector is empty, false otherwise.
+             */
+            bool is_empty() const {
+                return fossil_tofu_segvector_is_empty(vector);
+            }
+
+            /**
+             * Gets the number of elements in the vector.
+             *
+             * @return The number of elements.
+             */
+            size_t size() const {
+                return fossil_tofu_segvector_size(vector);
+            }
+
+            /**
+             * Gets the number of elements the allocated chunks can hold.
+             *
+             * @return The capacity of the vector.
+             */
+            size_t capacity() const {
+                return fossil_tofu_segvector_capacity(vector);
+            }
+
+            /**
+             * Gets a stable pointer to the element at the specified index.
+             *
+             * @param index The index of the element.
+             * @return      The element, or nullptr if the index is out of bounds.
+             */
+            fossil_tofu_t* at(size_t index) const {
+                return fossil_tofu_segvector_at(vector, index);
+            }
+
+            /**
+             * Gets the value of the element at the specified index.
+             *
+             * @param index The index of the element.
+             * @return      The element value.
+             */
+            std::string get(size_t index) const {
+                char* result = fossil_tofu_segvector_get(vector, index);
+                if (result == nullptr) {
+                    throw std::out_of_range("Index out of range");
+                }
+                return std::string(result);
+            }
+
+            /**
+             * Replaces the value of the element at the specified index.
+             *
+             * @param index   The index of the element.
+             * @param element The new value.
+             */
+            void set(size_t index, const std::string& element) {
+                if (fossil_tofu_segvector_set(vector, index, const_cast<char*>(element.c_str())) != FOSSIL_TOFU_SUCCESS) {
+                    throw std::runtime_error("Failed to set segmented vector element");
+                }
+            }
+
+        private:
+            /**
+             * A pointer to the underlying fossil_tofu_segvector_t structure.
+             */
+            fossil_tofu_segvector_t* vector;
+        };
+
+    } // namespace tofu
+
+} // namespace fossil
+
+#endif
+
+#endif /* FOSSIL_TOFU_FRAMEWORK_H */
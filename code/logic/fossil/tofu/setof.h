@@ -26,6 +26,7 @@
 #define FOSSIL_TOFU_SETOF_H
 
 #include "tofu.h"
+#include "hashtable.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -36,16 +37,20 @@ extern "C"
 // Type definitions
 // *****************************************************************************
 
+#define FOSSIL_TOFU_SETOF_MIN_SLOTS 16
+#define FOSSIL_TOFU_SETOF_MAX_LOAD  0.875f // Default load factor limit
+#define FOSSIL_TOFU_SETOF_LOAD_MIN  0.25f  // Accepted range for the limit
+#define FOSSIL_TOFU_SETOF_LOAD_MAX  0.95f
+
 // Set structure
 typedef struct fossil_tofu_setof_node_t {
     fossil_tofu_t data; // Data stored in the set node
-    struct fossil_tofu_setof_node_t* next; // Pointer to the next node
 } fossil_tofu_setof_node_t;
 
 typedef struct fossil_tofu_setof_t {
     char* type; // Type of the set
-    fossil_tofu_setof_node_t* head; // Pointer to the head node of the set
-    size_t size; // Number of elements in the set
+    fossil_tofu_hashtable_t table; // One node per element
+    float max_load; // Grow once the element count would exceed capacity * max_load
 } fossil_tofu_setof_t;
 
 // *****************************************************************************
@@ -93,18 +98,37 @@ void fossil_tofu_setof_destroy(fossil_tofu_setof_t* set);
 /**
  * @brief Inserts data into the set.
  *
+ * Elements are unique: inserting data that is already present leaves the
+ * set unchanged and still succeeds.
+ *
  * @param set The set to insert data into.
  * @param data The data to insert.
  * @return An integer indicating success (0) or failure (non-zero).
+ * @note Time complexity: O(1) expected
  */
 int32_t fossil_tofu_setof_insert(fossil_tofu_setof_t* set, char *data);
 
+/**
+ * @brief Inserts data into the set and reports whether it was new.
+ *
+ * This is the single-probe form of `contains` followed by `insert`, meant
+ * for deduplication loops.
+ *
+ * @param set The set to insert data into.
+ * @param data The data to insert.
+ * @param added Set to true when the data was not in the set yet; may be NULL.
+ * @return An integer indicating success (0) or failure (non-zero).
+ * @note Time complexity: O(1) expected
+ */
+int32_t fossil_tofu_setof_add(fossil_tofu_setof_t* set, char *data, bool* added);
+
 /**
  * @brief Removes data from the set.
  *
  * @param set The set to remove data from.
  * @param data The data to remove.
  * @return An integer indicating success (0) or failure (non-zero).
+ * @note Time complexity: O(1) expected
  */
 int32_t fossil_tofu_setof_remove(fossil_tofu_setof_t* set, char *data);
 
@@ -114,9 +138,196 @@ int32_t fossil_tofu_setof_remove(fossil_tofu_setof_t* set, char *data);
  * @param set The set to check.
  * @param data The data to check for.
  * @return True if the set contains the data, false otherwise.
+ * @note Time complexity: O(1) expected
  */
 bool fossil_tofu_setof_contains(const fossil_tofu_setof_t* set, char *data);
 
+/**
+ * @brief Checks for an element given as borrowed text, without allocating.
+ *
+ * The text is hashed and compared in place, so it need not be
+ * NUL-terminated. Numeric elements match by value, as fossil_tofu_compare
+ * orders them ("7" and "07" are the same i32 element); other elements, and
+ * text that is not entirely a number, match exactly.
+ *
+ * @param set The set to check.
+ * @param data The element text.
+ * @param len Length of the element text in bytes.
+ * @return True if the set contains the element, false otherwise.
+ * @note Time complexity: O(1) expected
+ */
+bool fossil_tofu_setof_contains_key(const fossil_tofu_setof_t* set, const char* data, size_t len);
+
+/**
+ * @brief Checks for an integer element without allocating.
+ *
+ * @param set The set to check.
+ * @param value The integer, matched against its decimal text.
+ * @return True if the set contains the element, false otherwise.
+ * @note Time complexity: O(1) expected
+ */
+bool fossil_tofu_setof_contains_i64(const fossil_tofu_setof_t* set, int64_t value);
+
+/**
+ * @brief Grows the hash table so it can hold at least `count` elements
+ * without rehashing.
+ *
+ * @param set The set to grow.
+ * @param count The number of elements to make room for.
+ * @return An integer indicating success (0) or failure (non-zero).
+ * @note Time complexity: O(n)
+ */
+int32_t fossil_tofu_setof_reserve(fossil_tofu_setof_t* set, size_t count);
+
+/**
+ * @brief Puts a Bloom filter in front of the hash table.
+ *
+ * Lookups test the filter first, so most misses return without touching
+ * the slots. Inserts keep it current and every rehash rebuilds it; removed
+ * elements stay in it until then. Attaching again rebuilds the filter.
+ *
+ * @param set The set to filter.
+ * @param bits_per_key Filter bits per slot; 0 selects FOSSIL_TOFU_BLOOM_BITS_PER_KEY.
+ * @return An integer indicating success (0) or failure (non-zero).
+ * @note Time complexity: O(n)
+ */
+int32_t fossil_tofu_setof_attach_filter(fossil_tofu_setof_t* set, size_t bits_per_key);
+
+/**
+ * @brief Drops the set's Bloom filter, if any.
+ *
+ * @param set The set to modify.
+ */
+void fossil_tofu_setof_detach_filter(fossil_tofu_setof_t* set);
+
+/**
+ * @brief Checks whether the set has a Bloom filter attached.
+ *
+ * @param set The set to query.
+ * @return True if a filter is attached.
+ */
+bool fossil_tofu_setof_has_filter(const fossil_tofu_setof_t* set);
+
+/**
+ * @brief Gets the number of slots in the hash table.
+ *
+ * @param set The set to query.
+ * @return The slot count, zero before the first insert.
+ */
+size_t fossil_tofu_setof_capacity(const fossil_tofu_setof_t* set);
+
+/**
+ * @brief Gets the current load factor (size / capacity).
+ *
+ * @param set The set to query.
+ * @return The load factor, 0 for an empty table.
+ */
+float fossil_tofu_setof_load_factor(const fossil_tofu_setof_t* set);
+
+/**
+ * @brief Sets the load factor at which the table grows.
+ *
+ * Lower limits trade memory for shorter probe runs. The table is grown
+ * immediately if it is already above the new limit.
+ *
+ * @param set The set to configure.
+ * @param max_load The new limit, between FOSSIL_TOFU_SETOF_LOAD_MIN and
+ *                 FOSSIL_TOFU_SETOF_LOAD_MAX.
+ * @return An integer indicating success (0) or failure (non-zero).
+ */
+int32_t fossil_tofu_setof_set_max_load(fossil_tofu_setof_t* set, float max_load);
+
+/**
+ * @brief Adds every element of `other` to `set` (set = set ∪ other).
+ *
+ * @param set The set to update in place.
+ * @param other The set whose elements are added.
+ * @return An integer indicating success (0) or failure (non-zero);
+ *         FOSSIL_TOFU_ERROR_TYPE_MISMATCH if the element types differ.
+ * @note Time complexity: O(m) expected, m = size of `other`
+ */
+int32_t fossil_tofu_setof_union_with(fossil_tofu_setof_t* set, const fossil_tofu_setof_t* other);
+
+/**
+ * @brief Keeps only the elements of `set` that are also in `other`.
+ *
+ * @param set The set to update in place.
+ * @param other The set to intersect with.
+ * @return An integer indicating success (0) or failure (non-zero).
+ * @note Time complexity: O(n) expected
+ */
+int32_t fossil_tofu_setof_intersect_with(fossil_tofu_setof_t* set, const fossil_tofu_setof_t* other);
+
+/**
+ * @brief Removes the elements of `other` from `set` (set = set \ other).
+ *
+ * @param set The set to update in place.
+ * @param other The set whose elements are removed.
+ * @return An integer indicating success (0) or failure (non-zero).
+ * @note Time complexity: O(min(n, m)) expected
+ */
+int32_t fossil_tofu_setof_difference_with(fossil_tofu_setof_t* set, const fossil_tofu_setof_t* other);
+
+/**
+ * @brief Keeps the elements that are in exactly one of `set` and `other`.
+ *
+ * @param set The set to update in place.
+ * @param other The set to combine with.
+ * @return An integer indicating success (0) or failure (non-zero).
+ * @note Time complexity: O(m) expected
+ */
+int32_t fossil_tofu_setof_symmetric_difference_with(fossil_tofu_setof_t* set, const fossil_tofu_setof_t* other);
+
+/**
+ * @brief Creates a new set holding the union of `a` and `b`.
+ *
+ * @param a The first set.
+ * @param b The second set.
+ * @return A new set, or NULL on allocation failure or type mismatch.
+ * @note Time complexity: O(n + m) expected
+ */
+fossil_tofu_setof_t* fossil_tofu_setof_union(const fossil_tofu_setof_t* a, const fossil_tofu_setof_t* b);
+
+/**
+ * @brief Creates a new set holding the elements common to `a` and `b`.
+ *
+ * @param a The first set.
+ * @param b The second set.
+ * @return A new set, or NULL on allocation failure or type mismatch.
+ * @note Time complexity: O(min(n, m)) expected
+ */
+fossil_tofu_setof_t* fossil_tofu_setof_intersection(const fossil_tofu_setof_t* a, const fossil_tofu_setof_t* b);
+
+/**
+ * @brief Creates a new set holding the elements of `a` that are not in `b`.
+ *
+ * @param a The first set.
+ * @param b The second set.
+ * @return A new set, or NULL on allocation failure or type mismatch.
+ * @note Time complexity: O(n) expected
+ */
+fossil_tofu_setof_t* fossil_tofu_setof_difference(const fossil_tofu_setof_t* a, const fossil_tofu_setof_t* b);
+
+/**
+ * @brief Creates a new set holding the elements in exactly one of `a` and `b`.
+ *
+ * @param a The first set.
+ * @param b The second set.
+ * @return A new set, or NULL on allocation failure or type mismatch.
+ * @note Time complexity: O(n + m) expected
+ */
+fossil_tofu_setof_t* fossil_tofu_setof_symmetric_difference(const fossil_tofu_setof_t* a, const fossil_tofu_setof_t* b);
+
+/**
+ * @brief Checks whether every element of `set` is also in `other`.
+ *
+ * @param set The candidate subset.
+ * @param other The candidate superset.
+ * @return True if `set` is a subset of `other`, false otherwise or on type mismatch.
+ * @note Time complexity: O(n) expected
+ */
+bool fossil_tofu_setof_is_subset(const fossil_tofu_setof_t* set, const fossil_tofu_setof_t* other);
+
 /**
  * @brief Gets the number of elements in the set.
  *
@@ -188,6 +399,21 @@ namespace fossil {
                 }
             }
 
+            /**
+             * @brief Inserts an element and reports whether it was new.
+             * 
+             * @param data The element to insert into the set.
+             * @return True if the element was added, false if it was already present.
+             * @throws std::runtime_error If the insertion fails.
+             */
+            bool add(const std::string& data) {
+                bool added = false;
+                if (fossil_tofu_setof_add(set_, const_cast<char*>(data.c_str()), &added) != 0) {
+                    throw std::runtime_error("Failed to insert data into set.");
+                }
+                return added;
+            }
+
             /**
              * @brief Removes an element from the set.
              * 
@@ -207,7 +433,145 @@ namespace fossil {
              * @return True if the set contains the element, false otherwise.
              */
             bool contains(const std::string& data) const {
-                return fossil_tofu_setof_contains(set_, const_cast<char*>(data.c_str()));
+                return fossil_tofu_setof_contains_key(set_, data.data(), data.size());
+            }
+
+            /**
+             * @brief Checks if the set contains the specified integer.
+             * 
+             * @param value The integer to check for.
+             * @return True if the set contains the element, false otherwise.
+             */
+            bool contains(int64_t value) const {
+                return fossil_tofu_setof_contains_i64(set_, value);
+            }
+
+            /**
+             * @brief Grows the set to hold at least `count` elements without rehashing.
+             * 
+             * @param count The number of elements to make room for.
+             * @throws std::runtime_error If the table cannot be grown.
+             */
+            void reserve(size_t count) {
+                if (fossil_tofu_setof_reserve(set_, count) != 0) {
+                    throw std::runtime_error("Failed to reserve set capacity.");
+                }
+            }
+
+            /**
+             * @brief Puts a Bloom filter in front of the hash table.
+             * 
+             * @param bits_per_key Filter bits per slot; 0 selects the default.
+             * @throws std::runtime_error If the filter cannot be built.
+             */
+            void attach_filter(size_t bits_per_key = 0) {
+                if (fossil_tofu_setof_attach_filter(set_, bits_per_key) != 0) {
+                    throw std::runtime_error("Failed to attach set filter.");
+                }
+            }
+
+            /**
+             * @brief Drops the Bloom filter, if any.
+             */
+            void detach_filter() {
+                fossil_tofu_setof_detach_filter(set_);
+            }
+
+            /**
+             * @brief Checks whether a Bloom filter is attached.
+             * 
+             * @return True if a filter is attached.
+             */
+            bool has_filter() const {
+                return fossil_tofu_setof_has_filter(set_);
+            }
+
+            /**
+             * @brief Gets the number of slots in the hash table.
+             * 
+             * @return The slot count.
+             */
+            size_t capacity() const {
+                return fossil_tofu_setof_capacity(set_);
+            }
+
+            /**
+             * @brief Gets the current load factor.
+             * 
+             * @return The ratio of elements to slots.
+             */
+            float load_factor() const {
+                return fossil_tofu_setof_load_factor(set_);
+            }
+
+            /**
+             * @brief Sets the load factor at which the table grows.
+             * 
+             * @param max_load The new limit.
+             * @throws std::runtime_error If the limit is out of range.
+             */
+            void max_load_factor(float max_load) {
+                if (fossil_tofu_setof_set_max_load(set_, max_load) != 0) {
+                    throw std::runtime_error("Invalid set load factor.");
+                }
+            }
+
+            /**
+             * @brief Adds every element of another set to this one.
+             * 
+             * @param other The set whose elements are added.
+             * @throws std::runtime_error If the types differ or allocation fails.
+             */
+            void union_with(const SetOf& other) {
+                if (fossil_tofu_setof_union_with(set_, other.set_) != 0) {
+                    throw std::runtime_error("Failed to compute set union.");
+                }
+            }
+
+            /**
+             * @brief Keeps only the elements also present in another set.
+             * 
+             * @param other The set to intersect with.
+             * @throws std::runtime_error If the types differ.
+             */
+            void intersect_with(const SetOf& other) {
+                if (fossil_tofu_setof_intersect_with(set_, other.set_) != 0) {
+                    throw std::runtime_error("Failed to compute set intersection.");
+                }
+            }
+
+            /**
+             * @brief Removes the elements present in another set.
+             * 
+             * @param other The set whose elements are removed.
+             * @throws std::runtime_error If the types differ.
+             */
+            void difference_with(const SetOf& other) {
+                if (fossil_tofu_setof_difference_with(set_, other.set_) != 0) {
+                    throw std::runtime_error("Failed to compute set difference.");
+                }
+            }
+
+            /**
+             * @brief Keeps the elements present in exactly one of the two sets.
+             * 
+             * @param other The set to combine with.
+             * @throws std::runtime_error If the types differ or allocation fails.
+             */
+            void symmetric_difference_with(const SetOf& other) {
+                if (fossil_tofu_setof_symmetric_difference_with(set_, other.set_) != 0) {
+                    throw std::runtime_error("Failed to compute set symmetric difference.");
+                }
+            }
+
+            /**
+             * @brief Checks whether this set is a subset of another.
+             * 
+             * @param other The candidate superset.
+             * @return True if every element of this set is in `other`.
+             */
+            bool is_subset_of(const SetOf& other) const {
+                return fossil_tofu_setof_is_subset(set_, other.set_);
             }
 
             /**
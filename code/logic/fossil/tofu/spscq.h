@@ -0,0 +1,397 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef FOSSIL_TOFU_SPSCQ_H
+#define FOSSIL_TOFU_SPSCQ_H
+
+#include "tofu.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// *****************************************************************************
+// Type definitions
+// *****************************************************************************
+
+// Producer and consumer indices, each on its own cache line; defined in spscq.c.
+typedef struct fossil_tofu_spscq_ring_t fossil_tofu_spscq_ring_t;
+
+// Single-producer/single-consumer ring queue. It keeps the circular queue
+// vocabulary but is safe for exactly one thread inserting while one other
+// thread removes, without locks: each side owns one index and publishes it
+// with a release store. Capacity is rounded up to a power of two.
+// create_container and destroy are not thread-safe.
+typedef struct fossil_tofu_spscq_t {
+    char* type;
+    fossil_tofu_t* slots;
+    size_t capacity;
+    size_t mask;
+    fossil_tofu_spscq_ring_t* ring;
+} fossil_tofu_spscq_t;
+
+// *****************************************************************************
+// Function prototypes
+// *****************************************************************************
+
+/**
+ * Create a new single-producer/single-consumer queue.
+ *
+ * @param type     The type of data the queue will store as a string.
+ * @param capacity Minimum number of elements the queue can hold, rounded up to a power of two.
+ * @return         Pointer to the created queue, or NULL on failure or zero capacity.
+ * @note           Time complexity: O(capacity)
+ */
+fossil_tofu_spscq_t* fossil_tofu_spscq_create_container(char* type, size_t capacity);
+
+/**
+ * Destroy the queue, including any elements not yet removed.
+ *
+ * @param queue Pointer to the queue to destroy.
+ * @note        Time complexity: O(n)
+ * @details     Both threads must have stopped using the queue.
+ */
+void fossil_tofu_spscq_destroy(fossil_tofu_spscq_t* queue);
+
+// *****************************************************************************
+// Producer functions
+// *****************************************************************************
+
+/**
+ * Insert data at the rear of the queue.
+ *
+ * @param queue Pointer to the queue.
+ * @param data  The data to insert as a string.
+ * @return      FOSSIL_TOFU_SUCCESS, FOSSIL_TOFU_FAILURE if the queue is full,
+ *              or a negative error code.
+ * @note        Time complexity: O(1)
+ * @details     Producer thread only. Never blocks.
+ */
+int32_t fossil_tofu_spscq_insert(fossil_tofu_spscq_t* queue, char* data);
+
+/**
+ * Hand an existing tofu to the queue without copying its value.
+ *
+ * @param queue Pointer to the queue.
+ * @param tofu  Tofu to move in; on success it is zeroed and owned by the queue.
+ * @return      FOSSIL_TOFU_SUCCESS, FOSSIL_TOFU_FAILURE if the queue is full,
+ *              or FOSSIL_TOFU_ERROR_INVALID_ARGUMENT.
+ * @note        Time complexity: O(1)
+ * @details     Producer thread only. Performs no allocation.
+ */
+int32_t fossil_tofu_spscq_insert_tofu(fossil_tofu_spscq_t* queue, fossil_tofu_t* tofu);
+
+/**
+ * Insert up to 'count' strings with a single publication.
+ *
+ * @param queue Pointer to the queue.
+ * @param data  Array of strings to insert in order.
+ * @param count Number of entries in 'data'.
+ * @return      Number of elements inserted, which is less than 'count' when
+ *              the queue fills up or an allocation fails.
+ * @note        Time complexity: O(count)
+ * @details     Producer thread only. The consumer sees the whole batch at once,
+ *              which amortizes the cross-core index update.
+ */
+size_t fossil_tofu_spscq_insert_batch(fossil_tofu_spscq_t* queue, char* const data[], size_t count);
+
+// *****************************************************************************
+// Consumer functions
+// *****************************************************************************
+
+/**
+ * Remove and discard the front element.
+ *
+ * @param queue Pointer to the queue.
+ * @return      FOSSIL_TOFU_SUCCESS, or FOSSIL_TOFU_FAILURE if the queue is empty.
+ * @note        Time complexity: O(1)
+ * @details     Consumer thread only.
+ */
+int32_t fossil_tofu_spscq_remove(fossil_tofu_spscq_t* queue);
+
+/**
+ * Move the front element out of the queue.
+ *
+ * @param queue Pointer to the queue.
+ * @param out   Receives the tofu; the caller must fossil_tofu_destroy it.
+ * @return      FOSSIL_TOFU_SUCCESS, FOSSIL_TOFU_FAILURE if the queue is empty,
+ *              or FOSSIL_TOFU_ERROR_INVALID_ARGUMENT.
+ * @note        Time complexity: O(1)
+ * @details     Consumer thread only. Ownership moves to the caller, so the
+ *              value is never copied between the two threads.
+ */
+int32_t fossil_tofu_spscq_take(fossil_tofu_spscq_t* queue, fossil_tofu_t* out);
+
+/**
+ * Move up to 'max' elements out of the queue with a single publication.
+ *
+ * @param queue Pointer to the queue.
+ * @param out   Array of at least 'max' tofus; each filled entry must be destroyed by the caller.
+ * @param max   Maximum number of elements to take.
+ * @return      Number of elements taken.
+ * @note        Time complexity: O(max)
+ * @details     Consumer thread only.
+ */
+size_t fossil_tofu_spscq_take_batch(fossil_tofu_spscq_t* queue, fossil_tofu_t out[], size_t max);
+
+/**
+ * Get the element at the front of the queue.
+ *
+ * @param queue Pointer to the queue.
+ * @return      The front value, or NULL if the queue is empty.
+ * @note        Time complexity: O(1)
+ * @details     Consumer thread only; the pointer stays valid until the
+ *              consumer removes or takes that element.
+ */
+char* fossil_tofu_spscq_get_front(const fossil_tofu_spscq_t* queue);
+
+// *****************************************************************************
+// Utility functions
+// *****************************************************************************
+
+/**
+ * Get the number of elements in the queue.
+ *
+ * @param queue Pointer to the queue.
+ * @return      The element count, or 0 for NULL.
+ * @note        Time complexity: O(1)
+ * @details     Exact when called from either endpoint thread with the other
+ *              idle; otherwise a snapshot that may already be stale.
+ */
+size_t fossil_tofu_spscq_size(const fossil_tofu_spscq_t* queue);
+
+/**
+ * Get the capacity of the queue.
+ *
+ * @param queue Pointer to the queue.
+ * @return      The power-of-two capacity, or 0 for NULL.
+ * @note        Time complexity: O(1)
+ */
+size_t fossil_tofu_spscq_capacity(const fossil_tofu_spscq_t* queue);
+
+/**
+ * Check if the queue is empty.
+ *
+ * @param queue Pointer to the queue.
+ * @return      True if the queue has no elements or is NULL.
+ * @note        Time complexity: O(1)
+ */
+bool fossil_tofu_spscq_is_empty(const fossil_tofu_spscq_t* queue);
+
+/**
+ * Check if the queue is not empty.
+ *
+ * @param queue Pointer to the queue.
+ * @return      True if the queue has at least one element.
+ * @note        Time complexity: O(1)
+ */
+bool fossil_tofu_spscq_not_empty(const fossil_tofu_spscq_t* queue);
+
+/**
+ * Check if the queue is full.
+ *
+ * @param queue Pointer to the queue.
+ * @return      True if the queue holds 'capacity' elements.
+ * @note        Time complexity: O(1)
+ */
+bool fossil_tofu_spscq_is_full(const fossil_tofu_spscq_t* queue);
+
+/**
+ * Check if the queue is a null pointer.
+ *
+ * @param queue Pointer to the queue.
+ * @return      True if the queue pointer is NULL.
+ * @note        Time complexity: O(1)
+ */
+bool fossil_tofu_spscq_is_cnullptr(const fossil_tofu_spscq_t* queue);
+
+/**
+ * Check if the queue is not a null pointer.
+ *
+ * @param queue Pointer to the queue.
+ * @return      True if the queue pointer is valid.
+ * @note        Time complexity: O(1)
+ */
+bool fossil_tofu_spscq_not_cnullptr(const fossil_tofu_spscq_t* queue);
+
+#ifdef __cplusplus
+}
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace fossil {
+
+    namespace tofu {
+
+        /**
+         * @class SPSCQueue
+         * @brief C++ wrapper for the single-producer/single-consumer ring queue.
+         *
+         * One thread may call the producer members (insert, insert_batch) while
+         * another calls the consumer members (remove, take, take_batch, get_front).
+         */
+        class SPSCQueue {
+        public:
+            /**
+             * @brief Create a queue holding at least 'capacity' elements.
+             *
+             * @param type     The type of data the queue will store.
+             * @param capacity Minimum capacity, rounded up to a power of two.
+             * @throws std::runtime_error If the queue creation fails.
+             */
+            SPSCQueue(const std::string& type, size_t capacity) {
+                queue = fossil_tofu_spscq_create_container(const_cast<char*>(type.c_str()), capacity);
+                if (queue == nullptr) {
+                    throw std::runtime_error("Failed to create SPSC queue.");
+                }
+            }
+
+            SPSCQueue(const SPSCQueue&) = delete;
+            SPSCQueue& operator=(const SPSCQueue&) = delete;
+
+            /**
+             * @brief Destroy the queue and any elements left in it.
+             */
+            ~SPSCQueue() {
+                fossil_tofu_spscq_destroy(queue);
+            }
+
+            /**
+             * @brief Insert data at the rear (producer only).
+             *
+             * @param data The data to insert.
+             * @return 0 on success, FOSSIL_TOFU_FAILURE if full.
+             */
+            int32_t insert(const std::string& data) {
+                return fossil_tofu_spscq_insert(queue, const_cast<char*>(data.c_str()));
+            }
+
+            /**
+             * @brief Insert a batch with one publication (producer only).
+             *
+             * @param data Values to insert in order.
+             * @return Number of values inserted.
+             */
+            size_t insert_batch(const std::vector<std::string>& data) {
+                std::vector<char*> raw;
+                raw.reserve(data.size());
+                for (const std::string& item : data) {
+                    raw.push_back(const_cast<char*>(item.c_str()));
+                }
+                return fossil_tofu_spscq_insert_batch(queue, raw.data(), raw.size());
+            }
+
+            /**
+             * @brief Remove the front element (consumer only).
+             *
+             * @return 0 on success, FOSSIL_TOFU_FAILURE if empty.
+             */
+            int32_t remove() {
+                return fossil_tofu_spscq_remove(queue);
+            }
+
+            /**
+             * @brief Take the front element (consumer only).
+             *
+             * @param out Receives the value.
+             * @return True if an element was taken, false if the queue was empty.
+             */
+            bool take(std::string& out) {
+                fossil_tofu_t tofu;
+                if (fossil_tofu_spscq_take(queue, &tofu) != FOSSIL_TOFU_SUCCESS) {
+                    return false;
+                }
+                out = tofu.value.data;
+                fossil_tofu_destroy(&tofu);
+                return true;
+            }
+
+            /**
+             * @brief Take up to 'max' elements with one publication (consumer only).
+             *
+             * @param out Vector the values are appended to.
+             * @param max Maximum number of elements to take.
+             * @return Number of elements taken.
+             */
+            size_t take_batch(std::vector<std::string>& out, size_t max) {
+                std::vector<fossil_tofu_t> tofus(max);
+                size_t taken = fossil_tofu_spscq_take_batch(queue, tofus.data(), max);
+                for (size_t i = 0; i < taken; i++) {
+                    out.emplace_back(tofus[i].value.data);
+                    fossil_tofu_destroy(&tofus[i]);
+                }
+                return taken;
+            }
+
+            /**
+             * @brief Get the front element (consumer only).
+             *
+             * @return The front value, or an empty string if the queue is empty.
+             */
+            std::string get_front() const {
+                char* result = fossil_tofu_spscq_get_front(queue);
+                return result ? std::string(result) : std::string();
+            }
+
+            /**
+             * @brief Get the number of elements in the queue.
+             */
+            size_t size() const {
+                return fossil_tofu_spscq_size(queue);
+            }
+
+            /**
+             * @brief Get the power-of-two capacity of the queue.
+             */
+            size_t capacity() const {
+                return fossil_tofu_spscq_capacity(queue);
+            }
+
+            /**
+             * @brief Check if the queue is empty.
+             */
+            bool is_empty() const {
+                return fossil_tofu_spscq_is_empty(queue);
+            }
+
+            /**
+             * @brief Check if the queue is full.
+             */
+            bool is_full() const {
+                return fossil_tofu_spscq_is_full(queue);
+            }
+
+        private:
+            fossil_tofu_spscq_t* queue;
+        };
+
+    } // namespace tofu
+
+} // namespace fossil
+
+#endif
+
+#endif /* FOSSIL_TOFU_FRAMEWORK_H */
@@ -26,6 +26,7 @@
 #define FOSSIL_TOFU_STACK_H
 
 #include "tofu.h"
+#include "vector.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -36,15 +37,12 @@ extern "C"
 // Type definitions
 // *****************************************************************************
 
-// Stack structure
-typedef struct fossil_tofu_stack_node_t {
-    fossil_tofu_t data; // Data stored in the stack node
-    struct fossil_tofu_stack_node_t* next; // Pointer to the next node
-} fossil_tofu_stack_node_t;
-
+// Stack structure, stored as a contiguous array with the top at data[size - 1]
 typedef struct fossil_tofu_stack_t {
     char* type; // Type of the stack
-    fossil_tofu_stack_node_t* top; // Pointer to the top node of the stack
+    fossil_tofu_t* data; // Elements, bottom of the stack first
+    size_t size; // Number of elements in the stack
+    size_t capacity; // Number of slots allocated in data
 } fossil_tofu_stack_t;
 
 // *****************************************************************************
@@ -107,7 +105,7 @@ void fossil_tofu_stack_destroy(fossil_tofu_stack_t* stack);
  * @param stack The stack to insert data into.
  * @param data  The data to insert.
  * @return      The error code indicating the success or failure of the operation.
- * @note        Time complexity: O(1)
+ * @note        Time complexity: O(1) amortized
  */
 int32_t fossil_tofu_stack_insert(fossil_tofu_stack_t* stack, char *data);
 
@@ -120,15 +118,73 @@ int32_t fossil_tofu_stack_insert(fossil_tofu_stack_t* stack, char *data);
  */
 int32_t fossil_tofu_stack_remove(fossil_tofu_stack_t* stack);
 
+/**
+ * Grow the stack so it can hold at least 'capacity' elements without
+ * reallocating. Never shrinks the stack.
+ *
+ * @param stack    The stack to grow.
+ * @param capacity The number of elements to make room for.
+ * @return         The error code indicating the success or failure of the operation.
+ * @note           Time complexity: O(n)
+ */
+int32_t fossil_tofu_stack_reserve(fossil_tofu_stack_t* stack, size_t capacity);
+
+/**
+ * Push several elements in one call. data[0] is pushed first, so
+ * data[count - 1] ends up on top. Room is reserved before anything is
+ * pushed, so on failure the stack is left unchanged.
+ *
+ * @param stack The stack to push onto.
+ * @param data  The elements to push.
+ * @param count The number of elements in data.
+ * @return      The error code indicating the success or failure of the operation.
+ * @note        Time complexity: O(count) amortized
+ */
+int32_t fossil_tofu_stack_push_many(fossil_tofu_stack_t* stack, char** data, size_t count);
+
+/**
+ * Pop up to 'count' elements and append their values to a vector, the old
+ * top first. When vector is NULL the popped elements are discarded. If the
+ * vector cannot grow, popping stops and the remaining elements stay on the
+ * stack.
+ *
+ * @param stack  The stack to pop from.
+ * @param vector The vector receiving the popped values, or NULL.
+ * @param count  The maximum number of elements to pop.
+ * @return       The number of elements popped.
+ * @note         Time complexity: O(count)
+ */
+size_t fossil_tofu_stack_pop_many(fossil_tofu_stack_t* stack, fossil_tofu_vector_t* vector, size_t count);
+
 /**
  * Get the size of the stack.
  *
  * @param stack The stack for which to get the size.
  * @return      The size of the stack.
- * @note        Time complexity: O(n)
+ * @note        Time complexity: O(1)
  */
 size_t fossil_tofu_stack_size(const fossil_tofu_stack_t* stack);
 
+/**
+ * Get the number of elements the stack can hold before it reallocates.
+ *
+ * @param stack The stack for which to get the capacity.
+ * @return      The capacity of the stack.
+ * @note        Time complexity: O(1)
+ */
+size_t fossil_tofu_stack_capacity(const fossil_tofu_stack_t* stack);
+
+/**
+ * Check the internal invariants of the stack: the size never exceeds the
+ * capacity and allocated slots are backed by storage. Debug builds
+ * (FOSSIL_TOFU_DEBUG) run this after every mutation.
+ *
+ * @param stack The stack to check.
+ * @return      True if the stack is consistent, false otherwise.
+ * @note        Time complexity: O(1)
+ */
+bool fossil_tofu_stack_verify(const fossil_tofu_stack_t* stack);
+
 /**
  * Check if the stack is not empty.
  *
@@ -179,20 +235,23 @@ fossil_tofu_t fossil_tofu_stack_top(fossil_tofu_stack_t* stack);
 // *****************************************************************************
 
 /**
- * Get the element at the specified index in the stack.
+ * Get the element at the specified index in the stack, counting from the
+ * top (index 0 is the top element).
  * 
- * Time complexity: O(n)
+ * Time complexity: O(1)
  *
  * @param stack The stack from which to get the element.
  * @param index The index of the element to get.
- * @return      The element at the specified index.
+ * @return      The element at the specified index, or the default value if out of bounds.
  */
 fossil_tofu_t fossil_tofu_stack_get(const fossil_tofu_stack_t* stack, size_t index);
 
 /**
- * Set the element at the specified index in the stack.
+ * Set the element at the specified index in the stack, counting from the
+ * top. The element is copied; the caller keeps ownership of it. It may
+ * be the value returned by top() or get(), even for the same slot.
  * 
- * Time complexity: O(n)
+ * Time complexity: O(1)
  *
  * @param stack   The stack in which to set the element.
  * @param index   The index at which to set the element.
@@ -204,6 +263,7 @@ void fossil_tofu_stack_set(fossil_tofu_stack_t* stack, size_t index, fossil_tofu
 }
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 namespace fossil {
 
@@ -279,6 +339,63 @@ namespace fossil {
                     return fossil_tofu_stack_remove(stack_);
                 }
 
+                /**
+                 * Grow the stack so it can hold at least 'capacity' elements.
+                 *
+                 * @param capacity The number of elements to make room for.
+                 * @throws std::runtime_error If the allocation fails.
+                 */
+                void reserve(size_t capacity) {
+                    if (fossil_tofu_stack_reserve(stack_, capacity) != FOSSIL_TOFU_SUCCESS) {
+                        throw std::runtime_error("Failed to reserve stack capacity.");
+                    }
+                }
+
+                /**
+                 * Push several elements; the last one ends up on top.
+                 *
+                 * @param data The elements to push.
+                 * @return     The error code indicating the success or failure of the operation.
+                 */
+                int32_t push_many(const std::vector<std::string>& data) {
+                    std::vector<char*> values;
+                    values.reserve(data.size());
+                    for (const std::string& value : data) {
+                        values.push_back(const_cast<char*>(value.c_str()));
+                    }
+                    return fossil_tofu_stack_push_many(stack_, values.data(), values.size());
+                }
+
+                /**
+                 * Pop up to 'count' elements and append them to 'out', the old top first.
+                 *
+                 * @param out   The vector receiving the popped values.
+                 * @param count The maximum number of elements to pop.
+                 * @return      The number of elements popped.
+                 * @throws std::runtime_error If the staging vector cannot be created.
+                 */
+                size_t pop_many(std::vector<std::string>& out, size_t count) {
+                    // Grow 'out' before anything leaves the stack.
+                    out.reserve(out.size() + (count < size() ? count : size()));
+                    fossil_tofu_vector_t* popped = fossil_tofu_vector_create_container(stack_->type);
+                    if (!popped) {
+                        throw std::runtime_error("Failed to pop stack elements.");
+                    }
+                    size_t taken = fossil_tofu_stack_pop_many(stack_, popped, count);
+                    try {
+                        for (size_t i = 0; i < taken; i++) {
+                            out.emplace_back(fossil_tofu_vector_get(popped, i));
+                        }
+                    } catch (...) {
+                        fossil_tofu_vector_erase(popped);
+                        fossil_tofu_vector_destroy(popped);
+                        throw;
+                    }
+                    fossil_tofu_vector_erase(popped);
+                    fossil_tofu_vector_destroy(popped);
+                    return taken;
+                }
+
                 /**
                  * Get the size of the stack.
                  *
@@ -288,6 +405,24 @@ namespace fossil {
                     return fossil_tofu_stack_size(stack_);
                 }
 
+                /**
+                 * Get the number of elements the stack can hold before it reallocates.
+                 *
+                 * @return The capacity of the stack.
+                 */
+                size_t capacity() const {
+                    return fossil_tofu_stack_capacity(stack_);
+                }
+
+                /**
+                 * Check the internal invariants of the stack.
+                 *
+                 * @return True if the stack is consistent, false otherwise.
+                 */
+                bool verify() const {
+                    return fossil_tofu_stack_verify(stack_);
+                }
+
                 /**
                  * Check if the stack is not empty.
                  *
@@ -0,0 +1,185 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef FOSSIL_TOFU_THREADS_H
+#define FOSSIL_TOFU_THREADS_H
+
+#include "tofu.h"
+
+// Internal portability layer for the concurrent containers and the parallel
+// vector functions. Win32 primitives are used on Windows and pthreads on
+// every other platform that has them. Where neither exists the locks are
+// no-ops, no thread can be started, and callers fall back to serial code.
+// Not part of framework.h.
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#define FOSSIL_TOFU_THREADS_WIN32 1
+#elif defined(__unix__) || defined(__unix) || defined(__APPLE__)
+#include <pthread.h>
+#define FOSSIL_TOFU_THREADS_POSIX 1
+#endif
+
+#if defined(FOSSIL_TOFU_THREADS_WIN32) || defined(FOSSIL_TOFU_THREADS_POSIX)
+#define FOSSIL_TOFU_HAVE_THREADS 1
+#else
+#define FOSSIL_TOFU_HAVE_THREADS 0
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// *****************************************************************************
+// Type definitions
+// *****************************************************************************
+
+#if defined(FOSSIL_TOFU_THREADS_WIN32)
+typedef HANDLE fossil_tofu_thread_t;
+typedef SRWLOCK fossil_tofu_mutex_t;
+typedef SRWLOCK fossil_tofu_rwlock_t;
+typedef CONDITION_VARIABLE fossil_tofu_cond_t;
+typedef INIT_ONCE fossil_tofu_once_t;
+#define FOSSIL_TOFU_ONCE_INIT INIT_ONCE_STATIC_INIT
+#elif defined(FOSSIL_TOFU_THREADS_POSIX)
+typedef pthread_t fossil_tofu_thread_t;
+typedef pthread_mutex_t fossil_tofu_mutex_t;
+typedef pthread_rwlock_t fossil_tofu_rwlock_t;
+typedef pthread_cond_t fossil_tofu_cond_t;
+typedef pthread_once_t fossil_tofu_once_t;
+#define FOSSIL_TOFU_ONCE_INIT PTHREAD_ONCE_INIT
+#else
+typedef int fossil_tofu_thread_t;
+typedef int fossil_tofu_mutex_t;
+typedef int fossil_tofu_rwlock_t;
+typedef int fossil_tofu_cond_t;
+typedef int fossil_tofu_once_t;
+#define FOSSIL_TOFU_ONCE_INIT 0
+#endif
+
+// Entry point of a thread started with fossil_tofu_thread_create.
+typedef void* (*fossil_tofu_thread_fn)(void* arg);
+
+// Work item run by the shared worker pool.
+typedef void (*fossil_tofu_pool_fn)(void* item);
+
+// *****************************************************************************
+// Threads
+// *****************************************************************************
+
+/**
+ * Start a thread running routine(arg).
+ *
+ * @return FOSSIL_TOFU_SUCCESS, or FOSSIL_TOFU_FAILURE if the thread could not
+ *         be started or the platform has no threads.
+ */
+int32_t fossil_tofu_thread_create(fossil_tofu_thread_t* thread, fossil_tofu_thread_fn routine, void* arg);
+
+/**
+ * Wait for a thread to finish and release it.
+ */
+void fossil_tofu_thread_join(fossil_tofu_thread_t thread);
+
+/**
+ * Release a thread that will never be joined.
+ */
+void fossil_tofu_thread_detach(fossil_tofu_thread_t thread);
+
+/**
+ * Give up the rest of the calling thread's time slice.
+ */
+void fossil_tofu_thread_yield(void);
+
+/**
+ * Number of processors currently online, at least 1.
+ */
+size_t fossil_tofu_cpu_count(void);
+
+/**
+ * Milliseconds on a monotonic clock with an unspecified origin.
+ */
+uint64_t fossil_tofu_clock_ms(void);
+
+/**
+ * Run fn once per process, however many threads race to call this.
+ */
+void fossil_tofu_call_once(fossil_tofu_once_t* once, void (*fn)(void));
+
+// *****************************************************************************
+// Locks and condition variables
+// *****************************************************************************
+
+int32_t fossil_tofu_mutex_init(fossil_tofu_mutex_t* mutex);
+void fossil_tofu_mutex_destroy(fossil_tofu_mutex_t* mutex);
+void fossil_tofu_mutex_lock(fossil_tofu_mutex_t* mutex);
+void fossil_tofu_mutex_unlock(fossil_tofu_mutex_t* mutex);
+
+int32_t fossil_tofu_rwlock_init(fossil_tofu_rwlock_t* lock);
+void fossil_tofu_rwlock_destroy(fossil_tofu_rwlock_t* lock);
+void fossil_tofu_rwlock_read_lock(fossil_tofu_rwlock_t* lock);
+void fossil_tofu_rwlock_read_unlock(fossil_tofu_rwlock_t* lock);
+void fossil_tofu_rwlock_write_lock(fossil_tofu_rwlock_t* lock);
+void fossil_tofu_rwlock_write_unlock(fossil_tofu_rwlock_t* lock);
+
+/**
+ * Initialize a condition variable. Timed waits measure against a monotonic
+ * clock where the platform allows it, so wall-clock changes do not stretch
+ * or cut short a timeout.
+ */
+int32_t fossil_tofu_cond_init(fossil_tofu_cond_t* cond);
+void fossil_tofu_cond_destroy(fossil_tofu_cond_t* cond);
+void fossil_tofu_cond_wait(fossil_tofu_cond_t* cond, fossil_tofu_mutex_t* mutex);
+
+/**
+ * Wait at most 'ms' milliseconds. Like any condition wait it may return
+ * early without a signal; callers re-check their predicate.
+ *
+ * @return false if the wait timed out, true otherwise.
+ */
+bool fossil_tofu_cond_wait_ms(fossil_tofu_cond_t* cond, fossil_tofu_mutex_t* mutex, uint64_t ms);
+void fossil_tofu_cond_signal(fossil_tofu_cond_t* cond);
+void fossil_tofu_cond_broadcast(fossil_tofu_cond_t* cond);
+
+// *****************************************************************************
+// Worker pool
+// *****************************************************************************
+
+/**
+ * Run fn on 'count' items laid out 'stride' bytes apart, using a process-wide
+ * pool of persistent workers. The pool starts on first use with one worker
+ * per processor beyond the first. The calling thread works through its own
+ * items too, so nested calls make progress and a pool that could not start
+ * degrades to a serial loop. Returns once every item has finished.
+ */
+void fossil_tofu_pool_run(fossil_tofu_pool_fn fn, void* items, size_t stride, size_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FOSSIL_TOFU_FRAMEWORK_H */
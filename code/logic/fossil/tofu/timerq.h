@@ -0,0 +1,559 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef FOSSIL_TOFU_TIMERQ_H
+#define FOSSIL_TOFU_TIMERQ_H
+
+#include "tofu.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// *****************************************************************************
+// Type definitions
+// *****************************************************************************
+
+// Slots per wheel level as a power of two, and the number of levels. Four
+// levels of 256 one-millisecond slots span 2^32 ms (about 49 days); timers
+// further out wait in the top level and are re-filed as the wheel turns.
+#define FOSSIL_TOFU_TIMERQ_SLOT_BITS 8
+#define FOSSIL_TOFU_TIMERQ_SLOTS (1u << FOSSIL_TOFU_TIMERQ_SLOT_BITS)
+#define FOSSIL_TOFU_TIMERQ_LEVELS 4
+
+// Bucket lists: one per wheel slot plus a trailing list of timers that are
+// already due.
+#define FOSSIL_TOFU_TIMERQ_BUCKETS (FOSSIL_TOFU_TIMERQ_LEVELS * FOSSIL_TOFU_TIMERQ_SLOTS + 1)
+
+/**
+ * Stable reference to a scheduled timer. It is rejected once the timer has
+ * fired or been cancelled, even if its storage has been reused.
+ */
+typedef uint64_t fossil_tofu_timerq_handle_t;
+
+#define FOSSIL_TOFU_TIMERQ_HANDLE_INVALID UINT64_MAX
+
+typedef struct fossil_tofu_timerq_node_t {
+    fossil_tofu_t data;
+    uint64_t expiry;      // Absolute expiry in milliseconds since the Unix epoch
+    uint32_t prev;        // Bucket links; next doubles as the free-list link
+    uint32_t next;
+    uint32_t bucket;      // Bucket the timer is filed in
+    uint32_t generation;  // Bumped each time the node is released
+    bool live;
+} fossil_tofu_timerq_node_t;
+
+/**
+ * A hierarchical timing wheel. Timers carry a tofu payload and an absolute
+ * expiry in milliseconds; the wheel only moves when the caller advances it
+ * to a new time, so it works the same against a real or simulated clock.
+ *
+ * Scheduling and cancelling are O(1): a timer is linked into the slot of
+ * the lowest level whose span covers its distance from the current time.
+ * As the wheel turns, a higher-level slot is re-filed into the levels
+ * below it, so each timer is moved at most once per level before it fires.
+ * Timers live in one pooled node array and are addressed by index.
+ */
+typedef struct fossil_tofu_timerq_t {
+    fossil_tofu_timerq_node_t* nodes;
+    size_t node_count;      // Nodes ever handed out
+    size_t node_capacity;
+    uint32_t free_node;     // Head of the released-node list
+    uint32_t heads[FOSSIL_TOFU_TIMERQ_BUCKETS];
+    uint32_t tails[FOSSIL_TOFU_TIMERQ_BUCKETS];
+    uint64_t occupied[FOSSIL_TOFU_TIMERQ_LEVELS][FOSSIL_TOFU_TIMERQ_SLOTS / 64];
+    uint64_t now;           // Current wheel time in milliseconds
+    size_t size;
+    char* type;
+} fossil_tofu_timerq_t;
+
+/**
+ * Called once for each timer that fires. The payload is destroyed when the
+ * callback returns. The callback may schedule and cancel timers but must not
+ * advance or destroy the queue; timers it schedules at or before the current
+ * time fire no later than the next advance.
+ */
+typedef void (*fossil_tofu_timerq_fire_fn)(fossil_tofu_timerq_handle_t handle, const fossil_tofu_t* payload, void* context);
+
+// *****************************************************************************
+// Function prototypes
+// *****************************************************************************
+
+/**
+ * Create a new timer queue for payloads of the given type. The wheel starts
+ * at time 0; advance it to the current clock before scheduling relative
+ * timers.
+ *
+ * Time complexity: O(1)
+ *
+ * @param type The type of the payloads.
+ * @return     The created timer queue, or NULL on failure.
+ */
+fossil_tofu_timerq_t* fossil_tofu_timerq_create_container(char* type);
+
+/**
+ * Create a new timer queue with default values.
+ *
+ * Time complexity: O(1)
+ *
+ * @return The created timer queue, or NULL on failure.
+ */
+fossil_tofu_timerq_t* fossil_tofu_timerq_create_default(void);
+
+/**
+ * Create a copy of a timer queue. Handles into the original address the
+ * same timers in the copy.
+ *
+ * Time complexity: O(n)
+ *
+ * @param other The timer queue to copy.
+ * @return      The copy, or NULL on failure.
+ */
+fossil_tofu_timerq_t* fossil_tofu_timerq_create_copy(const fossil_tofu_timerq_t* other);
+
+/**
+ * Create a timer queue by moving the timers out of another one, which is
+ * left empty.
+ *
+ * Time complexity: O(1)
+ *
+ * @param other The timer queue to move from.
+ * @return      The new timer queue, or NULL on failure.
+ */
+fossil_tofu_timerq_t* fossil_tofu_timerq_create_move(fossil_tofu_timerq_t* other);
+
+/**
+ * Destroy a timer queue and every pending payload. Pending timers do not
+ * fire.
+ *
+ * Time complexity: O(n)
+ *
+ * @param timerq The timer queue to destroy.
+ */
+void fossil_tofu_timerq_destroy(fossil_tofu_timerq_t* timerq);
+
+// *****************************************************************************
+// Time parsing
+// *****************************************************************************
+
+/**
+ * Parse an ISO 8601 datetime such as "2024-06-01T12:34:56Z" into
+ * milliseconds since the Unix epoch. The time part, fractional seconds and
+ * a "Z" or "+HH:MM" offset are optional; no offset means UTC.
+ *
+ * Time complexity: O(n) in the text length
+ *
+ * @param text The datetime text.
+ * @param ms   Receives the parsed time.
+ * @return     FOSSIL_TOFU_SUCCESS, or FOSSIL_TOFU_ERROR_PARSE if the text is malformed.
+ */
+int32_t fossil_tofu_timerq_parse_datetime(const char* text, uint64_t* ms);
+
+/**
+ * Parse a duration such as "30s", "5m", "250ms" or "1h30m" into
+ * milliseconds. Units are ms, s, m, h, d and w.
+ *
+ * Time complexity: O(n) in the text length
+ *
+ * @param text The duration text.
+ * @param ms   Receives the parsed duration.
+ * @return     FOSSIL_TOFU_SUCCESS, FOSSIL_TOFU_ERROR_PARSE if the text is malformed,
+ *             or FOSSIL_TOFU_ERROR_OVERFLOW if it does not fit in 64 bits.
+ */
+int32_t fossil_tofu_timerq_parse_duration(const char* text, uint64_t* ms);
+
+// *****************************************************************************
+// Scheduling
+// *****************************************************************************
+
+/**
+ * Schedule a payload to fire at an absolute time. A time at or before the
+ * current wheel time fires on the next advance.
+ *
+ * Time complexity: O(1) amortized
+ *
+ * @param timerq The timer queue.
+ * @param data   The payload.
+ * @param expiry Absolute expiry in milliseconds since the Unix epoch.
+ * @param handle Receives the timer's handle; may be NULL.
+ * @return       The error code indicating the success or failure of the operation.
+ */
+int32_t fossil_tofu_timerq_schedule_at_ms(fossil_tofu_timerq_t* timerq, char* data, uint64_t expiry, fossil_tofu_timerq_handle_t* handle);
+
+/**
+ * Schedule a payload at an ISO 8601 datetime.
+ *
+ * Time complexity: O(1) amortized
+ *
+ * @param timerq   The timer queue.
+ * @param data     The payload.
+ * @param datetime The expiry, as accepted by fossil_tofu_timerq_parse_datetime.
+ * @param handle   Receives the timer's handle; may be NULL.
+ * @return         The error code indicating the success or failure of the operation.
+ */
+int32_t fossil_tofu_timerq_schedule_at(fossil_tofu_timerq_t* timerq, char* data, const char* datetime, fossil_tofu_timerq_handle_t* handle);
+
+/**
+ * Schedule a payload a duration after the current wheel time.
+ *
+ * Time complexity: O(1) amortized
+ *
+ * @param timerq   The timer queue.
+ * @param data     The payload.
+ * @param duration The delay, as accepted by fossil_tofu_timerq_parse_duration.
+ * @param handle   Receives the timer's handle; may be NULL.
+ * @return         The error code indicating the success or failure of the operation.
+ */
+int32_t fossil_tofu_timerq_schedule_in(fossil_tofu_timerq_t* timerq, char* data, const char* duration, fossil_tofu_timerq_handle_t* handle);
+
+/**
+ * Schedule a payload at a time given as a tofu: a datetime is an absolute
+ * expiry and a duration is a delay from the current wheel time.
+ *
+ * Time complexity: O(1) amortized
+ *
+ * @param timerq The timer queue.
+ * @param data   The payload.
+ * @param when   A tofu of type datetime or duration.
+ * @param handle Receives the timer's handle; may be NULL.
+ * @return       The error code indicating the success or failure of the operation;
+ *               FOSSIL_TOFU_ERROR_TYPE_MISMATCH for any other tofu type.
+ */
+int32_t fossil_tofu_timerq_schedule(fossil_tofu_timerq_t* timerq, char* data, const fossil_tofu_t* when, fossil_tofu_timerq_handle_t* handle);
+
+/**
+ * Cancel a pending timer and destroy its payload.
+ *
+ * Time complexity: O(1)
+ *
+ * @param timerq The timer queue.
+ * @param handle The timer's handle.
+ * @return       FOSSIL_TOFU_SUCCESS, or FOSSIL_TOFU_ERROR_NOT_FOUND if the timer
+ *               already fired or was cancelled.
+ */
+int32_t fossil_tofu_timerq_cancel(fossil_tofu_timerq_t* timerq, fossil_tofu_timerq_handle_t handle);
+
+/**
+ * Move the wheel forward to the given time, firing every timer that expires
+ * on the way in expiry order; timers that were already due when scheduled
+ * fire first. Stretches with nothing pending are skipped without visiting
+ * each millisecond. A time before the current one fires only timers that
+ * are already due.
+ *
+ * Time complexity: amortized O(1) per fired timer plus O(1) per non-empty slot visited
+ *
+ * @param timerq  The timer queue.
+ * @param now     The new time in milliseconds since the Unix epoch.
+ * @param fire    Called for each fired timer; may be NULL to drop them.
+ * @param context Passed through to fire.
+ * @return        The number of timers fired.
+ */
+size_t fossil_tofu_timerq_advance(fossil_tofu_timerq_t* timerq, uint64_t now, fossil_tofu_timerq_fire_fn fire, void* context);
+
+// *****************************************************************************
+// Getter functions
+// *****************************************************************************
+
+/**
+ * Get the payload and expiry of a pending timer.
+ *
+ * Time complexity: O(1)
+ *
+ * @param timerq The timer queue.
+ * @param handle The timer's handle.
+ * @param expiry Receives the expiry; may be NULL.
+ * @return       The payload, or NULL if the timer is no longer pending.
+ */
+const fossil_tofu_t* fossil_tofu_timerq_get(const fossil_tofu_timerq_t* timerq, fossil_tofu_timerq_handle_t handle, uint64_t* expiry);
+
+/**
+ * Check whether a timer is still pending.
+ *
+ * Time complexity: O(1)
+ *
+ * @param timerq The timer queue.
+ * @param handle The timer's handle.
+ * @return       True if the timer is pending, false otherwise.
+ */
+bool fossil_tofu_timerq_contains(const fossil_tofu_timerq_t* timerq, fossil_tofu_timerq_handle_t handle);
+
+/**
+ * Get the current wheel time.
+ *
+ * Time complexity: O(1)
+ *
+ * @param timerq The timer queue.
+ * @return       The time last passed to fossil_tofu_timerq_advance.
+ */
+uint64_t fossil_tofu_timerq_now(const fossil_tofu_timerq_t* timerq);
+
+/**
+ * Get the latest time the caller can sleep until without missing a timer.
+ * This is the next slot the wheel must visit, which is never later than
+ * the earliest pending expiry but may be earlier when that slot only
+ * re-files timers.
+ *
+ * Time complexity: O(1)
+ *
+ * @param timerq   The timer queue.
+ * @param deadline Receives the time.
+ * @return         FOSSIL_TOFU_SUCCESS, or FOSSIL_TOFU_ERROR_NOT_FOUND if no timer is pending.
+ */
+int32_t fossil_tofu_timerq_next_deadline(const fossil_tofu_timerq_t* timerq, uint64_t* deadline);
+
+/**
+ * Get the number of pending timers.
+ *
+ * Time complexity: O(1)
+ *
+ * @param timerq The timer queue.
+ * @return       The number of pending timers.
+ */
+size_t fossil_tofu_timerq_size(const fossil_tofu_timerq_t* timerq);
+
+/**
+ * Check if the timer queue has no pending timers.
+ *
+ * Time complexity: O(1)
+ *
+ * @param timerq The timer queue.
+ * @return       True if no timer is pending, false otherwise.
+ */
+bool fossil_tofu_timerq_is_empty(const fossil_tofu_timerq_t* timerq);
+
+/**
+ * Check if the timer queue has pending timers.
+ *
+ * Time complexity: O(1)
+ *
+ * @param timerq The timer queue.
+ * @return       True if a timer is pending, false otherwise.
+ */
+bool fossil_tofu_timerq_not_empty(const fossil_tofu_timerq_t* timerq);
+
+/**
+ * Check if the timer queue is a null pointer.
+ *
+ * Time complexity: O(1)
+ *
+ * @param timerq The timer queue.
+ * @return       True if the timer queue is a null pointer, false otherwise.
+ */
+bool fossil_tofu_timerq_is_cnullptr(const fossil_tofu_timerq_t* timerq);
+
+/**
+ * Check if the timer queue is not a null pointer.
+ *
+ * Time complexity: O(1)
+ *
+ * @param timerq The timer queue.
+ * @return       True if the timer queue is not a null pointer, false otherwise.
+ */
+bool fossil_tofu_timerq_not_cnullptr(const fossil_tofu_timerq_t* timerq);
+
+#ifdef __cplusplus
+}
+#include <stdexcept>
+#include <string>
+
+namespace fossil {
+
+    namespace tofu {
+
+        class TimerQ {
+        public:
+            /**
+             * Create a timer queue for payloads of the given type.
+             * Throws a runtime_error if the queue creation fails.
+             *
+             * @param type The type of the payloads.
+             */
+            TimerQ(const std::string& type = "any") {
+                timerq = fossil_tofu_timerq_create_container(const_cast<char*>(type.c_str()));
+                if (timerq == nullptr) {
+                    throw std::runtime_error("Failed to create timer queue");
+                }
+            }
+
+            /**
+             * Copy constructor. Throws a runtime_error if the copy fails.
+             *
+             * @param other The timer queue to copy.
+             */
+            TimerQ(const TimerQ& other) {
+                timerq = fossil_tofu_timerq_create_copy(other.timerq);
+                if (timerq == nullptr) {
+                    throw std::runtime_error("Failed to create timer queue");
+                }
+            }
+
+            /**
+             * Move constructor. Takes ownership of the other queue's timers.
+             *
+             * @param other The timer queue to move from.
+             */
+            TimerQ(TimerQ&& other) noexcept {
+                timerq = fossil_tofu_timerq_create_move(other.timerq);
+            }
+
+            TimerQ& operator=(const TimerQ&) = delete;
+            TimerQ& operator=(TimerQ&&) = delete;
+
+            /**
+             * Destructor. Destroys the queue and every pending payload.
+             */
+            ~TimerQ() {
+                fossil_tofu_timerq_destroy(timerq);
+            }
+
+            /**
+             * Schedule a payload at an absolute time in milliseconds.
+             *
+             * @param data   The payload.
+             * @param expiry Absolute expiry in milliseconds since the Unix epoch.
+             * @return       The timer's handle.
+             */
+            fossil_tofu_timerq_handle_t schedule_at_ms(const std::string& data, uint64_t expiry) {
+                fossil_tofu_timerq_handle_t handle = FOSSIL_TOFU_TIMERQ_HANDLE_INVALID;
+                check(fossil_tofu_timerq_schedule_at_ms(timerq, const_cast<char*>(data.c_str()), expiry, &handle));
+                return handle;
+            }
+
+            /**
+             * Schedule a payload at an ISO 8601 datetime.
+             *
+             * @param data     The payload.
+             * @param datetime The expiry.
+             * @return         The timer's handle.
+             */
+            fossil_tofu_timerq_handle_t schedule_at(const std::string& data, const std::string& datetime) {
+                fossil_tofu_timerq_handle_t handle = FOSSIL_TOFU_TIMERQ_HANDLE_INVALID;
+                check(fossil_tofu_timerq_schedule_at(timerq, const_cast<char*>(data.c_str()), datetime.c_str(), &handle));
+                return handle;
+            }
+
+            /**
+             * Schedule a payload a duration after the current wheel time.
+             *
+             * @param data     The payload.
+             * @param duration The delay, e.g. "30s" or "1h30m".
+             * @return         The timer's handle.
+             */
+            fossil_tofu_timerq_handle_t schedule_in(const std::string& data, const std::string& duration) {
+                fossil_tofu_timerq_handle_t handle = FOSSIL_TOFU_TIMERQ_HANDLE_INVALID;
+                check(fossil_tofu_timerq_schedule_in(timerq, const_cast<char*>(data.c_str()), duration.c_str(), &handle));
+                return handle;
+            }
+
+            /**
+             * Cancel a pending timer.
+             *
+             * @param handle The timer's handle.
+             * @return       True if the timer was pending.
+             */
+            bool cancel(fossil_tofu_timerq_handle_t handle) {
+                return fossil_tofu_timerq_cancel(timerq, handle) == FOSSIL_TOFU_SUCCESS;
+            }
+
+            /**
+             * Move the wheel forward, calling fn for each timer that fires.
+             *
+             * @param now The new time in milliseconds since the Unix epoch.
+             * @param fn  Callable taking (fossil_tofu_timerq_handle_t handle, const fossil_tofu_t& payload).
+             * @return    The number of timers fired.
+             */
+            template <typename F>
+            size_t advance(uint64_t now, F fn) {
+                return fossil_tofu_timerq_advance(timerq, now, &TimerQ::fire_trampoline<F>, &fn);
+            }
+
+            /**
+             * Move the wheel forward, dropping the timers that fire.
+             *
+             * @param now The new time in milliseconds since the Unix epoch.
+             * @return    The number of timers fired.
+             */
+            size_t advance(uint64_t now) {
+                return fossil_tofu_timerq_advance(timerq, now, nullptr, nullptr);
+            }
+
+            /**
+             * Check whether a timer is still pending.
+             *
+             * @param handle The timer's handle.
+             * @return       True if the timer is pending.
+             */
+            bool contains(fossil_tofu_timerq_handle_t handle) const {
+                return fossil_tofu_timerq_contains(timerq, handle);
+            }
+
+            /**
+             * Get the current wheel time.
+             *
+             * @return The current time in milliseconds.
+             */
+            uint64_t now() const {
+                return fossil_tofu_timerq_now(timerq);
+            }
+
+            /**
+             * Get the number of pending timers.
+             *
+             * @return The number of pending timers.
+             */
+            size_t size() const {
+                return fossil_tofu_timerq_size(timerq);
+            }
+
+            /**
+             * Check if no timer is pending.
+             *
+             * @return True if the queue is empty.
+             */
+            bool is_empty() const {
+                return fossil_tofu_timerq_is_empty(timerq);
+            }
+
+        private:
+            template <typename F>
+            static void fire_trampoline(fossil_tofu_timerq_handle_t handle, const fossil_tofu_t* payload, void* context) {
+                (*static_cast<F*>(context))(handle, *payload);
+            }
+
+            static void check(int32_t result) {
+                if (result != FOSSIL_TOFU_SUCCESS) {
+                    throw std::runtime_error("Failed to schedule timer");
+                }
+            }
+
+            fossil_tofu_timerq_t* timerq;
+        };
+
+    } // namespace tofu
+
+} // namespace fossil
+
+#endif
+
+#endif /* FOSSIL_TOFU_FRAMEWORK_H */
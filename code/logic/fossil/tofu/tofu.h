@@ -37,6 +37,26 @@
 
 #define INITIAL_CAPACITY 10
 
+// Numeric container keys match by value only when their text is shorter
+// than this, so lookups can parse them in a stack buffer. Longer numeric
+// text matches exactly, like any other key.
+#define FOSSIL_TOFU_KEY_TEXT_MAX 64
+
+// Container self-checks. Building with FOSSIL_TOFU_DEBUG defined (meson
+// -Dwith_debug_checks=enabled) runs the verify function of the linked
+// containers after every mutation and aborts on the first broken invariant.
+#ifdef FOSSIL_TOFU_DEBUG
+#define FOSSIL_TOFU_DEBUG_CHECK(check) \
+    do { \
+        if (!(check)) { \
+            fprintf(stderr, "fossil tofu invariant failed: %s (%s:%d)\n", #check, __FILE__, __LINE__); \
+            abort(); \
+        } \
+    } while (0)
+#else
+#define FOSSIL_TOFU_DEBUG_CHECK(check) ((void)0)
+#endif
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -630,6 +650,162 @@ void* fossil_tofu_as_any(const fossil_tofu_t *tofu);
  */
 fossil_tofu_t fossil_tofu_from_any(void *data, size_t size);
 
+// *****************************************************************************
+// Numeric aggregation kernels
+// *****************************************************************************
+
+/**
+ * @brief Running summary of a numeric sequence.
+ *
+ * Blocks are folded in with a pairwise (Chan et al.) merge, so the variance
+ * stays accurate over very long sequences.
+ */
+typedef struct {
+    size_t count;  // Number of values folded in
+    double sum;    // Sum of all values
+    double min;    // Smallest value seen
+    double max;    // Largest value seen
+    double m2;     // Sum of squared deviations from the mean
+} fossil_tofu_stats_t;
+
+/**
+ * @brief Predicate used by the count_if reductions.
+ */
+typedef bool (*fossil_tofu_predicate_t)(double value, void *context);
+
+/**
+ * @brief Returns true for the integer, floating point and size types.
+ */
+bool fossil_tofu_type_is_numeric(fossil_tofu_type_t type);
+
+/**
+ * @brief Resets a stats accumulator to the empty state.
+ */
+void fossil_tofu_stats_init(fossil_tofu_stats_t *stats);
+
+/**
+ * @brief Folds a packed array of doubles into a stats accumulator.
+ *
+ * Uses AVX or SSE2 when the target supports it, with a scalar fallback.
+ *
+ * @note O(n) - Linear time complexity.
+ */
+void fossil_tofu_stats_add_f64(fossil_tofu_stats_t *stats, const double *values, size_t count);
+
+/**
+ * @brief Folds an array of boxed tofu into a stats accumulator.
+ *
+ * Each numeric element is parsed once into a block buffer which is then
+ * reduced with fossil_tofu_stats_add_f64. Non-numeric elements are skipped.
+ *
+ * @note O(n) - Linear time complexity.
+ */
+void fossil_tofu_stats_add_tofu(fossil_tofu_stats_t *stats, const fossil_tofu_t *items, size_t count);
+
+/**
+ * @brief Returns the population variance of the accumulated values.
+ */
+double fossil_tofu_stats_variance(const fossil_tofu_stats_t *stats);
+
+/**
+ * @brief Counts the packed doubles that satisfy a predicate.
+ *
+ * @note O(n) - Linear time complexity.
+ */
+size_t fossil_tofu_count_if_f64(const double *values, size_t count, fossil_tofu_predicate_t predicate, void *context);
+
+/**
+ * @brief Counts the numeric tofu elements that satisfy a predicate.
+ *
+ * @note O(n) - Linear time complexity.
+ */
+size_t fossil_tofu_count_if_tofu(const fossil_tofu_t *items, size_t count, fossil_tofu_predicate_t predicate, void *context);
+
+// *****************************************************************************
+// Search kernels
+// *****************************************************************************
+
+/**
+ * @brief Computes the 64-bit hash cached in `value.hash` for a value string.
+ *
+ * @param data NUL-terminated value text.
+ * @return The hash, or 0 for NULL.
+ * @note O(n) - Linear in the length of the text.
+ */
+uint64_t fossil_tofu_hash64(const char *data);
+
+/**
+ * @brief Computes a seeded 64-bit hash over `len` bytes.
+ *
+ * With a zero seed this matches fossil_tofu_hash64 for the same text, which
+ * lets containers hash a borrowed key without copying it.
+ *
+ * @note O(n) - Linear in `len`.
+ */
+uint64_t fossil_tofu_hash64_seed(const void *data, size_t len, uint64_t seed);
+
+/**
+ * @brief Checks whether a tofu holds exactly the given value text.
+ *
+ * This is the allocation-free equality used by hashed containers. As with
+ * fossil_tofu_search, matching is by exact value text.
+ *
+ * @param tofu The stored tofu.
+ * @param text Candidate value text, not necessarily NUL-terminated.
+ * @param len  Length of `text` in bytes.
+ * @return true if the stored text is exactly `text`.
+ * @note O(n) - Linear in `len`.
+ */
+bool fossil_tofu_equals_text(const fossil_tofu_t *tofu, const char *text, size_t len);
+
+/**
+ * @brief Hashes a container key consistently with fossil_tofu_compare.
+ *
+ * Integer and floating-point keys shorter than FOSSIL_TOFU_KEY_TEXT_MAX
+ * that parse completely hash the parsed value, so texts such as "5" and
+ * "05" that fossil_tofu_compare treats as equal hash the same. Every other
+ * key hashes its text, as fossil_tofu_hash64_seed with a zero seed does.
+ * Never allocates.
+ *
+ * @param type Declared key type of the container.
+ * @param text Key text, not necessarily NUL-terminated.
+ * @param len  Length of `text` in bytes.
+ * @return The key hash, or 0 for NULL.
+ * @note O(n) - Linear in `len`.
+ */
+uint64_t fossil_tofu_hash_key(fossil_tofu_type_t type, const char *text, size_t len);
+
+/**
+ * @brief Checks whether a stored key equals candidate key text.
+ *
+ * The equality that goes with fossil_tofu_hash_key: numeric keys shorter
+ * than FOSSIL_TOFU_KEY_TEXT_MAX compare by value as fossil_tofu_compare
+ * does, anything else by exact text. Never allocates.
+ *
+ * @param tofu The stored key.
+ * @param text Candidate key text, not necessarily NUL-terminated.
+ * @param len  Length of `text` in bytes.
+ * @return true if the keys are equal.
+ * @note O(n) - Linear in `len`.
+ */
+bool fossil_tofu_equals_key(const fossil_tofu_t *tofu, const char *text, size_t len);
+
+/**
+ * @brief Finds the first element of a tofu array equal to a value.
+ *
+ * Elements are screened by their cached value hash and only hash hits are
+ * confirmed with fossil_tofu_compare, so a miss never touches the element
+ * strings. Matching is by exact value text: "1" and "01" are different.
+ *
+ * @param items Pointer to the first element.
+ * @param count Number of elements.
+ * @param type  Type of the value being searched for.
+ * @param value Value to search for.
+ * @return Index of the first match, or count if there is none.
+ * @note O(n) - Linear time complexity.
+ */
+size_t fossil_tofu_search(const fossil_tofu_t *items, size_t count, fossil_tofu_type_t type, const char *value);
+
 // *****************************************************************************
 // Memory management functions
 // *****************************************************************************
@@ -41,7 +41,7 @@ typedef struct {
     fossil_tofu_t* elements;  // Dynamic array of ToFu elements in the tuple
     size_t element_count;     // Number of elements in the tuple
     size_t capacity;          // Capacity of the tuple
-    char* type;               // Expected type of elements in the tuple
+    char* type;               // Expected type of elements, owned by the tuple
 } fossil_tofu_tuple_t;
 
 // *****************************************************************************
@@ -208,6 +208,86 @@ void fossil_tofu_tuple_set_front(fossil_tofu_tuple_t* tuple, char *element);
  */
 void fossil_tofu_tuple_set_back(fossil_tofu_tuple_t* tuple, char *element);
 
+// *****************************************************************************
+// Aggregation functions
+// *****************************************************************************
+
+/**
+ * @brief Folds every numeric element of the tuple into a stats accumulator in a
+ * single pass.
+ *
+ * @param tuple  The tuple to reduce.
+ * @param stats  Receives count, sum, min, max and squared deviations.
+ * @return       FOSSIL_TOFU_SUCCESS, or an error code on failure.
+ * @note Time complexity: O(n)
+ */
+int32_t fossil_tofu_tuple_stats(const fossil_tofu_tuple_t* tuple, fossil_tofu_stats_t* stats);
+
+/**
+ * @brief Computes the sum of the numeric elements in the tuple.
+ *
+ * @param tuple  The tuple to reduce.
+ * @param out    Receives the sum (0 for an empty tuple).
+ * @return       FOSSIL_TOFU_SUCCESS, or an error code on failure.
+ * @note Time complexity: O(n)
+ */
+int32_t fossil_tofu_tuple_sum(const fossil_tofu_tuple_t* tuple, double* out);
+
+/**
+ * @brief Finds the smallest numeric element in the tuple.
+ *
+ * @param tuple  The tuple to reduce.
+ * @param out    Receives the minimum.
+ * @return       FOSSIL_TOFU_SUCCESS, FOSSIL_TOFU_ERROR_NOT_FOUND if the tuple holds
+ *               no numeric elements, or another error code on failure.
+ * @note Time complexity: O(n)
+ */
+int32_t fossil_tofu_tuple_min(const fossil_tofu_tuple_t* tuple, double* out);
+
+/**
+ * @brief Finds the largest numeric element in the tuple.
+ *
+ * @param tuple  The tuple to reduce.
+ * @param out    Receives the maximum.
+ * @return       FOSSIL_TOFU_SUCCESS, FOSSIL_TOFU_ERROR_NOT_FOUND if the tuple holds
+ *               no numeric elements, or another error code on failure.
+ * @note Time complexity: O(n)
+ */
+int32_t fossil_tofu_tuple_max(const fossil_tofu_tuple_t* tuple, double* out);
+
+/**
+ * @brief Computes the arithmetic mean of the numeric elements in the tuple.
+ *
+ * @param tuple  The tuple to reduce.
+ * @param out    Receives the mean.
+ * @return       FOSSIL_TOFU_SUCCESS, FOSSIL_TOFU_ERROR_NOT_FOUND if the tuple holds
+ *               no numeric elements, or another error code on failure.
+ * @note Time complexity: O(n)
+ */
+int32_t fossil_tofu_tuple_mean(const fossil_tofu_tuple_t* tuple, double* out);
+
+/**
+ * @brief Computes the population variance of the numeric elements in the tuple.
+ *
+ * @param tuple  The tuple to reduce.
+ * @param out    Receives the variance.
+ * @return       FOSSIL_TOFU_SUCCESS, FOSSIL_TOFU_ERROR_NOT_FOUND if the tuple holds
+ *               no numeric elements, or another error code on failure.
+ * @note Time complexity: O(n)
+ */
+int32_t fossil_tofu_tuple_variance(const fossil_tofu_tuple_t* tuple, double* out);
+
+/**
+ * @brief Counts the numeric elements of the tuple that satisfy a predicate.
+ *
+ * @param tuple     The tuple to scan.
+ * @param predicate Called with each numeric element.
+ * @param context   Passed through to the predicate.
+ * @return          The number of matching elements.
+ * @note Time complexity: O(n)
+ */
+size_t fossil_tofu_tuple_count_if(const fossil_tofu_tuple_t* tuple, fossil_tofu_predicate_t predicate, void* context);
+
 #ifdef __cplusplus
 }
 #include <stdexcept>
@@ -392,6 +472,87 @@ namespace fossil {
                     fossil_tofu_tuple_set_back(tuple_, const_cast<char*>(element.c_str()));
                 }
 
+                /**
+                 * Computes the sum of the numeric elements.
+                 *
+                 * @return The result of the reduction.
+                 * @throws std::runtime_error If the container holds no numeric elements.
+                 */
+                double sum() const {
+                    double result = 0.0;
+                    if (fossil_tofu_tuple_sum(tuple_, &result) != FOSSIL_TOFU_SUCCESS) {
+                        throw std::runtime_error("Failed to compute sum");
+                    }
+                    return result;
+                }
+
+                /**
+                 * Finds the smallest numeric element.
+                 *
+                 * @return The result of the reduction.
+                 * @throws std::runtime_error If the container holds no numeric elements.
+                 */
+                double min() const {
+                    double result = 0.0;
+                    if (fossil_tofu_tuple_min(tuple_, &result) != FOSSIL_TOFU_SUCCESS) {
+                        throw std::runtime_error("Failed to compute min");
+                    }
+                    return result;
+                }
+
+                /**
+                 * Finds the largest numeric element.
+                 *
+                 * @return The result of the reduction.
+                 * @throws std::runtime_error If the container holds no numeric elements.
+                 */
+                double max() const {
+                    double result = 0.0;
+                    if (fossil_tofu_tuple_max(tuple_, &result) != FOSSIL_TOFU_SUCCESS) {
+                        throw std::runtime_error("Failed to compute max");
+                    }
+                    return result;
+                }
+
+                /**
+                 * Computes the arithmetic mean of the numeric elements.
+                 *
+                 * @return The result of the reduction.
+                 * @throws std::runtime_error If the container holds no numeric elements.
+                 */
+                double mean() const {
+                    double result = 0.0;
+                    if (fossil_tofu_tuple_mean(tuple_, &result) != FOSSIL_TOFU_SUCCESS) {
+                        throw std::runtime_error("Failed to compute mean");
+                    }
+                    return result;
+                }
+
+                /**
+                 * Computes the population variance of the numeric elements.
+                 *
+                 * @return The result of the reduction.
+                 * @throws std::runtime_error If the container holds no numeric elements.
+                 */
+                double variance() const {
+                    double result = 0.0;
+                    if (fossil_tofu_tuple_variance(tuple_, &result) != FOSSIL_TOFU_SUCCESS) {
+                        throw std::runtime_error("Failed to compute variance");
+                    }
+                    return result;
+                }
+
+                /**
+                 * Counts the numeric elements that satisfy a predicate.
+                 *
+                 * @param predicate Called with each numeric element.
+                 * @param context   Passed through to the predicate.
+                 * @return          The number of matching elements.
+                 */
+                size_t count_if(fossil_tofu_predicate_t predicate, void* context = nullptr) const {
+                    return fossil_tofu_tuple_count_if(tuple_, predicate, context);
+                }
+
             private:
                 fossil_tofu_tuple_t* tuple_; /**< Pointer to the underlying fossil_tofu_tuple_t structure. */
         };
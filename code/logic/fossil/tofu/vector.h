@@ -35,13 +35,31 @@ extern "C" {
 // Type definitions
 // *****************************************************************************
 
+// Size of a buffer that holds any formatted columnar value.
+#define FOSSIL_TOFU_VECTOR_VALUE_BUFFER 48
+
 typedef struct {
     fossil_tofu_t* data;
     size_t size;
     size_t capacity;
-    char* type;
+    char* type;                      // Owned copy of the element type
+    void* column;                    // Packed native values (columnar vectors only)
+    uint8_t* nulls;                  // Optional null bitmap, allocated on first null
+    size_t element_size;             // Width of one packed value, 0 for boxed vectors
+    fossil_tofu_type_t column_type;  // Native type of the packed values
 } fossil_tofu_vector_t;
 
+// Size of the buffer a map callback writes its result into.
+#define FOSSIL_TOFU_VECTOR_MAP_BUFFER 256
+
+// Callbacks for the bulk transform functions. Elements are passed as their
+// string value; null slots of a columnar vector are passed as NULL.
+typedef void (*fossil_tofu_vector_each_fn)(size_t index, const char *element, void *context);
+typedef bool (*fossil_tofu_vector_map_fn)(const char *element, char *out, size_t size, void *context);
+typedef bool (*fossil_tofu_vector_pred_fn)(const char *element, void *context);
+typedef void (*fossil_tofu_vector_fold_fn)(void *accumulator, const char *element, void *context);
+typedef void (*fossil_tofu_vector_combine_fn)(void *accumulator, const void *partial, void *context);
+
 // *****************************************************************************
 // Function prototypes
 // *****************************************************************************
@@ -56,6 +74,23 @@ typedef struct {
  */
 fossil_tofu_vector_t* fossil_tofu_vector_create_container(char* type);
 
+/**
+ * Create a new columnar vector for a numeric element type.
+ *
+ * A columnar vector stores raw packed native values (i8 through u64, f32
+ * and f64) instead of one fossil_tofu_t per element, plus an optional null
+ * bitmap. The string based push/get/set API keeps working and converts at
+ * the boundary; a NULL or unparsable element is stored as null. Strings
+ * returned by the getters live in a per-vector buffer that is overwritten
+ * by the next get on the same vector.
+ * 
+ * Time complexity: O(1)
+ *
+ * @param type The numeric element type ("i32", "f64", ...).
+ * @return     The created vector, or NULL if the type is not numeric.
+ */
+fossil_tofu_vector_t* fossil_tofu_vector_create_columnar(char* type);
+
 /**
  * Create a new vector with default values.
  * 
@@ -226,6 +261,29 @@ size_t fossil_tofu_vector_size(const fossil_tofu_vector_t* vector);
  */
 size_t fossil_tofu_vector_capacity(const fossil_tofu_vector_t* vector);
 
+/**
+ * Check if the vector uses columnar storage.
+ * 
+ * Time complexity: O(1)
+ *
+ * @param vector The vector to check.
+ * @return       True if the vector stores packed native values, false otherwise.
+ */
+bool fossil_tofu_vector_is_columnar(const fossil_tofu_vector_t* vector);
+
+/**
+ * Check if the element at the specified index is null.
+ * 
+ * Boxed vectors report an element as null when it holds no value.
+ * 
+ * Time complexity: O(1)
+ *
+ * @param vector The vector to check.
+ * @param index  The index of the element.
+ * @return       True if the element is null or the index is out of range.
+ */
+bool fossil_tofu_vector_is_null(const fossil_tofu_vector_t* vector, size_t index);
+
 // *****************************************************************************
 // Getter and setter functions
 // *****************************************************************************
@@ -235,19 +293,39 @@ size_t fossil_tofu_vector_capacity(const fossil_tofu_vector_t* vector);
  * 
  * Time complexity: O(1)
  *
+ * @note A columnar vector stores packed values with no string to point at,
+ *       so this returns NULL for it. Use fossil_tofu_vector_get_into() to
+ *       format the value into a buffer of your own.
+ *
  * @param vector The vector from which to get the element.
  * @param index  The index of the element to get.
  * @return       The element at the specified index.
  */
 char *fossil_tofu_vector_get(const fossil_tofu_vector_t* vector, size_t index);
 
+/**
+ * Copy the element at the specified index into a caller-provided buffer.
+ * The value is truncated to fit and always NUL-terminated. Safe to call
+ * from several threads on a vector that is not being modified.
+ * 
+ * Time complexity: O(1)
+ *
+ * @param vector The vector from which to get the element.
+ * @param index  The index of the element to get.
+ * @param buf    The buffer receiving the value; FOSSIL_TOFU_VECTOR_VALUE_BUFFER
+ *               bytes hold any columnar value.
+ * @param len    The size of buf in bytes.
+ * @return       buf, or NULL if the index is out of range, the element is null or buf is empty.
+ */
+char *fossil_tofu_vector_get_into(const fossil_tofu_vector_t* vector, size_t index, char *buf, size_t len);
+
 /**
  * Get the first element in the vector.
  * 
  * Time complexity: O(1)
  *
  * @param vector The vector from which to get the first element.
- * @return       The first element in the vector.
+ * @return       The first element in the vector; see fossil_tofu_vector_get() for columnar vectors.
  */
 char *fossil_tofu_vector_get_front(const fossil_tofu_vector_t* vector);
 
@@ -257,7 +335,7 @@ char *fossil_tofu_vector_get_front(const fossil_tofu_vector_t* vector);
  * Time complexity: O(1)
  *
  * @param vector The vector from which to get the last element.
- * @return       The last element in the vector.
+ * @return       The last element in the vector; see fossil_tofu_vector_get() for columnar vectors.
  */
 char *fossil_tofu_vector_get_back(const fossil_tofu_vector_t* vector);
 
@@ -268,7 +346,7 @@ char *fossil_tofu_vector_get_back(const fossil_tofu_vector_t* vector);
  *
  * @param vector The vector from which to get the element.
  * @param index  The index of the element to get.
- * @return       The element at the specified index.
+ * @return       The element at the specified index; see fossil_tofu_vector_get() for columnar vectors.
  */
 char *fossil_tofu_vector_get_at(const fossil_tofu_vector_t* vector, size_t index);
 
@@ -314,6 +392,260 @@ void fossil_tofu_vector_set_back(fossil_tofu_vector_t* vector, char *element);
  */
 void fossil_tofu_vector_set_at(fossil_tofu_vector_t* vector, size_t index, char *element);
 
+// *****************************************************************************
+// Search functions
+// *****************************************************************************
+
+/**
+ * Find the index of the first element equal to the given value.
+ * 
+ * Boxed vectors compare cached value hashes first and confirm hits with
+ * fossil_tofu_compare. Columnar vectors parse the value once and scan the
+ * packed column. Null slots never match.
+ * 
+ * Time complexity: O(n)
+ *
+ * @param vector  The vector to search.
+ * @param element The value to search for.
+ * @param index   Receives the index of the first match.
+ * @return        FOSSIL_TOFU_SUCCESS, FOSSIL_TOFU_ERROR_NOT_FOUND, or an error code.
+ */
+int32_t fossil_tofu_vector_index_of(const fossil_tofu_vector_t* vector, char *element, size_t* index);
+
+/**
+ * Find the first element equal to the given value.
+ * 
+ * Time complexity: O(n)
+ *
+ * @param vector  The vector to search.
+ * @param element The value to search for.
+ * @return        The stored element, or NULL if there is no match.
+ */
+char *fossil_tofu_vector_find(const fossil_tofu_vector_t* vector, char *element);
+
+/**
+ * Check if the vector holds an element equal to the given value.
+ * 
+ * Time complexity: O(n)
+ *
+ * @param vector  The vector to search.
+ * @param element The value to search for.
+ * @return        True if a match exists, false otherwise.
+ */
+bool fossil_tofu_vector_contains(const fossil_tofu_vector_t* vector, char *element);
+
+// *****************************************************************************
+// Columnar span accessors
+// *****************************************************************************
+
+/**
+ * Get the packed values of a columnar vector as a raw span.
+ * 
+ * Each accessor returns NULL unless the vector is columnar and its column
+ * type matches the accessor. The span holds fossil_tofu_vector_size()
+ * elements; slots marked null in the bitmap hold zero. The pointer is
+ * invalidated by any operation that grows the vector.
+ * 
+ * Time complexity: O(1)
+ *
+ * @param vector The columnar vector.
+ * @return       Pointer to the first packed value, or NULL.
+ */
+const int8_t*   fossil_tofu_vector_span_i8(const fossil_tofu_vector_t* vector);
+const int16_t*  fossil_tofu_vector_span_i16(const fossil_tofu_vector_t* vector);
+const int32_t*  fossil_tofu_vector_span_i32(const fossil_tofu_vector_t* vector);
+const int64_t*  fossil_tofu_vector_span_i64(const fossil_tofu_vector_t* vector);
+const uint8_t*  fossil_tofu_vector_span_u8(const fossil_tofu_vector_t* vector);
+const uint16_t* fossil_tofu_vector_span_u16(const fossil_tofu_vector_t* vector);
+const uint32_t* fossil_tofu_vector_span_u32(const fossil_tofu_vector_t* vector);
+const uint64_t* fossil_tofu_vector_span_u64(const fossil_tofu_vector_t* vector);
+const float*    fossil_tofu_vector_span_f32(const fossil_tofu_vector_t* vector);
+const double*   fossil_tofu_vector_span_f64(const fossil_tofu_vector_t* vector);
+
+/**
+ * Get the null bitmap of a columnar vector.
+ * 
+ * Bit (index % 8) of byte (index / 8) is set when the element is null.
+ * 
+ * Time complexity: O(1)
+ *
+ * @param vector The columnar vector.
+ * @return       The bitmap, or NULL if no element has ever been null.
+ */
+const uint8_t* fossil_tofu_vector_nulls(const fossil_tofu_vector_t* vector);
+
+// *****************************************************************************
+// Aggregation functions
+// *****************************************************************************
+
+/**
+ * Folds every numeric element of the vector into a stats accumulator in a
+ * single pass.
+ *
+ * Time complexity: O(n)
+ *
+ * @param vector The vector to reduce.
+ * @param stats  Receives count, sum, min, max and squared deviations.
+ * @return       FOSSIL_TOFU_SUCCESS, or an error code on failure.
+ */
+int32_t fossil_tofu_vector_stats(const fossil_tofu_vector_t* vector, fossil_tofu_stats_t* stats);
+
+/**
+ * Computes the sum of the numeric elements in the vector.
+ *
+ * Time complexity: O(n)
+ *
+ * @param vector The vector to reduce.
+ * @param out    Receives the sum (0 for an empty vector).
+ * @return       FOSSIL_TOFU_SUCCESS, or an error code on failure.
+ */
+int32_t fossil_tofu_vector_sum(const fossil_tofu_vector_t* vector, double* out);
+
+/**
+ * Finds the smallest numeric element in the vector.
+ *
+ * Time complexity: O(n)
+ *
+ * @param vector The vector to reduce.
+ * @param out    Receives the minimum.
+ * @return       FOSSIL_TOFU_SUCCESS, FOSSIL_TOFU_ERROR_NOT_FOUND if the vector holds
+ *               no numeric elements, or another error code on failure.
+ */
+int32_t fossil_tofu_vector_min(const fossil_tofu_vector_t* vector, double* out);
+
+/**
+ * Finds the largest numeric element in the vector.
+ *
+ * Time complexity: O(n)
+ *
+ * @param vector The vector to reduce.
+ * @param out    Receives the maximum.
+ * @return       FOSSIL_TOFU_SUCCESS, FOSSIL_TOFU_ERROR_NOT_FOUND if the vector holds
+ *               no numeric elements, or another error code on failure.
+ */
+int32_t fossil_tofu_vector_max(const fossil_tofu_vector_t* vector, double* out);
+
+/**
+ * Computes the arithmetic mean of the numeric elements in the vector.
+ *
+ * Time complexity: O(n)
+ *
+ * @param vector The vector to reduce.
+ * @param out    Receives the mean.
+ * @return       FOSSIL_TOFU_SUCCESS, FOSSIL_TOFU_ERROR_NOT_FOUND if the vector holds
+ *               no numeric elements, or another error code on failure.
+ */
+int32_t fossil_tofu_vector_mean(const fossil_tofu_vector_t* vector, double* out);
+
+/**
+ * Computes the population variance of the numeric elements in the vector.
+ *
+ * Time complexity: O(n)
+ *
+ * @param vector The vector to reduce.
+ * @param out    Receives the variance.
+ * @return       FOSSIL_TOFU_SUCCESS, FOSSIL_TOFU_ERROR_NOT_FOUND if the vector holds
+ *               no numeric elements, or another error code on failure.
+ */
+int32_t fossil_tofu_vector_variance(const fossil_tofu_vector_t* vector, double* out);
+
+/**
+ * Counts the numeric elements of the vector that satisfy a predicate.
+ *
+ * Time complexity: O(n)
+ *
+ * @param vector    The vector to scan.
+ * @param predicate Called with each numeric element.
+ * @param context   Passed through to the predicate.
+ * @return          The number of matching elements.
+ */
+size_t fossil_tofu_vector_count_if(const fossil_tofu_vector_t* vector, fossil_tofu_predicate_t predicate, void* context);
+
+// *****************************************************************************
+// Bulk transform functions
+// *****************************************************************************
+
+/**
+ * Call a function for every element of the vector, in index order.
+ * 
+ * Time complexity: O(n)
+ *
+ * @param vector  The vector to walk.
+ * @param each    Called with the index and value of each element.
+ * @param context Passed through to the callback.
+ * @return        FOSSIL_TOFU_SUCCESS, or an error code on failure.
+ */
+int32_t fossil_tofu_vector_for_each(const fossil_tofu_vector_t* vector, fossil_tofu_vector_each_fn each, void* context);
+
+/**
+ * Create a new vector holding the mapped value of every element.
+ * 
+ * The callback writes its result as a string into a buffer of
+ * FOSSIL_TOFU_VECTOR_MAP_BUFFER bytes. A columnar source maps into a
+ * columnar vector when the target type has a packed representation; a
+ * result that does not parse becomes null there.
+ * 
+ * Time complexity: O(n)
+ *
+ * @param vector  The source vector.
+ * @param type    Element type of the new vector.
+ * @param map     Produces the new value; returning false aborts the map.
+ * @param context Passed through to the callback.
+ * @return        The new vector, or NULL on failure.
+ */
+fossil_tofu_vector_t* fossil_tofu_vector_map(const fossil_tofu_vector_t* vector, char *type, fossil_tofu_vector_map_fn map, void* context);
+
+/**
+ * Remove every element for which the predicate returns false, keeping the
+ * order of the rest. Compaction happens in place without reallocating.
+ * 
+ * Time complexity: O(n)
+ *
+ * @param vector  The vector to filter.
+ * @param pred    Returns true for elements to keep.
+ * @param context Passed through to the callback.
+ * @return        The number of elements removed.
+ */
+size_t fossil_tofu_vector_filter(fossil_tofu_vector_t* vector, fossil_tofu_vector_pred_fn pred, void* context);
+
+/**
+ * Fold every element into a caller-owned accumulator, in index order.
+ * 
+ * Time complexity: O(n)
+ *
+ * @param vector      The vector to reduce.
+ * @param accumulator Initial value, updated in place.
+ * @param fold        Folds one element into the accumulator.
+ * @param context     Passed through to the callback.
+ * @return            FOSSIL_TOFU_SUCCESS, or an error code on failure.
+ */
+int32_t fossil_tofu_vector_reduce(const fossil_tofu_vector_t* vector, void* accumulator, fossil_tofu_vector_fold_fn fold, void* context);
+
+/**
+ * Parallel variants of the bulk transforms.
+ * 
+ * The index range is split into contiguous slices, at most `threads` of
+ * them, which run on a process-wide worker pool started on first use. The
+ * calling thread works through slices too. Pass 0 for threads to use one
+ * slice per online CPU. Small vectors, and builds without thread support,
+ * run on the calling thread alone. Callbacks run concurrently and must be
+ * safe to do so.
+ * 
+ * for_each makes no ordering guarantee across slices. map and filter
+ * produce the same result as their sequential counterparts. reduce gives
+ * each worker a copy of the size-byte accumulator, so its initial value
+ * must be an identity for combine; the partial results are combined in
+ * index order.
+ * 
+ * Time complexity: O(n / threads)
+ */
+int32_t fossil_tofu_vector_parallel_for_each(const fossil_tofu_vector_t* vector, fossil_tofu_vector_each_fn each, void* context, size_t threads);
+fossil_tofu_vector_t* fossil_tofu_vector_parallel_map(const fossil_tofu_vector_t* vector, char *type, fossil_tofu_vector_map_fn map, void* context, size_t threads);
+size_t fossil_tofu_vector_parallel_filter(fossil_tofu_vector_t* vector, fossil_tofu_vector_pred_fn pred, void* context, size_t threads);
+int32_t fossil_tofu_vector_parallel_reduce(const fossil_tofu_vector_t* vector, void* accumulator, size_t size,
+                                           fossil_tofu_vector_fold_fn fold, fossil_tofu_vector_combine_fn combine,
+                                           void* context, size_t threads);
+
 #ifdef __cplusplus
 }
 #include <stdexcept>
@@ -351,6 +683,21 @@ namespace fossil {
                 }
             }
 
+            /**
+             * Creates a new columnar vector storing packed native values.
+             * Throws a runtime_error if the type is not numeric.
+             *
+             * @param type The numeric element type of the vector.
+             * @return     The created vector.
+             */
+            static Vector columnar(const std::string& type) {
+                fossil_tofu_vector_t* raw = fossil_tofu_vector_create_columnar(const_cast<char*>(type.c_str()));
+                if (fossil_tofu_vector_is_cnullptr(raw)) {
+                    throw std::runtime_error("Failed to create columnar vector");
+                }
+                return Vector(raw);
+            }
+
             /**
              * Copy constructor. Creates a new vector by copying an existing vector.
              * Throws a runtime_error if the vector creation fails.
@@ -458,6 +805,25 @@ namespace fossil {
                 return fossil_tofu_vector_size(vector);
             }
 
+            /**
+             * Checks if the vector uses columnar storage.
+             *
+             * @return True if the vector stores packed native values, false otherwise.
+             */
+            bool is_columnar() const {
+                return fossil_tofu_vector_is_columnar(vector);
+            }
+
+            /**
+             * Checks if the element at the specified index is null.
+             *
+             * @param index The index of the element.
+             * @return      True if the element is null, false otherwise.
+             */
+            bool is_null(size_t index) const {
+                return fossil_tofu_vector_is_null(vector, index);
+            }
+
             /**
              * Gets the element at the specified index in the vector.
              *
@@ -465,7 +831,7 @@ namespace fossil {
              * @return      The element at the specified index.
              */
             std::string get(size_t index) const {
-                return std::string(fossil_tofu_vector_get(vector, index));
+                return element(index);
             }
 
             /**
@@ -474,7 +840,7 @@ namespace fossil {
              * @return The first element in the vector.
              */
             std::string get_front() const {
-                return std::string(fossil_tofu_vector_get_front(vector));
+                return element(0);
             }
 
             /**
@@ -483,7 +849,7 @@ namespace fossil {
              * @return The last element in the vector.
              */
             std::string get_back() const {
-                return std::string(fossil_tofu_vector_get_back(vector));
+                return element(fossil_tofu_vector_size(vector) - 1);
             }
 
             /**
@@ -493,7 +859,7 @@ namespace fossil {
              * @return      The element at the specified index.
              */
             std::string get_at(size_t index) const {
-                return std::string(fossil_tofu_vector_get_at(vector, index));
+                return element(index);
             }
 
             /**
@@ -534,7 +900,165 @@ namespace fossil {
                 fossil_tofu_vector_set_at(vector, index, const_cast<char*>(element.c_str()));
             }
 
+            /**
+             * Computes the sum of the numeric elements.
+             *
+             * @return The result of the reduction.
+             * @throws std::runtime_error If the container holds no numeric elements.
+             */
+            double sum() const {
+                double result = 0.0;
+                if (fossil_tofu_vector_sum(vector, &result) != FOSSIL_TOFU_SUCCESS) {
+                    throw std::runtime_error("Failed to compute sum");
+                }
+                return result;
+            }
+
+            /**
+             * Finds the smallest numeric element.
+             *
+             * @return The result of the reduction.
+             * @throws std::runtime_error If the container holds no numeric elements.
+             */
+            double min() const {
+                double result = 0.0;
+                if (fossil_tofu_vector_min(vector, &result) != FOSSIL_TOFU_SUCCESS) {
+                    throw std::runtime_error("Failed to compute min");
+                }
+                return result;
+            }
+
+            /**
+             * Finds the largest numeric element.
+             *
+             * @return The result of the reduction.
+             * @throws std::runtime_error If the container holds no numeric elements.
+             */
+            double max() const {
+                double result = 0.0;
+                if (fossil_tofu_vector_max(vector, &result) != FOSSIL_TOFU_SUCCESS) {
+                    throw std::runtime_error("Failed to compute max");
+                }
+                return result;
+            }
+
+            /**
+             * Computes the arithmetic mean of the numeric elements.
+             *
+             * @return The result of the reduction.
+             * @throws std::runtime_error If the container holds no numeric elements.
+             */
+            double mean() const {
+                double result = 0.0;
+                if (fossil_tofu_vector_mean(vector, &result) != FOSSIL_TOFU_SUCCESS) {
+                    throw std::runtime_error("Failed to compute mean");
+                }
+                return result;
+            }
+
+            /**
+             * Computes the population variance of the numeric elements.
+             *
+             * @return The result of the reduction.
+             * @throws std::runtime_error If the container holds no numeric elements.
+             */
+            double variance() const {
+                double result = 0.0;
+                if (fossil_tofu_vector_variance(vector, &result) != FOSSIL_TOFU_SUCCESS) {
+                    throw std::runtime_error("Failed to compute variance");
+                }
+                return result;
+            }
+
+            /**
+             * Counts the numeric elements that satisfy a predicate.
+             *
+             * @param predicate Called with each numeric element.
+             * @param context   Passed through to the predicate.
+             * @return          The number of matching elements.
+             */
+            size_t count_if(fossil_tofu_predicate_t predicate, void* context = nullptr) const {
+                return fossil_tofu_vector_count_if(vector, predicate, context);
+            }
+
+            /**
+             * Finds the index of the first element equal to the given value.
+             *
+             * @param element The value to search for.
+             * @param index   Receives the index of the first match.
+             * @return        True if a match was found, false otherwise.
+             */
+            bool index_of(const std::string& element, size_t& index) const {
+                return fossil_tofu_vector_index_of(vector, const_cast<char*>(element.c_str()), &index) == FOSSIL_TOFU_SUCCESS;
+            }
+
+            /**
+             * Checks if an element equal to the given value is present.
+             *
+             * @param element The value to search for.
+             * @return        True if a match exists, false otherwise.
+             */
+            bool contains(const std::string& element) const {
+                return fossil_tofu_vector_contains(vector, const_cast<char*>(element.c_str()));
+            }
+
+            /**
+             * Calls a function for every element, in index order.
+             *
+             * @param fn Callable taking (size_t index, const char* element).
+             */
+            template <typename F>
+            void for_each(F fn) const {
+                fossil_tofu_vector_for_each(vector, &Vector::each_trampoline<F>, &fn);
+            }
+
+            /**
+             * Calls a function for every element from several threads.
+             *
+             * @param fn      Callable taking (size_t index, const char* element).
+             * @param threads Number of workers, or 0 for one per CPU.
+             */
+            template <typename F>
+            void parallel_for_each(F fn, size_t threads = 0) const {
+                fossil_tofu_vector_parallel_for_each(vector, &Vector::each_trampoline<F>, &fn, threads);
+            }
+
+            /**
+             * Removes every element for which the predicate returns false.
+             *
+             * @param pred Callable taking (const char* element) and returning bool.
+             * @return     The number of elements removed.
+             */
+            template <typename F>
+            size_t filter(F pred) {
+                return fossil_tofu_vector_filter(vector, &Vector::pred_trampoline<F>, &pred);
+            }
+
         private:
+            // Columnar values have no stored string; format them locally.
+            std::string element(size_t index) const {
+                if (fossil_tofu_vector_is_columnar(vector)) {
+                    char buf[FOSSIL_TOFU_VECTOR_VALUE_BUFFER];
+                    return std::string(fossil_tofu_vector_get_into(vector, index, buf, sizeof(buf)));
+                }
+                return std::string(fossil_tofu_vector_get(vector, index));
+            }
+
+            template <typename F>
+            static void each_trampoline(size_t index, const char* element, void* context) {
+                (*static_cast<F*>(context))(index, element);
+            }
+
+            template <typename F>
+            static bool pred_trampoline(const char* element, void* context) {
+                return (*static_cast<F*>(context))(element);
+            }
+
+            /**
+             * Adopts an already created fossil_tofu_vector_t structure.
+             */
+            explicit Vector(fossil_tofu_vector_t* raw) : vector(raw) {}
+
             /**
              * A pointer to the underlying fossil_tofu_vector_t structure.
              */
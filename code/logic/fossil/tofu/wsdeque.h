@@ -0,0 +1,287 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef FOSSIL_TOFU_WSDEQUE_H
+#define FOSSIL_TOFU_WSDEQUE_H
+
+#include "tofu.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// *****************************************************************************
+// Type definitions
+// *****************************************************************************
+
+// Top/bottom indices, the live circular array and the arrays retired by
+// growth; defined in wsdeque.c.
+typedef struct fossil_tofu_wsdeque_state_t fossil_tofu_wsdeque_state_t;
+
+// Chase-Lev work-stealing deque. One owner thread pushes and pops at the
+// bottom like a stack, while any number of thief threads steal from the top,
+// so the oldest (usually largest) pieces of work migrate to idle workers.
+// The circular array doubles when full; retired arrays are kept until
+// destroy because a thief may still be reading them.
+typedef struct fossil_tofu_wsdeque_t {
+    char* type;
+    fossil_tofu_wsdeque_state_t* state;
+} fossil_tofu_wsdeque_t;
+
+// *****************************************************************************
+// Function prototypes
+// *****************************************************************************
+
+/**
+ * Create a new work-stealing deque.
+ *
+ * @param type     The type of data the deque will store.
+ * @param capacity Initial array size hint, rounded up to a power of two; 0 picks a default.
+ * @return         The created deque, or NULL on failure.
+ * @note           Time complexity: O(capacity)
+ */
+fossil_tofu_wsdeque_t* fossil_tofu_wsdeque_create_container(char* type, size_t capacity);
+
+/**
+ * Destroy the deque and any elements left in it.
+ *
+ * @param wsdeque The deque to destroy.
+ * @note          Time complexity: O(n)
+ * @details       Owner and thieves must have stopped using the deque.
+ */
+void fossil_tofu_wsdeque_destroy(fossil_tofu_wsdeque_t* wsdeque);
+
+// *****************************************************************************
+// Utility functions
+// *****************************************************************************
+
+/**
+ * Push data onto the bottom of the deque (owner thread only).
+ *
+ * @param wsdeque The deque to push onto.
+ * @param data    The data to push.
+ * @return        The error code indicating the success or failure of the operation.
+ * @note          Time complexity: amortized O(1)
+ */
+int32_t fossil_tofu_wsdeque_push(fossil_tofu_wsdeque_t* wsdeque, char *data);
+
+/**
+ * Move an existing tofu onto the bottom of the deque (owner thread only).
+ *
+ * @param wsdeque The deque to push onto.
+ * @param tofu    The tofu to move in; zeroed on success.
+ * @return        The error code indicating the success or failure of the operation.
+ * @note          Time complexity: amortized O(1)
+ */
+int32_t fossil_tofu_wsdeque_push_tofu(fossil_tofu_wsdeque_t* wsdeque, fossil_tofu_t* tofu);
+
+/**
+ * Pop the most recently pushed element from the bottom (owner thread only).
+ *
+ * @param wsdeque The deque to pop from.
+ * @param out     Receives the tofu; the caller must fossil_tofu_destroy it.
+ * @return        FOSSIL_TOFU_SUCCESS, or FOSSIL_TOFU_FAILURE if the deque is
+ *                empty or a thief won the last element.
+ * @note          Time complexity: O(1)
+ */
+int32_t fossil_tofu_wsdeque_pop(fossil_tofu_wsdeque_t* wsdeque, fossil_tofu_t* out);
+
+/**
+ * Steal the oldest element from the top (any thread).
+ *
+ * @param wsdeque The deque to steal from.
+ * @param out     Receives the tofu; the caller must fossil_tofu_destroy it.
+ * @return        FOSSIL_TOFU_SUCCESS, or FOSSIL_TOFU_FAILURE if the deque is empty.
+ * @note          Time complexity: O(1) without contention
+ * @details       Retries when another thread takes the same element first.
+ */
+int32_t fossil_tofu_wsdeque_steal(fossil_tofu_wsdeque_t* wsdeque, fossil_tofu_t* out);
+
+/**
+ * Get the number of elements in the deque.
+ *
+ * @param wsdeque The deque for which to get the size.
+ * @return        The element count; a snapshot while other threads are active.
+ * @note          Time complexity: O(1)
+ */
+size_t fossil_tofu_wsdeque_size(const fossil_tofu_wsdeque_t* wsdeque);
+
+/**
+ * Get the size of the current circular array.
+ *
+ * @param wsdeque The deque.
+ * @return        Number of elements the deque holds before it grows again.
+ * @note          Time complexity: O(1)
+ */
+size_t fossil_tofu_wsdeque_capacity(const fossil_tofu_wsdeque_t* wsdeque);
+
+/**
+ * Check if the deque is not empty.
+ *
+ * @param wsdeque The deque to check.
+ * @return        True if the deque holds at least one element.
+ * @note          Time complexity: O(1)
+ */
+bool fossil_tofu_wsdeque_not_empty(const fossil_tofu_wsdeque_t* wsdeque);
+
+/**
+ * Check if the deque is not a null pointer.
+ *
+ * @param wsdeque The deque to check.
+ * @return        True if the deque pointer is valid.
+ * @note          Time complexity: O(1)
+ */
+bool fossil_tofu_wsdeque_not_cnullptr(const fossil_tofu_wsdeque_t* wsdeque);
+
+/**
+ * Check if the deque is empty.
+ *
+ * @param wsdeque The deque to check.
+ * @return        True if the deque holds no elements or is NULL.
+ * @note          Time complexity: O(1)
+ */
+bool fossil_tofu_wsdeque_is_empty(const fossil_tofu_wsdeque_t* wsdeque);
+
+/**
+ * Check if the deque is a null pointer.
+ *
+ * @param wsdeque The deque to check.
+ * @return        True if the deque pointer is NULL.
+ * @note          Time complexity: O(1)
+ */
+bool fossil_tofu_wsdeque_is_cnullptr(const fossil_tofu_wsdeque_t* wsdeque);
+
+#ifdef __cplusplus
+}
+#include <stdexcept>
+#include <string>
+
+namespace fossil {
+
+    namespace tofu {
+
+        /**
+         * A C++ wrapper class for the work-stealing deque (fossil_tofu_wsdeque_t).
+         * push and pop belong to the owning thread; steal may be called from any thread.
+         */
+        class WSDeque {
+        public:
+            /**
+             * Constructor with a specified data type.
+             *
+             * @param type     The type of data the deque will store.
+             * @param capacity Initial array size hint; 0 picks a default.
+             * @throws std::runtime_error if the deque creation fails.
+             */
+            WSDeque(const std::string& type, size_t capacity = 0) : wsdeque(fossil_tofu_wsdeque_create_container(const_cast<char*>(type.c_str()), capacity)) {
+                if (wsdeque == nullptr) {
+                    throw std::runtime_error("Failed to create a new work-stealing deque with type: " + type);
+                }
+            }
+
+            WSDeque(const WSDeque&) = delete;
+            WSDeque& operator=(const WSDeque&) = delete;
+
+            /**
+             * Destructor.
+             * Destroys the deque and any elements left in it.
+             */
+            ~WSDeque() {
+                fossil_tofu_wsdeque_destroy(wsdeque);
+            }
+
+            /**
+             * Push data onto the bottom (owner only).
+             *
+             * @param data The data to push.
+             * @return The error code indicating the success or failure of the operation.
+             */
+            int32_t push(const std::string& data) {
+                return fossil_tofu_wsdeque_push(wsdeque, const_cast<char*>(data.c_str()));
+            }
+
+            /**
+             * Pop the newest element from the bottom (owner only).
+             *
+             * @param out Receives the value.
+             * @return True if an element was popped.
+             */
+            bool pop(std::string& out) {
+                fossil_tofu_t tofu;
+                if (fossil_tofu_wsdeque_pop(wsdeque, &tofu) != FOSSIL_TOFU_SUCCESS) {
+                    return false;
+                }
+                out = tofu.value.data;
+                fossil_tofu_destroy(&tofu);
+                return true;
+            }
+
+            /**
+             * Steal the oldest element from the top (any thread).
+             *
+             * @param out Receives the value.
+             * @return True if an element was stolen.
+             */
+            bool steal(std::string& out) {
+                fossil_tofu_t tofu;
+                if (fossil_tofu_wsdeque_steal(wsdeque, &tofu) != FOSSIL_TOFU_SUCCESS) {
+                    return false;
+                }
+                out = tofu.value.data;
+                fossil_tofu_destroy(&tofu);
+                return true;
+            }
+
+            /**
+             * Get the number of elements in the deque.
+             */
+            size_t size() const {
+                return fossil_tofu_wsdeque_size(wsdeque);
+            }
+
+            /**
+             * Get the size of the current circular array.
+             */
+            size_t capacity() const {
+                return fossil_tofu_wsdeque_capacity(wsdeque);
+            }
+
+            /**
+             * Check if the deque is empty.
+             */
+            bool is_empty() const {
+                return fossil_tofu_wsdeque_is_empty(wsdeque);
+            }
+
+        private:
+            fossil_tofu_wsdeque_t* wsdeque;
+        };
+
+    } // namespace tofu
+
+} // namespace fossil
+
+#endif
+
+#endif /* FOSSIL_TOFU_FRAMEWORK_H */
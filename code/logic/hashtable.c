@@ -0,0 +1,234 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include "fossil/tofu/hashtable.h"
+
+// *****************************************************************************
+// Internal helpers
+// *****************************************************************************
+
+static inline const fossil_tofu_t* fossil_tofu_hashtable_key(const fossil_tofu_hashtable_t* table, const void* node) {
+    return (const fossil_tofu_t*)((const char*)node + table->key_offset);
+}
+
+// Distance of the node in slot `i` from its home slot.
+static inline size_t fossil_tofu_hashtable_distance(const fossil_tofu_hashtable_t* table, size_t i) {
+    size_t mask = table->capacity - 1;
+    return (i - (size_t)(table->slots[i].hash & mask)) & mask;
+}
+
+// *****************************************************************************
+// Function definitions
+// *****************************************************************************
+
+void fossil_tofu_hashtable_init(fossil_tofu_hashtable_t* table, fossil_tofu_type_t key_type, size_t key_offset) {
+    table->slots = NULL;
+    table->capacity = 0;
+    table->count = 0;
+    table->key_offset = key_offset;
+    table->key_type = key_type;
+    table->filter = NULL;
+}
+
+void fossil_tofu_hashtable_release(fossil_tofu_hashtable_t* table) {
+    fossil_tofu_bloom_destroy(table->filter);
+    fossil_tofu_free(table->slots);
+    table->slots = NULL;
+    table->filter = NULL;
+    table->capacity = 0;
+    table->count = 0;
+}
+
+void fossil_tofu_hashtable_move(fossil_tofu_hashtable_t* table, fossil_tofu_hashtable_t* source) {
+    table->slots = source->slots;
+    table->capacity = source->capacity;
+    table->count = source->count;
+    table->filter = source->filter;
+    source->slots = NULL;
+    source->capacity = 0;
+    source->count = 0;
+    source->filter = NULL;
+}
+
+int32_t fossil_tofu_hashtable_clone(fossil_tofu_hashtable_t* table, const fossil_tofu_hashtable_t* source,
+                                    fossil_tofu_hashtable_clone_fn clone, void* context) {
+    if (source->filter) {
+        table->filter = fossil_tofu_bloom_create_copy(source->filter);
+        if (!table->filter) return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+    }
+    if (source->count == 0) return FOSSIL_TOFU_SUCCESS;
+
+    table->slots = (fossil_tofu_hashtable_slot_t*)fossil_tofu_alloc(source->capacity * sizeof(fossil_tofu_hashtable_slot_t));
+    if (!table->slots) return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+    memset(table->slots, 0, source->capacity * sizeof(fossil_tofu_hashtable_slot_t));
+    table->capacity = source->capacity;
+
+    for (size_t i = 0; i < source->capacity; i++) {
+        if (!source->slots[i].node) continue;
+        void* node = clone(source->slots[i].node, context);
+        if (!node) return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+        table->slots[i].hash = source->slots[i].hash;
+        table->slots[i].node = node;
+        table->count++;
+    }
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+uint64_t fossil_tofu_hashtable_hash(const fossil_tofu_hashtable_t* table, const char* key, size_t len) {
+    return fossil_tofu_hash_key(table->key_type, key, len);
+}
+
+size_t fossil_tofu_hashtable_probe(const fossil_tofu_hashtable_t* table, uint64_t hash, const char* key, size_t len) {
+    if (table->count == 0) return SIZE_MAX;
+    if (table->filter && !fossil_tofu_bloom_may_contain_hash(table->filter, hash)) return SIZE_MAX;
+
+    size_t mask = table->capacity - 1;
+    size_t i = (size_t)(hash & mask);
+
+    for (size_t dist = 0;; dist++, i = (i + 1) & mask) {
+        const fossil_tofu_hashtable_slot_t* slot = &table->slots[i];
+        if (!slot->node || fossil_tofu_hashtable_distance(table, i) < dist) return SIZE_MAX;
+        if (slot->hash == hash && fossil_tofu_equals_key(fossil_tofu_hashtable_key(table, slot->node), key, len)) return i;
+    }
+}
+
+size_t fossil_tofu_hashtable_lookup(const fossil_tofu_hashtable_t* table, const char* key, size_t len) {
+    return fossil_tofu_hashtable_probe(table, fossil_tofu_hashtable_hash(table, key, len), key, len);
+}
+
+void fossil_tofu_hashtable_place(fossil_tofu_hashtable_t* table, uint64_t hash, void* node) {
+    if (table->filter) fossil_tofu_bloom_add_hash(table->filter, hash);
+    table->count++;
+
+    size_t mask = table->capacity - 1;
+    size_t i = (size_t)(hash & mask);
+    size_t dist = 0;
+
+    for (;;) {
+        fossil_tofu_hashtable_slot_t* slot = &table->slots[i];
+        if (!slot->node) {
+            slot->hash = hash;
+            slot->node = node;
+            return;
+        }
+        // Robin Hood: a node further from home takes the slot over.
+        size_t theirs = fossil_tofu_hashtable_distance(table, i);
+        if (theirs < dist) {
+            fossil_tofu_hashtable_slot_t evicted = *slot;
+            slot->hash = hash;
+            slot->node = node;
+            hash = evicted.hash;
+            node = evicted.node;
+            dist = theirs;
+        }
+        i = (i + 1) & mask;
+        dist++;
+    }
+}
+
+void* fossil_tofu_hashtable_vacate(fossil_tofu_hashtable_t* table, size_t i) {
+    void* node = table->slots[i].node;
+    size_t mask = table->capacity - 1;
+    size_t next = (i + 1) & mask;
+
+    while (table->slots[next].node && fossil_tofu_hashtable_distance(table, next) > 0) {
+        table->slots[i] = table->slots[next];
+        i = next;
+        next = (next + 1) & mask;
+    }
+    table->slots[i].hash = 0;
+    table->slots[i].node = NULL;
+    table->count--;
+    return node;
+}
+
+void fossil_tofu_hashtable_clear(fossil_tofu_hashtable_t* table) {
+    if (table->slots) memset(table->slots, 0, table->capacity * sizeof(fossil_tofu_hashtable_slot_t));
+    if (table->filter) fossil_tofu_bloom_clear(table->filter);
+    table->count = 0;
+}
+
+int32_t fossil_tofu_hashtable_rehash(fossil_tofu_hashtable_t* table, size_t capacity) {
+    fossil_tofu_hashtable_slot_t* slots = (fossil_tofu_hashtable_slot_t*)fossil_tofu_alloc(capacity * sizeof(fossil_tofu_hashtable_slot_t));
+    if (!slots) return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+    memset(slots, 0, capacity * sizeof(fossil_tofu_hashtable_slot_t));
+
+    fossil_tofu_hashtable_slot_t* old = table->slots;
+    size_t old_capacity = table->capacity;
+
+    table->slots = slots;
+    table->capacity = capacity;
+    table->count = 0;
+    // Rebuild the filter at the new size, which also sheds the bits of
+    // removed keys. If it cannot be resized it is refilled at its old size.
+    if (table->filter && fossil_tofu_bloom_reset(table->filter, capacity) != FOSSIL_TOFU_SUCCESS) {
+        fossil_tofu_bloom_clear(table->filter);
+    }
+    for (size_t i = 0; i < old_capacity; i++) {
+        if (old[i].node) fossil_tofu_hashtable_place(table, old[i].hash, old[i].node);
+    }
+    fossil_tofu_free(old);
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+size_t fossil_tofu_hashtable_slots_for(size_t count, double max_load) {
+    size_t capacity = FOSSIL_TOFU_HASHTABLE_MIN_SLOTS;
+    while ((double)count > (double)capacity * max_load) {
+        if (capacity > SIZE_MAX / 2) return 0;
+        capacity <<= 1;
+    }
+    return capacity;
+}
+
+int32_t fossil_tofu_hashtable_grow(fossil_tofu_hashtable_t* table, double max_load) {
+    if ((double)(table->count + 1) <= (double)table->capacity * max_load) return FOSSIL_TOFU_SUCCESS;
+
+    size_t capacity = table->capacity ? table->capacity * 2 : fossil_tofu_hashtable_slots_for(1, max_load);
+    if (capacity == 0 || capacity < table->capacity) return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+    return fossil_tofu_hashtable_rehash(table, capacity);
+}
+
+int32_t fossil_tofu_hashtable_reserve(fossil_tofu_hashtable_t* table, size_t count, double max_load) {
+    size_t capacity = fossil_tofu_hashtable_slots_for(count, max_load);
+    if (capacity == 0) return FOSSIL_TOFU_ERROR_OVERFLOW;
+    if (capacity <= table->capacity) return FOSSIL_TOFU_SUCCESS;
+    return fossil_tofu_hashtable_rehash(table, capacity);
+}
+
+int32_t fossil_tofu_hashtable_attach_filter(fossil_tofu_hashtable_t* table, size_t bits_per_key) {
+    size_t expected = table->capacity ? table->capacity : FOSSIL_TOFU_HASHTABLE_MIN_SLOTS;
+    fossil_tofu_bloom_t* filter = fossil_tofu_bloom_create(expected, bits_per_key);
+    if (!filter) return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+    for (size_t i = 0; i < table->capacity; i++) {
+        if (table->slots[i].node) fossil_tofu_bloom_add_hash(filter, table->slots[i].hash);
+    }
+    fossil_tofu_bloom_destroy(table->filter);
+    table->filter = filter;
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+void fossil_tofu_hashtable_detach_filter(fossil_tofu_hashtable_t* table) {
+    fossil_tofu_bloom_destroy(table->filter);
+    table->filter = NULL;
+}
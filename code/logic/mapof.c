@@ -24,6 +24,565 @@
  */
 #include "fossil/tofu/mapof.h"
 
+// *****************************************************************************
+// Hash table helpers
+// *****************************************************************************
+
+// Keys resolved together by the batched calls: enough to keep several
+// cache misses in flight, small enough for the scratch arrays to stay on
+// the stack.
+#define FOSSIL_TOFU_MAPOF_BATCH 16
+
+#if defined(__GNUC__) || defined(__clang__)
+#define FOSSIL_TOFU_MAPOF_PREFETCH(addr) __builtin_prefetch((addr), 0, 1)
+#else
+#define FOSSIL_TOFU_MAPOF_PREFETCH(addr) ((void)(addr))
+#endif
+
+// Grow once the table is 7/8 full.
+#define FOSSIL_TOFU_MAPOF_MAX_LOAD ((double)FOSSIL_TOFU_MAPOF_LOAD_NUM / FOSSIL_TOFU_MAPOF_LOAD_DEN)
+
+static inline fossil_tofu_mapof_node_t* fossil_tofu_mapof_node(const fossil_tofu_mapof_t* map, size_t i) {
+    return (fossil_tofu_mapof_node_t*)map->table.slots[i].node;
+}
+
+static void fossil_tofu_mapof_destroy_chain(fossil_tofu_mapof_node_t* node) {
+    while (node) {
+        fossil_tofu_mapof_node_t* next = node->next;
+        fossil_tofu_destroy(&node->key);
+        fossil_tofu_destroy(&node->value);
+        fossil_tofu_free(node);
+        node = next;
+    }
+}
+
+// Clone an entry chain, newest first, checking that the stored types still
+// match the map. Returns NULL on mismatch or allocation failure.
+static fossil_tofu_mapof_node_t* fossil_tofu_mapof_clone_chain(const fossil_tofu_mapof_t* map, const fossil_tofu_mapof_node_t* head) {
+    fossil_tofu_type_t value_type = fossil_tofu_validate_type(map->value_type);
+    fossil_tofu_mapof_node_t* copy = NULL;
+    fossil_tofu_mapof_node_t** tail = &copy;
+
+    // Check type match for key and value
+    if (fossil_tofu_get_type(&head->key) != map->key_id) return NULL;
+
+    for (const fossil_tofu_mapof_node_t* current = head; current; current = current->next) {
+        fossil_tofu_mapof_node_t* node = NULL;
+        if (fossil_tofu_get_type(&current->value) == value_type) {
+            node = (fossil_tofu_mapof_node_t*)fossil_tofu_alloc(sizeof(fossil_tofu_mapof_node_t));
+        }
+        if (!node) {
+            fossil_tofu_mapof_destroy_chain(copy);
+            return NULL;
+        }
+        memset(node, 0, sizeof(*node));
+        if (current == head) {
+            node->key = fossil_tofu_create(map->key_type, fossil_tofu_get_value(&current->key));
+        }
+        node->value = fossil_tofu_create(map->value_type, fossil_tofu_get_value(&current->value));
+        *tail = node;
+        tail = &node->next;
+    }
+    return copy;
+}
+
+static size_t fossil_tofu_mapof_chain_length(const fossil_tofu_mapof_node_t* node) {
+    size_t length = 0;
+    for (; node; node = node->next) length++;
+    return length;
+}
+
+static void* fossil_tofu_mapof_clone_node(const void* node, void* context) {
+    fossil_tofu_mapof_t* map = (fossil_tofu_mapof_t*)context;
+    fossil_tofu_mapof_node_t* chain = fossil_tofu_mapof_clone_chain(map, (const fossil_tofu_mapof_node_t*)node);
+    if (chain) map->size += fossil_tofu_mapof_chain_length(chain);
+    return chain;
+}
+
+// Give the head of a key a new value; the current one moves down the
+// chain. The head itself stays put, so whatever points at it stays valid.
+static int32_t fossil_tofu_mapof_shadow(const fossil_tofu_mapof_t* map, fossil_tofu_mapof_node_t* head, char *value) {
+    fossil_tofu_mapof_node_t* older = (fossil_tofu_mapof_node_t*)fossil_tofu_alloc(sizeof(fossil_tofu_mapof_node_t));
+    if (!older) return FOSSIL_TOFU_FAILURE;
+    memset(&older->key, 0, sizeof(older->key));
+    older->value = head->value;
+    older->next = head->next;
+    head->value = fossil_tofu_create(map->value_type, value);
+    head->next = older;
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+// Drop the newest value of a key. When an older one was shadowed it moves
+// back into the head and true is returned; otherwise the head is left with
+// only its key and the caller unlinks it.
+static bool fossil_tofu_mapof_uncover(fossil_tofu_mapof_node_t* head) {
+    fossil_tofu_destroy(&head->value);
+    if (!head->next) return false;
+
+    fossil_tofu_mapof_node_t* older = head->next;
+    head->value = older->value;
+    head->next = older->next;
+    fossil_tofu_free(older);
+    return true;
+}
+
+// *****************************************************************************
+// B-tree helpers (ordered maps)
+// *****************************************************************************
+
+#define FOSSIL_TOFU_MAPOF_T FOSSIL_TOFU_MAPOF_BTREE_T
+
+// Stack tofu used to compare a borrowed key against the stored ones.
+static inline fossil_tofu_t fossil_tofu_mapof_needle(const fossil_tofu_mapof_t* map, const char* key) {
+    fossil_tofu_t needle = {0};
+    needle.type = map->key_id;
+    needle.value.data = (char*)key;
+    return needle;
+}
+
+static fossil_tofu_mapof_bnode_t* fossil_tofu_mapof_bnode_create(bool leaf) {
+    fossil_tofu_mapof_bnode_t* node = (fossil_tofu_mapof_bnode_t*)fossil_tofu_alloc(sizeof(fossil_tofu_mapof_bnode_t));
+    if (!node) return NULL;
+    memset(node, 0, sizeof(*node));
+    node->leaf = leaf;
+    return node;
+}
+
+static void fossil_tofu_mapof_bnode_destroy(fossil_tofu_mapof_bnode_t* node) {
+    if (!node) return;
+    for (size_t i = 0; i <= node->count && !node->leaf; i++) {
+        fossil_tofu_mapof_bnode_destroy(node->children[i]);
+    }
+    for (size_t i = 0; i < node->count; i++) {
+        fossil_tofu_mapof_destroy_chain(node->entries[i]);
+    }
+    fossil_tofu_free(node);
+}
+
+// Index of the first key in `node` that is not less than `key`.
+static size_t fossil_tofu_mapof_bnode_search(const fossil_tofu_mapof_bnode_t* node, const fossil_tofu_t* key, bool* found) {
+    size_t lo = 0, hi = node->count;
+    *found = false;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        int cmp = fossil_tofu_compare(&node->entries[mid]->key, key);
+        if (cmp < 0) {
+            lo = mid + 1;
+        } else {
+            if (cmp == 0) *found = true;
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+static fossil_tofu_mapof_node_t* fossil_tofu_mapof_btree_find(const fossil_tofu_mapof_t* map, const fossil_tofu_t* key) {
+    const fossil_tofu_mapof_bnode_t* node = map->root;
+    while (node) {
+        bool found;
+        size_t i = fossil_tofu_mapof_bnode_search(node, key, &found);
+        if (found) return node->entries[i];
+        if (node->leaf) return NULL;
+        node = node->children[i];
+    }
+    return NULL;
+}
+
+// Key types fossil_tofu_compare orders by parsed value; the rest it orders
+// by text, as strcmp does.
+static inline bool fossil_tofu_mapof_numeric_key(fossil_tofu_type_t type) {
+    return type <= FOSSIL_TOFU_TYPE_U64 || type == FOSSIL_TOFU_TYPE_F32 || type == FOSSIL_TOFU_TYPE_F64;
+}
+
+// strcmp of a stored key against borrowed text that need not be terminated.
+static int fossil_tofu_mapof_compare_text(const fossil_tofu_t* stored, const char* key, size_t len) {
+    const unsigned char* a = (const unsigned char*)stored->value.data;
+    const unsigned char* b = (const unsigned char*)key;
+    for (size_t i = 0; i < len; i++) {
+        if (a[i] != b[i]) return a[i] < b[i] ? -1 : 1;
+        if (a[i] == '\0') return 0; // Text after an embedded NUL is ignored, as by strcmp
+    }
+    return a[len] != '\0';
+}
+
+// btree_find for keys of a text-ordered type, compared in place.
+static fossil_tofu_mapof_node_t* fossil_tofu_mapof_btree_find_text(const fossil_tofu_mapof_t* map, const char* key, size_t len) {
+    const fossil_tofu_mapof_bnode_t* node = map->root;
+    while (node) {
+        size_t lo = 0, hi = node->count;
+        while (lo < hi) {
+            size_t mid = lo + (hi - lo) / 2;
+            int cmp = fossil_tofu_mapof_compare_text(&node->entries[mid]->key, key, len);
+            if (cmp == 0) return node->entries[mid];
+            if (cmp < 0) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        if (node->leaf) return NULL;
+        node = node->children[lo];
+    }
+    return NULL;
+}
+
+// Split the full child `i` of `parent` around its median key.
+static int32_t fossil_tofu_mapof_bnode_split(fossil_tofu_mapof_bnode_t* parent, size_t i) {
+    fossil_tofu_mapof_bnode_t* left = parent->children[i];
+    fossil_tofu_mapof_bnode_t* right = fossil_tofu_mapof_bnode_create(left->leaf);
+    if (!right) return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+
+    const size_t t = FOSSIL_TOFU_MAPOF_T;
+    right->count = t - 1;
+    memcpy(right->entries, left->entries + t, (t - 1) * sizeof(right->entries[0]));
+    if (!left->leaf) {
+        memcpy(right->children, left->children + t, t * sizeof(right->children[0]));
+    }
+    left->count = t - 1;
+
+    memmove(parent->children + i + 2, parent->children + i + 1, (parent->count - i) * sizeof(parent->children[0]));
+    parent->children[i + 1] = right;
+    memmove(parent->entries + i + 1, parent->entries + i, (parent->count - i) * sizeof(parent->entries[0]));
+    parent->entries[i] = left->entries[t - 1];
+    parent->count++;
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+// Insert an entry whose key is not in the tree yet. Full nodes are split on
+// the way down, so the walk never has to back up.
+static int32_t fossil_tofu_mapof_btree_insert(fossil_tofu_mapof_t* map, fossil_tofu_mapof_node_t* entry) {
+    if (!map->root) {
+        map->root = fossil_tofu_mapof_bnode_create(true);
+        if (!map->root) return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+    }
+    if (map->root->count == FOSSIL_TOFU_MAPOF_BTREE_MAX) {
+        fossil_tofu_mapof_bnode_t* root = fossil_tofu_mapof_bnode_create(false);
+        if (!root) return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+        root->children[0] = map->root;
+        if (fossil_tofu_mapof_bnode_split(root, 0) != FOSSIL_TOFU_SUCCESS) {
+            fossil_tofu_free(root);
+            return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+        }
+        map->root = root;
+    }
+
+    fossil_tofu_mapof_bnode_t* node = map->root;
+    bool found;
+    for (;;) {
+        size_t i = fossil_tofu_mapof_bnode_search(node, &entry->key, &found);
+        if (node->leaf) {
+            memmove(node->entries + i + 1, node->entries + i, (node->count - i) * sizeof(node->entries[0]));
+            node->entries[i] = entry;
+            node->count++;
+            map->keys++;
+            return FOSSIL_TOFU_SUCCESS;
+        }
+        if (node->children[i]->count == FOSSIL_TOFU_MAPOF_BTREE_MAX) {
+            if (fossil_tofu_mapof_bnode_split(node, i) != FOSSIL_TOFU_SUCCESS) return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+            if (fossil_tofu_compare(&entry->key, &node->entries[i]->key) > 0) i++;
+        }
+        node = node->children[i];
+    }
+}
+
+// Fold child `i + 1` and separator `i` of `parent` into child `i`.
+static void fossil_tofu_mapof_bnode_merge(fossil_tofu_mapof_bnode_t* parent, size_t i) {
+    fossil_tofu_mapof_bnode_t* left = parent->children[i];
+    fossil_tofu_mapof_bnode_t* right = parent->children[i + 1];
+
+    left->entries[left->count] = parent->entries[i];
+    memcpy(left->entries + left->count + 1, right->entries, right->count * sizeof(left->entries[0]));
+    if (!left->leaf) {
+        memcpy(left->children + left->count + 1, right->children, (right->count + 1) * sizeof(left->children[0]));
+    }
+    left->count += right->count + 1;
+
+    memmove(parent->entries + i, parent->entries + i + 1, (parent->count - i - 1) * sizeof(parent->entries[0]));
+    memmove(parent->children + i + 1, parent->children + i + 2, (parent->count - i - 1) * sizeof(parent->children[0]));
+    parent->count--;
+    fossil_tofu_free(right);
+}
+
+// Make sure child `i` of `node` has at least T keys before descending into
+// it, borrowing from a sibling or merging. Returns the child to descend.
+static size_t fossil_tofu_mapof_bnode_fill(fossil_tofu_mapof_bnode_t* node, size_t i) {
+    const size_t t = FOSSIL_TOFU_MAPOF_T;
+    fossil_tofu_mapof_bnode_t* child = node->children[i];
+    if (child->count >= t) return i;
+
+    if (i > 0 && node->children[i - 1]->count >= t) {
+        fossil_tofu_mapof_bnode_t* left = node->children[i - 1];
+        memmove(child->entries + 1, child->entries, child->count * sizeof(child->entries[0]));
+        if (!child->leaf) {
+            memmove(child->children + 1, child->children, (child->count + 1) * sizeof(child->children[0]));
+            child->children[0] = left->children[left->count];
+        }
+        child->entries[0] = node->entries[i - 1];
+        node->entries[i - 1] = left->entries[left->count - 1];
+        left->count--;
+        child->count++;
+        return i;
+    }
+    if (i < node->count && node->children[i + 1]->count >= t) {
+        fossil_tofu_mapof_bnode_t* right = node->children[i + 1];
+        child->entries[child->count] = node->entries[i];
+        if (!child->leaf) {
+            child->children[child->count + 1] = right->children[0];
+            memmove(right->children, right->children + 1, right->count * sizeof(right->children[0]));
+        }
+        node->entries[i] = right->entries[0];
+        memmove(right->entries, right->entries + 1, (right->count - 1) * sizeof(right->entries[0]));
+        right->count--;
+        child->count++;
+        return i;
+    }
+    if (i < node->count) {
+        fossil_tofu_mapof_bnode_merge(node, i);
+        return i;
+    }
+    fossil_tofu_mapof_bnode_merge(node, i - 1);
+    return i - 1;
+}
+
+// Unlink the entry for `key`, which must be present; the entry itself is
+// left to the caller. Single pass, top-down (CLRS deletion).
+static void fossil_tofu_mapof_btree_erase(fossil_tofu_mapof_t* map, const fossil_tofu_t* key) {
+    const size_t t = FOSSIL_TOFU_MAPOF_T;
+    fossil_tofu_mapof_bnode_t* node = map->root;
+
+    while (node) {
+        bool found;
+        size_t i = fossil_tofu_mapof_bnode_search(node, key, &found);
+        if (found && node->leaf) {
+            memmove(node->entries + i, node->entries + i + 1, (node->count - i - 1) * sizeof(node->entries[0]));
+            node->count--;
+            break;
+        }
+        if (found) {
+            fossil_tofu_mapof_bnode_t* left = node->children[i];
+            fossil_tofu_mapof_bnode_t* right = node->children[i + 1];
+            if (left->count >= t) {
+                // Replace with the predecessor, then delete that from the left subtree.
+                fossil_tofu_mapof_bnode_t* walk = left;
+                while (!walk->leaf) walk = walk->children[walk->count];
+                node->entries[i] = walk->entries[walk->count - 1];
+                key = &node->entries[i]->key;
+                node = left;
+            } else if (right->count >= t) {
+                fossil_tofu_mapof_bnode_t* walk = right;
+                while (!walk->leaf) walk = walk->children[0];
+                node->entries[i] = walk->entries[0];
+                key = &node->entries[i]->key;
+                node = right;
+            } else {
+                fossil_tofu_mapof_bnode_merge(node, i);
+                node = left;
+            }
+            continue;
+        }
+        if (node->leaf) break;
+        node = node->children[fossil_tofu_mapof_bnode_fill(node, i)];
+    }
+
+    map->keys--;
+    if (map->root->count == 0) {
+        fossil_tofu_mapof_bnode_t* root = map->root;
+        map->root = root->leaf ? NULL : root->children[0];
+        fossil_tofu_free(root);
+    }
+}
+
+static fossil_tofu_mapof_bnode_t* fossil_tofu_mapof_bnode_clone(const fossil_tofu_mapof_t* map, const fossil_tofu_mapof_bnode_t* other, size_t* size) {
+    fossil_tofu_mapof_bnode_t* node = fossil_tofu_mapof_bnode_create(other->leaf);
+    if (!node) return NULL;
+    for (size_t i = 0; i <= other->count; i++) {
+        if (!other->leaf) {
+            node->children[i] = fossil_tofu_mapof_bnode_clone(map, other->children[i], size);
+            if (!node->children[i]) break;
+        }
+        if (i == other->count) return node;
+        node->entries[i] = fossil_tofu_mapof_clone_chain(map, other->entries[i]);
+        if (!node->entries[i]) break;
+        *size += fossil_tofu_mapof_chain_length(node->entries[i]);
+        node->count++;
+    }
+    fossil_tofu_mapof_bnode_destroy(node);
+    return NULL;
+}
+
+// In-order walk of the keys in [begin, end); either bound may be NULL.
+static bool fossil_tofu_mapof_bnode_walk(const fossil_tofu_mapof_bnode_t* node, const fossil_tofu_t* begin, const fossil_tofu_t* end,
+                                         fossil_tofu_mapof_visit_fn visit, void* context, size_t* visited) {
+    bool found = false;
+    size_t first = begin ? fossil_tofu_mapof_bnode_search(node, begin, &found) : 0;
+    for (size_t i = first; i <= node->count; i++) {
+        // Only the leftmost child can still hold keys below `begin`.
+        if (!node->leaf && !(found && i == first) &&
+            !fossil_tofu_mapof_bnode_walk(node->children[i], i == first ? begin : NULL, end, visit, context, visited)) {
+            return false;
+        }
+        if (i == node->count) break;
+        const fossil_tofu_mapof_node_t* entry = node->entries[i];
+        if (end && fossil_tofu_compare(&entry->key, end) >= 0) return false;
+        (*visited)++;
+        if (!visit(&entry->key, &entry->value, context)) return false;
+    }
+    return true;
+}
+
+// *****************************************************************************
+// Dense array helpers (insertion-ordered maps)
+// *****************************************************************************
+
+// Index value of a slot whose entry was removed. Probes step over it.
+#define FOSSIL_TOFU_MAPOF_INDEX_DEAD UINT32_MAX
+
+// Point the first free index slot on `entry`'s probe path at it. The key
+// is known not to be indexed yet, so a dead slot can be reused.
+static void fossil_tofu_mapof_dense_link(fossil_tofu_mapof_t* map, size_t entry) {
+    size_t mask = map->index_capacity - 1;
+    size_t i = (size_t)(map->entries[entry].hash & mask);
+    while (map->index[i] != 0 && map->index[i] != FOSSIL_TOFU_MAPOF_INDEX_DEAD) i = (i + 1) & mask;
+    map->index[i] = (uint32_t)(entry + 1);
+}
+
+// Index slot referring to the live entry for `key[0..len)`, or SIZE_MAX.
+static size_t fossil_tofu_mapof_dense_probe(const fossil_tofu_mapof_t* map, uint64_t hash, const char* key, size_t len) {
+    if (map->keys == 0) return SIZE_MAX;
+
+    size_t mask = map->index_capacity - 1;
+    for (size_t i = (size_t)(hash & mask);; i = (i + 1) & mask) {
+        uint32_t slot = map->index[i];
+        if (slot == 0) return SIZE_MAX;
+        if (slot == FOSSIL_TOFU_MAPOF_INDEX_DEAD) continue;
+        const fossil_tofu_mapof_entry_t* entry = &map->entries[slot - 1];
+        if (entry->hash == hash && fossil_tofu_equals_key(&entry->node.key, key, len)) return i;
+    }
+}
+
+// Move the live entries, still in order, to the front of a fresh array
+// with room for `keys` keys, and index them again. Dead entries and dead
+// index slots are gone afterwards.
+static int32_t fossil_tofu_mapof_dense_rebuild(fossil_tofu_mapof_t* map, size_t keys) {
+    size_t capacity = fossil_tofu_hashtable_slots_for(keys, FOSSIL_TOFU_MAPOF_MAX_LOAD);
+    if (capacity == 0) return FOSSIL_TOFU_ERROR_OVERFLOW;
+    // Filling the array up to `room` keeps the index under its load limit.
+    size_t room = capacity / FOSSIL_TOFU_MAPOF_LOAD_DEN * FOSSIL_TOFU_MAPOF_LOAD_NUM;
+    if (room >= FOSSIL_TOFU_MAPOF_INDEX_DEAD - 1) return FOSSIL_TOFU_ERROR_CAPACITY;
+
+    fossil_tofu_mapof_entry_t* entries = (fossil_tofu_mapof_entry_t*)fossil_tofu_alloc(room * sizeof(fossil_tofu_mapof_entry_t));
+    uint32_t* index = (uint32_t*)fossil_tofu_alloc(capacity * sizeof(uint32_t));
+    if (!entries || !index) {
+        fossil_tofu_free(entries);
+        fossil_tofu_free(index);
+        return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+    }
+    memset(index, 0, capacity * sizeof(uint32_t));
+
+    size_t count = 0;
+    for (size_t j = 0; j < map->entry_count; j++) {
+        if (map->entries[j].live) entries[count++] = map->entries[j];
+    }
+    fossil_tofu_free(map->entries);
+    fossil_tofu_free(map->index);
+    map->entries = entries;
+    map->entry_count = count;
+    map->entry_capacity = room;
+    map->index = index;
+    map->index_capacity = capacity;
+    for (size_t j = 0; j < count; j++) {
+        fossil_tofu_mapof_dense_link(map, j);
+    }
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+// Append a head entry for a key that is not in the map yet.
+static int32_t fossil_tofu_mapof_dense_append(fossil_tofu_mapof_t* map, uint64_t hash, fossil_tofu_mapof_node_t head) {
+    if (map->entry_count == map->entry_capacity) {
+        int32_t result = fossil_tofu_mapof_dense_rebuild(map, map->keys + 1);
+        if (result != FOSSIL_TOFU_SUCCESS) return result;
+    }
+    fossil_tofu_mapof_entry_t* entry = &map->entries[map->entry_count];
+    entry->hash = hash;
+    entry->live = true;
+    entry->node = head;
+    fossil_tofu_mapof_dense_link(map, map->entry_count);
+    map->entry_count++;
+    map->keys++;
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+static int32_t fossil_tofu_mapof_dense_put(fossil_tofu_mapof_t* map, char *key, size_t len, uint64_t hash, char *value) {
+    size_t i = fossil_tofu_mapof_dense_probe(map, hash, key, len);
+    if (i != SIZE_MAX) {
+        int32_t result = fossil_tofu_mapof_shadow(map, &map->entries[map->index[i] - 1].node, value);
+        if (result == FOSSIL_TOFU_SUCCESS) map->size++;
+        return result;
+    }
+
+    fossil_tofu_mapof_node_t head;
+    head.key = fossil_tofu_create(map->key_type, key);
+    head.value = fossil_tofu_create(map->value_type, value);
+    head.next = NULL;
+    if (fossil_tofu_mapof_dense_append(map, hash, head) != FOSSIL_TOFU_SUCCESS) {
+        fossil_tofu_destroy(&head.key);
+        fossil_tofu_destroy(&head.value);
+        return FOSSIL_TOFU_FAILURE;
+    }
+    map->size++;
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+static int32_t fossil_tofu_mapof_dense_remove(fossil_tofu_mapof_t* map, const char* key, size_t len) {
+    size_t i = fossil_tofu_mapof_dense_probe(map, fossil_tofu_hash_key(map->key_id, key, len), key, len);
+    if (i == SIZE_MAX) return FOSSIL_TOFU_FAILURE;
+
+    fossil_tofu_mapof_entry_t* entry = &map->entries[map->index[i] - 1];
+    if (!fossil_tofu_mapof_uncover(&entry->node)) {
+        fossil_tofu_destroy(&entry->node.key);
+        entry->live = false;
+        map->index[i] = FOSSIL_TOFU_MAPOF_INDEX_DEAD;
+        map->keys--;
+    }
+    map->size--;
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+// *****************************************************************************
+// Mode dispatch
+// *****************************************************************************
+
+// Head entry for a key in any mode, NULL when absent. Values are shadowed
+// and uncovered inside the head, so it never moves while the key is live.
+static fossil_tofu_mapof_node_t* fossil_tofu_mapof_head(const fossil_tofu_mapof_t* map, const char* key, size_t len) {
+    if (map->mode == FOSSIL_TOFU_MAPOF_INSERTION) {
+        size_t i = fossil_tofu_mapof_dense_probe(map, fossil_tofu_hash_key(map->key_id, key, len), key, len);
+        return i == SIZE_MAX ? NULL : &map->entries[map->index[i] - 1].node;
+    }
+    if (map->mode == FOSSIL_TOFU_MAPOF_ORDERED) {
+        if (!fossil_tofu_mapof_numeric_key(map->key_id)) {
+            return fossil_tofu_mapof_btree_find_text(map, key, len);
+        }
+        // Numeric comparisons parse the key, so it needs a terminator.
+        if (len >= FOSSIL_TOFU_KEY_TEXT_MAX) return NULL;
+        char text[FOSSIL_TOFU_KEY_TEXT_MAX];
+        memcpy(text, key, len);
+        text[len] = '\0';
+        fossil_tofu_t needle = fossil_tofu_mapof_needle(map, text);
+        return fossil_tofu_mapof_btree_find(map, &needle);
+    }
+    size_t i = fossil_tofu_hashtable_lookup(&map->table, key, len);
+    return i == SIZE_MAX ? NULL : fossil_tofu_mapof_node(map, i);
+}
+
+static fossil_tofu_mapof_node_t* fossil_tofu_mapof_head_cstr(const fossil_tofu_mapof_t* map, const char* key) {
+    if (map->mode == FOSSIL_TOFU_MAPOF_ORDERED) {
+        fossil_tofu_t needle = fossil_tofu_mapof_needle(map, key);
+        return fossil_tofu_mapof_btree_find(map, &needle);
+    }
+    return fossil_tofu_mapof_head(map, key, strlen(key));
+}
+
 // *****************************************************************************
 // Function definitions
 // *****************************************************************************
@@ -36,13 +595,40 @@ fossil_tofu_mapof_t* fossil_tofu_mapof_create_container(char* key_type, char* va
 
     fossil_tofu_mapof_t* map = (fossil_tofu_mapof_t*)fossil_tofu_alloc(sizeof(fossil_tofu_mapof_t));
     if (!map) return NULL;
-    map->key_type = key_type;
-    map->value_type = value_type;
-    map->head = NULL;
+    map->key_type = fossil_tofu_strdup(key_type);
+    map->value_type = fossil_tofu_strdup(value_type);
+    if (!map->key_type || !map->value_type) {
+        fossil_tofu_free(map->key_type);
+        fossil_tofu_free(map->value_type);
+        fossil_tofu_free(map);
+        return NULL;
+    }
+    map->mode = FOSSIL_TOFU_MAPOF_HASHED;
+    map->key_id = fossil_tofu_validate_type(key_type);
+    fossil_tofu_hashtable_init(&map->table, map->key_id, offsetof(fossil_tofu_mapof_node_t, key));
+    map->root = NULL;
+    map->entries = NULL;
+    map->entry_count = 0;
+    map->entry_capacity = 0;
+    map->index = NULL;
+    map->index_capacity = 0;
+    map->keys = 0;
     map->size = 0;
     return map;
 }
 
+fossil_tofu_mapof_t* fossil_tofu_mapof_create_ordered(char* key_type, char* value_type) {
+    fossil_tofu_mapof_t* map = fossil_tofu_mapof_create_container(key_type, value_type);
+    if (map) map->mode = FOSSIL_TOFU_MAPOF_ORDERED;
+    return map;
+}
+
+fossil_tofu_mapof_t* fossil_tofu_mapof_create_insertion_ordered(char* key_type, char* value_type) {
+    fossil_tofu_mapof_t* map = fossil_tofu_mapof_create_container(key_type, value_type);
+    if (map) map->mode = FOSSIL_TOFU_MAPOF_INSERTION;
+    return map;
+}
+
 fossil_tofu_mapof_t* fossil_tofu_mapof_create_default(void) {
     return fossil_tofu_mapof_create_container("any", "any");
 }
@@ -52,17 +638,45 @@ fossil_tofu_mapof_t* fossil_tofu_mapof_create_copy(const fossil_tofu_mapof_t* ot
 
     fossil_tofu_mapof_t* map = fossil_tofu_mapof_create_container(other->key_type, other->value_type);
     if (!map) return NULL;
+    map->mode = other->mode;
+    if (map->mode == FOSSIL_TOFU_MAPOF_HASHED) {
+        // Same slot count and same hashes, so every slot is cloned in place.
+        if (fossil_tofu_hashtable_clone(&map->table, &other->table, fossil_tofu_mapof_clone_node, map) != FOSSIL_TOFU_SUCCESS) {
+            fossil_tofu_mapof_destroy(map);
+            return NULL;
+        }
+        map->keys = map->table.count;
+        return map;
+    }
+    if (other->keys == 0) return map;
 
-    fossil_tofu_mapof_node_t* current = other->head;
-    while (current) {
-        // Check type match for key and value
-        if (fossil_tofu_get_type(&current->key) != fossil_tofu_validate_type(map->key_type) ||
-            fossil_tofu_get_type(&current->value) != fossil_tofu_validate_type(map->value_type)) {
+    if (map->mode == FOSSIL_TOFU_MAPOF_ORDERED) {
+        // Clone the tree shape as is; no rebalancing needed.
+        map->root = fossil_tofu_mapof_bnode_clone(map, other->root, &map->size);
+        if (!map->root) {
             fossil_tofu_mapof_destroy(map);
             return NULL;
         }
-        fossil_tofu_mapof_insert(map, fossil_tofu_get_value(&current->key), fossil_tofu_get_value(&current->value));
-        current = current->next;
+        map->keys = other->keys;
+        return map;
+    }
+
+    // Appending in order also compacts away the source's dead entries.
+    if (fossil_tofu_mapof_dense_rebuild(map, other->keys) != FOSSIL_TOFU_SUCCESS) {
+        fossil_tofu_mapof_destroy(map);
+        return NULL;
+    }
+    for (size_t j = 0; j < other->entry_count; j++) {
+        const fossil_tofu_mapof_entry_t* entry = &other->entries[j];
+        if (!entry->live) continue;
+        fossil_tofu_mapof_node_t* chain = fossil_tofu_mapof_clone_chain(map, &entry->node);
+        if (!chain) {
+            fossil_tofu_mapof_destroy(map);
+            return NULL;
+        }
+        map->size += fossil_tofu_mapof_chain_length(chain);
+        fossil_tofu_mapof_dense_append(map, entry->hash, *chain);
+        fossil_tofu_free(chain);
     }
     return map;
 }
@@ -73,9 +687,23 @@ fossil_tofu_mapof_t* fossil_tofu_mapof_create_move(fossil_tofu_mapof_t* other) {
     fossil_tofu_mapof_t* map = fossil_tofu_mapof_create_container(other->key_type, other->value_type);
     if (!map) return NULL;
 
-    map->head = other->head;
+    map->mode = other->mode;
+    fossil_tofu_hashtable_move(&map->table, &other->table);
+    map->root = other->root;
+    map->entries = other->entries;
+    map->entry_count = other->entry_count;
+    map->entry_capacity = other->entry_capacity;
+    map->index = other->index;
+    map->index_capacity = other->index_capacity;
+    map->keys = other->keys;
     map->size = other->size;
-    other->head = NULL;
+    other->root = NULL;
+    other->entries = NULL;
+    other->entry_count = 0;
+    other->entry_capacity = 0;
+    other->index = NULL;
+    other->index_capacity = 0;
+    other->keys = 0;
     other->size = 0;
 
     return map;
@@ -84,98 +712,262 @@ fossil_tofu_mapof_t* fossil_tofu_mapof_create_move(fossil_tofu_mapof_t* other) {
 void fossil_tofu_mapof_destroy(fossil_tofu_mapof_t* map) {
     if (!map) return;
 
-    while (map->head) {
-        fossil_tofu_mapof_node_t* temp = map->head;
-        map->head = map->head->next;
-        fossil_tofu_destroy(&temp->key);
-        fossil_tofu_destroy(&temp->value);
-        fossil_tofu_free(temp);
+    for (size_t i = 0; i < map->table.capacity; i++) {
+        fossil_tofu_mapof_destroy_chain(fossil_tofu_mapof_node(map, i));
     }
-
+    for (size_t j = 0; j < map->entry_count; j++) {
+        fossil_tofu_mapof_entry_t* entry = &map->entries[j];
+        if (!entry->live) continue;
+        fossil_tofu_mapof_destroy_chain(entry->node.next);
+        fossil_tofu_destroy(&entry->node.key);
+        fossil_tofu_destroy(&entry->node.value);
+    }
+    fossil_tofu_free(map->entries);
+    fossil_tofu_free(map->index);
+    fossil_tofu_mapof_bnode_destroy(map->root);
+    fossil_tofu_hashtable_release(&map->table);
+    fossil_tofu_free(map->key_type);
+    fossil_tofu_free(map->value_type);
     fossil_tofu_free(map);
 }
 
-int32_t fossil_tofu_mapof_insert(fossil_tofu_mapof_t* map, char *key, char *value) {
-    if (!map || !key || !value) return FOSSIL_TOFU_FAILURE;
+// Insert with the key length and hash already worked out; the hash is
+// unused in ordered mode.
+static int32_t fossil_tofu_mapof_put(fossil_tofu_mapof_t* map, char *key, size_t len, uint64_t hash, char *value) {
+    if (map->mode == FOSSIL_TOFU_MAPOF_INSERTION) return fossil_tofu_mapof_dense_put(map, key, len, hash, value);
+
+    fossil_tofu_mapof_node_t* head;
+    if (map->mode == FOSSIL_TOFU_MAPOF_ORDERED) {
+        head = fossil_tofu_mapof_head_cstr(map, key);
+    } else {
+        size_t i = fossil_tofu_hashtable_probe(&map->table, hash, key, len);
+        head = i == SIZE_MAX ? NULL : fossil_tofu_mapof_node(map, i);
+    }
+    if (head) {
+        int32_t result = fossil_tofu_mapof_shadow(map, head, value);
+        if (result == FOSSIL_TOFU_SUCCESS) map->size++;
+        return result;
+    }
+
+    if (map->mode == FOSSIL_TOFU_MAPOF_HASHED &&
+        fossil_tofu_hashtable_grow(&map->table, FOSSIL_TOFU_MAPOF_MAX_LOAD) != FOSSIL_TOFU_SUCCESS) {
+        return FOSSIL_TOFU_FAILURE;
+    }
 
     fossil_tofu_mapof_node_t* node = (fossil_tofu_mapof_node_t*)fossil_tofu_alloc(sizeof(fossil_tofu_mapof_node_t));
     if (!node) return FOSSIL_TOFU_FAILURE;
-
     node->key = fossil_tofu_create(map->key_type, key);
     node->value = fossil_tofu_create(map->value_type, value);
-    node->next = map->head;
-    map->head = node;
+    node->next = NULL;
+
+    if (map->mode == FOSSIL_TOFU_MAPOF_ORDERED) {
+        if (fossil_tofu_mapof_btree_insert(map, node) != FOSSIL_TOFU_SUCCESS) {
+            fossil_tofu_mapof_destroy_chain(node);
+            return FOSSIL_TOFU_FAILURE;
+        }
+    } else {
+        fossil_tofu_hashtable_place(&map->table, hash, node);
+        map->keys++;
+    }
     map->size++;
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+int32_t fossil_tofu_mapof_insert(fossil_tofu_mapof_t* map, char *key, char *value) {
+    if (!map || !key || !value) return FOSSIL_TOFU_FAILURE;
+
+    size_t len = strlen(key);
+    uint64_t hash = map->mode == FOSSIL_TOFU_MAPOF_ORDERED ? 0 : fossil_tofu_hash_key(map->key_id, key, len);
+    return fossil_tofu_mapof_put(map, key, len, hash, value);
+}
+
+int32_t fossil_tofu_mapof_insert_many(fossil_tofu_mapof_t* map, char* const keys[], char* const values[], size_t n) {
+    if (!map || (n && (!keys || !values))) return FOSSIL_TOFU_FAILURE;
+    for (size_t i = 0; i < n; i++) {
+        if (!keys[i] || !values[i]) return FOSSIL_TOFU_FAILURE; // Nothing is inserted if any pair is missing
+    }
+
+    if (map->mode != FOSSIL_TOFU_MAPOF_HASHED) {
+        for (size_t i = 0; i < n; i++) {
+            int32_t result = fossil_tofu_mapof_insert(map, keys[i], values[i]);
+            if (result != FOSSIL_TOFU_SUCCESS) return result;
+        }
+        return FOSSIL_TOFU_SUCCESS;
+    }
+
+    // Grow once up front so no rehash moves the slots we prefetch.
+    int32_t result = fossil_tofu_mapof_reserve(map, map->keys + n);
+    if (result != FOSSIL_TOFU_SUCCESS) return result;
 
+    size_t len[FOSSIL_TOFU_MAPOF_BATCH];
+    uint64_t hash[FOSSIL_TOFU_MAPOF_BATCH];
+    for (size_t base = 0; base < n; base += FOSSIL_TOFU_MAPOF_BATCH) {
+        size_t count = n - base < FOSSIL_TOFU_MAPOF_BATCH ? n - base : FOSSIL_TOFU_MAPOF_BATCH;
+        size_t mask = map->table.capacity - 1;
+        for (size_t j = 0; j < count; j++) {
+            len[j] = strlen(keys[base + j]);
+            hash[j] = fossil_tofu_hashtable_hash(&map->table, keys[base + j], len[j]);
+            FOSSIL_TOFU_MAPOF_PREFETCH(&map->table.slots[hash[j] & mask]);
+        }
+        for (size_t j = 0; j < count; j++) {
+            result = fossil_tofu_mapof_put(map, keys[base + j], len[j], hash[j], values[base + j]);
+            if (result != FOSSIL_TOFU_SUCCESS) return result;
+        }
+    }
     return FOSSIL_TOFU_SUCCESS;
 }
 
 int32_t fossil_tofu_mapof_remove(fossil_tofu_mapof_t* map, char *key) {
     if (!map || !key) return FOSSIL_TOFU_FAILURE;
+    if (map->mode == FOSSIL_TOFU_MAPOF_INSERTION) return fossil_tofu_mapof_dense_remove(map, key, strlen(key));
 
-    fossil_tofu_t temp_data = fossil_tofu_create(map->key_type, key);
-
-    fossil_tofu_mapof_node_t** current = &map->head;
-    while (*current) {
-        if (fossil_tofu_compare(&(*current)->key, &temp_data) == 0) {
-            fossil_tofu_mapof_node_t* temp = *current;
-            *current = (*current)->next;
-            fossil_tofu_destroy(&temp->key);
-            fossil_tofu_destroy(&temp->value);
-            fossil_tofu_free(temp);
-            map->size--;
-            return FOSSIL_TOFU_SUCCESS;
+    fossil_tofu_mapof_node_t* head;
+    size_t i = SIZE_MAX;
+    if (map->mode == FOSSIL_TOFU_MAPOF_ORDERED) {
+        head = fossil_tofu_mapof_head_cstr(map, key);
+    } else {
+        i = fossil_tofu_hashtable_lookup(&map->table, key, strlen(key));
+        head = i == SIZE_MAX ? NULL : fossil_tofu_mapof_node(map, i);
+    }
+    if (!head) return FOSSIL_TOFU_FAILURE;
+
+    if (!fossil_tofu_mapof_uncover(head)) {
+        if (map->mode == FOSSIL_TOFU_MAPOF_ORDERED) {
+            fossil_tofu_mapof_btree_erase(map, &head->key);
+        } else {
+            fossil_tofu_hashtable_vacate(&map->table, i);
+            map->keys--;
         }
-        current = &(*current)->next;
+        fossil_tofu_destroy(&head->key);
+        fossil_tofu_free(head);
     }
-    return FOSSIL_TOFU_FAILURE;
+    map->size--;
+    return FOSSIL_TOFU_SUCCESS;
 }
 
 bool fossil_tofu_mapof_contains(const fossil_tofu_mapof_t* map, char *key) {
     if (!map || !key) return false;
 
-    fossil_tofu_t temp_data = fossil_tofu_create(map->key_type, key);
+    return fossil_tofu_mapof_head_cstr(map, key) != NULL;
+}
+
+fossil_tofu_t fossil_tofu_mapof_get(const fossil_tofu_mapof_t* map, char *key) {
+    if (!map || !key) return (fossil_tofu_t){0};
 
-    fossil_tofu_mapof_node_t* current = map->head;
-    while (current) {
-        if (fossil_tofu_compare(&current->key, &temp_data) == 0) {
-            return true;
-        }
-        current = current->next;
+    fossil_tofu_mapof_node_t* head = fossil_tofu_mapof_head_cstr(map, key);
+    if (head) {
+        return head->value;
     }
-    return false;
+    return (fossil_tofu_t){0};
 }
 
-fossil_tofu_t fossil_tofu_mapof_get(const fossil_tofu_mapof_t* map, char *key) {
-    if (!map || !key) return fossil_tofu_create(map->value_type, NULL);
+size_t fossil_tofu_mapof_get_many(const fossil_tofu_mapof_t* map, char* const keys[], size_t n, fossil_tofu_t out[]) {
+    if (!out) return 0;
+    if (!map || !keys) {
+        for (size_t i = 0; i < n; i++) out[i] = (fossil_tofu_t){0};
+        return 0;
+    }
 
-    fossil_tofu_t temp_data = fossil_tofu_create(map->key_type, key);
+    size_t found = 0;
+    if (map->mode != FOSSIL_TOFU_MAPOF_HASHED || map->keys == 0) {
+        for (size_t i = 0; i < n; i++) {
+            out[i] = fossil_tofu_mapof_get(map, keys[i]);
+            if (out[i].value.data) found++;
+        }
+        return found;
+    }
 
-    fossil_tofu_mapof_node_t* current = map->head;
-    while (current) {
-        if (fossil_tofu_compare(&current->key, &temp_data) == 0) {
-            return current->value;
+    // Three passes per batch, each touching memory the previous one asked
+    // for: hash and fetch the home slots, fetch the nodes they point at,
+    // then probe with both already on their way into cache.
+    size_t len[FOSSIL_TOFU_MAPOF_BATCH];
+    uint64_t hash[FOSSIL_TOFU_MAPOF_BATCH];
+    size_t mask = map->table.capacity - 1;
+    for (size_t base = 0; base < n; base += FOSSIL_TOFU_MAPOF_BATCH) {
+        size_t count = n - base < FOSSIL_TOFU_MAPOF_BATCH ? n - base : FOSSIL_TOFU_MAPOF_BATCH;
+        for (size_t j = 0; j < count; j++) {
+            const char* key = keys[base + j];
+            len[j] = key ? strlen(key) : 0;
+            hash[j] = key ? fossil_tofu_hashtable_hash(&map->table, key, len[j]) : 0;
+            FOSSIL_TOFU_MAPOF_PREFETCH(&map->table.slots[hash[j] & mask]);
+        }
+        for (size_t j = 0; j < count; j++) {
+            const void* node = map->table.slots[hash[j] & mask].node;
+            if (node) FOSSIL_TOFU_MAPOF_PREFETCH(node);
+        }
+        for (size_t j = 0; j < count; j++) {
+            fossil_tofu_t* value = &out[base + j];
+            size_t i = keys[base + j] ? fossil_tofu_hashtable_probe(&map->table, hash[j], keys[base + j], len[j]) : SIZE_MAX;
+            if (i == SIZE_MAX) {
+                *value = (fossil_tofu_t){0};
+                continue;
+            }
+            *value = fossil_tofu_mapof_node(map, i)->value;
+            found++;
         }
-        current = current->next;
     }
-    return fossil_tofu_create(map->value_type, NULL);
+    return found;
+}
+
+const fossil_tofu_t* fossil_tofu_mapof_find(const fossil_tofu_mapof_t* map, const char* key, size_t len) {
+    if (!map || !key) return NULL;
+
+    fossil_tofu_mapof_node_t* head = fossil_tofu_mapof_head(map, key, len);
+    return head ? &head->value : NULL;
+}
+const fossil_tofu_t* fossil_tofu_mapof_find_i64(const fossil_tofu_mapof_t* map, int64_t key) {
+    char text[24];
+    int len = snprintf(text, sizeof(text), "%" PRId64, key);
+    return fossil_tofu_mapof_find(map, text, (size_t)len);
+}
+
+bool fossil_tofu_mapof_contains_key(const fossil_tofu_mapof_t* map, const char* key, size_t len) {
+    return fossil_tofu_mapof_find(map, key, len) != NULL;
 }
 
 int32_t fossil_tofu_mapof_set(fossil_tofu_mapof_t* map, char *key, char *value) {
     if (!map || !key || !value) return FOSSIL_TOFU_FAILURE;
 
-    fossil_tofu_t temp_data = fossil_tofu_create(map->key_type, key);
+    fossil_tofu_mapof_node_t* head = fossil_tofu_mapof_head_cstr(map, key);
+    if (!head) return FOSSIL_TOFU_FAILURE;
 
-    fossil_tofu_mapof_node_t* current = map->head;
-    while (current) {
-        if (fossil_tofu_compare(&current->key, &temp_data) == 0) {
-            fossil_tofu_destroy(&current->value);
-            current->value = fossil_tofu_create(map->value_type, value);
-            return FOSSIL_TOFU_SUCCESS;
-        }
-        current = current->next;
-    }
-    return FOSSIL_TOFU_FAILURE;
+    fossil_tofu_destroy(&head->value);
+    head->value = fossil_tofu_create(map->value_type, value);
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+int32_t fossil_tofu_mapof_reserve(fossil_tofu_mapof_t* map, size_t keys) {
+    if (!map) return FOSSIL_TOFU_ERROR_NULL_POINTER;
+    if (map->mode == FOSSIL_TOFU_MAPOF_ORDERED) return FOSSIL_TOFU_SUCCESS;
+
+    if (map->mode == FOSSIL_TOFU_MAPOF_HASHED) return fossil_tofu_hashtable_reserve(&map->table, keys, FOSSIL_TOFU_MAPOF_MAX_LOAD);
+
+    size_t capacity = fossil_tofu_hashtable_slots_for(keys, FOSSIL_TOFU_MAPOF_MAX_LOAD);
+    if (capacity == 0) return FOSSIL_TOFU_ERROR_OVERFLOW;
+    if (capacity <= map->index_capacity) return FOSSIL_TOFU_SUCCESS;
+    return fossil_tofu_mapof_dense_rebuild(map, keys);
+}
+
+int32_t fossil_tofu_mapof_attach_filter(fossil_tofu_mapof_t* map, size_t bits_per_key) {
+    if (!map) return FOSSIL_TOFU_ERROR_NULL_POINTER;
+    if (map->mode != FOSSIL_TOFU_MAPOF_HASHED) return FOSSIL_TOFU_ERROR_UNSUPPORTED;
+
+    return fossil_tofu_hashtable_attach_filter(&map->table, bits_per_key);
+}
+
+void fossil_tofu_mapof_detach_filter(fossil_tofu_mapof_t* map) {
+    if (!map) return;
+
+    fossil_tofu_hashtable_detach_filter(&map->table);
+}
+
+bool fossil_tofu_mapof_has_filter(const fossil_tofu_mapof_t* map) {
+    return map && map->table.filter;
+}
+
+size_t fossil_tofu_mapof_capacity(const fossil_tofu_mapof_t* map) {
+    if (!map) return 0;
+    return map->mode == FOSSIL_TOFU_MAPOF_INSERTION ? map->index_capacity : map->table.capacity;
 }
 
 size_t fossil_tofu_mapof_size(const fossil_tofu_mapof_t* map) {
@@ -183,9 +975,119 @@ size_t fossil_tofu_mapof_size(const fossil_tofu_mapof_t* map) {
 }
 
 bool fossil_tofu_mapof_not_empty(const fossil_tofu_mapof_t* map) {
-    return map && map->head != NULL;
+    return map && map->size != 0;
 }
 
 bool fossil_tofu_mapof_is_empty(const fossil_tofu_mapof_t* map) {
-    return !map || map->head == NULL;
+    return !map || map->size == 0;
+}
+
+// *****************************************************************************
+// Iteration and ordered queries
+// *****************************************************************************
+
+bool fossil_tofu_mapof_is_ordered(const fossil_tofu_mapof_t* map) {
+    return map && map->mode == FOSSIL_TOFU_MAPOF_ORDERED;
+}
+
+fossil_tofu_mapof_mode_t fossil_tofu_mapof_get_mode(const fossil_tofu_mapof_t* map) {
+    return map ? map->mode : FOSSIL_TOFU_MAPOF_HASHED;
+}
+
+size_t fossil_tofu_mapof_for_each(const fossil_tofu_mapof_t* map, fossil_tofu_mapof_visit_fn visit, void* context) {
+    if (!map || !visit) return 0;
+
+    size_t visited = 0;
+    if (map->mode == FOSSIL_TOFU_MAPOF_ORDERED) {
+        if (map->root) fossil_tofu_mapof_bnode_walk(map->root, NULL, NULL, visit, context, &visited);
+        return visited;
+    }
+    for (size_t j = 0; j < map->entry_count; j++) {
+        const fossil_tofu_mapof_entry_t* entry = &map->entries[j];
+        if (!entry->live) continue;
+        visited++;
+        if (!visit(&entry->node.key, &entry->node.value, context)) return visited;
+    }
+    for (size_t i = 0; i < map->table.capacity; i++) {
+        const fossil_tofu_mapof_node_t* head = fossil_tofu_mapof_node(map, i);
+        if (!head) continue;
+        visited++;
+        if (!visit(&head->key, &head->value, context)) break;
+    }
+    return visited;
+}
+
+size_t fossil_tofu_mapof_range(const fossil_tofu_mapof_t* map, char* begin, char* end, fossil_tofu_mapof_visit_fn visit, void* context) {
+    if (!map || !visit || map->mode != FOSSIL_TOFU_MAPOF_ORDERED || !map->root) return 0;
+
+    fossil_tofu_t low = fossil_tofu_mapof_needle(map, begin);
+    fossil_tofu_t high = fossil_tofu_mapof_needle(map, end);
+    size_t visited = 0;
+    fossil_tofu_mapof_bnode_walk(map->root, begin ? &low : NULL, end ? &high : NULL, visit, context, &visited);
+    return visited;
+}
+
+const fossil_tofu_mapof_node_t* fossil_tofu_mapof_lower_bound(const fossil_tofu_mapof_t* map, char* key) {
+    if (!map || !key || map->mode != FOSSIL_TOFU_MAPOF_ORDERED) return NULL;
+
+    fossil_tofu_t needle = fossil_tofu_mapof_needle(map, key);
+    const fossil_tofu_mapof_node_t* best = NULL;
+    const fossil_tofu_mapof_bnode_t* node = map->root;
+    while (node) {
+        bool found;
+        size_t i = fossil_tofu_mapof_bnode_search(node, &needle, &found);
+        if (i < node->count) best = node->entries[i];
+        if (found || node->leaf) break;
+        node = node->children[i];
+    }
+    return best;
+}
+
+const fossil_tofu_mapof_node_t* fossil_tofu_mapof_ceiling(const fossil_tofu_mapof_t* map, char* key) {
+    return fossil_tofu_mapof_lower_bound(map, key);
+}
+
+const fossil_tofu_mapof_node_t* fossil_tofu_mapof_floor(const fossil_tofu_mapof_t* map, char* key) {
+    if (!map || !key || map->mode != FOSSIL_TOFU_MAPOF_ORDERED) return NULL;
+
+    fossil_tofu_t needle = fossil_tofu_mapof_needle(map, key);
+    const fossil_tofu_mapof_node_t* best = NULL;
+    const fossil_tofu_mapof_bnode_t* node = map->root;
+    while (node) {
+        bool found;
+        size_t i = fossil_tofu_mapof_bnode_search(node, &needle, &found);
+        if (found) return node->entries[i];
+        if (i > 0) best = node->entries[i - 1];
+        if (node->leaf) break;
+        node = node->children[i];
+    }
+    return best;
+}
+
+const fossil_tofu_mapof_node_t* fossil_tofu_mapof_first(const fossil_tofu_mapof_t* map) {
+    if (map && map->mode == FOSSIL_TOFU_MAPOF_INSERTION) {
+        for (size_t j = 0; j < map->entry_count; j++) {
+            if (map->entries[j].live) return &map->entries[j].node;
+        }
+        return NULL;
+    }
+    if (!map || map->mode != FOSSIL_TOFU_MAPOF_ORDERED || !map->root) return NULL;
+
+    const fossil_tofu_mapof_bnode_t* node = map->root;
+    while (!node->leaf) node = node->children[0];
+    return node->entries[0];
+}
+
+const fossil_tofu_mapof_node_t* fossil_tofu_mapof_last(const fossil_tofu_mapof_t* map) {
+    if (map && map->mode == FOSSIL_TOFU_MAPOF_INSERTION) {
+        for (size_t j = map->entry_count; j > 0; j--) {
+            if (map->entries[j - 1].live) return &map->entries[j - 1].node;
+        }
+        return NULL;
+    }
+    if (!map || map->mode != FOSSIL_TOFU_MAPOF_ORDERED || !map->root) return NULL;
+
+    const fossil_tofu_mapof_bnode_t* node = map->root;
+    while (!node->leaf) node = node->children[node->count];
+    return node->entries[node->count - 1];
 }
@@ -0,0 +1,317 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include "fossil/tofu/mpmcq.h"
+#include "fossil/tofu/atomics.h"
+#include "fossil/tofu/threads.h"
+
+// *****************************************************************************
+// Cells and positions
+// *****************************************************************************
+
+#define FOSSIL_TOFU_MPMCQ_LINE 64  // Assumed cache line size
+#define FOSSIL_TOFU_MPMCQ_CHUNK 32 // Elements prepared per batch run
+
+// A cell at ring position p is free for the producer of lap position p when
+// sequence == p, and holds a published element for the consumer of p when
+// sequence == p + 1. Taking it sets sequence to p + capacity, which frees it
+// for the next lap.
+struct fossil_tofu_mpmcq_cell_t {
+    fossil_tofu_atomic_size_t sequence;
+    fossil_tofu_t data;
+};
+
+struct fossil_tofu_mpmcq_ring_t {
+    char pad0[FOSSIL_TOFU_MPMCQ_LINE];
+    fossil_tofu_atomic_size_t enqueue;
+    char pad1[FOSSIL_TOFU_MPMCQ_LINE];
+    fossil_tofu_atomic_size_t dequeue;
+    char pad2[FOSSIL_TOFU_MPMCQ_LINE];
+};
+
+// Claim up to 'want' consecutive cells whose sequence equals position + 'lap'
+// (0 for producers, 1 for consumers) by advancing 'position' with one CAS.
+// Returns the number claimed and their first position, or 0 when the first
+// cell is not ready (queue full for producers, empty for consumers).
+static size_t fossil_tofu_mpmcq_claim(const fossil_tofu_mpmcq_t* queue, fossil_tofu_atomic_size_t* position, size_t lap, size_t want, size_t* start) {
+    size_t pos = fossil_tofu_atomic_size_load(position, FOSSIL_TOFU_RELAXED);
+    for (;;) {
+        size_t ready = 0;
+        while (ready < want) {
+            const fossil_tofu_mpmcq_cell_t* cell = &queue->cells[(pos + ready) & queue->mask];
+            size_t seq = fossil_tofu_atomic_size_load(&cell->sequence, FOSSIL_TOFU_ACQUIRE);
+            if (seq != pos + ready + lap) {
+                if (ready == 0 && (intptr_t)(seq - (pos + lap)) < 0) {
+                    return 0;
+                }
+                break;
+            }
+            ready++;
+        }
+        if (ready == 0) {
+            // Another thread moved past this cell; catch up and retry
+            pos = fossil_tofu_atomic_size_load(position, FOSSIL_TOFU_RELAXED);
+            continue;
+        }
+        if (fossil_tofu_atomic_size_cas_weak(position, &pos, pos + ready, FOSSIL_TOFU_RELAXED)) {
+            *start = pos;
+            return ready;
+        }
+    }
+}
+
+// Move 'count' tofus into claimed cells starting at 'start' and publish them.
+static void fossil_tofu_mpmcq_publish(fossil_tofu_mpmcq_t* queue, size_t start, fossil_tofu_t* tofus, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        fossil_tofu_mpmcq_cell_t* cell = &queue->cells[(start + i) & queue->mask];
+        cell->data = tofus[i];
+        fossil_tofu_atomic_size_store(&cell->sequence, start + i + 1, FOSSIL_TOFU_RELEASE);
+    }
+}
+
+// Move 'count' tofus out of claimed cells starting at 'start' and free the cells.
+static void fossil_tofu_mpmcq_consume(fossil_tofu_mpmcq_t* queue, size_t start, fossil_tofu_t* out, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        fossil_tofu_mpmcq_cell_t* cell = &queue->cells[(start + i) & queue->mask];
+        out[i] = cell->data;
+        fossil_tofu_atomic_size_store(&cell->sequence, start + i + queue->capacity, FOSSIL_TOFU_RELEASE);
+    }
+}
+
+// *****************************************************************************
+// Function prototypes
+// *****************************************************************************
+
+fossil_tofu_mpmcq_t* fossil_tofu_mpmcq_create_container(char* type, size_t capacity) {
+    if (type == NULL || capacity == 0 || capacity > (SIZE_MAX / 2) / sizeof(fossil_tofu_mpmcq_cell_t)) {
+        return NULL;
+    }
+    size_t rounded = 1;
+    while (rounded < capacity) {
+        rounded <<= 1;
+    }
+    fossil_tofu_mpmcq_t* queue = (fossil_tofu_mpmcq_t*)fossil_tofu_alloc(sizeof(fossil_tofu_mpmcq_t));
+    if (queue == NULL) {
+        return NULL;
+    }
+    queue->type = fossil_tofu_strdup(type);
+    queue->cells = (fossil_tofu_mpmcq_cell_t*)fossil_tofu_alloc(rounded * sizeof(fossil_tofu_mpmcq_cell_t));
+    queue->ring = (fossil_tofu_mpmcq_ring_t*)fossil_tofu_alloc(sizeof(fossil_tofu_mpmcq_ring_t));
+    if (queue->type == NULL || queue->cells == NULL || queue->ring == NULL) {
+        fossil_tofu_free(queue->type);
+        fossil_tofu_free(queue->cells);
+        fossil_tofu_free(queue->ring);
+        fossil_tofu_free(queue);
+        return NULL;
+    }
+    for (size_t i = 0; i < rounded; i++) {
+        fossil_tofu_atomic_size_init(&queue->cells[i].sequence, i);
+        memset(&queue->cells[i].data, 0, sizeof(fossil_tofu_t));
+    }
+    queue->capacity = rounded;
+    queue->mask = rounded - 1;
+    fossil_tofu_atomic_size_init(&queue->ring->enqueue, 0);
+    fossil_tofu_atomic_size_init(&queue->ring->dequeue, 0);
+    return queue;
+}
+
+void fossil_tofu_mpmcq_destroy(fossil_tofu_mpmcq_t* queue) {
+    if (queue == NULL) {
+        return;
+    }
+    size_t head = fossil_tofu_atomic_size_load(&queue->ring->dequeue, FOSSIL_TOFU_RELAXED);
+    size_t tail = fossil_tofu_atomic_size_load(&queue->ring->enqueue, FOSSIL_TOFU_RELAXED);
+    for (; head != tail; head++) {
+        fossil_tofu_destroy(&queue->cells[head & queue->mask].data);
+    }
+    fossil_tofu_free(queue->ring);
+    fossil_tofu_free(queue->cells);
+    fossil_tofu_free(queue->type);
+    fossil_tofu_free(queue);
+}
+
+// *****************************************************************************
+// Utility functions
+// *****************************************************************************
+
+int32_t fossil_tofu_mpmcq_try_insert(fossil_tofu_mpmcq_t* queue, char* data) {
+    if (queue == NULL || data == NULL) {
+        return FOSSIL_TOFU_ERROR_INVALID_ARGUMENT;
+    }
+    // Build the tofu first so a claimed cell is always published
+    fossil_tofu_t tofu = fossil_tofu_create(queue->type, data);
+    if (tofu.value.data == NULL) {
+        return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+    }
+    size_t start = 0;
+    if (fossil_tofu_mpmcq_claim(queue, &queue->ring->enqueue, 0, 1, &start) == 0) {
+        fossil_tofu_destroy(&tofu);
+        return FOSSIL_TOFU_FAILURE;  // Queue is full
+    }
+    fossil_tofu_mpmcq_publish(queue, start, &tofu, 1);
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+int32_t fossil_tofu_mpmcq_insert(fossil_tofu_mpmcq_t* queue, char* data) {
+    if (queue == NULL || data == NULL) {
+        return FOSSIL_TOFU_ERROR_INVALID_ARGUMENT;
+    }
+    fossil_tofu_t tofu = fossil_tofu_create(queue->type, data);
+    if (tofu.value.data == NULL) {
+        return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+    }
+    size_t start = 0;
+    while (fossil_tofu_mpmcq_claim(queue, &queue->ring->enqueue, 0, 1, &start) == 0) {
+        fossil_tofu_thread_yield();  // Queue is full; give consumers a chance
+    }
+    fossil_tofu_mpmcq_publish(queue, start, &tofu, 1);
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+size_t fossil_tofu_mpmcq_insert_batch(fossil_tofu_mpmcq_t* queue, char* const data[], size_t count) {
+    if (queue == NULL || data == NULL) {
+        return 0;
+    }
+    size_t inserted = 0;
+    fossil_tofu_t tofus[FOSSIL_TOFU_MPMCQ_CHUNK];
+    while (inserted < count) {
+        size_t prepared = 0;
+        while (prepared < FOSSIL_TOFU_MPMCQ_CHUNK && inserted + prepared < count && data[inserted + prepared] != NULL) {
+            tofus[prepared] = fossil_tofu_create(queue->type, data[inserted + prepared]);
+            if (tofus[prepared].value.data == NULL) {
+                break;
+            }
+            prepared++;
+        }
+        size_t placed = 0;
+        while (placed < prepared) {
+            size_t start = 0;
+            size_t claimed = fossil_tofu_mpmcq_claim(queue, &queue->ring->enqueue, 0, prepared - placed, &start);
+            if (claimed == 0) {
+                break;
+            }
+            fossil_tofu_mpmcq_publish(queue, start, tofus + placed, claimed);
+            placed += claimed;
+        }
+        for (size_t i = placed; i < prepared; i++) {
+            fossil_tofu_destroy(&tofus[i]);
+        }
+        inserted += placed;
+        if (placed < FOSSIL_TOFU_MPMCQ_CHUNK) {
+            break;  // Full, allocation failure, or a NULL entry
+        }
+    }
+    return inserted;
+}
+
+int32_t fossil_tofu_mpmcq_try_take(fossil_tofu_mpmcq_t* queue, fossil_tofu_t* out) {
+    if (queue == NULL || out == NULL) {
+        return FOSSIL_TOFU_ERROR_INVALID_ARGUMENT;
+    }
+    size_t start = 0;
+    if (fossil_tofu_mpmcq_claim(queue, &queue->ring->dequeue, 1, 1, &start) == 0) {
+        return FOSSIL_TOFU_FAILURE;  // Queue is empty
+    }
+    fossil_tofu_mpmcq_consume(queue, start, out, 1);
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+int32_t fossil_tofu_mpmcq_take(fossil_tofu_mpmcq_t* queue, fossil_tofu_t* out) {
+    if (queue == NULL || out == NULL) {
+        return FOSSIL_TOFU_ERROR_INVALID_ARGUMENT;
+    }
+    size_t start = 0;
+    while (fossil_tofu_mpmcq_claim(queue, &queue->ring->dequeue, 1, 1, &start) == 0) {
+        fossil_tofu_thread_yield();  // Queue is empty; give producers a chance
+    }
+    fossil_tofu_mpmcq_consume(queue, start, out, 1);
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+size_t fossil_tofu_mpmcq_take_batch(fossil_tofu_mpmcq_t* queue, fossil_tofu_t out[], size_t max) {
+    if (queue == NULL || out == NULL || max == 0) {
+        return 0;
+    }
+    size_t start = 0;
+    size_t claimed = fossil_tofu_mpmcq_claim(queue, &queue->ring->dequeue, 1, max, &start);
+    fossil_tofu_mpmcq_consume(queue, start, out, claimed);
+    return claimed;
+}
+
+int32_t fossil_tofu_mpmcq_remove(fossil_tofu_mpmcq_t* queue) {
+    fossil_tofu_t tofu;
+    int32_t result = fossil_tofu_mpmcq_try_take(queue, &tofu);
+    if (result == FOSSIL_TOFU_SUCCESS) {
+        fossil_tofu_destroy(&tofu);
+        return FOSSIL_TOFU_SUCCESS;
+    }
+    return FOSSIL_TOFU_FAILURE;
+}
+
+size_t fossil_tofu_mpmcq_size(const fossil_tofu_mpmcq_t* queue) {
+    if (queue == NULL) {
+        return 0;
+    }
+    // Consumers never pass producers, so reading dequeue first keeps this non-negative
+    size_t head = fossil_tofu_atomic_size_load(&queue->ring->dequeue, FOSSIL_TOFU_ACQUIRE);
+    size_t tail = fossil_tofu_atomic_size_load(&queue->ring->enqueue, FOSSIL_TOFU_ACQUIRE);
+    size_t size = tail - head;
+    return size > queue->capacity ? queue->capacity : size;
+}
+
+size_t fossil_tofu_mpmcq_capacity(const fossil_tofu_mpmcq_t* queue) {
+    return (queue != NULL) ? queue->capacity : 0;
+}
+
+bool fossil_tofu_mpmcq_not_empty(const fossil_tofu_mpmcq_t* queue) {
+    return fossil_tofu_mpmcq_size(queue) > 0;
+}
+
+bool fossil_tofu_mpmcq_not_cnullptr(const fossil_tofu_mpmcq_t* queue) {
+    return queue != NULL;
+}
+
+bool fossil_tofu_mpmcq_is_empty(const fossil_tofu_mpmcq_t* queue) {
+    return fossil_tofu_mpmcq_size(queue) == 0;
+}
+
+bool fossil_tofu_mpmcq_is_cnullptr(const fossil_tofu_mpmcq_t* queue) {
+    return queue == NULL;
+}
+
+// *****************************************************************************
+// Getter and setter functions
+// *****************************************************************************
+
+char* fossil_tofu_mpmcq_get_front(const fossil_tofu_mpmcq_t* queue) {
+    if (queue == NULL) {
+        return NULL;
+    }
+    size_t pos = fossil_tofu_atomic_size_load(&queue->ring->dequeue, FOSSIL_TOFU_RELAXED);
+    const fossil_tofu_mpmcq_cell_t* cell = &queue->cells[pos & queue->mask];
+    if (fossil_tofu_atomic_size_load(&cell->sequence, FOSSIL_TOFU_ACQUIRE) != pos + 1) {
+        return NULL;  // Queue is empty
+    }
+    return cell->data.value.data;
+}
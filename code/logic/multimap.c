@@ -0,0 +1,289 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include "fossil/tofu/multimap.h"
+
+// *****************************************************************************
+// Hash table helpers
+// *****************************************************************************
+
+// Grow once the table is 7/8 full.
+#define FOSSIL_TOFU_MULTIMAP_MAX_LOAD ((double)FOSSIL_TOFU_MULTIMAP_LOAD_NUM / FOSSIL_TOFU_MULTIMAP_LOAD_DEN)
+
+static inline fossil_tofu_multimap_entry_t* fossil_tofu_multimap_entry(const fossil_tofu_multimap_t* map, size_t i) {
+    return (fossil_tofu_multimap_entry_t*)map->table.slots[i].node;
+}
+
+static void fossil_tofu_multimap_destroy_entry(fossil_tofu_multimap_entry_t* entry) {
+    if (!entry) return;
+
+    for (size_t i = 0; i < entry->count; i++) {
+        fossil_tofu_destroy(&entry->values[i]);
+    }
+    fossil_tofu_destroy(&entry->key);
+    fossil_tofu_free(entry->values);
+    fossil_tofu_free(entry);
+}
+
+// Append a value, doubling the array when it is full.
+static int32_t fossil_tofu_multimap_append(const fossil_tofu_multimap_t* map, fossil_tofu_multimap_entry_t* entry, const char* value) {
+    if (entry->count == entry->capacity) {
+        size_t capacity = entry->capacity ? entry->capacity * 2 : 1;
+        fossil_tofu_t* values = (fossil_tofu_t*)fossil_tofu_realloc(entry->values, capacity * sizeof(fossil_tofu_t));
+        if (!values) return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+        entry->values = values;
+        entry->capacity = capacity;
+    }
+    entry->values[entry->count++] = fossil_tofu_create(map->value_type, (char*)value);
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+static fossil_tofu_multimap_entry_t* fossil_tofu_multimap_clone_entry(const fossil_tofu_multimap_t* map, const fossil_tofu_multimap_entry_t* other) {
+    fossil_tofu_multimap_entry_t* entry = (fossil_tofu_multimap_entry_t*)fossil_tofu_alloc(sizeof(fossil_tofu_multimap_entry_t));
+    if (!entry) return NULL;
+
+    entry->key = fossil_tofu_create(map->key_type, fossil_tofu_get_value(&other->key));
+    entry->values = (fossil_tofu_t*)fossil_tofu_alloc(other->count * sizeof(fossil_tofu_t));
+    entry->count = 0;
+    entry->capacity = other->count;
+    if (!entry->values) {
+        fossil_tofu_multimap_destroy_entry(entry);
+        return NULL;
+    }
+    for (size_t i = 0; i < other->count; i++) {
+        entry->values[entry->count++] = fossil_tofu_create(map->value_type, fossil_tofu_get_value(&other->values[i]));
+    }
+    return entry;
+}
+
+static void* fossil_tofu_multimap_clone_node(const void* node, void* context) {
+    fossil_tofu_multimap_t* map = (fossil_tofu_multimap_t*)context;
+    fossil_tofu_multimap_entry_t* entry = fossil_tofu_multimap_clone_entry(map, (const fossil_tofu_multimap_entry_t*)node);
+    if (entry) map->size += entry->count;
+    return entry;
+}
+
+// Remove the key in slot `i` and free its values.
+static void fossil_tofu_multimap_drop(fossil_tofu_multimap_t* map, size_t i) {
+    fossil_tofu_multimap_entry_t* entry = (fossil_tofu_multimap_entry_t*)fossil_tofu_hashtable_vacate(&map->table, i);
+    map->size -= entry->count;
+    fossil_tofu_multimap_destroy_entry(entry);
+}
+
+// *****************************************************************************
+// Function definitions
+// *****************************************************************************
+
+fossil_tofu_multimap_t* fossil_tofu_multimap_create_container(char* key_type, char* value_type) {
+    if (!key_type || !value_type) return NULL;
+    if (fossil_tofu_validate_type(key_type) == FOSSIL_TOFU_TYPE_CNULL ||
+        fossil_tofu_validate_type(value_type) == FOSSIL_TOFU_TYPE_CNULL)
+        return NULL;
+
+    fossil_tofu_multimap_t* map = (fossil_tofu_multimap_t*)fossil_tofu_alloc(sizeof(fossil_tofu_multimap_t));
+    if (!map) return NULL;
+    map->key_type = fossil_tofu_strdup(key_type);
+    map->value_type = fossil_tofu_strdup(value_type);
+    if (!map->key_type || !map->value_type) {
+        fossil_tofu_free(map->key_type);
+        fossil_tofu_free(map->value_type);
+        fossil_tofu_free(map);
+        return NULL;
+    }
+    fossil_tofu_hashtable_init(&map->table, fossil_tofu_validate_type(key_type), offsetof(fossil_tofu_multimap_entry_t, key));
+    map->size = 0;
+    return map;
+}
+
+fossil_tofu_multimap_t* fossil_tofu_multimap_create_default(void) {
+    return fossil_tofu_multimap_create_container("any", "any");
+}
+
+fossil_tofu_multimap_t* fossil_tofu_multimap_create_copy(const fossil_tofu_multimap_t* other) {
+    if (!other) return NULL;
+
+    fossil_tofu_multimap_t* map = fossil_tofu_multimap_create_container(other->key_type, other->value_type);
+    if (!map) return NULL;
+    if (fossil_tofu_hashtable_clone(&map->table, &other->table, fossil_tofu_multimap_clone_node, map) != FOSSIL_TOFU_SUCCESS) {
+        fossil_tofu_multimap_destroy(map);
+        return NULL;
+    }
+    return map;
+}
+
+fossil_tofu_multimap_t* fossil_tofu_multimap_create_move(fossil_tofu_multimap_t* other) {
+    if (!other) return NULL;
+
+    fossil_tofu_multimap_t* map = fossil_tofu_multimap_create_container(other->key_type, other->value_type);
+    if (!map) return NULL;
+
+    fossil_tofu_hashtable_move(&map->table, &other->table);
+    map->size = other->size;
+    other->size = 0;
+    return map;
+}
+
+void fossil_tofu_multimap_destroy(fossil_tofu_multimap_t* map) {
+    if (!map) return;
+
+    for (size_t i = 0; i < map->table.capacity; i++) {
+        fossil_tofu_multimap_destroy_entry(fossil_tofu_multimap_entry(map, i));
+    }
+    fossil_tofu_hashtable_release(&map->table);
+    fossil_tofu_free(map->key_type);
+    fossil_tofu_free(map->value_type);
+    fossil_tofu_free(map);
+}
+
+int32_t fossil_tofu_multimap_insert(fossil_tofu_multimap_t* map, char *key, char *value) {
+    if (!map || !key || !value) return FOSSIL_TOFU_FAILURE;
+
+    size_t len = strlen(key);
+    uint64_t hash = fossil_tofu_hashtable_hash(&map->table, key, len);
+    size_t i = fossil_tofu_hashtable_probe(&map->table, hash, key, len);
+    if (i != SIZE_MAX) {
+        int32_t result = fossil_tofu_multimap_append(map, fossil_tofu_multimap_entry(map, i), value);
+        if (result == FOSSIL_TOFU_SUCCESS) map->size++;
+        return result;
+    }
+
+    if (fossil_tofu_hashtable_grow(&map->table, FOSSIL_TOFU_MULTIMAP_MAX_LOAD) != FOSSIL_TOFU_SUCCESS) {
+        return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+    }
+
+    fossil_tofu_multimap_entry_t* entry = (fossil_tofu_multimap_entry_t*)fossil_tofu_alloc(sizeof(fossil_tofu_multimap_entry_t));
+    if (!entry) return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+    entry->key = fossil_tofu_create(map->key_type, key);
+    entry->values = NULL;
+    entry->count = 0;
+    entry->capacity = 0;
+    if (fossil_tofu_multimap_append(map, entry, value) != FOSSIL_TOFU_SUCCESS) {
+        fossil_tofu_multimap_destroy_entry(entry);
+        return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+    }
+
+    fossil_tofu_hashtable_place(&map->table, hash, entry);
+    map->size++;
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+int32_t fossil_tofu_multimap_remove(fossil_tofu_multimap_t* map, char *key) {
+    if (!map || !key) return FOSSIL_TOFU_FAILURE;
+
+    size_t i = fossil_tofu_hashtable_lookup(&map->table, key, strlen(key));
+    if (i == SIZE_MAX) return FOSSIL_TOFU_ERROR_NOT_FOUND;
+
+    fossil_tofu_multimap_drop(map, i);
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+int32_t fossil_tofu_multimap_remove_value(fossil_tofu_multimap_t* map, char *key, char *value) {
+    if (!map || !key || !value) return FOSSIL_TOFU_FAILURE;
+
+    size_t i = fossil_tofu_hashtable_lookup(&map->table, key, strlen(key));
+    if (i == SIZE_MAX) return FOSSIL_TOFU_ERROR_NOT_FOUND;
+
+    fossil_tofu_multimap_entry_t* entry = fossil_tofu_multimap_entry(map, i);
+    size_t len = strlen(value);
+    for (size_t j = 0; j < entry->count; j++) {
+        if (!fossil_tofu_equals_text(&entry->values[j], value, len)) continue;
+        if (entry->count == 1) {
+            fossil_tofu_multimap_drop(map, i);
+            return FOSSIL_TOFU_SUCCESS;
+        }
+        fossil_tofu_destroy(&entry->values[j]);
+        memmove(&entry->values[j], &entry->values[j + 1], (entry->count - j - 1) * sizeof(fossil_tofu_t));
+        entry->count--;
+        map->size--;
+        return FOSSIL_TOFU_SUCCESS;
+    }
+    return FOSSIL_TOFU_ERROR_NOT_FOUND;
+}
+
+bool fossil_tofu_multimap_contains(const fossil_tofu_multimap_t* map, char *key) {
+    if (!map || !key) return false;
+
+    return fossil_tofu_hashtable_lookup(&map->table, key, strlen(key)) != SIZE_MAX;
+}
+
+const fossil_tofu_t* fossil_tofu_multimap_find(const fossil_tofu_multimap_t* map, const char* key, size_t len, size_t* count) {
+    if (count) *count = 0;
+    if (!map || !key) return NULL;
+
+    size_t i = fossil_tofu_hashtable_lookup(&map->table, key, len);
+    if (i == SIZE_MAX) return NULL;
+
+    const fossil_tofu_multimap_entry_t* entry = fossil_tofu_multimap_entry(map, i);
+    if (count) *count = entry->count;
+    return entry->values;
+}
+
+const fossil_tofu_t* fossil_tofu_multimap_get_all(const fossil_tofu_multimap_t* map, char *key, size_t* count) {
+    if (!key) {
+        if (count) *count = 0;
+        return NULL;
+    }
+    return fossil_tofu_multimap_find(map, key, strlen(key), count);
+}
+
+size_t fossil_tofu_multimap_count(const fossil_tofu_multimap_t* map, char *key) {
+    size_t count = 0;
+    fossil_tofu_multimap_get_all(map, key, &count);
+    return count;
+}
+
+int32_t fossil_tofu_multimap_reserve(fossil_tofu_multimap_t* map, size_t keys) {
+    if (!map) return FOSSIL_TOFU_ERROR_NULL_POINTER;
+
+    return fossil_tofu_hashtable_reserve(&map->table, keys, FOSSIL_TOFU_MULTIMAP_MAX_LOAD);
+}
+
+size_t fossil_tofu_multimap_for_each(const fossil_tofu_multimap_t* map, fossil_tofu_multimap_visit_fn visit, void* context) {
+    if (!map || !visit) return 0;
+
+    size_t visited = 0;
+    for (size_t i = 0; i < map->table.capacity; i++) {
+        const fossil_tofu_multimap_entry_t* entry = fossil_tofu_multimap_entry(map, i);
+        if (!entry) continue;
+        visited++;
+        if (!visit(&entry->key, entry->values, entry->count, context)) break;
+    }
+    return visited;
+}
+
+size_t fossil_tofu_multimap_key_count(const fossil_tofu_multimap_t* map) {
+    return map ? map->table.count : 0;
+}
+
+size_t fossil_tofu_multimap_size(const fossil_tofu_multimap_t* map) {
+    return map ? map->size : 0;
+}
+
+bool fossil_tofu_multimap_not_empty(const fossil_tofu_multimap_t* map) {
+    return map && map->size != 0;
+}
+
+bool fossil_tofu_multimap_is_empty(const fossil_tofu_multimap_t* map) {
+    return !map || map->size == 0;
+}
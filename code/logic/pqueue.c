@@ -24,11 +24,233 @@
  */
 #include "fossil/tofu/pqueue.h"
 
+// *****************************************************************************
+// Heap helpers
+// *****************************************************************************
+
+#define FOSSIL_TOFU_PQUEUE_NO_SLOT SIZE_MAX
+
+/**
+ * Heap order: lower priority value first, then earlier insertion first.
+ */
+static bool fossil_tofu_pqueue_before(const fossil_tofu_pqueue_node_t* a, const fossil_tofu_pqueue_node_t* b) {
+    if (a->priority != b->priority) {
+        return a->priority < b->priority;
+    }
+    return a->seq < b->seq;
+}
+
+/**
+ * Store a node at heap index i and point its handle slot at it.
+ */
+static void fossil_tofu_pqueue_place(fossil_tofu_pqueue_t* pqueue, size_t i, const fossil_tofu_pqueue_node_t* node) {
+    pqueue->nodes[i] = *node;
+    pqueue->slots[node->slot].position = i;
+}
+
+/**
+ * Move nodes[i] towards the root. The moving node is held aside and parents
+ * are shifted down into the hole, so each level costs one copy, not a swap.
+ */
+static void fossil_tofu_pqueue_sift_up(fossil_tofu_pqueue_t* pqueue, size_t i) {
+    fossil_tofu_pqueue_node_t moving = pqueue->nodes[i];
+    while (i > 0) {
+        size_t parent = (i - 1) / pqueue->arity;
+        if (!fossil_tofu_pqueue_before(&moving, &pqueue->nodes[parent])) {
+            break;
+        }
+        fossil_tofu_pqueue_place(pqueue, i, &pqueue->nodes[parent]);
+        i = parent;
+    }
+    fossil_tofu_pqueue_place(pqueue, i, &moving);
+}
+
+static void fossil_tofu_pqueue_sift_down(fossil_tofu_pqueue_t* pqueue, size_t i) {
+    fossil_tofu_pqueue_node_t moving = pqueue->nodes[i];
+    for (;;) {
+        size_t first = i * pqueue->arity + 1;
+        if (first >= pqueue->size) {
+            break;
+        }
+        size_t last = first + pqueue->arity;
+        if (last > pqueue->size) {
+            last = pqueue->size;
+        }
+        size_t best = first;
+        for (size_t c = first + 1; c < last; c++) {
+            if (fossil_tofu_pqueue_before(&pqueue->nodes[c], &pqueue->nodes[best])) {
+                best = c;
+            }
+        }
+        if (!fossil_tofu_pqueue_before(&pqueue->nodes[best], &moving)) {
+            break;
+        }
+        fossil_tofu_pqueue_place(pqueue, i, &pqueue->nodes[best]);
+        i = best;
+    }
+    fossil_tofu_pqueue_place(pqueue, i, &moving);
+}
+
+/**
+ * Restore heap order around index i after its key changed in either
+ * direction.
+ */
+static void fossil_tofu_pqueue_fix(fossil_tofu_pqueue_t* pqueue, size_t i) {
+    if (i > 0 && fossil_tofu_pqueue_before(&pqueue->nodes[i], &pqueue->nodes[(i - 1) / pqueue->arity])) {
+        fossil_tofu_pqueue_sift_up(pqueue, i);
+    } else {
+        fossil_tofu_pqueue_sift_down(pqueue, i);
+    }
+}
+
+static int32_t fossil_tofu_pqueue_grow(fossil_tofu_pqueue_t* pqueue, size_t needed) {
+    if (needed <= pqueue->capacity) {
+        return FOSSIL_TOFU_SUCCESS;
+    }
+    size_t capacity = pqueue->capacity ? pqueue->capacity : 8;
+    while (capacity < needed) {
+        capacity *= 2;
+    }
+    fossil_tofu_pqueue_node_t* nodes = (fossil_tofu_pqueue_node_t*)fossil_tofu_realloc(pqueue->nodes, capacity * sizeof(fossil_tofu_pqueue_node_t));
+    if (nodes == NULL) {
+        return FOSSIL_TOFU_FAILURE;
+    }
+    pqueue->nodes = nodes;
+    pqueue->capacity = capacity;
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+/**
+ * Take a handle slot from the free list, or append a new one. Freed slots
+ * keep their generation so stale handles to them are still rejected.
+ */
+static int32_t fossil_tofu_pqueue_acquire_slot(fossil_tofu_pqueue_t* pqueue, uint32_t* slot) {
+    if (pqueue->free_slot != FOSSIL_TOFU_PQUEUE_NO_SLOT) {
+        *slot = (uint32_t)pqueue->free_slot;
+        pqueue->free_slot = pqueue->slots[*slot].position;
+    } else {
+        if (pqueue->slot_count >= UINT32_MAX) {
+            return FOSSIL_TOFU_FAILURE;
+        }
+        if (pqueue->slot_count == pqueue->slot_capacity) {
+            size_t capacity = pqueue->slot_capacity ? pqueue->slot_capacity * 2 : 8;
+            fossil_tofu_pqueue_slot_t* slots = (fossil_tofu_pqueue_slot_t*)fossil_tofu_realloc(pqueue->slots, capacity * sizeof(fossil_tofu_pqueue_slot_t));
+            if (slots == NULL) {
+                return FOSSIL_TOFU_FAILURE;
+            }
+            pqueue->slots = slots;
+            pqueue->slot_capacity = capacity;
+        }
+        *slot = (uint32_t)pqueue->slot_count++;
+        pqueue->slots[*slot].generation = 0;
+    }
+    pqueue->slots[*slot].live = true;
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+static void fossil_tofu_pqueue_release_slot(fossil_tofu_pqueue_t* pqueue, uint32_t slot) {
+    pqueue->slots[slot].live = false;
+    pqueue->slots[slot].generation++;
+    pqueue->slots[slot].position = pqueue->free_slot;
+    pqueue->free_slot = slot;
+}
+
+static fossil_tofu_pqueue_handle_t fossil_tofu_pqueue_make_handle(const fossil_tofu_pqueue_t* pqueue, uint32_t slot) {
+    return ((uint64_t)pqueue->slots[slot].generation << 32) | slot;
+}
+
+/**
+ * Heap index of the element a handle refers to, or size when the handle is
+ * out of range or stale.
+ */
+static size_t fossil_tofu_pqueue_resolve(const fossil_tofu_pqueue_t* pqueue, fossil_tofu_pqueue_handle_t handle) {
+    uint32_t slot = (uint32_t)(handle & UINT32_MAX);
+    if (slot >= pqueue->slot_count) {
+        return pqueue->size;
+    }
+    const fossil_tofu_pqueue_slot_t* entry = &pqueue->slots[slot];
+    if (!entry->live || entry->generation != (uint32_t)(handle >> 32)) {
+        return pqueue->size;
+    }
+    return entry->position;
+}
+
+/**
+ * Append a node at the bottom of the heap without restoring order.
+ */
+static int32_t fossil_tofu_pqueue_append(fossil_tofu_pqueue_t* pqueue, char* data, int32_t priority, uint32_t* slot) {
+    if (fossil_tofu_pqueue_grow(pqueue, pqueue->size + 1) != FOSSIL_TOFU_SUCCESS ||
+        fossil_tofu_pqueue_acquire_slot(pqueue, slot) != FOSSIL_TOFU_SUCCESS) {
+        return FOSSIL_TOFU_FAILURE;
+    }
+    fossil_tofu_pqueue_node_t node;
+    node.data = fossil_tofu_create(pqueue->type, data);
+    node.priority = priority;
+    node.slot = *slot;
+    node.seq = pqueue->seq++;
+    fossil_tofu_pqueue_place(pqueue, pqueue->size++, &node);
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+/**
+ * Drop nodes[i]: the last node fills the hole and is sifted whichever way
+ * restores the heap.
+ */
+static void fossil_tofu_pqueue_remove_at(fossil_tofu_pqueue_t* pqueue, size_t i) {
+    fossil_tofu_pqueue_release_slot(pqueue, pqueue->nodes[i].slot);
+    fossil_tofu_destroy(&pqueue->nodes[i].data);
+    pqueue->size--;
+    if (i == pqueue->size) {
+        return;
+    }
+    fossil_tofu_pqueue_place(pqueue, i, &pqueue->nodes[pqueue->size]);
+    fossil_tofu_pqueue_fix(pqueue, i);
+}
+
+/**
+ * Earliest-inserted node with the given priority, or size when absent.
+ */
+static size_t fossil_tofu_pqueue_find(const fossil_tofu_pqueue_t* pqueue, int32_t priority) {
+    size_t found = pqueue->size;
+    for (size_t i = 0; i < pqueue->size; i++) {
+        if (pqueue->nodes[i].priority == priority &&
+            (found == pqueue->size || pqueue->nodes[i].seq < pqueue->nodes[found].seq)) {
+            found = i;
+        }
+    }
+    return found;
+}
+
+/**
+ * Node that would leave the queue last. It has no children, so only the
+ * leaf level needs scanning.
+ */
+static size_t fossil_tofu_pqueue_back(const fossil_tofu_pqueue_t* pqueue) {
+    size_t back = pqueue->size > 1 ? (pqueue->size - 2) / pqueue->arity + 1 : 0;
+    for (size_t i = back + 1; i < pqueue->size; i++) {
+        if (fossil_tofu_pqueue_before(&pqueue->nodes[back], &pqueue->nodes[i])) {
+            back = i;
+        }
+    }
+    return back;
+}
+
 // *****************************************************************************
 // Function prototypes
 // *****************************************************************************
 
 fossil_tofu_pqueue_t* fossil_tofu_pqueue_create_container(char* type) {
+    return fossil_tofu_pqueue_create_arity(type, FOSSIL_TOFU_PQUEUE_ARITY);
+}
+
+fossil_tofu_pqueue_t* fossil_tofu_pqueue_create_default(void) {
+    return fossil_tofu_pqueue_create_container("any");
+}
+
+fossil_tofu_pqueue_t* fossil_tofu_pqueue_create_arity(char* type, size_t arity) {
+    if (arity < 2) {
+        return NULL;
+    }
     fossil_tofu_type_t t = fossil_tofu_validate_type(type);
     if (t == FOSSIL_TOFU_TYPE_CNULL) {
         return NULL;
@@ -38,40 +260,49 @@ fossil_tofu_pqueue_t* fossil_tofu_pqueue_create_container(char* type) {
         return NULL;
     }
     pqueue->type = type;
-    pqueue->front = NULL;
+    pqueue->nodes = NULL;
+    pqueue->size = 0;
+    pqueue->capacity = 0;
+    pqueue->arity = arity;
+    pqueue->seq = 0;
+    pqueue->slots = NULL;
+    pqueue->slot_count = 0;
+    pqueue->slot_capacity = 0;
+    pqueue->free_slot = FOSSIL_TOFU_PQUEUE_NO_SLOT;
     return pqueue;
 }
 
-fossil_tofu_pqueue_t* fossil_tofu_pqueue_create_default(void) {
-    return fossil_tofu_pqueue_create_container("any");
-}
-
 fossil_tofu_pqueue_t* fossil_tofu_pqueue_create_copy(const fossil_tofu_pqueue_t* other) {
     if (other == NULL) {
         return NULL;
     }
-    fossil_tofu_pqueue_t* pqueue = (fossil_tofu_pqueue_t*)fossil_tofu_alloc(sizeof(fossil_tofu_pqueue_t));
+    fossil_tofu_pqueue_t* pqueue = fossil_tofu_pqueue_create_arity(other->type, other->arity);
     if (pqueue == NULL) {
         return NULL;
     }
-    pqueue->type = other->type;
-    pqueue->front = NULL;
-    fossil_tofu_type_t t1 = fossil_tofu_validate_type(pqueue->type);
-    fossil_tofu_type_t t2 = fossil_tofu_validate_type(other->type);
-    if (t1 != t2) {
-        fossil_tofu_free(pqueue);
+    if (fossil_tofu_pqueue_grow(pqueue, other->size) != FOSSIL_TOFU_SUCCESS) {
+        fossil_tofu_pqueue_destroy(pqueue);
         return NULL;
     }
-    fossil_tofu_pqueue_node_t* current = other->front;
-    while (current != NULL) {
-        fossil_tofu_type_t node_type = fossil_tofu_get_type(&current->data);
-        if (node_type != t1 && t1 != FOSSIL_TOFU_TYPE_CNULL) {
+    if (other->slot_count > 0) {
+        pqueue->slots = (fossil_tofu_pqueue_slot_t*)fossil_tofu_alloc(other->slot_count * sizeof(fossil_tofu_pqueue_slot_t));
+        if (pqueue->slots == NULL) {
             fossil_tofu_pqueue_destroy(pqueue);
             return NULL;
         }
-        fossil_tofu_pqueue_insert(pqueue, current->data.value.data, current->priority);
-        current = current->next;
+        memcpy(pqueue->slots, other->slots, other->slot_count * sizeof(fossil_tofu_pqueue_slot_t));
+        pqueue->slot_count = other->slot_count;
+        pqueue->slot_capacity = other->slot_count;
+        pqueue->free_slot = other->free_slot;
+    }
+    // Same layout, stamps and handle table, so the copy is already a valid
+    // heap and handles into the original also address the copy.
+    for (size_t i = 0; i < other->size; i++) {
+        pqueue->nodes[i] = other->nodes[i];
+        pqueue->nodes[i].data = fossil_tofu_create(pqueue->type, other->nodes[i].data.value.data);
+        pqueue->size++;
     }
+    pqueue->seq = other->seq;
     return pqueue;
 }
 
@@ -87,9 +318,14 @@ fossil_tofu_pqueue_t* fossil_tofu_pqueue_create_move(fossil_tofu_pqueue_t* other
     if (pqueue == NULL) {
         return NULL;
     }
-    pqueue->type = other->type;
-    pqueue->front = other->front;
-    other->front = NULL;
+    *pqueue = *other;
+    other->nodes = NULL;
+    other->size = 0;
+    other->capacity = 0;
+    other->slots = NULL;
+    other->slot_count = 0;
+    other->slot_capacity = 0;
+    other->free_slot = FOSSIL_TOFU_PQUEUE_NO_SLOT;
     return pqueue;
 }
 
@@ -97,12 +333,11 @@ void fossil_tofu_pqueue_destroy(fossil_tofu_pqueue_t* pqueue) {
     if (pqueue == NULL) {
         return;
     }
-    while (pqueue->front != NULL) {
-        fossil_tofu_pqueue_node_t* temp = pqueue->front;
-        pqueue->front = pqueue->front->next;
-        fossil_tofu_destroy(&temp->data);
-        fossil_tofu_free(temp);
+    for (size_t i = 0; i < pqueue->size; i++) {
+        fossil_tofu_destroy(&pqueue->nodes[i].data);
     }
+    fossil_tofu_free(pqueue->nodes);
+    fossil_tofu_free(pqueue->slots);
     fossil_tofu_free(pqueue);
 }
 
@@ -111,71 +346,121 @@ void fossil_tofu_pqueue_destroy(fossil_tofu_pqueue_t* pqueue) {
 // *****************************************************************************
 
 int32_t fossil_tofu_pqueue_insert(fossil_tofu_pqueue_t* pqueue, char *data, int32_t priority) {
+    return fossil_tofu_pqueue_insert_handle(pqueue, data, priority, NULL);
+}
+
+int32_t fossil_tofu_pqueue_insert_handle(fossil_tofu_pqueue_t* pqueue, char *data, int32_t priority, fossil_tofu_pqueue_handle_t* handle) {
     if (pqueue == NULL) {
         return FOSSIL_TOFU_FAILURE;
     }
-    fossil_tofu_pqueue_node_t* node = (fossil_tofu_pqueue_node_t*)fossil_tofu_alloc(sizeof(fossil_tofu_pqueue_node_t));
-    if (node == NULL) {
+    uint32_t slot;
+    if (fossil_tofu_pqueue_append(pqueue, data, priority, &slot) != FOSSIL_TOFU_SUCCESS) {
         return FOSSIL_TOFU_FAILURE;
     }
-    node->data = fossil_tofu_create(pqueue->type, data);
-    node->priority = priority;
-    node->next = NULL;
-    if (pqueue->front == NULL) {
-        pqueue->front = node;
-    } else {
-        fossil_tofu_pqueue_node_t* current = pqueue->front;
-        fossil_tofu_pqueue_node_t* prev = NULL;
-        while (current != NULL && current->priority < priority) {
-            prev = current;
-            current = current->next;
+    fossil_tofu_pqueue_sift_up(pqueue, pqueue->size - 1);
+    if (handle != NULL) {
+        *handle = fossil_tofu_pqueue_make_handle(pqueue, slot);
+    }
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+int32_t fossil_tofu_pqueue_update_priority(fossil_tofu_pqueue_t* pqueue, fossil_tofu_pqueue_handle_t handle, int32_t priority) {
+    if (pqueue == NULL) {
+        return FOSSIL_TOFU_ERROR_INVALID_ARGUMENT;
+    }
+    size_t i = fossil_tofu_pqueue_resolve(pqueue, handle);
+    if (i == pqueue->size) {
+        return FOSSIL_TOFU_ERROR_NOT_FOUND;
+    }
+    pqueue->nodes[i].priority = priority;
+    pqueue->nodes[i].seq = pqueue->seq++;
+    fossil_tofu_pqueue_fix(pqueue, i);
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+int32_t fossil_tofu_pqueue_remove_handle(fossil_tofu_pqueue_t* pqueue, fossil_tofu_pqueue_handle_t handle) {
+    if (pqueue == NULL) {
+        return FOSSIL_TOFU_ERROR_INVALID_ARGUMENT;
+    }
+    size_t i = fossil_tofu_pqueue_resolve(pqueue, handle);
+    if (i == pqueue->size) {
+        return FOSSIL_TOFU_ERROR_NOT_FOUND;
+    }
+    fossil_tofu_pqueue_remove_at(pqueue, i);
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+bool fossil_tofu_pqueue_contains_handle(const fossil_tofu_pqueue_t* pqueue, fossil_tofu_pqueue_handle_t handle) {
+    return pqueue != NULL && fossil_tofu_pqueue_resolve(pqueue, handle) != pqueue->size;
+}
+
+int32_t fossil_tofu_pqueue_heapify(fossil_tofu_pqueue_t* pqueue, char* const data[], const int32_t priorities[], size_t count) {
+    if (pqueue == NULL || (count > 0 && (data == NULL || priorities == NULL))) {
+        return FOSSIL_TOFU_ERROR_INVALID_ARGUMENT;
+    }
+    if (fossil_tofu_pqueue_grow(pqueue, pqueue->size + count) != FOSSIL_TOFU_SUCCESS) {
+        return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+    }
+    int32_t result = FOSSIL_TOFU_SUCCESS;
+    for (size_t i = 0; i < count; i++) {
+        uint32_t slot;
+        if (fossil_tofu_pqueue_append(pqueue, data[i], priorities[i], &slot) != FOSSIL_TOFU_SUCCESS) {
+            result = FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+            break;
         }
-        if (prev == NULL) {
-            node->next = pqueue->front;
-            pqueue->front = node;
-        } else {
-            prev->next = node;
-            node->next = current;
+    }
+    if (pqueue->size > 1) {
+        // Floyd's construction: sift down every internal node, deepest first.
+        for (size_t i = (pqueue->size - 2) / pqueue->arity + 1; i-- > 0;) {
+            fossil_tofu_pqueue_sift_down(pqueue, i);
         }
     }
+    return result;
+}
+
+int32_t fossil_tofu_pqueue_pop(fossil_tofu_pqueue_t* pqueue) {
+    if (pqueue == NULL || pqueue->size == 0) {
+        return FOSSIL_TOFU_FAILURE;
+    }
+    fossil_tofu_pqueue_remove_at(pqueue, 0);
     return FOSSIL_TOFU_SUCCESS;
 }
 
 int32_t fossil_tofu_pqueue_remove(fossil_tofu_pqueue_t* pqueue, int32_t priority) {
-    if (pqueue == NULL || pqueue->front == NULL) {
+    if (pqueue == NULL || pqueue->size == 0) {
         return FOSSIL_TOFU_FAILURE;
     }
-    fossil_tofu_pqueue_node_t* current = pqueue->front;
-    fossil_tofu_pqueue_node_t* prev = NULL;
-    while (current != NULL && current->priority != priority) {
-        prev = current;
-        current = current->next;
-    }
-    if (current == NULL) {
+    // The root is the earliest element of the smallest priority.
+    size_t i = pqueue->nodes[0].priority == priority ? 0 : fossil_tofu_pqueue_find(pqueue, priority);
+    if (i == pqueue->size) {
         return FOSSIL_TOFU_FAILURE; // Node with the given priority not found
     }
-    if (prev == NULL) {
-        pqueue->front = current->next;
-    } else {
-        prev->next = current->next;
+    fossil_tofu_pqueue_remove_at(pqueue, i);
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+int32_t fossil_tofu_pqueue_reserve(fossil_tofu_pqueue_t* pqueue, size_t capacity) {
+    if (pqueue == NULL) {
+        return FOSSIL_TOFU_ERROR_INVALID_ARGUMENT;
     }
-    fossil_tofu_destroy(&current->data);
-    fossil_tofu_free(current);
+    if (capacity <= pqueue->capacity) {
+        return FOSSIL_TOFU_SUCCESS;
+    }
+    fossil_tofu_pqueue_node_t* nodes = (fossil_tofu_pqueue_node_t*)fossil_tofu_realloc(pqueue->nodes, capacity * sizeof(fossil_tofu_pqueue_node_t));
+    if (nodes == NULL) {
+        return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+    }
+    pqueue->nodes = nodes;
+    pqueue->capacity = capacity;
     return FOSSIL_TOFU_SUCCESS;
 }
 
 size_t fossil_tofu_pqueue_size(const fossil_tofu_pqueue_t* pqueue) {
-    size_t size = 0;
-    fossil_tofu_pqueue_node_t* current = pqueue->front;
-    while (current != NULL) {
-        size++;
-        current = current->next;
-    }
-    return size;
+    return pqueue == NULL ? 0 : pqueue->size;
 }
 
 bool fossil_tofu_pqueue_not_empty(const fossil_tofu_pqueue_t* pqueue) {
-    return pqueue != NULL && pqueue->front != NULL;
+    return pqueue != NULL && pqueue->size > 0;
 }
 
 bool fossil_tofu_pqueue_not_cnullptr(const fossil_tofu_pqueue_t* pqueue) {
@@ -183,7 +468,7 @@ bool fossil_tofu_pqueue_not_cnullptr(const fossil_tofu_pqueue_t* pqueue) {
 }
 
 bool fossil_tofu_pqueue_is_empty(const fossil_tofu_pqueue_t* pqueue) {
-    return pqueue == NULL || pqueue->front == NULL;
+    return pqueue == NULL || pqueue->size == 0;
 }
 
 bool fossil_tofu_pqueue_is_cnullptr(const fossil_tofu_pqueue_t* pqueue) {
@@ -195,58 +480,69 @@ bool fossil_tofu_pqueue_is_cnullptr(const fossil_tofu_pqueue_t* pqueue) {
 // *****************************************************************************
 
 char *fossil_tofu_pqueue_get_front(const fossil_tofu_pqueue_t* pqueue) {
-    return pqueue == NULL || pqueue->front == NULL ? NULL : pqueue->front->data.value.data;
+    return pqueue == NULL || pqueue->size == 0 ? NULL : pqueue->nodes[0].data.value.data;
+}
+
+int32_t fossil_tofu_pqueue_front_priority(const fossil_tofu_pqueue_t* pqueue, int32_t* priority) {
+    if (pqueue == NULL || priority == NULL) {
+        return FOSSIL_TOFU_ERROR_INVALID_ARGUMENT;
+    }
+    if (pqueue->size == 0) {
+        return FOSSIL_TOFU_ERROR_NOT_FOUND;
+    }
+    *priority = pqueue->nodes[0].priority;
+    return FOSSIL_TOFU_SUCCESS;
 }
 
 char *fossil_tofu_pqueue_get_back(const fossil_tofu_pqueue_t* pqueue) {
-    if (pqueue == NULL || pqueue->front == NULL) {
+    if (pqueue == NULL || pqueue->size == 0) {
         return NULL;
     }
-    fossil_tofu_pqueue_node_t* current = pqueue->front;
-    while (current->next != NULL) {
-        current = current->next;
-    }
-    return current->data.value.data;
+    return pqueue->nodes[fossil_tofu_pqueue_back(pqueue)].data.value.data;
 }
 
 char *fossil_tofu_pqueue_get_at(const fossil_tofu_pqueue_t* pqueue, int32_t priority) {
-    if (pqueue == NULL || pqueue->front == NULL) {
+    if (pqueue == NULL || pqueue->size == 0) {
         return NULL;
     }
-    fossil_tofu_pqueue_node_t* current = pqueue->front;
-    while (current != NULL && current->priority != priority) {
-        current = current->next;
+    size_t i = fossil_tofu_pqueue_find(pqueue, priority);
+    return i == pqueue->size ? NULL : pqueue->nodes[i].data.value.data;
+}
+
+char *fossil_tofu_pqueue_get_handle(const fossil_tofu_pqueue_t* pqueue, fossil_tofu_pqueue_handle_t handle, int32_t* priority) {
+    if (pqueue == NULL) {
+        return NULL;
     }
-    return current == NULL ? NULL : current->data.value.data;
+    size_t i = fossil_tofu_pqueue_resolve(pqueue, handle);
+    if (i == pqueue->size) {
+        return NULL;
+    }
+    if (priority != NULL) {
+        *priority = pqueue->nodes[i].priority;
+    }
+    return pqueue->nodes[i].data.value.data;
 }
 
 void fossil_tofu_pqueue_set_front(fossil_tofu_pqueue_t* pqueue, char *element) {
-    if (pqueue == NULL || pqueue->front == NULL) {
+    if (pqueue == NULL || pqueue->size == 0) {
         return;
     }
-    fossil_tofu_set_value(&pqueue->front->data, element);
+    fossil_tofu_set_value(&pqueue->nodes[0].data, element);
 }
 
 void fossil_tofu_pqueue_set_back(fossil_tofu_pqueue_t* pqueue, char *element) {
-    if (pqueue == NULL || pqueue->front == NULL) {
+    if (pqueue == NULL || pqueue->size == 0) {
         return;
     }
-    fossil_tofu_pqueue_node_t* current = pqueue->front;
-    while (current->next != NULL) {
-        current = current->next;
-    }
-    fossil_tofu_set_value(&current->data, element);
+    fossil_tofu_set_value(&pqueue->nodes[fossil_tofu_pqueue_back(pqueue)].data, element);
 }
 
 void fossil_tofu_pqueue_set_at(fossil_tofu_pqueue_t* pqueue, int32_t priority, char *element) {
-    if (pqueue == NULL || pqueue->front == NULL) {
+    if (pqueue == NULL || pqueue->size == 0) {
         return;
     }
-    fossil_tofu_pqueue_node_t* current = pqueue->front;
-    while (current != NULL && current->priority != priority) {
-        current = current->next;
-    }
-    if (current != NULL) {
-        fossil_tofu_set_value(&current->data, element);
+    size_t i = fossil_tofu_pqueue_find(pqueue, priority);
+    if (i != pqueue->size) {
+        fossil_tofu_set_value(&pqueue->nodes[i].data, element);
     }
 }
@@ -36,6 +36,7 @@ fossil_tofu_queue_t* fossil_tofu_queue_create_container(char* type) {
     queue->type = type;
     queue->front = NULL;
     queue->rear = NULL;
+    queue->size = 0;
     return queue;
 }
 
@@ -51,6 +52,7 @@ fossil_tofu_queue_t* fossil_tofu_queue_create_copy(const fossil_tofu_queue_t* ot
     queue->type = other->type;
     queue->front = NULL;
     queue->rear = NULL;
+    queue->size = 0;
     fossil_tofu_queue_node_t* current = other->front;
     while (current != NULL) {
         fossil_tofu_queue_insert(queue, current->data.value.data);
@@ -67,8 +69,10 @@ fossil_tofu_queue_t* fossil_tofu_queue_create_move(fossil_tofu_queue_t* other) {
     queue->type = other->type;
     queue->front = other->front;
     queue->rear = other->rear;
+    queue->size = other->size;
     other->front = NULL;
     other->rear = NULL;
+    other->size = 0;
     return queue;
 }
 
@@ -105,6 +109,8 @@ int32_t fossil_tofu_queue_insert(fossil_tofu_queue_t* queue, char *data) {
         queue->rear->next = node;
     }
     queue->rear = node;
+    queue->size++;
+    FOSSIL_TOFU_DEBUG_CHECK(fossil_tofu_queue_verify(queue));
     return FOSSIL_TOFU_SUCCESS;
 }
 
@@ -114,23 +120,37 @@ int32_t fossil_tofu_queue_remove(fossil_tofu_queue_t* queue) {
     }
     fossil_tofu_queue_node_t* temp = queue->front;
     queue->front = queue->front->next;
+    if (queue->front == NULL) {
+        queue->rear = NULL;
+    }
+    queue->size--;
     fossil_tofu_destroy(&temp->data);
     fossil_tofu_free(temp);
+    FOSSIL_TOFU_DEBUG_CHECK(fossil_tofu_queue_verify(queue));
     return FOSSIL_TOFU_SUCCESS;
 }
 
 size_t fossil_tofu_queue_size(const fossil_tofu_queue_t* queue) {
-    size_t size = 0;
-    fossil_tofu_queue_node_t* current = queue->front;
-    while (current != NULL) {
-        size++;
-        current = current->next;
+    return queue == NULL ? 0 : queue->size;
+}
+
+bool fossil_tofu_queue_verify(const fossil_tofu_queue_t* queue) {
+    if (queue == NULL) {
+        return false;
+    }
+    size_t count = 0;
+    const fossil_tofu_queue_node_t* last = NULL;
+    for (const fossil_tofu_queue_node_t* current = queue->front; current != NULL; current = current->next) {
+        if (++count > queue->size) {
+            return false;
+        }
+        last = current;
     }
-    return size;
+    return count == queue->size && queue->rear == last;
 }
 
 bool fossil_tofu_queue_not_empty(const fossil_tofu_queue_t* queue) {
-    return queue != NULL && queue->front != NULL;
+    return queue != NULL && queue->size > 0;
 }
 
 bool fossil_tofu_queue_not_cnullptr(const fossil_tofu_queue_t* queue) {
@@ -138,7 +158,7 @@ bool fossil_tofu_queue_not_cnullptr(const fossil_tofu_queue_t* queue) {
 }
 
 bool fossil_tofu_queue_is_empty(const fossil_tofu_queue_t* queue) {
-    return queue == NULL || queue->front == NULL;
+    return queue == NULL || queue->size == 0;
 }
 
 bool fossil_tofu_queue_is_cnullptr(const fossil_tofu_queue_t* queue) {
@@ -0,0 +1,262 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include "fossil/tofu/segvector.h"
+
+// *****************************************************************************
+// Chunk helpers
+// *****************************************************************************
+
+static inline size_t fossil_tofu_segvector_chunk_of(const fossil_tofu_segvector_t* vector, size_t index) {
+    return index >> vector->chunk_shift;
+}
+
+static inline size_t fossil_tofu_segvector_slot_of(const fossil_tofu_segvector_t* vector, size_t index) {
+    return index & (((size_t)1 << vector->chunk_shift) - 1);
+}
+
+// Appends one chunk. Only the index of chunk pointers is ever reallocated,
+// so elements already written keep their addresses.
+static bool fossil_tofu_segvector_add_chunk(fossil_tofu_segvector_t* vector) {
+    if (vector->chunk_count == vector->index_capacity) {
+        if (vector->index_capacity > SIZE_MAX / (2 * sizeof(fossil_tofu_t*))) {
+            return false;
+        }
+        size_t new_capacity = vector->index_capacity ? 2 * vector->index_capacity : 4;
+        fossil_tofu_t** chunks = (fossil_tofu_t**)fossil_tofu_realloc(vector->chunks, new_capacity * sizeof(fossil_tofu_t*));
+        if (chunks == NULL) {
+            return false;
+        }
+        vector->chunks = chunks;
+        vector->index_capacity = new_capacity;
+    }
+    size_t chunk_size = fossil_tofu_segvector_chunk_size(vector);
+    if (chunk_size > SIZE_MAX / sizeof(fossil_tofu_t)) {
+        return false;
+    }
+    fossil_tofu_t* chunk = (fossil_tofu_t*)fossil_tofu_alloc(chunk_size * sizeof(fossil_tofu_t));
+    if (chunk == NULL) {
+        return false;
+    }
+    vector->chunks[vector->chunk_count++] = chunk;
+    return true;
+}
+
+// *****************************************************************************
+// Function prototypes
+// *****************************************************************************
+
+fossil_tofu_segvector_t* fossil_tofu_segvector_create_chunked(char* type, size_t chunk_size) {
+    if (type == NULL || fossil_tofu_validate_type(type) == FOSSIL_TOFU_TYPE_CNULL || chunk_size == 0) {
+        return NULL;
+    }
+    // The rounded chunk must still be addressable in bytes.
+    const size_t max_chunk = SIZE_MAX / sizeof(fossil_tofu_t);
+    size_t shift = 0;
+    while (((size_t)1 << shift) < chunk_size) {
+        if (((size_t)1 << shift) > max_chunk / 2) {
+            return NULL;
+        }
+        shift++;
+    }
+    fossil_tofu_segvector_t* vector = (fossil_tofu_segvector_t*)fossil_tofu_alloc(sizeof(fossil_tofu_segvector_t));
+    if (vector == NULL) {
+        return NULL;
+    }
+    vector->type = fossil_tofu_strdup(type);
+    if (vector->type == NULL) {
+        fossil_tofu_free(vector);
+        return NULL;
+    }
+    vector->chunks = NULL;
+    vector->chunk_count = 0;
+    vector->index_capacity = 0;
+    vector->chunk_shift = shift;
+    vector->size = 0;
+    return vector;
+}
+
+fossil_tofu_segvector_t* fossil_tofu_segvector_create_container(char* type) {
+    return fossil_tofu_segvector_create_chunked(type, FOSSIL_TOFU_SEGVECTOR_CHUNK);
+}
+
+fossil_tofu_segvector_t* fossil_tofu_segvector_create_default(void) {
+    return fossil_tofu_segvector_create_container("any");
+}
+
+fossil_tofu_segvector_t* fossil_tofu_segvector_create_copy(const fossil_tofu_segvector_t* other) {
+    if (other == NULL) {
+        return NULL;
+    }
+    fossil_tofu_segvector_t* vector = fossil_tofu_segvector_create_chunked(other->type, fossil_tofu_segvector_chunk_size(other));
+    if (vector == NULL) {
+        return NULL;
+    }
+    for (size_t i = 0; i < other->size; i++) {
+        if (fossil_tofu_segvector_push_back(vector, fossil_tofu_segvector_get(other, i)) != FOSSIL_TOFU_SUCCESS) {
+            fossil_tofu_segvector_destroy(vector);
+            return NULL;
+        }
+    }
+    return vector;
+}
+
+fossil_tofu_segvector_t* fossil_tofu_segvector_create_move(fossil_tofu_segvector_t* other) {
+    if (other == NULL) {
+        return NULL;
+    }
+    fossil_tofu_segvector_t* vector = (fossil_tofu_segvector_t*)fossil_tofu_alloc(sizeof(fossil_tofu_segvector_t));
+    if (vector == NULL) {
+        return NULL;
+    }
+    *vector = *other;
+    other->chunks = NULL;
+    other->chunk_count = 0;
+    other->index_capacity = 0;
+    other->size = 0;
+    other->type = NULL;
+    return vector;
+}
+
+void fossil_tofu_segvector_destroy(fossil_tofu_segvector_t* vector) {
+    if (vector == NULL) {
+        return;
+    }
+    fossil_tofu_segvector_erase(vector);
+    for (size_t i = 0; i < vector->chunk_count; i++) {
+        fossil_tofu_free(vector->chunks[i]);
+    }
+    fossil_tofu_free(vector->chunks);
+    fossil_tofu_free(vector->type);
+    fossil_tofu_free(vector);
+}
+
+// *****************************************************************************
+// Utility functions
+// *****************************************************************************
+
+int32_t fossil_tofu_segvector_push_back(fossil_tofu_segvector_t* vector, char *element) {
+    if (vector == NULL || element == NULL) {
+        return FOSSIL_TOFU_ERROR_NULL_POINTER;
+    }
+    if (vector->size == fossil_tofu_segvector_capacity(vector) && !fossil_tofu_segvector_add_chunk(vector)) {
+        return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+    }
+    fossil_tofu_t tofu = fossil_tofu_create(vector->type, element);
+    if (tofu.value.data == NULL) {
+        return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+    }
+    size_t index = vector->size;
+    vector->chunks[fossil_tofu_segvector_chunk_of(vector, index)][fossil_tofu_segvector_slot_of(vector, index)] = tofu;
+    vector->size++;
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+void fossil_tofu_segvector_pop_back(fossil_tofu_segvector_t* vector) {
+    if (vector == NULL || vector->size == 0) {
+        return;
+    }
+    fossil_tofu_destroy(fossil_tofu_segvector_at(vector, vector->size - 1));
+    vector->size--;
+}
+
+void fossil_tofu_segvector_erase(fossil_tofu_segvector_t* vector) {
+    if (vector == NULL) {
+        return;
+    }
+    while (vector->size > 0) {
+        fossil_tofu_segvector_pop_back(vector);
+    }
+}
+
+int32_t fossil_tofu_segvector_reserve(fossil_tofu_segvector_t* vector, size_t capacity) {
+    if (vector == NULL) {
+        return FOSSIL_TOFU_ERROR_NULL_POINTER;
+    }
+    while (fossil_tofu_segvector_capacity(vector) < capacity) {
+        if (!fossil_tofu_segvector_add_chunk(vector)) {
+            return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+        }
+    }
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+bool fossil_tofu_segvector_is_cnullptr(const fossil_tofu_segvector_t* vector) {
+    return vector == NULL;
+}
+
+bool fossil_tofu_segvector_not_cnullptr(const fossil_tofu_segvector_t* vector) {
+    return vector != NULL;
+}
+
+bool fossil_tofu_segvector_is_empty(const fossil_tofu_segvector_t* vector) {
+    return vector == NULL || vector->size == 0;
+}
+
+bool fossil_tofu_segvector_not_empty(const fossil_tofu_segvector_t* vector) {
+    return vector != NULL && vector->size > 0;
+}
+
+size_t fossil_tofu_segvector_size(const fossil_tofu_segvector_t* vector) {
+    return vector == NULL ? 0 : vector->size;
+}
+
+size_t fossil_tofu_segvector_capacity(const fossil_tofu_segvector_t* vector) {
+    return vector == NULL ? 0 : vector->chunk_count << vector->chunk_shift;
+}
+
+size_t fossil_tofu_segvector_chunk_size(const fossil_tofu_segvector_t* vector) {
+    return vector == NULL ? 0 : (size_t)1 << vector->chunk_shift;
+}
+
+// *****************************************************************************
+// Getter and setter functions
+// *****************************************************************************
+
+fossil_tofu_t* fossil_tofu_segvector_at(const fossil_tofu_segvector_t* vector, size_t index) {
+    if (vector == NULL || index >= vector->size) {
+        return NULL;
+    }
+    return &vector->chunks[fossil_tofu_segvector_chunk_of(vector, index)][fossil_tofu_segvector_slot_of(vector, index)];
+}
+
+char *fossil_tofu_segvector_get(const fossil_tofu_segvector_t* vector, size_t index) {
+    return fossil_tofu_get_value(fossil_tofu_segvector_at(vector, index));
+}
+
+char *fossil_tofu_segvector_get_front(const fossil_tofu_segvector_t* vector) {
+    return vector == NULL || vector->size == 0 ? NULL : fossil_tofu_segvector_get(vector, 0);
+}
+
+char *fossil_tofu_segvector_get_back(const fossil_tofu_segvector_t* vector) {
+    return vector == NULL || vector->size == 0 ? NULL : fossil_tofu_segvector_get(vector, vector->size - 1);
+}
+
+int32_t fossil_tofu_segvector_set(fossil_tofu_segvector_t* vector, size_t index, char *element) {
+    fossil_tofu_t* tofu = fossil_tofu_segvector_at(vector, index);
+    if (tofu == NULL) {
+        return FOSSIL_TOFU_ERROR_NOT_FOUND;
+    }
+    return fossil_tofu_set_value(tofu, element);
+}
@@ -24,18 +24,92 @@
  */
 #include "fossil/tofu/setof.h"
 
+// *****************************************************************************
+// Hash table helpers
+// *****************************************************************************
+
+// Slot index holding an element equal to `data`, which may belong to another set.
+static size_t fossil_tofu_setof_find(const fossil_tofu_setof_t* set, const fossil_tofu_t* data) {
+    if (data->value.data == NULL) {
+        return SIZE_MAX;
+    }
+    return fossil_tofu_hashtable_lookup(&set->table, data->value.data, strlen(data->value.data));
+}
+
+static inline fossil_tofu_setof_node_t* fossil_tofu_setof_node(const fossil_tofu_setof_t* set, size_t i) {
+    return (fossil_tofu_setof_node_t*)set->table.slots[i].node;
+}
+
+// Take ownership of `data`, which must not be in the set yet.
+static int32_t fossil_tofu_setof_adopt(fossil_tofu_setof_t* set, fossil_tofu_t* data) {
+    if (fossil_tofu_hashtable_grow(&set->table, set->max_load) != FOSSIL_TOFU_SUCCESS) {
+        return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+    }
+    fossil_tofu_setof_node_t* node = (fossil_tofu_setof_node_t*)fossil_tofu_alloc(sizeof(fossil_tofu_setof_node_t));
+    if (node == NULL) {
+        return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+    }
+    node->data = *data;
+    fossil_tofu_hashtable_place(&set->table, fossil_tofu_hashtable_hash(&set->table, data->value.data, strlen(data->value.data)), node);
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+// Insert a copy of an element owned by another set, skipping the temporary
+// key that the public insert needs.
+static int32_t fossil_tofu_setof_adopt_copy(fossil_tofu_setof_t* set, const fossil_tofu_t* data) {
+    if (fossil_tofu_setof_find(set, data) != SIZE_MAX) {
+        return FOSSIL_TOFU_SUCCESS;
+    }
+    fossil_tofu_t copy = fossil_tofu_create(set->type, data->value.data);
+    if (copy.value.data == NULL) {
+        return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+    }
+    int32_t result = fossil_tofu_setof_adopt(set, &copy);
+    if (result != FOSSIL_TOFU_SUCCESS) {
+        fossil_tofu_destroy(&copy);
+    }
+    return result;
+}
+
+// Remove and free the element in slot `i`.
+static void fossil_tofu_setof_drop(fossil_tofu_setof_t* set, size_t i) {
+    fossil_tofu_setof_node_t* node = (fossil_tofu_setof_node_t*)fossil_tofu_hashtable_vacate(&set->table, i);
+    fossil_tofu_destroy(&node->data);
+    fossil_tofu_free(node);
+}
+
+static void* fossil_tofu_setof_clone_node(const void* source, void* context) {
+    const fossil_tofu_setof_t* set = (const fossil_tofu_setof_t*)context;
+    fossil_tofu_setof_node_t* node = (fossil_tofu_setof_node_t*)fossil_tofu_alloc(sizeof(fossil_tofu_setof_node_t));
+    if (node != NULL) {
+        node->data = fossil_tofu_create(set->type, fossil_tofu_get_value(&((const fossil_tofu_setof_node_t*)source)->data));
+    }
+    return node;
+}
+
+static bool fossil_tofu_setof_same_type(const fossil_tofu_setof_t* a, const fossil_tofu_setof_t* b) {
+    return fossil_tofu_validate_type(a->type) == fossil_tofu_validate_type(b->type);
+}
+
 // *****************************************************************************
 // Function prototypes
 // *****************************************************************************
 
 fossil_tofu_setof_t* fossil_tofu_setof_create_container(char* type) {
+    if (type == NULL) {
+        return NULL;
+    }
     fossil_tofu_setof_t* set = (fossil_tofu_setof_t*)fossil_tofu_alloc(sizeof(fossil_tofu_setof_t));
     if (set == NULL) {
         return NULL;
     }
-    set->type = type;
-    set->head = NULL;
-    set->size = 0;
+    set->type = fossil_tofu_strdup(type);
+    if (set->type == NULL) {
+        fossil_tofu_free(set);
+        return NULL;
+    }
+    fossil_tofu_hashtable_init(&set->table, fossil_tofu_validate_type(type), offsetof(fossil_tofu_setof_node_t, data));
+    set->max_load = FOSSIL_TOFU_SETOF_MAX_LOAD;
     return set;
 }
 
@@ -44,27 +118,31 @@ fossil_tofu_setof_t* fossil_tofu_setof_create_default(void) {
 }
 
 fossil_tofu_setof_t* fossil_tofu_setof_create_copy(const fossil_tofu_setof_t* other) {
+    if (other == NULL) {
+        return NULL;
+    }
     fossil_tofu_setof_t* set = fossil_tofu_setof_create_container(other->type);
     if (set == NULL) {
         return NULL;
     }
-    fossil_tofu_setof_node_t* current = other->head;
-    while (current != NULL) {
-        fossil_tofu_setof_insert(set, fossil_tofu_get_value(&current->data));
-        current = current->next;
+    set->max_load = other->max_load;
+    if (fossil_tofu_hashtable_clone(&set->table, &other->table, fossil_tofu_setof_clone_node, set) != FOSSIL_TOFU_SUCCESS) {
+        fossil_tofu_setof_destroy(set);
+        return NULL;
     }
     return set;
 }
 
 fossil_tofu_setof_t* fossil_tofu_setof_create_move(fossil_tofu_setof_t* other) {
+    if (other == NULL) {
+        return NULL;
+    }
     fossil_tofu_setof_t* set = fossil_tofu_setof_create_container(other->type);
     if (set == NULL) {
         return NULL;
     }
-    set->head = other->head;
-    other->head = NULL;
-    set->size = other->size;
-    other->size = 0;
+    fossil_tofu_hashtable_move(&set->table, &other->table);
+    set->max_load = other->max_load;
     return set;
 }
 
@@ -72,53 +150,56 @@ void fossil_tofu_setof_destroy(fossil_tofu_setof_t* set) {
     if (set == NULL) {
         return;
     }
-    while (set->head != NULL) {
-        fossil_tofu_setof_node_t* temp = set->head;
-        set->head = set->head->next;
-        fossil_tofu_destroy(&temp->data);
-        fossil_tofu_free(temp);
+    for (size_t i = 0; i < set->table.capacity; i++) {
+        fossil_tofu_setof_node_t* node = fossil_tofu_setof_node(set, i);
+        if (node != NULL) {
+            fossil_tofu_destroy(&node->data);
+            fossil_tofu_free(node);
+        }
     }
+    fossil_tofu_hashtable_release(&set->table);
+    fossil_tofu_free(set->type);
     fossil_tofu_free(set);
 }
 
-int32_t fossil_tofu_setof_insert(fossil_tofu_setof_t* set, char *data) {
+int32_t fossil_tofu_setof_add(fossil_tofu_setof_t* set, char *data, bool* added) {
+    if (added != NULL) {
+        *added = false;
+    }
     if (set == NULL || data == NULL) {
         return FOSSIL_TOFU_FAILURE;
     }
-    fossil_tofu_setof_node_t* node = (fossil_tofu_setof_node_t*)fossil_tofu_alloc(sizeof(fossil_tofu_setof_node_t));
-    if (node == NULL) {
+
+    if (fossil_tofu_hashtable_lookup(&set->table, data, strlen(data)) != SIZE_MAX) {
+        return FOSSIL_TOFU_SUCCESS;
+    }
+    fossil_tofu_t element = fossil_tofu_create(set->type, data);
+    if (fossil_tofu_setof_adopt(set, &element) != FOSSIL_TOFU_SUCCESS) {
+        fossil_tofu_destroy(&element);
         return FOSSIL_TOFU_FAILURE;
     }
-    node->data = fossil_tofu_create(set->type, data);
-    node->next = set->head;
-    set->head = node;
-    set->size++;
+    if (added != NULL) {
+        *added = true;
+    }
     return FOSSIL_TOFU_SUCCESS;
 }
 
+int32_t fossil_tofu_setof_insert(fossil_tofu_setof_t* set, char *data) {
+    return fossil_tofu_setof_add(set, data, NULL);
+}
+
 int32_t fossil_tofu_setof_remove(fossil_tofu_setof_t* set, char *data) {
     if (set == NULL || data == NULL) {
         return FOSSIL_TOFU_FAILURE;
     }
 
-    fossil_tofu_t temp_data = fossil_tofu_create(set->type, data);
-    fossil_tofu_setof_node_t** current = &set->head;
-
-    while (*current) {
-        if (fossil_tofu_compare(&(*current)->data, &temp_data) == 0) {
-            fossil_tofu_setof_node_t* temp = *current;
-            *current = (*current)->next;
-            fossil_tofu_destroy(&temp->data);
-            fossil_tofu_free(temp);
-            set->size--;
-            fossil_tofu_destroy(&temp_data);
-            return FOSSIL_TOFU_SUCCESS;
-        }
-        current = &((*current)->next);
+    size_t i = fossil_tofu_hashtable_lookup(&set->table, data, strlen(data));
+    if (i == SIZE_MAX) {
+        return FOSSIL_TOFU_FAILURE;
     }
 
-    fossil_tofu_destroy(&temp_data);
-    return FOSSIL_TOFU_FAILURE;
+    fossil_tofu_setof_drop(set, i);
+    return FOSSIL_TOFU_SUCCESS;
 }
 
 bool fossil_tofu_setof_contains(const fossil_tofu_setof_t* set, char *data) {
@@ -126,29 +207,276 @@ bool fossil_tofu_setof_contains(const fossil_tofu_setof_t* set, char *data) {
         return false;
     }
 
-    fossil_tofu_t temp_data = fossil_tofu_create(set->type, data);
-    fossil_tofu_setof_node_t* current = set->head;
+    size_t i = fossil_tofu_hashtable_lookup(&set->table, data, strlen(data));
+    return i != SIZE_MAX;
+}
+
+bool fossil_tofu_setof_contains_key(const fossil_tofu_setof_t* set, const char* data, size_t len) {
+    if (set == NULL || data == NULL) {
+        return false;
+    }
+    return fossil_tofu_hashtable_lookup(&set->table, data, len) != SIZE_MAX;
+}
+
+bool fossil_tofu_setof_contains_i64(const fossil_tofu_setof_t* set, int64_t value) {
+    char text[24];
+    int len = snprintf(text, sizeof(text), "%" PRId64, value);
+    return fossil_tofu_setof_contains_key(set, text, (size_t)len);
+}
+
+int32_t fossil_tofu_setof_reserve(fossil_tofu_setof_t* set, size_t count) {
+    if (set == NULL) {
+        return FOSSIL_TOFU_ERROR_NULL_POINTER;
+    }
+    return fossil_tofu_hashtable_reserve(&set->table, count, set->max_load);
+}
+
+int32_t fossil_tofu_setof_attach_filter(fossil_tofu_setof_t* set, size_t bits_per_key) {
+    if (set == NULL) {
+        return FOSSIL_TOFU_ERROR_NULL_POINTER;
+    }
+    return fossil_tofu_hashtable_attach_filter(&set->table, bits_per_key);
+}
+
+void fossil_tofu_setof_detach_filter(fossil_tofu_setof_t* set) {
+    if (set == NULL) {
+        return;
+    }
+    fossil_tofu_hashtable_detach_filter(&set->table);
+}
+
+bool fossil_tofu_setof_has_filter(const fossil_tofu_setof_t* set) {
+    return set != NULL && set->table.filter != NULL;
+}
+
+size_t fossil_tofu_setof_capacity(const fossil_tofu_setof_t* set) {
+    return set == NULL ? 0 : set->table.capacity;
+}
+
+float fossil_tofu_setof_load_factor(const fossil_tofu_setof_t* set) {
+    if (set == NULL || set->table.capacity == 0) {
+        return 0.0f;
+    }
+    return (float)set->table.count / (float)set->table.capacity;
+}
 
-    while (current) {
-        if (fossil_tofu_compare(&current->data, &temp_data) == 0) {
-            fossil_tofu_destroy(&temp_data);
-            return true;
+int32_t fossil_tofu_setof_set_max_load(fossil_tofu_setof_t* set, float max_load) {
+    if (set == NULL) {
+        return FOSSIL_TOFU_ERROR_NULL_POINTER;
+    }
+    if (!(max_load >= FOSSIL_TOFU_SETOF_LOAD_MIN && max_load <= FOSSIL_TOFU_SETOF_LOAD_MAX)) {
+        return FOSSIL_TOFU_ERROR_INVALID_ARGUMENT;
+    }
+    set->max_load = max_load;
+    return set->table.count == 0 ? FOSSIL_TOFU_SUCCESS : fossil_tofu_setof_reserve(set, set->table.count);
+}
+
+// *****************************************************************************
+// Set algebra
+// *****************************************************************************
+
+int32_t fossil_tofu_setof_union_with(fossil_tofu_setof_t* set, const fossil_tofu_setof_t* other) {
+    if (set == NULL || other == NULL) {
+        return FOSSIL_TOFU_ERROR_NULL_POINTER;
+    }
+    if (!fossil_tofu_setof_same_type(set, other)) {
+        return FOSSIL_TOFU_ERROR_TYPE_MISMATCH;
+    }
+    if (set == other) {
+        return FOSSIL_TOFU_SUCCESS;
+    }
+    // Size for the larger input up front; overlap only makes this generous.
+    int32_t result = fossil_tofu_setof_reserve(set, set->table.count > other->table.count ? set->table.count : other->table.count);
+    for (size_t i = 0; result == FOSSIL_TOFU_SUCCESS && i < other->table.capacity; i++) {
+        if (fossil_tofu_setof_node(other, i) != NULL) {
+            result = fossil_tofu_setof_adopt_copy(set, &fossil_tofu_setof_node(other, i)->data);
+        }
+    }
+    return result;
+}
+
+int32_t fossil_tofu_setof_intersect_with(fossil_tofu_setof_t* set, const fossil_tofu_setof_t* other) {
+    if (set == NULL || other == NULL) {
+        return FOSSIL_TOFU_ERROR_NULL_POINTER;
+    }
+    if (!fossil_tofu_setof_same_type(set, other)) {
+        return FOSSIL_TOFU_ERROR_TYPE_MISMATCH;
+    }
+    // Backward-shift deletion pulls the next element into slot `i`, so the
+    // slot is examined again instead of advancing.
+    for (size_t i = 0; i < set->table.capacity;) {
+        fossil_tofu_setof_node_t* node = fossil_tofu_setof_node(set, i);
+        if (node != NULL && fossil_tofu_setof_find(other, &node->data) == SIZE_MAX) {
+            fossil_tofu_setof_drop(set, i);
+        } else {
+            i++;
+        }
+    }
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+int32_t fossil_tofu_setof_difference_with(fossil_tofu_setof_t* set, const fossil_tofu_setof_t* other) {
+    if (set == NULL || other == NULL) {
+        return FOSSIL_TOFU_ERROR_NULL_POINTER;
+    }
+    if (!fossil_tofu_setof_same_type(set, other)) {
+        return FOSSIL_TOFU_ERROR_TYPE_MISMATCH;
+    }
+    if (set == other) {
+        for (size_t i = 0; i < set->table.capacity; i++) {
+            fossil_tofu_setof_node_t* node = fossil_tofu_setof_node(set, i);
+            if (node != NULL) {
+                fossil_tofu_destroy(&node->data);
+                fossil_tofu_free(node);
+            }
+        }
+        fossil_tofu_hashtable_clear(&set->table);
+        return FOSSIL_TOFU_SUCCESS;
+    }
+    // Walk whichever side is smaller.
+    if (other->table.count < set->table.count) {
+        for (size_t i = 0; i < other->table.capacity && set->table.count > 0; i++) {
+            if (fossil_tofu_setof_node(other, i) == NULL) {
+                continue;
+            }
+            size_t j = fossil_tofu_setof_find(set, &fossil_tofu_setof_node(other, i)->data);
+            if (j != SIZE_MAX) {
+                fossil_tofu_setof_drop(set, j);
+            }
+        }
+    } else {
+        for (size_t i = 0; i < set->table.capacity;) {
+            fossil_tofu_setof_node_t* node = fossil_tofu_setof_node(set, i);
+            if (node != NULL && fossil_tofu_setof_find(other, &node->data) != SIZE_MAX) {
+                fossil_tofu_setof_drop(set, i);
+            } else {
+                i++;
+            }
+        }
+    }
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+int32_t fossil_tofu_setof_symmetric_difference_with(fossil_tofu_setof_t* set, const fossil_tofu_setof_t* other) {
+    if (set == NULL || other == NULL) {
+        return FOSSIL_TOFU_ERROR_NULL_POINTER;
+    }
+    if (set == other) {
+        return fossil_tofu_setof_difference_with(set, other);
+    }
+    if (!fossil_tofu_setof_same_type(set, other)) {
+        return FOSSIL_TOFU_ERROR_TYPE_MISMATCH;
+    }
+    for (size_t i = 0; i < other->table.capacity; i++) {
+        if (fossil_tofu_setof_node(other, i) == NULL) {
+            continue;
+        }
+        const fossil_tofu_t* data = &fossil_tofu_setof_node(other, i)->data;
+        size_t j = fossil_tofu_setof_find(set, data);
+        int32_t result = FOSSIL_TOFU_SUCCESS;
+        if (j != SIZE_MAX) {
+            fossil_tofu_setof_drop(set, j);
+        } else {
+            result = fossil_tofu_setof_adopt_copy(set, data);
+        }
+        if (result != FOSSIL_TOFU_SUCCESS) {
+            return result;
         }
-        current = current->next;
     }
+    return FOSSIL_TOFU_SUCCESS;
+}
 
-    fossil_tofu_destroy(&temp_data);
-    return false;
+fossil_tofu_setof_t* fossil_tofu_setof_union(const fossil_tofu_setof_t* a, const fossil_tofu_setof_t* b) {
+    if (a == NULL || b == NULL || !fossil_tofu_setof_same_type(a, b)) {
+        return NULL;
+    }
+    // Start from a clone of the larger side so only the smaller is probed.
+    const fossil_tofu_setof_t* large = a->table.count >= b->table.count ? a : b;
+    const fossil_tofu_setof_t* small = large == a ? b : a;
+    fossil_tofu_setof_t* set = fossil_tofu_setof_create_copy(large);
+    if (set != NULL && fossil_tofu_setof_union_with(set, small) != FOSSIL_TOFU_SUCCESS) {
+        fossil_tofu_setof_destroy(set);
+        return NULL;
+    }
+    return set;
+}
+
+fossil_tofu_setof_t* fossil_tofu_setof_intersection(const fossil_tofu_setof_t* a, const fossil_tofu_setof_t* b) {
+    if (a == NULL || b == NULL || !fossil_tofu_setof_same_type(a, b)) {
+        return NULL;
+    }
+    const fossil_tofu_setof_t* small = a->table.count <= b->table.count ? a : b;
+    const fossil_tofu_setof_t* large = small == a ? b : a;
+    fossil_tofu_setof_t* set = fossil_tofu_setof_create_container(a->type);
+    if (set == NULL) {
+        return NULL;
+    }
+    for (size_t i = 0; i < small->table.capacity; i++) {
+        const fossil_tofu_setof_node_t* node = fossil_tofu_setof_node(small, i);
+        if (node != NULL && fossil_tofu_setof_find(large, &node->data) != SIZE_MAX &&
+            fossil_tofu_setof_adopt_copy(set, &node->data) != FOSSIL_TOFU_SUCCESS) {
+            fossil_tofu_setof_destroy(set);
+            return NULL;
+        }
+    }
+    return set;
+}
+
+fossil_tofu_setof_t* fossil_tofu_setof_difference(const fossil_tofu_setof_t* a, const fossil_tofu_setof_t* b) {
+    if (a == NULL || b == NULL || !fossil_tofu_setof_same_type(a, b)) {
+        return NULL;
+    }
+    fossil_tofu_setof_t* set = fossil_tofu_setof_create_container(a->type);
+    if (set == NULL) {
+        return NULL;
+    }
+    for (size_t i = 0; i < a->table.capacity; i++) {
+        const fossil_tofu_setof_node_t* node = fossil_tofu_setof_node(a, i);
+        if (node != NULL && fossil_tofu_setof_find(b, &node->data) == SIZE_MAX &&
+            fossil_tofu_setof_adopt_copy(set, &node->data) != FOSSIL_TOFU_SUCCESS) {
+            fossil_tofu_setof_destroy(set);
+            return NULL;
+        }
+    }
+    return set;
+}
+
+fossil_tofu_setof_t* fossil_tofu_setof_symmetric_difference(const fossil_tofu_setof_t* a, const fossil_tofu_setof_t* b) {
+    if (a == NULL || b == NULL || !fossil_tofu_setof_same_type(a, b)) {
+        return NULL;
+    }
+    fossil_tofu_setof_t* set = fossil_tofu_setof_create_copy(a);
+    if (set != NULL && fossil_tofu_setof_symmetric_difference_with(set, b) != FOSSIL_TOFU_SUCCESS) {
+        fossil_tofu_setof_destroy(set);
+        return NULL;
+    }
+    return set;
+}
+
+bool fossil_tofu_setof_is_subset(const fossil_tofu_setof_t* set, const fossil_tofu_setof_t* other) {
+    if (set == NULL || other == NULL || !fossil_tofu_setof_same_type(set, other)) {
+        return false;
+    }
+    if (set->table.count > other->table.count) {
+        return false;
+    }
+    for (size_t i = 0; i < set->table.capacity; i++) {
+        const fossil_tofu_setof_node_t* node = fossil_tofu_setof_node(set, i);
+        if (node != NULL && fossil_tofu_setof_find(other, &node->data) == SIZE_MAX) {
+            return false;
+        }
+    }
+    return true;
 }
 
 size_t fossil_tofu_setof_size(const fossil_tofu_setof_t* set) {
-    return set == NULL ? 0 : set->size;
+    return set == NULL ? 0 : set->table.count;
 }
 
 bool fossil_tofu_setof_not_empty(const fossil_tofu_setof_t* set) {
-    return set != NULL && set->size > 0;
+    return set != NULL && set->table.count > 0;
 }
 
 bool fossil_tofu_setof_is_empty(const fossil_tofu_setof_t* set) {
-    return set == NULL || set->size == 0;
+    return set == NULL || set->table.count == 0;
 }
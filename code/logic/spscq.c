@@ -0,0 +1,276 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include "fossil/tofu/spscq.h"
+#include "fossil/tofu/atomics.h"
+
+// *****************************************************************************
+// Ring indices
+// *****************************************************************************
+
+#define FOSSIL_TOFU_SPSCQ_LINE 64 // Assumed cache line size
+
+// 'tail' is written only by the producer and 'head' only by the consumer.
+// Each side also keeps a private copy of the other side's index so the
+// shared line is read only when the cached value says full or empty. The
+// padding keeps the two halves at least a cache line apart.
+struct fossil_tofu_spscq_ring_t {
+    char pad0[FOSSIL_TOFU_SPSCQ_LINE];
+    fossil_tofu_atomic_size_t tail;
+    size_t head_cache;
+    char pad1[FOSSIL_TOFU_SPSCQ_LINE];
+    fossil_tofu_atomic_size_t head;
+    size_t tail_cache;
+    char pad2[FOSSIL_TOFU_SPSCQ_LINE];
+};
+
+// Free slots the producer may fill starting at 'tail', refreshing its view
+// of the consumer only when the cached one is not enough.
+static size_t fossil_tofu_spscq_room(const fossil_tofu_spscq_t* queue, size_t tail, size_t wanted) {
+    fossil_tofu_spscq_ring_t* ring = queue->ring;
+    size_t room = queue->capacity - (tail - ring->head_cache);
+    if (room < wanted) {
+        ring->head_cache = fossil_tofu_atomic_size_load(&ring->head, FOSSIL_TOFU_ACQUIRE);
+        room = queue->capacity - (tail - ring->head_cache);
+    }
+    return room;
+}
+
+// Elements the consumer may read starting at 'head'.
+static size_t fossil_tofu_spscq_ready(const fossil_tofu_spscq_t* queue, size_t head, size_t wanted) {
+    fossil_tofu_spscq_ring_t* ring = queue->ring;
+    size_t ready = ring->tail_cache - head;
+    if (ready < wanted) {
+        ring->tail_cache = fossil_tofu_atomic_size_load(&ring->tail, FOSSIL_TOFU_ACQUIRE);
+        ready = ring->tail_cache - head;
+    }
+    return ready;
+}
+
+// *****************************************************************************
+// Function prototypes
+// *****************************************************************************
+
+fossil_tofu_spscq_t* fossil_tofu_spscq_create_container(char* type, size_t capacity) {
+    if (type == NULL || capacity == 0 || capacity > (SIZE_MAX / 2) / sizeof(fossil_tofu_t)) {
+        return NULL;
+    }
+    size_t rounded = 1;
+    while (rounded < capacity) {
+        rounded <<= 1;
+    }
+    fossil_tofu_spscq_t* queue = (fossil_tofu_spscq_t*)fossil_tofu_alloc(sizeof(fossil_tofu_spscq_t));
+    if (queue == NULL) {
+        return NULL;
+    }
+    queue->type = fossil_tofu_strdup(type);
+    queue->slots = (fossil_tofu_t*)fossil_tofu_alloc(rounded * sizeof(fossil_tofu_t));
+    queue->ring = (fossil_tofu_spscq_ring_t*)fossil_tofu_alloc(sizeof(fossil_tofu_spscq_ring_t));
+    if (queue->type == NULL || queue->slots == NULL || queue->ring == NULL) {
+        fossil_tofu_free(queue->type);
+        fossil_tofu_free(queue->slots);
+        fossil_tofu_free(queue->ring);
+        fossil_tofu_free(queue);
+        return NULL;
+    }
+    memset(queue->slots, 0, rounded * sizeof(fossil_tofu_t));
+    queue->capacity = rounded;
+    queue->mask = rounded - 1;
+    fossil_tofu_atomic_size_init(&queue->ring->tail, 0);
+    fossil_tofu_atomic_size_init(&queue->ring->head, 0);
+    queue->ring->head_cache = 0;
+    queue->ring->tail_cache = 0;
+    return queue;
+}
+
+void fossil_tofu_spscq_destroy(fossil_tofu_spscq_t* queue) {
+    if (queue == NULL) {
+        return;
+    }
+    size_t head = fossil_tofu_atomic_size_load(&queue->ring->head, FOSSIL_TOFU_RELAXED);
+    size_t tail = fossil_tofu_atomic_size_load(&queue->ring->tail, FOSSIL_TOFU_RELAXED);
+    for (; head != tail; head++) {
+        fossil_tofu_destroy(&queue->slots[head & queue->mask]);
+    }
+    fossil_tofu_free(queue->ring);
+    fossil_tofu_free(queue->slots);
+    fossil_tofu_free(queue->type);
+    fossil_tofu_free(queue);
+}
+
+// *****************************************************************************
+// Producer functions
+// *****************************************************************************
+
+int32_t fossil_tofu_spscq_insert(fossil_tofu_spscq_t* queue, char* data) {
+    if (queue == NULL || data == NULL) {
+        return FOSSIL_TOFU_ERROR_INVALID_ARGUMENT;
+    }
+    size_t tail = fossil_tofu_atomic_size_load(&queue->ring->tail, FOSSIL_TOFU_RELAXED);
+    if (fossil_tofu_spscq_room(queue, tail, 1) == 0) {
+        return FOSSIL_TOFU_FAILURE;  // Queue is full
+    }
+    fossil_tofu_t* slot = &queue->slots[tail & queue->mask];
+    *slot = fossil_tofu_create(queue->type, data);
+    if (slot->value.data == NULL) {
+        return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+    }
+    fossil_tofu_atomic_size_store(&queue->ring->tail, tail + 1, FOSSIL_TOFU_RELEASE);
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+int32_t fossil_tofu_spscq_insert_tofu(fossil_tofu_spscq_t* queue, fossil_tofu_t* tofu) {
+    if (queue == NULL || tofu == NULL || tofu->value.data == NULL) {
+        return FOSSIL_TOFU_ERROR_INVALID_ARGUMENT;
+    }
+    size_t tail = fossil_tofu_atomic_size_load(&queue->ring->tail, FOSSIL_TOFU_RELAXED);
+    if (fossil_tofu_spscq_room(queue, tail, 1) == 0) {
+        return FOSSIL_TOFU_FAILURE;  // Queue is full
+    }
+    queue->slots[tail & queue->mask] = *tofu;
+    memset(tofu, 0, sizeof(*tofu));
+    fossil_tofu_atomic_size_store(&queue->ring->tail, tail + 1, FOSSIL_TOFU_RELEASE);
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+size_t fossil_tofu_spscq_insert_batch(fossil_tofu_spscq_t* queue, char* const data[], size_t count) {
+    if (queue == NULL || data == NULL || count == 0) {
+        return 0;
+    }
+    size_t tail = fossil_tofu_atomic_size_load(&queue->ring->tail, FOSSIL_TOFU_RELAXED);
+    size_t room = fossil_tofu_spscq_room(queue, tail, count);
+    if (count > room) {
+        count = room;
+    }
+    size_t inserted = 0;
+    while (inserted < count && data[inserted] != NULL) {
+        fossil_tofu_t* slot = &queue->slots[(tail + inserted) & queue->mask];
+        *slot = fossil_tofu_create(queue->type, data[inserted]);
+        if (slot->value.data == NULL) {
+            break;
+        }
+        inserted++;
+    }
+    if (inserted > 0) {
+        fossil_tofu_atomic_size_store(&queue->ring->tail, tail + inserted, FOSSIL_TOFU_RELEASE);
+    }
+    return inserted;
+}
+
+// *****************************************************************************
+// Consumer functions
+// *****************************************************************************
+
+int32_t fossil_tofu_spscq_remove(fossil_tofu_spscq_t* queue) {
+    if (queue == NULL) {
+        return FOSSIL_TOFU_FAILURE;
+    }
+    size_t head = fossil_tofu_atomic_size_load(&queue->ring->head, FOSSIL_TOFU_RELAXED);
+    if (fossil_tofu_spscq_ready(queue, head, 1) == 0) {
+        return FOSSIL_TOFU_FAILURE;  // Queue is empty
+    }
+    fossil_tofu_destroy(&queue->slots[head & queue->mask]);
+    fossil_tofu_atomic_size_store(&queue->ring->head, head + 1, FOSSIL_TOFU_RELEASE);
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+int32_t fossil_tofu_spscq_take(fossil_tofu_spscq_t* queue, fossil_tofu_t* out) {
+    if (queue == NULL || out == NULL) {
+        return FOSSIL_TOFU_ERROR_INVALID_ARGUMENT;
+    }
+    size_t head = fossil_tofu_atomic_size_load(&queue->ring->head, FOSSIL_TOFU_RELAXED);
+    if (fossil_tofu_spscq_ready(queue, head, 1) == 0) {
+        return FOSSIL_TOFU_FAILURE;  // Queue is empty
+    }
+    *out = queue->slots[head & queue->mask];
+    fossil_tofu_atomic_size_store(&queue->ring->head, head + 1, FOSSIL_TOFU_RELEASE);
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+size_t fossil_tofu_spscq_take_batch(fossil_tofu_spscq_t* queue, fossil_tofu_t out[], size_t max) {
+    if (queue == NULL || out == NULL || max == 0) {
+        return 0;
+    }
+    size_t head = fossil_tofu_atomic_size_load(&queue->ring->head, FOSSIL_TOFU_RELAXED);
+    size_t ready = fossil_tofu_spscq_ready(queue, head, max);
+    if (ready > max) {
+        ready = max;
+    }
+    for (size_t i = 0; i < ready; i++) {
+        out[i] = queue->slots[(head + i) & queue->mask];
+    }
+    if (ready > 0) {
+        fossil_tofu_atomic_size_store(&queue->ring->head, head + ready, FOSSIL_TOFU_RELEASE);
+    }
+    return ready;
+}
+
+char* fossil_tofu_spscq_get_front(const fossil_tofu_spscq_t* queue) {
+    if (queue == NULL) {
+        return NULL;
+    }
+    size_t head = fossil_tofu_atomic_size_load(&queue->ring->head, FOSSIL_TOFU_RELAXED);
+    if (fossil_tofu_spscq_ready(queue, head, 1) == 0) {
+        return NULL;  // Queue is empty
+    }
+    return queue->slots[head & queue->mask].value.data;
+}
+
+// *****************************************************************************
+// Utility functions
+// *****************************************************************************
+
+size_t fossil_tofu_spscq_size(const fossil_tofu_spscq_t* queue) {
+    if (queue == NULL) {
+        return 0;
+    }
+    // Read head first: tail only grows, so the difference never underflows
+    size_t head = fossil_tofu_atomic_size_load(&queue->ring->head, FOSSIL_TOFU_ACQUIRE);
+    size_t tail = fossil_tofu_atomic_size_load(&queue->ring->tail, FOSSIL_TOFU_ACQUIRE);
+    return tail - head;
+}
+
+size_t fossil_tofu_spscq_capacity(const fossil_tofu_spscq_t* queue) {
+    return (queue != NULL) ? queue->capacity : 0;
+}
+
+bool fossil_tofu_spscq_is_empty(const fossil_tofu_spscq_t* queue) {
+    return fossil_tofu_spscq_size(queue) == 0;
+}
+
+bool fossil_tofu_spscq_not_empty(const fossil_tofu_spscq_t* queue) {
+    return fossil_tofu_spscq_size(queue) > 0;
+}
+
+bool fossil_tofu_spscq_is_full(const fossil_tofu_spscq_t* queue) {
+    return (queue != NULL) && (fossil_tofu_spscq_size(queue) >= queue->capacity);
+}
+
+bool fossil_tofu_spscq_is_cnullptr(const fossil_tofu_spscq_t* queue) {
+    return queue == NULL;
+}
+
+bool fossil_tofu_spscq_not_cnullptr(const fossil_tofu_spscq_t* queue) {
+    return queue != NULL;
+}
@@ -24,17 +24,48 @@
  */
 #include "fossil/tofu/stack.h"
 
+// Grow the element array so it can hold at least 'needed' elements.
+static int32_t fossil_tofu_stack_grow(fossil_tofu_stack_t* stack, size_t needed) {
+    if (needed <= stack->capacity) {
+        return FOSSIL_TOFU_SUCCESS; // Already large enough
+    }
+    if (needed > SIZE_MAX / sizeof(fossil_tofu_t)) {
+        return FOSSIL_TOFU_ERROR_OVERFLOW;
+    }
+
+    // Double until the request fits so repeated pushes stay amortized O(1)
+    size_t capacity = stack->capacity ? stack->capacity : INITIAL_CAPACITY;
+    while (capacity < needed) {
+        capacity = capacity > SIZE_MAX / 2 ? needed : capacity * 2;
+    }
+    if (capacity > SIZE_MAX / sizeof(fossil_tofu_t)) {
+        capacity = needed;
+    }
+
+    fossil_tofu_t* data = (fossil_tofu_t*)fossil_tofu_realloc(stack->data, capacity * sizeof(fossil_tofu_t));
+    if (!data) {
+        return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+    }
+    stack->data = data;
+    stack->capacity = capacity;
+    return FOSSIL_TOFU_SUCCESS;
+}
+
 fossil_tofu_stack_t* fossil_tofu_stack_create_container(char* type) {
-    fossil_tofu_stack_t* stack = (fossil_tofu_stack_t*)malloc(sizeof(fossil_tofu_stack_t));
+    fossil_tofu_stack_t* stack = (fossil_tofu_stack_t*)fossil_tofu_alloc(sizeof(fossil_tofu_stack_t));
     if (!stack) {
         return NULL; // Memory allocation failed
     }
     stack->type = fossil_tofu_strdup(type); // Duplicate the type string
-    if (!stack->type) {
+    stack->data = (fossil_tofu_t*)fossil_tofu_alloc(INITIAL_CAPACITY * sizeof(fossil_tofu_t));
+    if (!stack->type || !stack->data) {
+        fossil_tofu_free(stack->type);
+        fossil_tofu_free(stack->data);
         fossil_tofu_free(stack);
         return NULL; // Memory allocation failed
     }
-    stack->top = NULL; // Initialize the top pointer to NULL
+    stack->size = 0;
+    stack->capacity = INITIAL_CAPACITY;
     return stack;
 }
 
@@ -51,17 +82,17 @@ fossil_tofu_stack_t* fossil_tofu_stack_create_copy(const fossil_tofu_stack_t* ot
     if (!new_stack) {
         return NULL; // Memory allocation failed
     }
+    if (fossil_tofu_stack_grow(new_stack, other->size) != FOSSIL_TOFU_SUCCESS) {
+        fossil_tofu_stack_destroy(new_stack);
+        return NULL; // Memory allocation failed
+    }
 
-    // Copy the elements from the other stack
-    fossil_tofu_stack_node_t* current = other->top;
-    while (current) {
-        int32_t rc = fossil_tofu_stack_insert(new_stack, fossil_tofu_get_value(&current->data));
-        if (rc != FOSSIL_TOFU_SUCCESS) {
-            fossil_tofu_stack_destroy(new_stack);
-            return NULL; // Insertion failed
-        }
-        current = current->next;
+    // Copy the elements bottom to top so the order is preserved
+    for (size_t i = 0; i < other->size; i++) {
+        new_stack->data[i] = fossil_tofu_create(new_stack->type, fossil_tofu_get_value(&other->data[i]));
+        new_stack->size++;
     }
+    FOSSIL_TOFU_DEBUG_CHECK(fossil_tofu_stack_verify(new_stack));
     
     return new_stack;
 }
@@ -77,11 +108,15 @@ fossil_tofu_stack_t* fossil_tofu_stack_create_move(fossil_tofu_stack_t* other) {
     }
 
     new_stack->type = other->type;
-    new_stack->top = other->top;
+    new_stack->data = other->data;
+    new_stack->size = other->size;
+    new_stack->capacity = other->capacity;
 
     // Invalidate the original stack
     other->type = NULL;
-    other->top = NULL;
+    other->data = NULL;
+    other->size = 0;
+    other->capacity = 0;
 
     return new_stack;
 }
@@ -91,18 +126,14 @@ void fossil_tofu_stack_destroy(fossil_tofu_stack_t* stack) {
         return;
     }
 
-    // Free the type string
-    fossil_tofu_free(stack->type);
-
-    // Free the stack nodes
-    fossil_tofu_stack_node_t* current = stack->top;
-    while (current) {
-        fossil_tofu_stack_node_t* next = current->next;
-        fossil_tofu_free(current);
-        current = next;
+    // Free the stored elements and the array holding them
+    for (size_t i = 0; i < stack->size; i++) {
+        fossil_tofu_destroy(&stack->data[i]);
     }
+    fossil_tofu_free(stack->data);
 
-    // Free the stack structure
+    // Free the type string and the stack structure
+    fossil_tofu_free(stack->type);
     fossil_tofu_free(stack);
 }
 
@@ -110,50 +141,116 @@ int32_t fossil_tofu_stack_insert(fossil_tofu_stack_t* stack, char* data) {
     if (!stack || !data) {
         return FOSSIL_TOFU_FAILURE; // Invalid stack or data
     }
-
-    // Create a new stack node
-    fossil_tofu_stack_node_t* new_node = (fossil_tofu_stack_node_t*)malloc(sizeof(fossil_tofu_stack_node_t));
-    if (!new_node) {
+    if (stack->size == stack->capacity && fossil_tofu_stack_grow(stack, stack->size + 1) != FOSSIL_TOFU_SUCCESS) {
         return FOSSIL_TOFU_FAILURE; // Memory allocation failed
     }
 
     // Use the stack's type to create the tofu object
-    new_node->data = fossil_tofu_create(stack->type, data);
-    new_node->next = stack->top;
-    stack->top = new_node;
+    stack->data[stack->size++] = fossil_tofu_create(stack->type, data);
+    FOSSIL_TOFU_DEBUG_CHECK(fossil_tofu_stack_verify(stack));
 
     return FOSSIL_TOFU_SUCCESS;
 }
 
 int32_t fossil_tofu_stack_remove(fossil_tofu_stack_t* stack) {
-    if (!stack || !stack->top) {
+    if (!stack || stack->size == 0) {
         return FOSSIL_TOFU_FAILURE; // Invalid stack or empty stack
     }
 
-    // Remove the top node
-    fossil_tofu_stack_node_t* temp = stack->top;
-    stack->top = stack->top->next;
-    fossil_tofu_free(temp);
+    // Remove the top element; the slot is reused by the next insert
+    fossil_tofu_destroy(&stack->data[--stack->size]);
+    FOSSIL_TOFU_DEBUG_CHECK(fossil_tofu_stack_verify(stack));
 
     return FOSSIL_TOFU_SUCCESS; // Removal successful
 }
 
+int32_t fossil_tofu_stack_reserve(fossil_tofu_stack_t* stack, size_t capacity) {
+    if (!stack) {
+        return FOSSIL_TOFU_ERROR_NULL_POINTER;
+    }
+    return fossil_tofu_stack_grow(stack, capacity);
+}
+
+int32_t fossil_tofu_stack_push_many(fossil_tofu_stack_t* stack, char** data, size_t count) {
+    if (!stack || (!data && count > 0)) {
+        return FOSSIL_TOFU_FAILURE; // Invalid stack or data
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (!data[i]) {
+            return FOSSIL_TOFU_FAILURE; // Nothing is pushed if any element is missing
+        }
+    }
+    if (count > SIZE_MAX - stack->size) {
+        return FOSSIL_TOFU_FAILURE; // Size would overflow
+    }
+    if (fossil_tofu_stack_grow(stack, stack->size + count) != FOSSIL_TOFU_SUCCESS) {
+        return FOSSIL_TOFU_FAILURE; // Memory allocation failed
+    }
+
+    // Room is reserved up front, so the batch cannot fail half way
+    for (size_t i = 0; i < count; i++) {
+        stack->data[stack->size++] = fossil_tofu_create(stack->type, data[i]);
+    }
+    FOSSIL_TOFU_DEBUG_CHECK(fossil_tofu_stack_verify(stack));
+
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+size_t fossil_tofu_stack_pop_many(fossil_tofu_stack_t* stack, fossil_tofu_vector_t* vector, size_t count) {
+    if (!stack) {
+        return 0; // Invalid stack
+    }
+    if (count > stack->size) {
+        count = stack->size;
+    }
+
+    // Pop in stack order, so the old top becomes the first element appended.
+    // push_back drops the value when it cannot grow, so an element is only
+    // popped once the vector is seen to have taken it.
+    size_t popped = 0;
+    for (; popped < count; popped++) {
+        fossil_tofu_t* top = &stack->data[stack->size - 1];
+        if (vector) {
+            size_t size = fossil_tofu_vector_size(vector);
+            fossil_tofu_vector_push_back(vector, fossil_tofu_get_value(top));
+            if (fossil_tofu_vector_size(vector) == size) {
+                break; // Out of memory; the rest stays on the stack
+            }
+        }
+        fossil_tofu_destroy(top);
+        stack->size--;
+    }
+    FOSSIL_TOFU_DEBUG_CHECK(fossil_tofu_stack_verify(stack));
+
+    return popped;
+}
+
 size_t fossil_tofu_stack_size(const fossil_tofu_stack_t* stack) {
     if (!stack) {
         return 0; // Invalid stack
     }
+    return stack->size;
+}
 
-    size_t size = 0;
-    fossil_tofu_stack_node_t* current = stack->top;
-    while (current) {
-        size++;
-        current = current->next;
+size_t fossil_tofu_stack_capacity(const fossil_tofu_stack_t* stack) {
+    if (!stack) {
+        return 0; // Invalid stack
+    }
+    return stack->capacity;
+}
+
+bool fossil_tofu_stack_verify(const fossil_tofu_stack_t* stack) {
+    if (!stack) {
+        return false; // Invalid stack
+    }
+    if (stack->size > stack->capacity) {
+        return false; // More elements than slots
     }
-    return size;
+    return stack->capacity == 0 || stack->data != NULL;
 }
 
 bool fossil_tofu_stack_not_empty(const fossil_tofu_stack_t* stack) {
-    return fossil_tofu_stack_size(stack) > 0;
+    return stack != NULL && stack->size > 0;
 }
 
 bool fossil_tofu_stack_not_cnullptr(const fossil_tofu_stack_t* stack) {
@@ -161,7 +258,7 @@ bool fossil_tofu_stack_not_cnullptr(const fossil_tofu_stack_t* stack) {
 }
 
 bool fossil_tofu_stack_is_empty(const fossil_tofu_stack_t* stack) {
-    return fossil_tofu_stack_size(stack) == 0;
+    return stack == NULL || stack->size == 0;
 }
 
 bool fossil_tofu_stack_is_cnullptr(const fossil_tofu_stack_t* stack) {
@@ -169,42 +266,31 @@ bool fossil_tofu_stack_is_cnullptr(const fossil_tofu_stack_t* stack) {
 }
 
 fossil_tofu_t fossil_tofu_stack_top(fossil_tofu_stack_t* stack) {
-    if (!stack || !stack->top) {
+    if (!stack || stack->size == 0) {
         return fossil_tofu_create("any", ""); // Return default value if empty
     }
-    return stack->top->data;
+    return stack->data[stack->size - 1];
 }
 
 fossil_tofu_t fossil_tofu_stack_get(const fossil_tofu_stack_t* stack, size_t index) {
-    if (!stack) {
-        return fossil_tofu_create("any", ""); // Return default value if stack is null
-    }
-
-    fossil_tofu_stack_node_t* current = stack->top;
-    size_t current_index = 0;
-    while (current) {
-        if (current_index == index) {
-            return current->data;
-        }
-        current = current->next;
-        current_index++;
+    if (!stack || index >= stack->size) {
+        return fossil_tofu_create("any", ""); // Return default value if null or out of bounds
     }
-    return fossil_tofu_create("any", ""); // Return default value if index is out of bounds
+    return stack->data[stack->size - 1 - index]; // Index 0 is the top
 }
 
 void fossil_tofu_stack_set(fossil_tofu_stack_t* stack, size_t index, fossil_tofu_t element) {
-    if (!stack || index >= fossil_tofu_stack_size(stack)) {
+    if (!stack || index >= stack->size) {
         return; // Invalid stack or index out of bounds
     }
-
-    fossil_tofu_stack_node_t* current = stack->top;
-    size_t current_index = 0;
-    while (current) {
-        if (current_index == index) {
-            current->data = element; // Set the element at the specified index
-            return;
-        }
-        current = current->next;
-        current_index++;
+    // Copy before releasing the slot: element may be a shallow copy of it,
+    // as top() and get() return, and would otherwise be read after free.
+    fossil_tofu_t copy = {0};
+    if (fossil_tofu_copy(&copy, &element) != FOSSIL_TOFU_SUCCESS) {
+        fossil_tofu_destroy(&copy);
+        return;
     }
+    fossil_tofu_t* slot = &stack->data[stack->size - 1 - index];
+    fossil_tofu_destroy(slot);
+    *slot = copy;
 }
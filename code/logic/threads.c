@@ -0,0 +1,498 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#if defined(__APPLE__) && !defined(_DARWIN_C_SOURCE)
+#define _DARWIN_C_SOURCE // Exposes _SC_NPROCESSORS_ONLN and relative timed waits
+#endif
+#include "fossil/tofu/threads.h"
+
+#if defined(FOSSIL_TOFU_THREADS_POSIX)
+#include <errno.h>
+#include <sched.h>
+#include <unistd.h>
+#endif
+
+// Longest single timed wait; callers loop on their own deadline anyway.
+#define FOSSIL_TOFU_MAX_WAIT_MS 86400000ULL
+
+// *****************************************************************************
+// Threads
+// *****************************************************************************
+
+#if defined(FOSSIL_TOFU_THREADS_WIN32)
+
+typedef struct fossil_tofu_thread_start_t {
+    fossil_tofu_thread_fn routine;
+    void* arg;
+} fossil_tofu_thread_start_t;
+
+static DWORD WINAPI fossil_tofu_thread_entry(LPVOID param) {
+    fossil_tofu_thread_start_t start = *(fossil_tofu_thread_start_t*)param;
+    fossil_tofu_free(param);
+    start.routine(start.arg);
+    return 0;
+}
+
+typedef struct fossil_tofu_once_call_t {
+    void (*fn)(void);
+} fossil_tofu_once_call_t;
+
+static BOOL CALLBACK fossil_tofu_once_entry(PINIT_ONCE once, PVOID param, PVOID* context) {
+    (void)once;
+    (void)context;
+    ((fossil_tofu_once_call_t*)param)->fn();
+    return TRUE;
+}
+
+int32_t fossil_tofu_thread_create(fossil_tofu_thread_t* thread, fossil_tofu_thread_fn routine, void* arg) {
+    fossil_tofu_thread_start_t* start = (fossil_tofu_thread_start_t*)fossil_tofu_alloc(sizeof(fossil_tofu_thread_start_t));
+    if (start == NULL) {
+        return FOSSIL_TOFU_FAILURE;
+    }
+    start->routine = routine;
+    start->arg = arg;
+    *thread = CreateThread(NULL, 0, fossil_tofu_thread_entry, start, 0, NULL);
+    if (*thread == NULL) {
+        fossil_tofu_free(start);
+        return FOSSIL_TOFU_FAILURE;
+    }
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+void fossil_tofu_thread_join(fossil_tofu_thread_t thread) {
+    WaitForSingleObject(thread, INFINITE);
+    CloseHandle(thread);
+}
+
+void fossil_tofu_thread_detach(fossil_tofu_thread_t thread) {
+    CloseHandle(thread);
+}
+
+void fossil_tofu_thread_yield(void) {
+    SwitchToThread();
+}
+
+size_t fossil_tofu_cpu_count(void) {
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (size_t)info.dwNumberOfProcessors : 1;
+}
+
+uint64_t fossil_tofu_clock_ms(void) {
+    return (uint64_t)GetTickCount64();
+}
+
+void fossil_tofu_call_once(fossil_tofu_once_t* once, void (*fn)(void)) {
+    fossil_tofu_once_call_t call = { fn };
+    InitOnceExecuteOnce(once, fossil_tofu_once_entry, &call, NULL);
+}
+
+int32_t fossil_tofu_mutex_init(fossil_tofu_mutex_t* mutex) {
+    InitializeSRWLock(mutex);
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+void fossil_tofu_mutex_destroy(fossil_tofu_mutex_t* mutex) {
+    (void)mutex; // SRW locks hold no resources
+}
+
+void fossil_tofu_mutex_lock(fossil_tofu_mutex_t* mutex) {
+    AcquireSRWLockExclusive(mutex);
+}
+
+void fossil_tofu_mutex_unlock(fossil_tofu_mutex_t* mutex) {
+    ReleaseSRWLockExclusive(mutex);
+}
+
+int32_t fossil_tofu_rwlock_init(fossil_tofu_rwlock_t* lock) {
+    InitializeSRWLock(lock);
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+void fossil_tofu_rwlock_destroy(fossil_tofu_rwlock_t* lock) {
+    (void)lock;
+}
+
+void fossil_tofu_rwlock_read_lock(fossil_tofu_rwlock_t* lock) {
+    AcquireSRWLockShared(lock);
+}
+
+void fossil_tofu_rwlock_read_unlock(fossil_tofu_rwlock_t* lock) {
+    ReleaseSRWLockShared(lock);
+}
+
+void fossil_tofu_rwlock_write_lock(fossil_tofu_rwlock_t* lock) {
+    AcquireSRWLockExclusive(lock);
+}
+
+void fossil_tofu_rwlock_write_unlock(fossil_tofu_rwlock_t* lock) {
+    ReleaseSRWLockExclusive(lock);
+}
+
+int32_t fossil_tofu_cond_init(fossil_tofu_cond_t* cond) {
+    InitializeConditionVariable(cond);
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+void fossil_tofu_cond_destroy(fossil_tofu_cond_t* cond) {
+    (void)cond;
+}
+
+void fossil_tofu_cond_wait(fossil_tofu_cond_t* cond, fossil_tofu_mutex_t* mutex) {
+    SleepConditionVariableSRW(cond, mutex, INFINITE, 0);
+}
+
+bool fossil_tofu_cond_wait_ms(fossil_tofu_cond_t* cond, fossil_tofu_mutex_t* mutex, uint64_t ms) {
+    DWORD wait = (DWORD)(ms < FOSSIL_TOFU_MAX_WAIT_MS ? ms : FOSSIL_TOFU_MAX_WAIT_MS);
+    if (SleepConditionVariableSRW(cond, mutex, wait, 0)) {
+        return true;
+    }
+    return GetLastError() != ERROR_TIMEOUT;
+}
+
+void fossil_tofu_cond_signal(fossil_tofu_cond_t* cond) {
+    WakeConditionVariable(cond);
+}
+
+void fossil_tofu_cond_broadcast(fossil_tofu_cond_t* cond) {
+    WakeAllConditionVariable(cond);
+}
+
+#elif defined(FOSSIL_TOFU_THREADS_POSIX)
+
+int32_t fossil_tofu_thread_create(fossil_tofu_thread_t* thread, fossil_tofu_thread_fn routine, void* arg) {
+    return pthread_create(thread, NULL, routine, arg) == 0 ? FOSSIL_TOFU_SUCCESS : FOSSIL_TOFU_FAILURE;
+}
+
+void fossil_tofu_thread_join(fossil_tofu_thread_t thread) {
+    pthread_join(thread, NULL);
+}
+
+void fossil_tofu_thread_detach(fossil_tofu_thread_t thread) {
+    pthread_detach(thread);
+}
+
+void fossil_tofu_thread_yield(void) {
+    sched_yield();
+}
+
+size_t fossil_tofu_cpu_count(void) {
+#if defined(_SC_NPROCESSORS_ONLN)
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (size_t)n : 1;
+#else
+    return 1;
+#endif
+}
+
+uint64_t fossil_tofu_clock_ms(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000u + (uint64_t)now.tv_nsec / 1000000u;
+}
+
+void fossil_tofu_call_once(fossil_tofu_once_t* once, void (*fn)(void)) {
+    pthread_once(once, fn);
+}
+
+int32_t fossil_tofu_mutex_init(fossil_tofu_mutex_t* mutex) {
+    return pthread_mutex_init(mutex, NULL) == 0 ? FOSSIL_TOFU_SUCCESS : FOSSIL_TOFU_FAILURE;
+}
+
+void fossil_tofu_mutex_destroy(fossil_tofu_mutex_t* mutex) {
+    pthread_mutex_destroy(mutex);
+}
+
+void fossil_tofu_mutex_lock(fossil_tofu_mutex_t* mutex) {
+    pthread_mutex_lock(mutex);
+}
+
+void fossil_tofu_mutex_unlock(fossil_tofu_mutex_t* mutex) {
+    pthread_mutex_unlock(mutex);
+}
+
+int32_t fossil_tofu_rwlock_init(fossil_tofu_rwlock_t* lock) {
+    return pthread_rwlock_init(lock, NULL) == 0 ? FOSSIL_TOFU_SUCCESS : FOSSIL_TOFU_FAILURE;
+}
+
+void fossil_tofu_rwlock_destroy(fossil_tofu_rwlock_t* lock) {
+    pthread_rwlock_destroy(lock);
+}
+
+void fossil_tofu_rwlock_read_lock(fossil_tofu_rwlock_t* lock) {
+    pthread_rwlock_rdlock(lock);
+}
+
+void fossil_tofu_rwlock_read_unlock(fossil_tofu_rwlock_t* lock) {
+    pthread_rwlock_unlock(lock);
+}
+
+void fossil_tofu_rwlock_write_lock(fossil_tofu_rwlock_t* lock) {
+    pthread_rwlock_wrlock(lock);
+}
+
+void fossil_tofu_rwlock_write_unlock(fossil_tofu_rwlock_t* lock) {
+    pthread_rwlock_unlock(lock);
+}
+
+int32_t fossil_tofu_cond_init(fossil_tofu_cond_t* cond) {
+#if defined(__APPLE__)
+    // No pthread_condattr_setclock; timed waits use a relative timeout instead.
+    return pthread_cond_init(cond, NULL) == 0 ? FOSSIL_TOFU_SUCCESS : FOSSIL_TOFU_FAILURE;
+#else
+    pthread_condattr_t attr;
+    if (pthread_condattr_init(&attr) != 0) {
+        return FOSSIL_TOFU_FAILURE;
+    }
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    int rc = pthread_cond_init(cond, &attr);
+    pthread_condattr_destroy(&attr);
+    return rc == 0 ? FOSSIL_TOFU_SUCCESS : FOSSIL_TOFU_FAILURE;
+#endif
+}
+
+void fossil_tofu_cond_destroy(fossil_tofu_cond_t* cond) {
+    pthread_cond_destroy(cond);
+}
+
+void fossil_tofu_cond_wait(fossil_tofu_cond_t* cond, fossil_tofu_mutex_t* mutex) {
+    pthread_cond_wait(cond, mutex);
+}
+
+bool fossil_tofu_cond_wait_ms(fossil_tofu_cond_t* cond, fossil_tofu_mutex_t* mutex, uint64_t ms) {
+    if (ms > FOSSIL_TOFU_MAX_WAIT_MS) {
+        ms = FOSSIL_TOFU_MAX_WAIT_MS;
+    }
+#if defined(__APPLE__)
+    struct timespec wait = { (time_t)(ms / 1000u), (long)(ms % 1000u) * 1000000L };
+    return pthread_cond_timedwait_relative_np(cond, mutex, &wait) != ETIMEDOUT;
+#else
+    struct timespec deadline;
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    deadline.tv_sec += (time_t)(ms / 1000u);
+    deadline.tv_nsec += (long)(ms % 1000u) * 1000000L;
+    if (deadline.tv_nsec >= 1000000000L) {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000L;
+    }
+    return pthread_cond_timedwait(cond, mutex, &deadline) != ETIMEDOUT;
+#endif
+}
+
+void fossil_tofu_cond_signal(fossil_tofu_cond_t* cond) {
+    pthread_cond_signal(cond);
+}
+
+void fossil_tofu_cond_broadcast(fossil_tofu_cond_t* cond) {
+    pthread_cond_broadcast(cond);
+}
+
+#else
+
+// No threads: a single thread owns every lock, so locking is a no-op and a
+// timed wait can only time out.
+
+int32_t fossil_tofu_thread_create(fossil_tofu_thread_t* thread, fossil_tofu_thread_fn routine, void* arg) {
+    (void)thread;
+    (void)routine;
+    (void)arg;
+    return FOSSIL_TOFU_FAILURE;
+}
+
+void fossil_tofu_thread_join(fossil_tofu_thread_t thread) { (void)thread; }
+void fossil_tofu_thread_detach(fossil_tofu_thread_t thread) { (void)thread; }
+void fossil_tofu_thread_yield(void) {}
+size_t fossil_tofu_cpu_count(void) { return 1; }
+
+uint64_t fossil_tofu_clock_ms(void) {
+    return (uint64_t)clock() * 1000u / CLOCKS_PER_SEC;
+}
+
+void fossil_tofu_call_once(fossil_tofu_once_t* once, void (*fn)(void)) {
+    if (*once == 0) {
+        *once = 1;
+        fn();
+    }
+}
+
+int32_t fossil_tofu_mutex_init(fossil_tofu_mutex_t* mutex) { (void)mutex; return FOSSIL_TOFU_SUCCESS; }
+void fossil_tofu_mutex_destroy(fossil_tofu_mutex_t* mutex) { (void)mutex; }
+void fossil_tofu_mutex_lock(fossil_tofu_mutex_t* mutex) { (void)mutex; }
+void fossil_tofu_mutex_unlock(fossil_tofu_mutex_t* mutex) { (void)mutex; }
+
+int32_t fossil_tofu_rwlock_init(fossil_tofu_rwlock_t* lock) { (void)lock; return FOSSIL_TOFU_SUCCESS; }
+void fossil_tofu_rwlock_destroy(fossil_tofu_rwlock_t* lock) { (void)lock; }
+void fossil_tofu_rwlock_read_lock(fossil_tofu_rwlock_t* lock) { (void)lock; }
+void fossil_tofu_rwlock_read_unlock(fossil_tofu_rwlock_t* lock) { (void)lock; }
+void fossil_tofu_rwlock_write_lock(fossil_tofu_rwlock_t* lock) { (void)lock; }
+void fossil_tofu_rwlock_write_unlock(fossil_tofu_rwlock_t* lock) { (void)lock; }
+
+int32_t fossil_tofu_cond_init(fossil_tofu_cond_t* cond) { (void)cond; return FOSSIL_TOFU_SUCCESS; }
+void fossil_tofu_cond_destroy(fossil_tofu_cond_t* cond) { (void)cond; }
+void fossil_tofu_cond_wait(fossil_tofu_cond_t* cond, fossil_tofu_mutex_t* mutex) { (void)cond; (void)mutex; }
+
+bool fossil_tofu_cond_wait_ms(fossil_tofu_cond_t* cond, fossil_tofu_mutex_t* mutex, uint64_t ms) {
+    (void)cond;
+    (void)mutex;
+    (void)ms;
+    return false;
+}
+
+void fossil_tofu_cond_signal(fossil_tofu_cond_t* cond) { (void)cond; }
+void fossil_tofu_cond_broadcast(fossil_tofu_cond_t* cond) { (void)cond; }
+
+#endif
+
+// *****************************************************************************
+// Worker pool
+// *****************************************************************************
+
+#define FOSSIL_TOFU_POOL_MAX_WORKERS 63
+
+// One fossil_tofu_pool_run call. Lives on the caller's stack; the caller
+// waits for 'pending' to reach zero before returning.
+typedef struct fossil_tofu_pool_batch_t {
+    fossil_tofu_pool_fn fn;
+    char* items;
+    size_t stride;
+    size_t count;
+    size_t next;     // First item nobody has claimed yet
+    size_t pending;  // Items not finished yet
+    fossil_tofu_cond_t done;
+    struct fossil_tofu_pool_batch_t* link;
+} fossil_tofu_pool_batch_t;
+
+static struct {
+    fossil_tofu_mutex_t lock;
+    fossil_tofu_cond_t work;
+    fossil_tofu_pool_batch_t* batches; // Batches with unclaimed items, newest first
+    size_t workers;
+} fossil_tofu_pool;
+
+static fossil_tofu_once_t fossil_tofu_pool_once = FOSSIL_TOFU_ONCE_INIT;
+
+// Claims the next item of a batch; called with the pool lock held. A batch
+// leaves the list as soon as its last item is claimed.
+static void* fossil_tofu_pool_claim(fossil_tofu_pool_batch_t* batch) {
+    void* item = batch->items + batch->next * batch->stride;
+    if (++batch->next == batch->count) {
+        fossil_tofu_pool_batch_t** link = &fossil_tofu_pool.batches;
+        while (*link != batch) {
+            link = &(*link)->link;
+        }
+        *link = batch->link;
+    }
+    return item;
+}
+
+// Records a finished item; called with the pool lock held.
+static void fossil_tofu_pool_finish(fossil_tofu_pool_batch_t* batch) {
+    if (--batch->pending == 0) {
+        fossil_tofu_cond_signal(&batch->done);
+    }
+}
+
+static void* fossil_tofu_pool_worker(void* arg) {
+    (void)arg;
+    fossil_tofu_mutex_lock(&fossil_tofu_pool.lock);
+    for (;;) {
+        while (fossil_tofu_pool.batches == NULL) {
+            fossil_tofu_cond_wait(&fossil_tofu_pool.work, &fossil_tofu_pool.lock);
+        }
+        fossil_tofu_pool_batch_t* batch = fossil_tofu_pool.batches;
+        void* item = fossil_tofu_pool_claim(batch);
+        fossil_tofu_mutex_unlock(&fossil_tofu_pool.lock);
+        batch->fn(item);
+        fossil_tofu_mutex_lock(&fossil_tofu_pool.lock);
+        fossil_tofu_pool_finish(batch);
+    }
+    return NULL;
+}
+
+static void fossil_tofu_pool_start(void) {
+    if (fossil_tofu_mutex_init(&fossil_tofu_pool.lock) != FOSSIL_TOFU_SUCCESS) {
+        return;
+    }
+    if (fossil_tofu_cond_init(&fossil_tofu_pool.work) != FOSSIL_TOFU_SUCCESS) {
+        fossil_tofu_mutex_destroy(&fossil_tofu_pool.lock);
+        return;
+    }
+    size_t wanted = fossil_tofu_cpu_count() - 1;
+    if (wanted > FOSSIL_TOFU_POOL_MAX_WORKERS) {
+        wanted = FOSSIL_TOFU_POOL_MAX_WORKERS;
+    }
+    // Workers run for the life of the process.
+    size_t started = 0;
+    for (size_t i = 0; i < wanted; i++) {
+        fossil_tofu_thread_t thread;
+        if (fossil_tofu_thread_create(&thread, fossil_tofu_pool_worker, NULL) != FOSSIL_TOFU_SUCCESS) {
+            break;
+        }
+        fossil_tofu_thread_detach(thread);
+        started++;
+    }
+    fossil_tofu_pool.workers = started;
+}
+
+void fossil_tofu_pool_run(fossil_tofu_pool_fn fn, void* items, size_t stride, size_t count) {
+    if (fn == NULL || count == 0) {
+        return;
+    }
+    if (count > 1) {
+        fossil_tofu_call_once(&fossil_tofu_pool_once, fossil_tofu_pool_start);
+    }
+    fossil_tofu_pool_batch_t batch;
+    batch.fn = fn;
+    batch.items = (char*)items;
+    batch.stride = stride;
+    batch.count = count;
+    batch.next = 0;
+    batch.pending = count;
+    batch.link = NULL;
+    if (count == 1 || fossil_tofu_pool.workers == 0 || fossil_tofu_cond_init(&batch.done) != FOSSIL_TOFU_SUCCESS) {
+        for (size_t i = 0; i < count; i++) {
+            fn(batch.items + i * stride);
+        }
+        return;
+    }
+
+    fossil_tofu_mutex_lock(&fossil_tofu_pool.lock);
+    batch.link = fossil_tofu_pool.batches;
+    fossil_tofu_pool.batches = &batch;
+    fossil_tofu_cond_broadcast(&fossil_tofu_pool.work);
+    // Work through our own items alongside the pool, then wait for the
+    // items other threads claimed.
+    while (batch.next < batch.count) {
+        void* item = fossil_tofu_pool_claim(&batch);
+        fossil_tofu_mutex_unlock(&fossil_tofu_pool.lock);
+        fn(item);
+        fossil_tofu_mutex_lock(&fossil_tofu_pool.lock);
+        fossil_tofu_pool_finish(&batch);
+    }
+    while (batch.pending > 0) {
+        fossil_tofu_cond_wait(&batch.done, &fossil_tofu_pool.lock);
+    }
+    fossil_tofu_mutex_unlock(&fossil_tofu_pool.lock);
+    fossil_tofu_cond_destroy(&batch.done);
+}
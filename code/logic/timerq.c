@@ -0,0 +1,528 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include "fossil/tofu/timerq.h"
+
+#define FOSSIL_TOFU_TIMERQ_NONE UINT32_MAX
+#define FOSSIL_TOFU_TIMERQ_SLOT_MASK (FOSSIL_TOFU_TIMERQ_SLOTS - 1)
+#define FOSSIL_TOFU_TIMERQ_DUE (FOSSIL_TOFU_TIMERQ_BUCKETS - 1)
+#define FOSSIL_TOFU_TIMERQ_SPAN_BITS (FOSSIL_TOFU_TIMERQ_SLOT_BITS * FOSSIL_TOFU_TIMERQ_LEVELS)
+
+// *****************************************************************************
+// Node pool and handles
+// *****************************************************************************
+
+static uint32_t fossil_tofu_timerq_acquire(fossil_tofu_timerq_t* timerq) {
+    uint32_t index = timerq->free_node;
+    if (index != FOSSIL_TOFU_TIMERQ_NONE) {
+        timerq->free_node = timerq->nodes[index].next;
+        return index;
+    }
+    if (timerq->node_count >= FOSSIL_TOFU_TIMERQ_NONE) return FOSSIL_TOFU_TIMERQ_NONE;
+    if (timerq->node_count == timerq->node_capacity) {
+        size_t capacity = timerq->node_capacity ? timerq->node_capacity * 2 : 16;
+        fossil_tofu_timerq_node_t* nodes = (fossil_tofu_timerq_node_t*)fossil_tofu_realloc(timerq->nodes, capacity * sizeof(fossil_tofu_timerq_node_t));
+        if (!nodes) return FOSSIL_TOFU_TIMERQ_NONE;
+        timerq->nodes = nodes;
+        timerq->node_capacity = capacity;
+    }
+    index = (uint32_t)timerq->node_count++;
+    timerq->nodes[index].generation = 0;
+    return index;
+}
+
+static void fossil_tofu_timerq_release(fossil_tofu_timerq_t* timerq, uint32_t index) {
+    fossil_tofu_timerq_node_t* node = &timerq->nodes[index];
+    fossil_tofu_destroy(&node->data);
+    node->live = false;
+    node->generation++;
+    node->next = timerq->free_node;
+    timerq->free_node = index;
+}
+
+static inline fossil_tofu_timerq_handle_t fossil_tofu_timerq_handle(const fossil_tofu_timerq_t* timerq, uint32_t index) {
+    return ((uint64_t)timerq->nodes[index].generation << 32) | index;
+}
+
+// Node index a handle refers to, or NONE if the timer is no longer pending.
+static uint32_t fossil_tofu_timerq_resolve(const fossil_tofu_timerq_t* timerq, fossil_tofu_timerq_handle_t handle) {
+    uint32_t index = (uint32_t)(handle & UINT32_MAX);
+    if (!timerq || index >= timerq->node_count) return FOSSIL_TOFU_TIMERQ_NONE;
+    const fossil_tofu_timerq_node_t* node = &timerq->nodes[index];
+    if (!node->live || node->generation != (uint32_t)(handle >> 32)) return FOSSIL_TOFU_TIMERQ_NONE;
+    return index;
+}
+
+// *****************************************************************************
+// Buckets
+// *****************************************************************************
+
+static inline void fossil_tofu_timerq_mark(fossil_tofu_timerq_t* timerq, uint32_t bucket, bool set) {
+    if (bucket == FOSSIL_TOFU_TIMERQ_DUE) return;
+    uint32_t level = bucket >> FOSSIL_TOFU_TIMERQ_SLOT_BITS;
+    uint32_t slot = bucket & FOSSIL_TOFU_TIMERQ_SLOT_MASK;
+    uint64_t bit = 1ULL << (slot & 63);
+    if (set) timerq->occupied[level][slot >> 6] |= bit;
+    else timerq->occupied[level][slot >> 6] &= ~bit;
+}
+
+static void fossil_tofu_timerq_link(fossil_tofu_timerq_t* timerq, uint32_t index, uint32_t bucket) {
+    fossil_tofu_timerq_node_t* node = &timerq->nodes[index];
+    node->bucket = bucket;
+    node->next = FOSSIL_TOFU_TIMERQ_NONE;
+    node->prev = timerq->tails[bucket];
+    if (node->prev == FOSSIL_TOFU_TIMERQ_NONE) {
+        timerq->heads[bucket] = index;
+        fossil_tofu_timerq_mark(timerq, bucket, true);
+    } else {
+        timerq->nodes[node->prev].next = index;
+    }
+    timerq->tails[bucket] = index;
+}
+
+static void fossil_tofu_timerq_unlink(fossil_tofu_timerq_t* timerq, uint32_t index) {
+    fossil_tofu_timerq_node_t* node = &timerq->nodes[index];
+    if (node->prev == FOSSIL_TOFU_TIMERQ_NONE) timerq->heads[node->bucket] = node->next;
+    else timerq->nodes[node->prev].next = node->next;
+    if (node->next == FOSSIL_TOFU_TIMERQ_NONE) timerq->tails[node->bucket] = node->prev;
+    else timerq->nodes[node->next].prev = node->prev;
+    if (timerq->heads[node->bucket] == FOSSIL_TOFU_TIMERQ_NONE) fossil_tofu_timerq_mark(timerq, node->bucket, false);
+}
+
+// File a timer in the lowest level whose span covers its distance from now.
+// At level L the slot is bits [8L, 8L+8) of the expiry; with the distance
+// below 2^(8L+8) that slot comes round exactly when the expiry's 2^(8L)
+// block begins. Timers past the top level's span wait in the top slot that
+// comes round last and are filed again from there.
+static void fossil_tofu_timerq_place(fossil_tofu_timerq_t* timerq, uint32_t index) {
+    uint64_t expiry = timerq->nodes[index].expiry;
+    if (expiry <= timerq->now) {
+        fossil_tofu_timerq_link(timerq, index, FOSSIL_TOFU_TIMERQ_DUE);
+        return;
+    }
+    uint64_t delta = expiry - timerq->now;
+    for (uint32_t level = 0; level < FOSSIL_TOFU_TIMERQ_LEVELS; level++) {
+        uint32_t shift = level * FOSSIL_TOFU_TIMERQ_SLOT_BITS;
+        if (level + 1 == FOSSIL_TOFU_TIMERQ_LEVELS || (delta >> (shift + FOSSIL_TOFU_TIMERQ_SLOT_BITS)) == 0) {
+            uint64_t at = (delta >> FOSSIL_TOFU_TIMERQ_SPAN_BITS) ? timerq->now : expiry;
+            uint32_t slot = (uint32_t)(at >> shift) & FOSSIL_TOFU_TIMERQ_SLOT_MASK;
+            fossil_tofu_timerq_link(timerq, index, (level << FOSSIL_TOFU_TIMERQ_SLOT_BITS) | slot);
+            return;
+        }
+    }
+}
+
+// Lowest set slot at or after `from` in a level's occupancy bitmap, or
+// FOSSIL_TOFU_TIMERQ_SLOTS if there is none.
+static uint32_t fossil_tofu_timerq_scan(const uint64_t* bits, uint32_t from) {
+    for (uint32_t word = from >> 6; word < FOSSIL_TOFU_TIMERQ_SLOTS / 64; word++) {
+        uint64_t w = bits[word];
+        if (word == from >> 6) w &= ~0ULL << (from & 63);
+        if (!w) continue;
+#if defined(__GNUC__) || defined(__clang__)
+        return word * 64 + (uint32_t)__builtin_ctzll(w);
+#else
+        uint32_t bit = 0;
+        while (!(w & 1)) { w >>= 1; bit++; }
+        return word * 64 + bit;
+#endif
+    }
+    return FOSSIL_TOFU_TIMERQ_SLOTS;
+}
+
+// Time at which the wheel next has to visit a non-empty slot.
+static bool fossil_tofu_timerq_next_event(const fossil_tofu_timerq_t* timerq, uint64_t* when) {
+    bool found = false;
+    for (uint32_t level = 0; level < FOSSIL_TOFU_TIMERQ_LEVELS; level++) {
+        uint32_t shift = level * FOSSIL_TOFU_TIMERQ_SLOT_BITS;
+        uint64_t block = timerq->now >> shift;
+        uint32_t current = (uint32_t)block & FOSSIL_TOFU_TIMERQ_SLOT_MASK;
+        // The current slot was already visited, so it comes round last.
+        uint32_t slot = fossil_tofu_timerq_scan(timerq->occupied[level], current + 1);
+        uint64_t distance;
+        if (slot < FOSSIL_TOFU_TIMERQ_SLOTS) {
+            distance = slot - current;
+        } else {
+            slot = fossil_tofu_timerq_scan(timerq->occupied[level], 0);
+            if (slot > current) continue;
+            distance = FOSSIL_TOFU_TIMERQ_SLOTS - current + slot;
+        }
+        uint64_t at = (block + distance) << shift;
+        if (!found || at < *when) *when = at;
+        found = true;
+    }
+    return found;
+}
+
+// Re-file every timer in a higher-level slot into the levels below.
+static void fossil_tofu_timerq_cascade(fossil_tofu_timerq_t* timerq, uint32_t bucket) {
+    uint32_t index = timerq->heads[bucket];
+    timerq->heads[bucket] = FOSSIL_TOFU_TIMERQ_NONE;
+    timerq->tails[bucket] = FOSSIL_TOFU_TIMERQ_NONE;
+    fossil_tofu_timerq_mark(timerq, bucket, false);
+    while (index != FOSSIL_TOFU_TIMERQ_NONE) {
+        uint32_t next = timerq->nodes[index].next;
+        fossil_tofu_timerq_place(timerq, index);
+        index = next;
+    }
+}
+
+// Move the due list to the front of a level-0 slot. The slot for the
+// current time is always empty, so firing it never reaches timers that the
+// callbacks schedule into the due list meanwhile.
+static void fossil_tofu_timerq_splice_due(fossil_tofu_timerq_t* timerq, uint32_t bucket) {
+    uint32_t head = timerq->heads[FOSSIL_TOFU_TIMERQ_DUE];
+    uint32_t tail = timerq->tails[FOSSIL_TOFU_TIMERQ_DUE];
+    if (head == FOSSIL_TOFU_TIMERQ_NONE) return;
+    for (uint32_t index = head; index != FOSSIL_TOFU_TIMERQ_NONE; index = timerq->nodes[index].next) {
+        timerq->nodes[index].bucket = bucket;
+    }
+    timerq->nodes[tail].next = timerq->heads[bucket];
+    if (timerq->heads[bucket] == FOSSIL_TOFU_TIMERQ_NONE) timerq->tails[bucket] = tail;
+    else timerq->nodes[timerq->heads[bucket]].prev = tail;
+    timerq->heads[bucket] = head;
+    fossil_tofu_timerq_mark(timerq, bucket, true);
+    timerq->heads[FOSSIL_TOFU_TIMERQ_DUE] = FOSSIL_TOFU_TIMERQ_NONE;
+    timerq->tails[FOSSIL_TOFU_TIMERQ_DUE] = FOSSIL_TOFU_TIMERQ_NONE;
+}
+
+// Fire a bucket front to back. Timers are taken one at a time so a callback
+// may cancel the ones still queued behind it.
+static size_t fossil_tofu_timerq_fire(fossil_tofu_timerq_t* timerq, uint32_t bucket, fossil_tofu_timerq_fire_fn fire, void* context) {
+    size_t fired = 0;
+    uint32_t index;
+    while ((index = timerq->heads[bucket]) != FOSSIL_TOFU_TIMERQ_NONE) {
+        fossil_tofu_timerq_handle_t handle = fossil_tofu_timerq_handle(timerq, index);
+        fossil_tofu_timerq_unlink(timerq, index);
+        timerq->nodes[index].live = false;
+        timerq->size--;
+        // The callback may schedule and grow the pool, so hand it a copy.
+        fossil_tofu_t payload = timerq->nodes[index].data;
+        if (fire) fire(handle, &payload, context);
+        timerq->nodes[index].data = payload;
+        fossil_tofu_timerq_release(timerq, index);
+        fired++;
+    }
+    return fired;
+}
+
+// *****************************************************************************
+// Time parsing
+// *****************************************************************************
+
+// Days between 1970-01-01 and the given proleptic Gregorian date.
+static int64_t fossil_tofu_timerq_days_from_civil(int64_t y, unsigned m, unsigned d) {
+    y -= m <= 2;
+    int64_t era = (y >= 0 ? y : y - 399) / 400;
+    unsigned yoe = (unsigned)(y - era * 400);
+    unsigned doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + (int64_t)doe - 719468;
+}
+
+static bool fossil_tofu_timerq_digits(const char** text, size_t count, unsigned* value) {
+    *value = 0;
+    for (size_t i = 0; i < count; i++) {
+        char c = (*text)[i];
+        if (c < '0' || c > '9') return false;
+        *value = *value * 10 + (unsigned)(c - '0');
+    }
+    *text += count;
+    return true;
+}
+
+int32_t fossil_tofu_timerq_parse_datetime(const char* text, uint64_t* ms) {
+    if (!text || !ms) return FOSSIL_TOFU_ERROR_NULL_POINTER;
+    unsigned year, month, day, hour = 0, minute = 0, second = 0, millis = 0;
+    const char* p = text;
+    if (!fossil_tofu_timerq_digits(&p, 4, &year) || *p++ != '-' ||
+        !fossil_tofu_timerq_digits(&p, 2, &month) || *p++ != '-' ||
+        !fossil_tofu_timerq_digits(&p, 2, &day)) return FOSSIL_TOFU_ERROR_PARSE;
+    if (month < 1 || month > 12 || day < 1 || day > 31) return FOSSIL_TOFU_ERROR_PARSE;
+    int64_t offset = 0;
+    if (*p == 'T' || *p == ' ') {
+        p++;
+        if (!fossil_tofu_timerq_digits(&p, 2, &hour) || *p++ != ':' ||
+            !fossil_tofu_timerq_digits(&p, 2, &minute)) return FOSSIL_TOFU_ERROR_PARSE;
+        if (*p == ':') {
+            p++;
+            if (!fossil_tofu_timerq_digits(&p, 2, &second)) return FOSSIL_TOFU_ERROR_PARSE;
+            if (*p == '.' || *p == ',') {
+                p++;
+                unsigned scale = 100;
+                if (*p < '0' || *p > '9') return FOSSIL_TOFU_ERROR_PARSE;
+                for (; *p >= '0' && *p <= '9'; p++) {
+                    millis += (unsigned)(*p - '0') * scale;
+                    scale /= 10;
+                }
+            }
+        }
+        if (hour > 23 || minute > 59 || second > 60) return FOSSIL_TOFU_ERROR_PARSE;
+        if (*p == 'Z') {
+            p++;
+        } else if (*p == '+' || *p == '-') {
+            int sign = *p++ == '-' ? -1 : 1;
+            unsigned oh, om = 0;
+            if (!fossil_tofu_timerq_digits(&p, 2, &oh)) return FOSSIL_TOFU_ERROR_PARSE;
+            if (*p == ':') p++;
+            if (*p && !fossil_tofu_timerq_digits(&p, 2, &om)) return FOSSIL_TOFU_ERROR_PARSE;
+            offset = sign * (int64_t)(oh * 3600 + om * 60);
+        }
+    }
+    if (*p) return FOSSIL_TOFU_ERROR_PARSE;
+    int64_t seconds = fossil_tofu_timerq_days_from_civil(year, month, day) * 86400 +
+                      hour * 3600 + minute * 60 + second - offset;
+    if (seconds < 0) return FOSSIL_TOFU_ERROR_PARSE;
+    *ms = (uint64_t)seconds * 1000 + millis;
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+int32_t fossil_tofu_timerq_parse_duration(const char* text, uint64_t* ms) {
+    if (!text || !ms) return FOSSIL_TOFU_ERROR_NULL_POINTER;
+    const char* p = text;
+    uint64_t total = 0;
+    if (!*p) return FOSSIL_TOFU_ERROR_PARSE;
+    while (*p) {
+        if (*p < '0' || *p > '9') return FOSSIL_TOFU_ERROR_PARSE;
+        uint64_t value = 0;
+        for (; *p >= '0' && *p <= '9'; p++) {
+            if (value > (UINT64_MAX - 9) / 10) return FOSSIL_TOFU_ERROR_OVERFLOW;
+            value = value * 10 + (uint64_t)(*p - '0');
+        }
+        uint64_t unit;
+        if (p[0] == 'm' && p[1] == 's') { unit = 1; p += 2; }
+        else if (*p == 's') { unit = 1000; p++; }
+        else if (*p == 'm') { unit = 60000; p++; }
+        else if (*p == 'h') { unit = 3600000; p++; }
+        else if (*p == 'd') { unit = 86400000; p++; }
+        else if (*p == 'w') { unit = 604800000; p++; }
+        else return FOSSIL_TOFU_ERROR_PARSE;
+        if (value > (UINT64_MAX - total) / unit) return FOSSIL_TOFU_ERROR_OVERFLOW;
+        total += value * unit;
+    }
+    *ms = total;
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+// *****************************************************************************
+// Function definitions
+// *****************************************************************************
+
+fossil_tofu_timerq_t* fossil_tofu_timerq_create_container(char* type) {
+    if (fossil_tofu_validate_type(type) == FOSSIL_TOFU_TYPE_CNULL) return NULL;
+    fossil_tofu_timerq_t* timerq = (fossil_tofu_timerq_t*)fossil_tofu_alloc(sizeof(fossil_tofu_timerq_t));
+    if (!timerq) return NULL;
+    memset(timerq, 0, sizeof(*timerq));
+    memset(timerq->heads, 0xFF, sizeof(timerq->heads));
+    memset(timerq->tails, 0xFF, sizeof(timerq->tails));
+    timerq->free_node = FOSSIL_TOFU_TIMERQ_NONE;
+    timerq->type = type;
+    return timerq;
+}
+
+fossil_tofu_timerq_t* fossil_tofu_timerq_create_default(void) {
+    return fossil_tofu_timerq_create_container("any");
+}
+
+fossil_tofu_timerq_t* fossil_tofu_timerq_create_copy(const fossil_tofu_timerq_t* other) {
+    if (!other) return NULL;
+    fossil_tofu_timerq_t* timerq = (fossil_tofu_timerq_t*)fossil_tofu_alloc(sizeof(fossil_tofu_timerq_t));
+    if (!timerq) return NULL;
+    *timerq = *other;
+    timerq->nodes = NULL;
+    if (other->node_count) {
+        timerq->nodes = (fossil_tofu_timerq_node_t*)fossil_tofu_alloc(other->node_count * sizeof(fossil_tofu_timerq_node_t));
+        if (!timerq->nodes) {
+            fossil_tofu_free(timerq);
+            return NULL;
+        }
+        memcpy(timerq->nodes, other->nodes, other->node_count * sizeof(fossil_tofu_timerq_node_t));
+    }
+    timerq->node_capacity = other->node_count;
+    // Released nodes hold no payload; destroy on release leaves them empty.
+    for (size_t i = 0; i < timerq->node_count; i++) {
+        if (timerq->nodes[i].live) {
+            timerq->nodes[i].data = fossil_tofu_create(timerq->type, other->nodes[i].data.value.data);
+        }
+    }
+    return timerq;
+}
+
+fossil_tofu_timerq_t* fossil_tofu_timerq_create_move(fossil_tofu_timerq_t* other) {
+    if (!other) return NULL;
+    fossil_tofu_timerq_t* timerq = (fossil_tofu_timerq_t*)fossil_tofu_alloc(sizeof(fossil_tofu_timerq_t));
+    if (!timerq) return NULL;
+    *timerq = *other;
+    uint64_t now = other->now;
+    char* type = other->type;
+    memset(other, 0, sizeof(*other));
+    memset(other->heads, 0xFF, sizeof(other->heads));
+    memset(other->tails, 0xFF, sizeof(other->tails));
+    other->free_node = FOSSIL_TOFU_TIMERQ_NONE;
+    other->now = now;
+    other->type = type;
+    return timerq;
+}
+
+void fossil_tofu_timerq_destroy(fossil_tofu_timerq_t* timerq) {
+    if (!timerq) return;
+    for (size_t i = 0; i < timerq->node_count; i++) {
+        if (timerq->nodes[i].live) fossil_tofu_destroy(&timerq->nodes[i].data);
+    }
+    fossil_tofu_free(timerq->nodes);
+    fossil_tofu_free(timerq);
+}
+
+// *****************************************************************************
+// Scheduling
+// *****************************************************************************
+
+int32_t fossil_tofu_timerq_schedule_at_ms(fossil_tofu_timerq_t* timerq, char* data, uint64_t expiry, fossil_tofu_timerq_handle_t* handle) {
+    if (!timerq) return FOSSIL_TOFU_ERROR_NULL_POINTER;
+    uint32_t index = fossil_tofu_timerq_acquire(timerq);
+    if (index == FOSSIL_TOFU_TIMERQ_NONE) return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+    fossil_tofu_timerq_node_t* node = &timerq->nodes[index];
+    node->data = fossil_tofu_create(timerq->type, data);
+    node->expiry = expiry;
+    node->live = true;
+    fossil_tofu_timerq_place(timerq, index);
+    timerq->size++;
+    if (handle) *handle = fossil_tofu_timerq_handle(timerq, index);
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+int32_t fossil_tofu_timerq_schedule_at(fossil_tofu_timerq_t* timerq, char* data, const char* datetime, fossil_tofu_timerq_handle_t* handle) {
+    uint64_t expiry;
+    int32_t result = fossil_tofu_timerq_parse_datetime(datetime, &expiry);
+    if (result != FOSSIL_TOFU_SUCCESS) return result;
+    return fossil_tofu_timerq_schedule_at_ms(timerq, data, expiry, handle);
+}
+
+int32_t fossil_tofu_timerq_schedule_in(fossil_tofu_timerq_t* timerq, char* data, const char* duration, fossil_tofu_timerq_handle_t* handle) {
+    if (!timerq) return FOSSIL_TOFU_ERROR_NULL_POINTER;
+    uint64_t delay;
+    int32_t result = fossil_tofu_timerq_parse_duration(duration, &delay);
+    if (result != FOSSIL_TOFU_SUCCESS) return result;
+    if (delay > UINT64_MAX - timerq->now) return FOSSIL_TOFU_ERROR_OVERFLOW;
+    return fossil_tofu_timerq_schedule_at_ms(timerq, data, timerq->now + delay, handle);
+}
+
+int32_t fossil_tofu_timerq_schedule(fossil_tofu_timerq_t* timerq, char* data, const fossil_tofu_t* when, fossil_tofu_timerq_handle_t* handle) {
+    if (!when) return FOSSIL_TOFU_ERROR_NULL_POINTER;
+    switch (fossil_tofu_get_type(when)) {
+        case FOSSIL_TOFU_TYPE_DATETIME:
+            return fossil_tofu_timerq_schedule_at(timerq, data, fossil_tofu_as_datetime(when), handle);
+        case FOSSIL_TOFU_TYPE_DURATION:
+            return fossil_tofu_timerq_schedule_in(timerq, data, fossil_tofu_as_duration(when), handle);
+        default:
+            return FOSSIL_TOFU_ERROR_TYPE_MISMATCH;
+    }
+}
+
+int32_t fossil_tofu_timerq_cancel(fossil_tofu_timerq_t* timerq, fossil_tofu_timerq_handle_t handle) {
+    uint32_t index = fossil_tofu_timerq_resolve(timerq, handle);
+    if (index == FOSSIL_TOFU_TIMERQ_NONE) return FOSSIL_TOFU_ERROR_NOT_FOUND;
+    fossil_tofu_timerq_unlink(timerq, index);
+    fossil_tofu_timerq_release(timerq, index);
+    timerq->size--;
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+size_t fossil_tofu_timerq_advance(fossil_tofu_timerq_t* timerq, uint64_t now, fossil_tofu_timerq_fire_fn fire, void* context) {
+    if (!timerq) return 0;
+    uint32_t bucket = (uint32_t)(timerq->now & FOSSIL_TOFU_TIMERQ_SLOT_MASK);
+    fossil_tofu_timerq_splice_due(timerq, bucket);
+    size_t fired = fossil_tofu_timerq_fire(timerq, bucket, fire, context);
+    while (timerq->now < now) {
+        uint64_t at;
+        if (!fossil_tofu_timerq_next_event(timerq, &at) || at > now) {
+            timerq->now = now;
+            break;
+        }
+        timerq->now = at;
+        // Re-file from the top down so timers land in slots not yet visited.
+        for (uint32_t level = FOSSIL_TOFU_TIMERQ_LEVELS - 1; level > 0; level--) {
+            uint32_t shift = level * FOSSIL_TOFU_TIMERQ_SLOT_BITS;
+            if (at & ((1ULL << shift) - 1)) continue;
+            uint32_t slot = (uint32_t)(at >> shift) & FOSSIL_TOFU_TIMERQ_SLOT_MASK;
+            bucket = (level << FOSSIL_TOFU_TIMERQ_SLOT_BITS) | slot;
+            if (timerq->heads[bucket] != FOSSIL_TOFU_TIMERQ_NONE) fossil_tofu_timerq_cascade(timerq, bucket);
+        }
+        // Timers re-filed at exactly this time went to the due list; they
+        // and anything scheduled late by earlier callbacks fire first.
+        bucket = (uint32_t)(at & FOSSIL_TOFU_TIMERQ_SLOT_MASK);
+        fossil_tofu_timerq_splice_due(timerq, bucket);
+        fired += fossil_tofu_timerq_fire(timerq, bucket, fire, context);
+    }
+    return fired;
+}
+
+// *****************************************************************************
+// Getter functions
+// *****************************************************************************
+
+const fossil_tofu_t* fossil_tofu_timerq_get(const fossil_tofu_timerq_t* timerq, fossil_tofu_timerq_handle_t handle, uint64_t* expiry) {
+    uint32_t index = fossil_tofu_timerq_resolve(timerq, handle);
+    if (index == FOSSIL_TOFU_TIMERQ_NONE) return NULL;
+    if (expiry) *expiry = timerq->nodes[index].expiry;
+    return &timerq->nodes[index].data;
+}
+
+bool fossil_tofu_timerq_contains(const fossil_tofu_timerq_t* timerq, fossil_tofu_timerq_handle_t handle) {
+    return fossil_tofu_timerq_resolve(timerq, handle) != FOSSIL_TOFU_TIMERQ_NONE;
+}
+
+uint64_t fossil_tofu_timerq_now(const fossil_tofu_timerq_t* timerq) {
+    return timerq ? timerq->now : 0;
+}
+
+int32_t fossil_tofu_timerq_next_deadline(const fossil_tofu_timerq_t* timerq, uint64_t* deadline) {
+    if (!timerq || !deadline) return FOSSIL_TOFU_ERROR_NULL_POINTER;
+    if (timerq->size == 0) return FOSSIL_TOFU_ERROR_NOT_FOUND;
+    if (timerq->heads[FOSSIL_TOFU_TIMERQ_DUE] != FOSSIL_TOFU_TIMERQ_NONE) {
+        *deadline = timerq->now;
+        return FOSSIL_TOFU_SUCCESS;
+    }
+    return fossil_tofu_timerq_next_event(timerq, deadline) ? FOSSIL_TOFU_SUCCESS : FOSSIL_TOFU_ERROR_NOT_FOUND;
+}
+
+size_t fossil_tofu_timerq_size(const fossil_tofu_timerq_t* timerq) {
+    return timerq ? timerq->size : 0;
+}
+
+bool fossil_tofu_timerq_is_empty(const fossil_tofu_timerq_t* timerq) {
+    return !timerq || timerq->size == 0;
+}
+
+bool fossil_tofu_timerq_not_empty(const fossil_tofu_timerq_t* timerq) {
+    return timerq && timerq->size > 0;
+}
+
+bool fossil_tofu_timerq_is_cnullptr(const fossil_tofu_timerq_t* timerq) {
+    return timerq == NULL;
+}
+
+bool fossil_tofu_timerq_not_cnullptr(const fossil_tofu_timerq_t* timerq) {
+    return timerq != NULL;
+}
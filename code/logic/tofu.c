@@ -24,6 +24,13 @@
  */
 #include "fossil/tofu/tofu.h"
 
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define FOSSIL_TOFU_SSE2
+#endif
+
 // Lookup table for valid strings corresponding to each tofu type.
 static char *_TOFU_TYPE_ID[] = {
     "i8",
@@ -457,6 +464,7 @@ int fossil_tofu_set_value(fossil_tofu_t *tofu, char *value) {
     fossil_tofu_free(tofu->value.data);
     tofu->value.data = fossil_tofu_strdup(value);
     if (!tofu->value.data) return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+    tofu->value.hash = fossil_tofu_hash64(value);
     return FOSSIL_TOFU_SUCCESS;
 }
 
@@ -953,6 +961,296 @@ fossil_tofu_t fossil_tofu_from_any(void *data, size_t size) {
     return tofu;
 }
 
+// *****************************************************************************
+// Numeric aggregation kernels
+// *****************************************************************************
+
+// Values are reduced in blocks small enough to stay in L1 between the
+// sum/min/max pass and the squared deviation pass.
+#define FOSSIL_TOFU_STATS_BLOCK 256
+
+bool fossil_tofu_type_is_numeric(fossil_tofu_type_t type) {
+    return (type >= FOSSIL_TOFU_TYPE_I8 && type <= FOSSIL_TOFU_TYPE_U64) ||
+           type == FOSSIL_TOFU_TYPE_F32 || type == FOSSIL_TOFU_TYPE_F64 ||
+           type == FOSSIL_TOFU_TYPE_SIZE;
+}
+
+void fossil_tofu_stats_init(fossil_tofu_stats_t *stats) {
+    if (!stats) return;
+    stats->count = 0;
+    stats->sum = 0.0;
+    stats->min = 0.0;
+    stats->max = 0.0;
+    stats->m2 = 0.0;
+}
+
+// Sum, min and max of a non-empty block.
+static void fossil_tofu_stats_reduce(const double *v, size_t n, double *sum, double *min, double *max) {
+    size_t i = 0;
+    double s = 0.0, lo = v[0], hi = v[0];
+#if defined(__AVX__)
+    if (n >= 8) {
+        __m256d s0 = _mm256_setzero_pd(), s1 = _mm256_setzero_pd();
+        __m256d l = _mm256_set1_pd(v[0]), h = l;
+        for (; i + 8 <= n; i += 8) {
+            __m256d a = _mm256_loadu_pd(v + i);
+            __m256d b = _mm256_loadu_pd(v + i + 4);
+            s0 = _mm256_add_pd(s0, a);
+            s1 = _mm256_add_pd(s1, b);
+            l = _mm256_min_pd(l, _mm256_min_pd(a, b));
+            h = _mm256_max_pd(h, _mm256_max_pd(a, b));
+        }
+        double ls[4], ll[4], lh[4];
+        _mm256_storeu_pd(ls, _mm256_add_pd(s0, s1));
+        _mm256_storeu_pd(ll, l);
+        _mm256_storeu_pd(lh, h);
+        for (int k = 0; k < 4; k++) {
+            s += ls[k];
+            if (ll[k] < lo) lo = ll[k];
+            if (lh[k] > hi) hi = lh[k];
+        }
+    }
+#elif defined(FOSSIL_TOFU_SSE2)
+    if (n >= 4) {
+        __m128d s0 = _mm_setzero_pd(), s1 = _mm_setzero_pd();
+        __m128d l = _mm_set1_pd(v[0]), h = l;
+        for (; i + 4 <= n; i += 4) {
+            __m128d a = _mm_loadu_pd(v + i);
+            __m128d b = _mm_loadu_pd(v + i + 2);
+            s0 = _mm_add_pd(s0, a);
+            s1 = _mm_add_pd(s1, b);
+            l = _mm_min_pd(l, _mm_min_pd(a, b));
+            h = _mm_max_pd(h, _mm_max_pd(a, b));
+        }
+        double ls[2], ll[2], lh[2];
+        _mm_storeu_pd(ls, _mm_add_pd(s0, s1));
+        _mm_storeu_pd(ll, l);
+        _mm_storeu_pd(lh, h);
+        for (int k = 0; k < 2; k++) {
+            s += ls[k];
+            if (ll[k] < lo) lo = ll[k];
+            if (lh[k] > hi) hi = lh[k];
+        }
+    }
+#endif
+    for (; i < n; i++) {
+        s += v[i];
+        if (v[i] < lo) lo = v[i];
+        if (v[i] > hi) hi = v[i];
+    }
+    *sum = s;
+    *min = lo;
+    *max = hi;
+}
+
+// Sum of squared deviations of a block from the given mean.
+static double fossil_tofu_stats_deviation(const double *v, size_t n, double mean) {
+    size_t i = 0;
+    double m2 = 0.0;
+#if defined(__AVX__)
+    __m256d mu = _mm256_set1_pd(mean), acc = _mm256_setzero_pd();
+    for (; i + 4 <= n; i += 4) {
+        __m256d d = _mm256_sub_pd(_mm256_loadu_pd(v + i), mu);
+        acc = _mm256_add_pd(acc, _mm256_mul_pd(d, d));
+    }
+    double lanes[4];
+    _mm256_storeu_pd(lanes, acc);
+    m2 = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+#elif defined(FOSSIL_TOFU_SSE2)
+    __m128d mu = _mm_set1_pd(mean), acc = _mm_setzero_pd();
+    for (; i + 2 <= n; i += 2) {
+        __m128d d = _mm_sub_pd(_mm_loadu_pd(v + i), mu);
+        acc = _mm_add_pd(acc, _mm_mul_pd(d, d));
+    }
+    double lanes[2];
+    _mm_storeu_pd(lanes, acc);
+    m2 = lanes[0] + lanes[1];
+#endif
+    for (; i < n; i++) {
+        double d = v[i] - mean;
+        m2 += d * d;
+    }
+    return m2;
+}
+
+void fossil_tofu_stats_add_f64(fossil_tofu_stats_t *stats, const double *values, size_t count) {
+    if (!stats || !values) return;
+    for (size_t off = 0; off < count; off += FOSSIL_TOFU_STATS_BLOCK) {
+        size_t n = count - off < FOSSIL_TOFU_STATS_BLOCK ? count - off : FOSSIL_TOFU_STATS_BLOCK;
+        const double *block = values + off;
+        double sum, min, max;
+        fossil_tofu_stats_reduce(block, n, &sum, &min, &max);
+        double m2 = fossil_tofu_stats_deviation(block, n, sum / (double)n);
+
+        if (stats->count == 0) {
+            stats->count = n;
+            stats->sum = sum;
+            stats->min = min;
+            stats->max = max;
+            stats->m2 = m2;
+            continue;
+        }
+        double na = (double)stats->count, nb = (double)n;
+        double delta = sum / nb - stats->sum / na;
+        stats->m2 += m2 + delta * delta * na * nb / (na + nb);
+        stats->count += n;
+        stats->sum += sum;
+        if (min < stats->min) stats->min = min;
+        if (max > stats->max) stats->max = max;
+    }
+}
+
+// Parses the numeric elements of a tofu array into a block buffer, starting
+// at *cursor. Returns the number of values written.
+static size_t fossil_tofu_gather_f64(const fossil_tofu_t *items, size_t count, size_t *cursor, double *out) {
+    size_t n = 0;
+    while (*cursor < count && n < FOSSIL_TOFU_STATS_BLOCK) {
+        const fossil_tofu_t *item = &items[(*cursor)++];
+        if (!item->value.data || !fossil_tofu_type_is_numeric(item->type)) continue;
+        char *end = NULL;
+        double v = strtod(item->value.data, &end);
+        if (end != item->value.data) out[n++] = v;
+    }
+    return n;
+}
+
+void fossil_tofu_stats_add_tofu(fossil_tofu_stats_t *stats, const fossil_tofu_t *items, size_t count) {
+    if (!stats || !items) return;
+    double block[FOSSIL_TOFU_STATS_BLOCK];
+    size_t cursor = 0;
+    while (cursor < count) {
+        size_t n = fossil_tofu_gather_f64(items, count, &cursor, block);
+        fossil_tofu_stats_add_f64(stats, block, n);
+    }
+}
+
+double fossil_tofu_stats_variance(const fossil_tofu_stats_t *stats) {
+    if (!stats || stats->count == 0) return 0.0;
+    return stats->m2 / (double)stats->count;
+}
+
+size_t fossil_tofu_count_if_f64(const double *values, size_t count, fossil_tofu_predicate_t predicate, void *context) {
+    if (!values || !predicate) return 0;
+    size_t hits = 0;
+    for (size_t i = 0; i < count; i++) {
+        hits += predicate(values[i], context) ? 1 : 0;
+    }
+    return hits;
+}
+
+size_t fossil_tofu_count_if_tofu(const fossil_tofu_t *items, size_t count, fossil_tofu_predicate_t predicate, void *context) {
+    if (!items || !predicate) return 0;
+    double block[FOSSIL_TOFU_STATS_BLOCK];
+    size_t cursor = 0, hits = 0;
+    while (cursor < count) {
+        size_t n = fossil_tofu_gather_f64(items, count, &cursor, block);
+        hits += fossil_tofu_count_if_f64(block, n, predicate, context);
+    }
+    return hits;
+}
+
+// *****************************************************************************
+// Search kernels
+// *****************************************************************************
+
+bool fossil_tofu_equals_text(const fossil_tofu_t *tofu, const char *text, size_t len) {
+    if (!tofu || !tofu->value.data || !text) return false;
+    const char *data = tofu->value.data;
+    for (size_t i = 0; i < len; i++) {
+        if (data[i] == '\0' || data[i] != text[i]) return false;
+    }
+    return data[len] == '\0';
+}
+
+// Reads numeric key text the way fossil_tofu_compare does and returns the
+// value's bit pattern, so texts that compare equal produce the same bits.
+// Returns false for non-numeric types, for text too long to parse on the
+// stack and for text that is not entirely a number, all of which then keep
+// exact-text equality.
+static bool fossil_tofu_key_bits(fossil_tofu_type_t type, const char *text, size_t len, uint64_t *bits) {
+    switch (type) {
+        case FOSSIL_TOFU_TYPE_I8: case FOSSIL_TOFU_TYPE_I16:
+        case FOSSIL_TOFU_TYPE_I32: case FOSSIL_TOFU_TYPE_I64:
+        case FOSSIL_TOFU_TYPE_U8: case FOSSIL_TOFU_TYPE_U16:
+        case FOSSIL_TOFU_TYPE_U32: case FOSSIL_TOFU_TYPE_U64:
+        case FOSSIL_TOFU_TYPE_F32: case FOSSIL_TOFU_TYPE_F64:
+            break;
+        default:
+            return false;
+    }
+    if (len >= FOSSIL_TOFU_KEY_TEXT_MAX) return false;
+    char copy[FOSSIL_TOFU_KEY_TEXT_MAX];
+    memcpy(copy, text, len);
+    copy[len] = '\0';
+    char *end = copy;
+    switch (type) {
+        case FOSSIL_TOFU_TYPE_I8: case FOSSIL_TOFU_TYPE_I16:
+        case FOSSIL_TOFU_TYPE_I32: case FOSSIL_TOFU_TYPE_I64:
+            *bits = (uint64_t)strtoll(copy, &end, 10);
+            break;
+        case FOSSIL_TOFU_TYPE_U8: case FOSSIL_TOFU_TYPE_U16:
+        case FOSSIL_TOFU_TYPE_U32: case FOSSIL_TOFU_TYPE_U64:
+            *bits = (uint64_t)strtoull(copy, &end, 10);
+            break;
+        default: {
+            double v = strtod(copy, &end);
+            if (v == 0.0) v = 0.0; // -0.0 compares equal to 0.0
+            memcpy(bits, &v, sizeof(*bits));
+            if (v != v) *bits = UINT64_C(0x7ff8000000000000); // One pattern for every NaN
+            break;
+        }
+    }
+    return end != copy && *end == '\0';
+}
+
+uint64_t fossil_tofu_hash_key(fossil_tofu_type_t type, const char *text, size_t len) {
+    if (!text) return 0;
+    uint64_t bits;
+    if (fossil_tofu_key_bits(type, text, len, &bits)) {
+        return fossil_tofu_hash64_seed(&bits, sizeof(bits), 0);
+    }
+    return fossil_tofu_hash64_seed(text, len, 0);
+}
+
+bool fossil_tofu_equals_key(const fossil_tofu_t *tofu, const char *text, size_t len) {
+    if (!tofu || !tofu->value.data || !text) return false;
+    uint64_t want, have;
+    if (fossil_tofu_key_bits(tofu->type, text, len, &want) &&
+        fossil_tofu_key_bits(tofu->type, tofu->value.data, strlen(tofu->value.data), &have)) {
+        return want == have;
+    }
+    return fossil_tofu_equals_text(tofu, text, len);
+}
+
+static inline bool fossil_tofu_search_hit(const fossil_tofu_t *item, const fossil_tofu_t *needle) {
+    return item->value.data != NULL && fossil_tofu_compare(item, needle) == 0;
+}
+
+size_t fossil_tofu_search(const fossil_tofu_t *items, size_t count, fossil_tofu_type_t type, const char *value) {
+    if (!items || !value) return count;
+
+    fossil_tofu_t needle = {0};
+    needle.type = type;
+    needle.value.data = (char *)value;
+    const uint64_t hash = fossil_tofu_hash64(value);
+
+    // Only the cached hashes are touched until one matches; four lanes are
+    // tested per step so the compiler can keep the loop branch-light.
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        bool any = (items[i].value.hash == hash) | (items[i + 1].value.hash == hash) |
+                   (items[i + 2].value.hash == hash) | (items[i + 3].value.hash == hash);
+        if (!any) continue;
+        for (size_t k = i; k < i + 4; k++) {
+            if (items[k].value.hash == hash && fossil_tofu_search_hit(&items[k], &needle)) return k;
+        }
+    }
+    for (; i < count; i++) {
+        if (items[i].value.hash == hash && fossil_tofu_search_hit(&items[i], &needle)) return i;
+    }
+    return count;
+}
+
 // *****************************************************************************
 // Memory management functions
 // *****************************************************************************
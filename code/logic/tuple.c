@@ -38,9 +38,14 @@ fossil_tofu_tuple_t *fossil_tofu_tuple_create(char *type) {
         fossil_tofu_free(tuple);
         return NULL;
     }
+    tuple->type = fossil_tofu_strdup(type);
+    if (tuple->type == NULL) {
+        fossil_tofu_free(tuple->elements);
+        fossil_tofu_free(tuple);
+        return NULL;
+    }
     tuple->element_count = 0;
     tuple->capacity = INITIAL_CAPACITY;
-    tuple->type = type;
     return tuple;
 }
 
@@ -58,12 +63,17 @@ fossil_tofu_tuple_t* fossil_tofu_tuple_create_copy(const fossil_tofu_tuple_t* ot
         fossil_tofu_free(tuple);
         return NULL;
     }
+    tuple->type = fossil_tofu_strdup(other->type);
+    if (tuple->type == NULL) {
+        fossil_tofu_free(tuple->elements);
+        fossil_tofu_free(tuple);
+        return NULL;
+    }
     for (size_t i = 0; i < other->element_count; i++) {
         tuple->elements[i] = fossil_tofu_create(other->type, other->elements[i].value.data);
     }
     tuple->element_count = other->element_count;
     tuple->capacity = other->capacity;
-    tuple->type = other->type;
     return tuple;
 }
 
@@ -91,6 +101,7 @@ void fossil_tofu_tuple_destroy(fossil_tofu_tuple_t *tuple) {
         fossil_tofu_destroy(&tuple->elements[i]);
     }
     fossil_tofu_free(tuple->elements);
+    fossil_tofu_free(tuple->type);
     tuple->element_count = 0;
     tuple->capacity = 0;
     tuple->type = NULL;
@@ -227,3 +238,162 @@ void fossil_tofu_tuple_set_back(fossil_tofu_tuple_t* tuple, char *element) {
     }
     fossil_tofu_set_value(&tuple->elements[tuple->element_count - 1], element);
 }
+
+// *****************************************************************************
+// Aggregation functions
+// *****************************************************************************
+
+/**
+ * @brief Folds every numeric element of the tuple into a stats accumulator in a
+ * single pass.
+ *
+ * @param tuple  The tuple to reduce.
+ * @param stats  Receives count, sum, min, max and squared deviations.
+ * @return       FOSSIL_TOFU_SUCCESS, or an error code on failure.
+ * @note Time complexity: O(n)
+ */
+int32_t fossil_tofu_tuple_stats(const fossil_tofu_tuple_t* tuple, fossil_tofu_stats_t* stats) {
+    if (tuple == NULL || stats == NULL) {
+        return FOSSIL_TOFU_ERROR_NULL_POINTER;
+    }
+    fossil_tofu_stats_init(stats);
+    fossil_tofu_stats_add_tofu(stats, tuple->elements, tuple->element_count);
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+/**
+ * @brief Computes the sum of the numeric elements in the tuple.
+ *
+ * @param tuple  The tuple to reduce.
+ * @param out    Receives the sum (0 for an empty tuple).
+ * @return       FOSSIL_TOFU_SUCCESS, or an error code on failure.
+ * @note Time complexity: O(n)
+ */
+int32_t fossil_tofu_tuple_sum(const fossil_tofu_tuple_t* tuple, double* out) {
+    if (out == NULL) {
+        return FOSSIL_TOFU_ERROR_NULL_POINTER;
+    }
+    fossil_tofu_stats_t stats;
+    int32_t rc = fossil_tofu_tuple_stats(tuple, &stats);
+    if (rc != FOSSIL_TOFU_SUCCESS) {
+        return rc;
+    }
+    *out = stats.sum;
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+/**
+ * @brief Finds the smallest numeric element in the tuple.
+ *
+ * @param tuple  The tuple to reduce.
+ * @param out    Receives the minimum.
+ * @return       FOSSIL_TOFU_SUCCESS, FOSSIL_TOFU_ERROR_NOT_FOUND if the tuple holds
+ *               no numeric elements, or another error code on failure.
+ * @note Time complexity: O(n)
+ */
+int32_t fossil_tofu_tuple_min(const fossil_tofu_tuple_t* tuple, double* out) {
+    if (out == NULL) {
+        return FOSSIL_TOFU_ERROR_NULL_POINTER;
+    }
+    fossil_tofu_stats_t stats;
+    int32_t rc = fossil_tofu_tuple_stats(tuple, &stats);
+    if (rc != FOSSIL_TOFU_SUCCESS) {
+        return rc;
+    }
+    if (stats.count == 0) {
+        return FOSSIL_TOFU_ERROR_NOT_FOUND;
+    }
+    *out = stats.min;
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+/**
+ * @brief Finds the largest numeric element in the tuple.
+ *
+ * @param tuple  The tuple to reduce.
+ * @param out    Receives the maximum.
+ * @return       FOSSIL_TOFU_SUCCESS, FOSSIL_TOFU_ERROR_NOT_FOUND if the tuple holds
+ *               no numeric elements, or another error code on failure.
+ * @note Time complexity: O(n)
+ */
+int32_t fossil_tofu_tuple_max(const fossil_tofu_tuple_t* tuple, double* out) {
+    if (out == NULL) {
+        return FOSSIL_TOFU_ERROR_NULL_POINTER;
+    }
+    fossil_tofu_stats_t stats;
+    int32_t rc = fossil_tofu_tuple_stats(tuple, &stats);
+    if (rc != FOSSIL_TOFU_SUCCESS) {
+        return rc;
+    }
+    if (stats.count == 0) {
+        return FOSSIL_TOFU_ERROR_NOT_FOUND;
+    }
+    *out = stats.max;
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+/**
+ * @brief Computes the arithmetic mean of the numeric elements in the tuple.
+ *
+ * @param tuple  The tuple to reduce.
+ * @param out    Receives the mean.
+ * @return       FOSSIL_TOFU_SUCCESS, FOSSIL_TOFU_ERROR_NOT_FOUND if the tuple holds
+ *               no numeric elements, or another error code on failure.
+ * @note Time complexity: O(n)
+ */
+int32_t fossil_tofu_tuple_mean(const fossil_tofu_tuple_t* tuple, double* out) {
+    if (out == NULL) {
+        return FOSSIL_TOFU_ERROR_NULL_POINTER;
+    }
+    fossil_tofu_stats_t stats;
+    int32_t rc = fossil_tofu_tuple_stats(tuple, &stats);
+    if (rc != FOSSIL_TOFU_SUCCESS) {
+        return rc;
+    }
+    if (stats.count == 0) {
+        return FOSSIL_TOFU_ERROR_NOT_FOUND;
+    }
+    *out = stats.sum / (double)stats.count;
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+/**
+ * @brief Computes the population variance of the numeric elements in the tuple.
+ *
+ * @param tuple  The tuple to reduce.
+ * @param out    Receives the variance.
+ * @return       FOSSIL_TOFU_SUCCESS, FOSSIL_TOFU_ERROR_NOT_FOUND if the tuple holds
+ *               no numeric elements, or another error code on failure.
+ * @note Time complexity: O(n)
+ */
+int32_t fossil_tofu_tuple_variance(const fossil_tofu_tuple_t* tuple, double* out) {
+    if (out == NULL) {
+        return FOSSIL_TOFU_ERROR_NULL_POINTER;
+    }
+    fossil_tofu_stats_t stats;
+    int32_t rc = fossil_tofu_tuple_stats(tuple, &stats);
+    if (rc != FOSSIL_TOFU_SUCCESS) {
+        return rc;
+    }
+    if (stats.count == 0) {
+        return FOSSIL_TOFU_ERROR_NOT_FOUND;
+    }
+    *out = fossil_tofu_stats_variance(&stats);
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+/**
+ * @brief Counts the numeric elements of the tuple that satisfy a predicate.
+ *
+ * @param tuple     The tuple to scan.
+ * @param predicate Called with each numeric element.
+ * @param context   Passed through to the predicate.
+ * @return          The number of matching elements.
+ * @note Time complexity: O(n)
+ */
+size_t fossil_tofu_tuple_count_if(const fossil_tofu_tuple_t* tuple, fossil_tofu_predicate_t predicate, void* context) {
+    if (tuple == NULL || predicate == NULL) {
+        return 0;
+    }
+    return fossil_tofu_count_if_tofu(tuple->elements, tuple->element_count, predicate, context);
+}
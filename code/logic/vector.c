@@ -23,6 +23,222 @@
  * -----------------------------------------------------------------------------
  */
 #include "fossil/tofu/vector.h"
+#include "fossil/tofu/threads.h"
+
+// *****************************************************************************
+// Columnar storage helpers
+// *****************************************************************************
+
+static size_t fossil_tofu_vector_column_width(fossil_tofu_type_t type) {
+    switch (type) {
+        case FOSSIL_TOFU_TYPE_I8:  return sizeof(int8_t);
+        case FOSSIL_TOFU_TYPE_I16: return sizeof(int16_t);
+        case FOSSIL_TOFU_TYPE_I32: return sizeof(int32_t);
+        case FOSSIL_TOFU_TYPE_I64: return sizeof(int64_t);
+        case FOSSIL_TOFU_TYPE_U8:  return sizeof(uint8_t);
+        case FOSSIL_TOFU_TYPE_U16: return sizeof(uint16_t);
+        case FOSSIL_TOFU_TYPE_U32: return sizeof(uint32_t);
+        case FOSSIL_TOFU_TYPE_U64: return sizeof(uint64_t);
+        case FOSSIL_TOFU_TYPE_F32: return sizeof(float);
+        case FOSSIL_TOFU_TYPE_F64: return sizeof(double);
+        default:                   return 0;
+    }
+}
+
+// Parses a decimal string into the packed slot; returns false for NULL or
+// unparsable input so the caller can mark the slot as null.
+static bool fossil_tofu_vector_column_parse(fossil_tofu_type_t type, const char *text, void *slot) {
+    if (text == NULL || *text == '\0') {
+        return false;
+    }
+    char *end = NULL;
+    switch (type) {
+        case FOSSIL_TOFU_TYPE_I8:
+        case FOSSIL_TOFU_TYPE_I16:
+        case FOSSIL_TOFU_TYPE_I32:
+        case FOSSIL_TOFU_TYPE_I64: {
+            long long v = strtoll(text, &end, 10);
+            if (end == text) return false;
+            if (type == FOSSIL_TOFU_TYPE_I8)  *(int8_t*)slot = (int8_t)v;
+            if (type == FOSSIL_TOFU_TYPE_I16) *(int16_t*)slot = (int16_t)v;
+            if (type == FOSSIL_TOFU_TYPE_I32) *(int32_t*)slot = (int32_t)v;
+            if (type == FOSSIL_TOFU_TYPE_I64) *(int64_t*)slot = (int64_t)v;
+            return true;
+        }
+        case FOSSIL_TOFU_TYPE_U8:
+        case FOSSIL_TOFU_TYPE_U16:
+        case FOSSIL_TOFU_TYPE_U32:
+        case FOSSIL_TOFU_TYPE_U64: {
+            unsigned long long v = strtoull(text, &end, 10);
+            if (end == text) return false;
+            if (type == FOSSIL_TOFU_TYPE_U8)  *(uint8_t*)slot = (uint8_t)v;
+            if (type == FOSSIL_TOFU_TYPE_U16) *(uint16_t*)slot = (uint16_t)v;
+            if (type == FOSSIL_TOFU_TYPE_U32) *(uint32_t*)slot = (uint32_t)v;
+            if (type == FOSSIL_TOFU_TYPE_U64) *(uint64_t*)slot = (uint64_t)v;
+            return true;
+        }
+        case FOSSIL_TOFU_TYPE_F32: {
+            float v = strtof(text, &end);
+            if (end == text) return false;
+            *(float*)slot = v;
+            return true;
+        }
+        case FOSSIL_TOFU_TYPE_F64: {
+            double v = strtod(text, &end);
+            if (end == text) return false;
+            *(double*)slot = v;
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+// Formats a packed value back to its decimal string. Floating point values
+// use the shortest precision that round-trips.
+static void fossil_tofu_vector_column_format(fossil_tofu_type_t type, const void *slot, char *buf, size_t len) {
+    switch (type) {
+        case FOSSIL_TOFU_TYPE_I8:  snprintf(buf, len, "%d", *(const int8_t*)slot); break;
+        case FOSSIL_TOFU_TYPE_I16: snprintf(buf, len, "%d", *(const int16_t*)slot); break;
+        case FOSSIL_TOFU_TYPE_I32: snprintf(buf, len, "%d", (int)*(const int32_t*)slot); break;
+        case FOSSIL_TOFU_TYPE_I64: snprintf(buf, len, "%lld", (long long)*(const int64_t*)slot); break;
+        case FOSSIL_TOFU_TYPE_U8:  snprintf(buf, len, "%u", *(const uint8_t*)slot); break;
+        case FOSSIL_TOFU_TYPE_U16: snprintf(buf, len, "%u", *(const uint16_t*)slot); break;
+        case FOSSIL_TOFU_TYPE_U32: snprintf(buf, len, "%u", (unsigned)*(const uint32_t*)slot); break;
+        case FOSSIL_TOFU_TYPE_U64: snprintf(buf, len, "%llu", (unsigned long long)*(const uint64_t*)slot); break;
+        case FOSSIL_TOFU_TYPE_F32: {
+            float v = *(const float*)slot;
+            snprintf(buf, len, "%.6g", v);
+            if (strtof(buf, NULL) != v) snprintf(buf, len, "%.9g", v);
+            break;
+        }
+        case FOSSIL_TOFU_TYPE_F64: {
+            double v = *(const double*)slot;
+            snprintf(buf, len, "%.15g", v);
+            if (strtod(buf, NULL) != v) snprintf(buf, len, "%.17g", v);
+            break;
+        }
+        default:
+            buf[0] = '\0';
+            break;
+    }
+}
+
+static inline void *fossil_tofu_vector_column_slot(const fossil_tofu_vector_t* vector, size_t index) {
+    return (uint8_t*)vector->column + index * vector->element_size;
+}
+
+static inline bool fossil_tofu_vector_column_null(const fossil_tofu_vector_t* vector, size_t index) {
+    return vector->nulls != NULL && (vector->nulls[index >> 3] & (1u << (index & 7))) != 0;
+}
+
+static bool fossil_tofu_vector_column_mark(fossil_tofu_vector_t* vector, size_t index, bool is_null) {
+    if (vector->nulls == NULL) {
+        if (!is_null) {
+            return true;
+        }
+        size_t bytes = (vector->capacity + 7) / 8;
+        vector->nulls = (uint8_t*)fossil_tofu_alloc(bytes);
+        if (vector->nulls == NULL) {
+            return false;
+        }
+        memset(vector->nulls, 0, bytes);
+    }
+    if (is_null) {
+        vector->nulls[index >> 3] |= (uint8_t)(1u << (index & 7));
+    } else {
+        vector->nulls[index >> 3] &= (uint8_t)~(1u << (index & 7));
+    }
+    return true;
+}
+
+// Stores a string element into a packed slot, recording null when it does
+// not parse. The slot is left untouched when the null bitmap cannot be
+// allocated.
+static int32_t fossil_tofu_vector_column_store(fossil_tofu_vector_t* vector, size_t index, const char *element) {
+    union { int64_t i; uint64_t u; double f; } value = {0};
+    bool parsed = fossil_tofu_vector_column_parse(vector->column_type, element, &value);
+    if (!fossil_tofu_vector_column_mark(vector, index, !parsed)) {
+        return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+    }
+    if (!parsed) {
+        memset(&value, 0, sizeof(value));
+    }
+    memcpy(fossil_tofu_vector_column_slot(vector, index), &value, vector->element_size);
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+static bool fossil_tofu_vector_column_grow(fossil_tofu_vector_t* vector) {
+    size_t new_capacity = vector->capacity ? 2 * vector->capacity : INITIAL_CAPACITY;
+    void *column = fossil_tofu_realloc(vector->column, new_capacity * vector->element_size);
+    if (column == NULL) {
+        return false;
+    }
+    vector->column = column;
+    if (vector->nulls != NULL) {
+        size_t old_bytes = (vector->capacity + 7) / 8;
+        size_t new_bytes = (new_capacity + 7) / 8;
+        uint8_t *nulls = (uint8_t*)fossil_tofu_realloc(vector->nulls, new_bytes);
+        if (nulls == NULL) {
+            return false;
+        }
+        memset(nulls + old_bytes, 0, new_bytes - old_bytes);
+        vector->nulls = nulls;
+    }
+    vector->capacity = new_capacity;
+    return true;
+}
+
+// Shifts elements [index, size) one slot to the right (open) or left
+// (close), keeping the null bitmap in step with the packed values.
+static void fossil_tofu_vector_column_shift(fossil_tofu_vector_t* vector, size_t index, bool open) {
+    uint8_t *base = (uint8_t*)vector->column;
+    size_t width = vector->element_size;
+    if (open) {
+        memmove(base + (index + 1) * width, base + index * width, (vector->size - index) * width);
+        if (vector->nulls != NULL) {
+            for (size_t i = vector->size; i > index; i--) {
+                fossil_tofu_vector_column_mark(vector, i, fossil_tofu_vector_column_null(vector, i - 1));
+            }
+        }
+    } else {
+        memmove(base + index * width, base + (index + 1) * width, (vector->size - index - 1) * width);
+        if (vector->nulls != NULL) {
+            for (size_t i = index; i + 1 < vector->size; i++) {
+                fossil_tofu_vector_column_mark(vector, i, fossil_tofu_vector_column_null(vector, i + 1));
+            }
+            fossil_tofu_vector_column_mark(vector, vector->size - 1, false);
+        }
+    }
+}
+
+static int32_t fossil_tofu_vector_column_insert(fossil_tofu_vector_t* vector, size_t index, const char *element) {
+    if (vector->size == vector->capacity && !fossil_tofu_vector_column_grow(vector)) {
+        return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+    }
+    fossil_tofu_vector_column_shift(vector, index, true);
+    vector->size++;
+    int32_t result = fossil_tofu_vector_column_store(vector, index, element);
+    if (result != FOSSIL_TOFU_SUCCESS) {
+        // Close the gap again so the vector is as it was.
+        fossil_tofu_vector_column_shift(vector, index, false);
+        vector->size--;
+    }
+    return result;
+}
+
+// Reads element i into buf when it has to be formatted. Boxed values are
+// returned in place, so the result only aliases buf for columnar vectors.
+static const char *fossil_tofu_vector_element(const fossil_tofu_vector_t* vector, size_t index, char *buf, size_t len) {
+    if (!fossil_tofu_vector_is_columnar(vector)) {
+        return vector->data[index].value.data;
+    }
+    if (fossil_tofu_vector_column_null(vector, index)) {
+        return NULL;
+    }
+    fossil_tofu_vector_column_format(vector->column_type, fossil_tofu_vector_column_slot(vector, index), buf, len);
+    return buf;
+}
 
 // *****************************************************************************
 // Function prototypes
@@ -42,9 +258,48 @@ fossil_tofu_vector_t* fossil_tofu_vector_create_container(char* type) {
         fossil_tofu_free(vector);
         return NULL;
     }
+    vector->type = type ? fossil_tofu_strdup(type) : NULL;
+    if (type != NULL && vector->type == NULL) {
+        fossil_tofu_free(vector->data);
+        fossil_tofu_free(vector);
+        return NULL;
+    }
     vector->size = 0;
     vector->capacity = INITIAL_CAPACITY;
-    vector->type = type;
+    vector->column = NULL;
+    vector->nulls = NULL;
+    vector->element_size = 0;
+    vector->column_type = validated_type;
+    return vector;
+}
+
+fossil_tofu_vector_t* fossil_tofu_vector_create_columnar(char* type) {
+    fossil_tofu_type_t validated_type = fossil_tofu_validate_type(type);
+    size_t width = fossil_tofu_vector_column_width(validated_type);
+    if (type == NULL || width == 0) {
+        return NULL;
+    }
+    fossil_tofu_vector_t* vector = (fossil_tofu_vector_t*)fossil_tofu_alloc(sizeof(fossil_tofu_vector_t));
+    if (vector == NULL) {
+        return NULL;
+    }
+    vector->column = fossil_tofu_alloc(INITIAL_CAPACITY * width);
+    if (vector->column == NULL) {
+        fossil_tofu_free(vector);
+        return NULL;
+    }
+    vector->type = fossil_tofu_strdup(type);
+    if (vector->type == NULL) {
+        fossil_tofu_free(vector->column);
+        fossil_tofu_free(vector);
+        return NULL;
+    }
+    vector->data = NULL;
+    vector->size = 0;
+    vector->capacity = INITIAL_CAPACITY;
+    vector->nulls = NULL;
+    vector->element_size = width;
+    vector->column_type = validated_type;
     return vector;
 }
 
@@ -64,14 +319,42 @@ fossil_tofu_vector_t* fossil_tofu_vector_create_copy(const fossil_tofu_vector_t*
     if (vector == NULL) {
         return NULL;
     }
+    *vector = *other;
+    vector->data = NULL;
+    vector->column = NULL;
+    vector->nulls = NULL;
+    vector->type = other->type ? fossil_tofu_strdup(other->type) : NULL;
+    if (other->type != NULL && vector->type == NULL) {
+        fossil_tofu_free(vector);
+        return NULL;
+    }
+    if (fossil_tofu_vector_is_columnar(other)) {
+        vector->column = fossil_tofu_alloc(other->capacity * other->element_size);
+        if (vector->column == NULL) {
+            fossil_tofu_free(vector->type);
+            fossil_tofu_free(vector);
+            return NULL;
+        }
+        memcpy(vector->column, other->column, other->size * other->element_size);
+        if (other->nulls != NULL) {
+            size_t bytes = (other->capacity + 7) / 8;
+            vector->nulls = (uint8_t*)fossil_tofu_alloc(bytes);
+            if (vector->nulls == NULL) {
+                fossil_tofu_free(vector->column);
+                fossil_tofu_free(vector->type);
+                fossil_tofu_free(vector);
+                return NULL;
+            }
+            memcpy(vector->nulls, other->nulls, bytes);
+        }
+        return vector;
+    }
     vector->data = (fossil_tofu_t*)fossil_tofu_alloc(other->capacity * sizeof(fossil_tofu_t));
     if (vector->data == NULL) {
+        fossil_tofu_free(vector->type);
         fossil_tofu_free(vector);
         return NULL;
     }
-    vector->size = other->size;
-    vector->capacity = other->capacity;
-    vector->type = other->type;
     for (size_t i = 0; i < other->size; i++) {
         vector->data[i] = other->data[i];
     }
@@ -90,11 +373,10 @@ fossil_tofu_vector_t* fossil_tofu_vector_create_move(fossil_tofu_vector_t* other
     if (vector == NULL) {
         return NULL;
     }
-    vector->data = other->data;
-    vector->size = other->size;
-    vector->capacity = other->capacity;
-    vector->type = other->type;
+    *vector = *other;
     other->data = NULL;
+    other->column = NULL;
+    other->nulls = NULL;
     other->size = 0;
     other->capacity = 0;
     other->type = NULL;
@@ -106,6 +388,9 @@ void fossil_tofu_vector_destroy(fossil_tofu_vector_t* vector) {
         return;
     }
     fossil_tofu_free(vector->data);
+    fossil_tofu_free(vector->column);
+    fossil_tofu_free(vector->nulls);
+    fossil_tofu_free(vector->type);
     fossil_tofu_free(vector);
 }
 
@@ -117,6 +402,10 @@ void fossil_tofu_vector_push_back(fossil_tofu_vector_t* vector, char *element) {
     if (vector == NULL) {
         return;
     }
+    if (fossil_tofu_vector_is_columnar(vector)) {
+        fossil_tofu_vector_column_insert(vector, vector->size, element);
+        return;
+    }
     if (vector->size == vector->capacity) {
         fossil_tofu_t* new_data = (fossil_tofu_t*)fossil_tofu_alloc(2 * vector->capacity * sizeof(fossil_tofu_t));
         if (new_data == NULL) {
@@ -136,6 +425,10 @@ void fossil_tofu_vector_push_front(fossil_tofu_vector_t* vector, char *element)
     if (vector == NULL) {
         return;
     }
+    if (fossil_tofu_vector_is_columnar(vector)) {
+        fossil_tofu_vector_column_insert(vector, 0, element);
+        return;
+    }
     if (vector->size == vector->capacity) {
         fossil_tofu_t* new_data = (fossil_tofu_t*)fossil_tofu_alloc(2 * vector->capacity * sizeof(fossil_tofu_t));
         if (new_data == NULL) {
@@ -160,6 +453,10 @@ void fossil_tofu_vector_push_at(fossil_tofu_vector_t* vector, size_t index, char
     if (vector == NULL || index > vector->size) {
         return;
     }
+    if (fossil_tofu_vector_is_columnar(vector)) {
+        fossil_tofu_vector_column_insert(vector, index, element);
+        return;
+    }
     if (vector->size == vector->capacity) {
         fossil_tofu_t* new_data = (fossil_tofu_t*)fossil_tofu_alloc(2 * vector->capacity * sizeof(fossil_tofu_t));
         if (new_data == NULL) {
@@ -187,6 +484,10 @@ void fossil_tofu_vector_pop_back(fossil_tofu_vector_t* vector) {
     if (vector == NULL || vector->size == 0) {
         return;
     }
+    if (fossil_tofu_vector_is_columnar(vector)) {
+        fossil_tofu_vector_column_mark(vector, --vector->size, false);
+        return;
+    }
     fossil_tofu_destroy(&vector->data[--vector->size]);
 }
 
@@ -194,6 +495,11 @@ void fossil_tofu_vector_pop_front(fossil_tofu_vector_t* vector) {
     if (vector == NULL || vector->size == 0) {
         return;
     }
+    if (fossil_tofu_vector_is_columnar(vector)) {
+        fossil_tofu_vector_column_shift(vector, 0, false);
+        vector->size--;
+        return;
+    }
     fossil_tofu_destroy(&vector->data[0]);
     for (size_t i = 0; i < vector->size - 1; i++) {
         vector->data[i] = vector->data[i + 1];
@@ -205,6 +511,11 @@ void fossil_tofu_vector_pop_at(fossil_tofu_vector_t* vector, size_t index) {
     if (vector == NULL || index >= vector->size) {
         return;
     }
+    if (fossil_tofu_vector_is_columnar(vector)) {
+        fossil_tofu_vector_column_shift(vector, index, false);
+        vector->size--;
+        return;
+    }
     fossil_tofu_destroy(&vector->data[index]);
     for (size_t i = index; i < vector->size - 1; i++) {
         vector->data[i] = vector->data[i + 1];
@@ -216,6 +527,13 @@ void fossil_tofu_vector_erase(fossil_tofu_vector_t* vector) {
     if (vector == NULL) {
         return;
     }
+    if (fossil_tofu_vector_is_columnar(vector)) {
+        if (vector->nulls != NULL) {
+            memset(vector->nulls, 0, (vector->capacity + 7) / 8);
+        }
+        vector->size = 0;
+        return;
+    }
     for (size_t i = 0; i < vector->size; i++) {
         fossil_tofu_destroy(&vector->data[i]);
     }
@@ -246,30 +564,68 @@ size_t fossil_tofu_vector_capacity(const fossil_tofu_vector_t* vector) {
     return vector == NULL ? 0 : vector->capacity;
 }
 
+bool fossil_tofu_vector_is_columnar(const fossil_tofu_vector_t* vector) {
+    return vector != NULL && vector->element_size != 0;
+}
+
+bool fossil_tofu_vector_is_null(const fossil_tofu_vector_t* vector, size_t index) {
+    if (vector == NULL || index >= vector->size) {
+        return true;
+    }
+    if (fossil_tofu_vector_is_columnar(vector)) {
+        return fossil_tofu_vector_column_null(vector, index);
+    }
+    return vector->data[index].value.data == NULL;
+}
+
 // *****************************************************************************
 // Getter and setter functions
 // *****************************************************************************
 
 char *fossil_tofu_vector_get(const fossil_tofu_vector_t* vector, size_t index) {
-    return vector == NULL || index >= vector->size ? NULL : fossil_tofu_get_value(&vector->data[index]);
+    if (vector == NULL || index >= vector->size) {
+        return NULL;
+    }
+    if (fossil_tofu_vector_is_columnar(vector)) {
+        return NULL; // Packed values have no string to point at; see get_into
+    }
+    return fossil_tofu_get_value(&vector->data[index]);
+}
+
+char *fossil_tofu_vector_get_into(const fossil_tofu_vector_t* vector, size_t index, char *buf, size_t len) {
+    if (vector == NULL || index >= vector->size || buf == NULL || len == 0) {
+        return NULL;
+    }
+    const char *element = fossil_tofu_vector_element(vector, index, buf, len);
+    if (element == NULL) {
+        return NULL;
+    }
+    if (element != buf) {
+        snprintf(buf, len, "%s", element);
+    }
+    return buf;
 }
 
 char *fossil_tofu_vector_get_front(const fossil_tofu_vector_t* vector) {
-    return vector == NULL || vector->size == 0 ? NULL : fossil_tofu_get_value(&vector->data[0]);
+    return vector == NULL || vector->size == 0 ? NULL : fossil_tofu_vector_get(vector, 0);
 }
 
 char *fossil_tofu_vector_get_back(const fossil_tofu_vector_t* vector) {
-    return vector == NULL || vector->size == 0 ? NULL : fossil_tofu_get_value(&vector->data[vector->size - 1]);
+    return vector == NULL || vector->size == 0 ? NULL : fossil_tofu_vector_get(vector, vector->size - 1);
 }
 
 char *fossil_tofu_vector_get_at(const fossil_tofu_vector_t* vector, size_t index) {
-    return vector == NULL || index >= vector->size ? NULL : fossil_tofu_get_value(&vector->data[index]);
+    return fossil_tofu_vector_get(vector, index);
 }
 
 void fossil_tofu_vector_set(fossil_tofu_vector_t* vector, size_t index, char *element) {
     if (vector == NULL || index >= vector->size) {
         return;
     }
+    if (fossil_tofu_vector_is_columnar(vector)) {
+        fossil_tofu_vector_column_store(vector, index, element);
+        return;
+    }
     fossil_tofu_set_value(&vector->data[index], element);
 }
 
@@ -277,19 +633,647 @@ void fossil_tofu_vector_set_front(fossil_tofu_vector_t* vector, char *element) {
     if (vector == NULL || vector->size == 0) {
         return;
     }
-    fossil_tofu_set_value(&vector->data[0], element);
+    fossil_tofu_vector_set(vector, 0, element);
 }
 
 void fossil_tofu_vector_set_back(fossil_tofu_vector_t* vector, char *element) {
     if (vector == NULL || vector->size == 0) {
         return;
     }
-    fossil_tofu_set_value(&vector->data[vector->size - 1], element);
+    fossil_tofu_vector_set(vector, vector->size - 1, element);
 }
 
 void fossil_tofu_vector_set_at(fossil_tofu_vector_t* vector, size_t index, char *element) {
-    if (vector == NULL || index >= vector->size) {
-        return;
+    fossil_tofu_vector_set(vector, index, element);
+}
+
+// *****************************************************************************
+// Columnar span accessors
+// *****************************************************************************
+
+static const void *fossil_tofu_vector_span(const fossil_tofu_vector_t* vector, fossil_tofu_type_t type) {
+    if (!fossil_tofu_vector_is_columnar(vector) || vector->column_type != type) {
+        return NULL;
     }
-    fossil_tofu_set_value(&vector->data[index], element);
+    return vector->column;
+}
+
+const int8_t* fossil_tofu_vector_span_i8(const fossil_tofu_vector_t* vector) {
+    return (const int8_t*)fossil_tofu_vector_span(vector, FOSSIL_TOFU_TYPE_I8);
+}
+
+const int16_t* fossil_tofu_vector_span_i16(const fossil_tofu_vector_t* vector) {
+    return (const int16_t*)fossil_tofu_vector_span(vector, FOSSIL_TOFU_TYPE_I16);
+}
+
+const int32_t* fossil_tofu_vector_span_i32(const fossil_tofu_vector_t* vector) {
+    return (const int32_t*)fossil_tofu_vector_span(vector, FOSSIL_TOFU_TYPE_I32);
+}
+
+const int64_t* fossil_tofu_vector_span_i64(const fossil_tofu_vector_t* vector) {
+    return (const int64_t*)fossil_tofu_vector_span(vector, FOSSIL_TOFU_TYPE_I64);
+}
+
+const uint8_t* fossil_tofu_vector_span_u8(const fossil_tofu_vector_t* vector) {
+    return (const uint8_t*)fossil_tofu_vector_span(vector, FOSSIL_TOFU_TYPE_U8);
+}
+
+const uint16_t* fossil_tofu_vector_span_u16(const fossil_tofu_vector_t* vector) {
+    return (const uint16_t*)fossil_tofu_vector_span(vector, FOSSIL_TOFU_TYPE_U16);
+}
+
+const uint32_t* fossil_tofu_vector_span_u32(const fossil_tofu_vector_t* vector) {
+    return (const uint32_t*)fossil_tofu_vector_span(vector, FOSSIL_TOFU_TYPE_U32);
+}
+
+const uint64_t* fossil_tofu_vector_span_u64(const fossil_tofu_vector_t* vector) {
+    return (const uint64_t*)fossil_tofu_vector_span(vector, FOSSIL_TOFU_TYPE_U64);
+}
+
+const float* fossil_tofu_vector_span_f32(const fossil_tofu_vector_t* vector) {
+    return (const float*)fossil_tofu_vector_span(vector, FOSSIL_TOFU_TYPE_F32);
+}
+
+const double* fossil_tofu_vector_span_f64(const fossil_tofu_vector_t* vector) {
+    return (const double*)fossil_tofu_vector_span(vector, FOSSIL_TOFU_TYPE_F64);
+}
+
+const uint8_t* fossil_tofu_vector_nulls(const fossil_tofu_vector_t* vector) {
+    return fossil_tofu_vector_is_columnar(vector) ? vector->nulls : NULL;
+}
+
+// *****************************************************************************
+// Aggregation functions
+// *****************************************************************************
+
+#define FOSSIL_TOFU_VECTOR_BLOCK 256
+
+#define FOSSIL_TOFU_VECTOR_WIDEN(T) \
+    for (size_t i = 0; i < n; i++) out[i] = (double)((const T*)base)[i]; \
+    break
+
+// Widens packed values [start, start + n) to doubles and drops null slots.
+// Returns the number of values written to out.
+static size_t fossil_tofu_vector_column_widen(const fossil_tofu_vector_t* vector, size_t start, size_t n, double* out) {
+    const void *base = fossil_tofu_vector_column_slot(vector, start);
+    switch (vector->column_type) {
+        case FOSSIL_TOFU_TYPE_I8:  FOSSIL_TOFU_VECTOR_WIDEN(int8_t);
+        case FOSSIL_TOFU_TYPE_I16: FOSSIL_TOFU_VECTOR_WIDEN(int16_t);
+        case FOSSIL_TOFU_TYPE_I32: FOSSIL_TOFU_VECTOR_WIDEN(int32_t);
+        case FOSSIL_TOFU_TYPE_I64: FOSSIL_TOFU_VECTOR_WIDEN(int64_t);
+        case FOSSIL_TOFU_TYPE_U8:  FOSSIL_TOFU_VECTOR_WIDEN(uint8_t);
+        case FOSSIL_TOFU_TYPE_U16: FOSSIL_TOFU_VECTOR_WIDEN(uint16_t);
+        case FOSSIL_TOFU_TYPE_U32: FOSSIL_TOFU_VECTOR_WIDEN(uint32_t);
+        case FOSSIL_TOFU_TYPE_U64: FOSSIL_TOFU_VECTOR_WIDEN(uint64_t);
+        case FOSSIL_TOFU_TYPE_F32: FOSSIL_TOFU_VECTOR_WIDEN(float);
+        case FOSSIL_TOFU_TYPE_F64: FOSSIL_TOFU_VECTOR_WIDEN(double);
+        default: return 0;
+    }
+    if (vector->nulls == NULL) {
+        return n;
+    }
+    size_t kept = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (!fossil_tofu_vector_column_null(vector, start + i)) {
+            out[kept++] = out[i];
+        }
+    }
+    return kept;
+}
+
+int32_t fossil_tofu_vector_stats(const fossil_tofu_vector_t* vector, fossil_tofu_stats_t* stats) {
+    if (vector == NULL || stats == NULL) {
+        return FOSSIL_TOFU_ERROR_NULL_POINTER;
+    }
+    fossil_tofu_stats_init(stats);
+    if (!fossil_tofu_vector_is_columnar(vector)) {
+        if (!fossil_tofu_type_is_numeric(fossil_tofu_validate_type(vector->type))) {
+            return FOSSIL_TOFU_ERROR_TYPE_MISMATCH;
+        }
+        fossil_tofu_stats_add_tofu(stats, vector->data, vector->size);
+        return FOSSIL_TOFU_SUCCESS;
+    }
+    if (vector->column_type == FOSSIL_TOFU_TYPE_F64 && vector->nulls == NULL) {
+        fossil_tofu_stats_add_f64(stats, (const double*)vector->column, vector->size);
+        return FOSSIL_TOFU_SUCCESS;
+    }
+    double block[FOSSIL_TOFU_VECTOR_BLOCK];
+    for (size_t off = 0; off < vector->size; off += FOSSIL_TOFU_VECTOR_BLOCK) {
+        size_t n = vector->size - off < FOSSIL_TOFU_VECTOR_BLOCK ? vector->size - off : FOSSIL_TOFU_VECTOR_BLOCK;
+        fossil_tofu_stats_add_f64(stats, block, fossil_tofu_vector_column_widen(vector, off, n, block));
+    }
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+int32_t fossil_tofu_vector_sum(const fossil_tofu_vector_t* vector, double* out) {
+    if (out == NULL) {
+        return FOSSIL_TOFU_ERROR_NULL_POINTER;
+    }
+    fossil_tofu_stats_t stats;
+    int32_t rc = fossil_tofu_vector_stats(vector, &stats);
+    if (rc != FOSSIL_TOFU_SUCCESS) {
+        return rc;
+    }
+    *out = stats.sum;
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+int32_t fossil_tofu_vector_min(const fossil_tofu_vector_t* vector, double* out) {
+    if (out == NULL) {
+        return FOSSIL_TOFU_ERROR_NULL_POINTER;
+    }
+    fossil_tofu_stats_t stats;
+    int32_t rc = fossil_tofu_vector_stats(vector, &stats);
+    if (rc != FOSSIL_TOFU_SUCCESS) {
+        return rc;
+    }
+    if (stats.count == 0) {
+        return FOSSIL_TOFU_ERROR_NOT_FOUND;
+    }
+    *out = stats.min;
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+int32_t fossil_tofu_vector_max(const fossil_tofu_vector_t* vector, double* out) {
+    if (out == NULL) {
+        return FOSSIL_TOFU_ERROR_NULL_POINTER;
+    }
+    fossil_tofu_stats_t stats;
+    int32_t rc = fossil_tofu_vector_stats(vector, &stats);
+    if (rc != FOSSIL_TOFU_SUCCESS) {
+        return rc;
+    }
+    if (stats.count == 0) {
+        return FOSSIL_TOFU_ERROR_NOT_FOUND;
+    }
+    *out = stats.max;
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+int32_t fossil_tofu_vector_mean(const fossil_tofu_vector_t* vector, double* out) {
+    if (out == NULL) {
+        return FOSSIL_TOFU_ERROR_NULL_POINTER;
+    }
+    fossil_tofu_stats_t stats;
+    int32_t rc = fossil_tofu_vector_stats(vector, &stats);
+    if (rc != FOSSIL_TOFU_SUCCESS) {
+        return rc;
+    }
+    if (stats.count == 0) {
+        return FOSSIL_TOFU_ERROR_NOT_FOUND;
+    }
+    *out = stats.sum / (double)stats.count;
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+int32_t fossil_tofu_vector_variance(const fossil_tofu_vector_t* vector, double* out) {
+    if (out == NULL) {
+        return FOSSIL_TOFU_ERROR_NULL_POINTER;
+    }
+    fossil_tofu_stats_t stats;
+    int32_t rc = fossil_tofu_vector_stats(vector, &stats);
+    if (rc != FOSSIL_TOFU_SUCCESS) {
+        return rc;
+    }
+    if (stats.count == 0) {
+        return FOSSIL_TOFU_ERROR_NOT_FOUND;
+    }
+    *out = fossil_tofu_stats_variance(&stats);
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+size_t fossil_tofu_vector_count_if(const fossil_tofu_vector_t* vector, fossil_tofu_predicate_t predicate, void* context) {
+    if (vector == NULL || predicate == NULL) {
+        return 0;
+    }
+    if (!fossil_tofu_vector_is_columnar(vector)) {
+        if (!fossil_tofu_type_is_numeric(fossil_tofu_validate_type(vector->type))) {
+            return 0;
+        }
+        return fossil_tofu_count_if_tofu(vector->data, vector->size, predicate, context);
+    }
+    if (vector->column_type == FOSSIL_TOFU_TYPE_F64 && vector->nulls == NULL) {
+        return fossil_tofu_count_if_f64((const double*)vector->column, vector->size, predicate, context);
+    }
+    double block[FOSSIL_TOFU_VECTOR_BLOCK];
+    size_t hits = 0;
+    for (size_t off = 0; off < vector->size; off += FOSSIL_TOFU_VECTOR_BLOCK) {
+        size_t n = vector->size - off < FOSSIL_TOFU_VECTOR_BLOCK ? vector->size - off : FOSSIL_TOFU_VECTOR_BLOCK;
+        hits += fossil_tofu_count_if_f64(block, fossil_tofu_vector_column_widen(vector, off, n, block), predicate, context);
+    }
+    return hits;
+}
+
+// *****************************************************************************
+// Search functions
+// *****************************************************************************
+
+#define FOSSIL_TOFU_VECTOR_SCAN(T) { \
+        const T *values = (const T*)vector->column; \
+        const T key = *(const T*)slot; \
+        for (size_t i = 0; i < vector->size; i++) { \
+            if (values[i] == key && !fossil_tofu_vector_column_null(vector, i)) return i; \
+        } \
+        return vector->size; \
+    }
+
+// Compares the packed column against the parsed needle; no element is
+// formatted back to text.
+static size_t fossil_tofu_vector_column_search(const fossil_tofu_vector_t* vector, const char *element) {
+    uint64_t storage = 0;
+    void *slot = &storage;
+    if (!fossil_tofu_vector_column_parse(vector->column_type, element, slot)) {
+        return vector->size;
+    }
+    switch (vector->column_type) {
+        case FOSSIL_TOFU_TYPE_I8:  FOSSIL_TOFU_VECTOR_SCAN(int8_t)
+        case FOSSIL_TOFU_TYPE_I16: FOSSIL_TOFU_VECTOR_SCAN(int16_t)
+        case FOSSIL_TOFU_TYPE_I32: FOSSIL_TOFU_VECTOR_SCAN(int32_t)
+        case FOSSIL_TOFU_TYPE_I64: FOSSIL_TOFU_VECTOR_SCAN(int64_t)
+        case FOSSIL_TOFU_TYPE_U8:  FOSSIL_TOFU_VECTOR_SCAN(uint8_t)
+        case FOSSIL_TOFU_TYPE_U16: FOSSIL_TOFU_VECTOR_SCAN(uint16_t)
+        case FOSSIL_TOFU_TYPE_U32: FOSSIL_TOFU_VECTOR_SCAN(uint32_t)
+        case FOSSIL_TOFU_TYPE_U64: FOSSIL_TOFU_VECTOR_SCAN(uint64_t)
+        case FOSSIL_TOFU_TYPE_F32: FOSSIL_TOFU_VECTOR_SCAN(float)
+        case FOSSIL_TOFU_TYPE_F64: FOSSIL_TOFU_VECTOR_SCAN(double)
+        default: return vector->size;
+    }
+}
+
+int32_t fossil_tofu_vector_index_of(const fossil_tofu_vector_t* vector, char *element, size_t* index) {
+    if (vector == NULL || element == NULL || index == NULL) {
+        return FOSSIL_TOFU_ERROR_NULL_POINTER;
+    }
+    size_t found = fossil_tofu_vector_is_columnar(vector)
+        ? fossil_tofu_vector_column_search(vector, element)
+        : fossil_tofu_search(vector->data, vector->size, fossil_tofu_validate_type(vector->type), element);
+    if (found >= vector->size) {
+        return FOSSIL_TOFU_ERROR_NOT_FOUND;
+    }
+    *index = found;
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+char *fossil_tofu_vector_find(const fossil_tofu_vector_t* vector, char *element) {
+    size_t index = 0;
+    if (fossil_tofu_vector_index_of(vector, element, &index) != FOSSIL_TOFU_SUCCESS) {
+        return NULL;
+    }
+    return fossil_tofu_vector_get(vector, index);
+}
+
+bool fossil_tofu_vector_contains(const fossil_tofu_vector_t* vector, char *element) {
+    size_t index = 0;
+    return fossil_tofu_vector_index_of(vector, element, &index) == FOSSIL_TOFU_SUCCESS;
+}
+
+// *****************************************************************************
+// Bulk transform functions
+// *****************************************************************************
+
+// Ranges smaller than this are not worth a thread of their own.
+#define FOSSIL_TOFU_VECTOR_GRAIN 1024
+#define FOSSIL_TOFU_VECTOR_MAX_THREADS 64
+
+typedef struct fossil_tofu_vector_task {
+    void (*run)(struct fossil_tofu_vector_task *task);
+    const fossil_tofu_vector_t *vector;
+    fossil_tofu_vector_t *target;
+    size_t begin;
+    size_t end;
+    void *context;
+    void *accumulator;
+    uint8_t *keep;
+    fossil_tofu_vector_each_fn each;
+    fossil_tofu_vector_map_fn map;
+    fossil_tofu_vector_pred_fn pred;
+    fossil_tofu_vector_fold_fn fold;
+    bool failed;
+} fossil_tofu_vector_task_t;
+
+static void fossil_tofu_vector_task_entry(void *arg) {
+    fossil_tofu_vector_task_t *task = (fossil_tofu_vector_task_t*)arg;
+    task->run(task);
+}
+
+// Splits [0, size) into at most `threads` ranges whose boundaries are
+// multiples of 8, so no two workers share a byte of a null bitmap.
+static size_t fossil_tofu_vector_split(fossil_tofu_vector_task_t *tasks, size_t size, size_t threads) {
+    if (threads == 0) {
+        threads = fossil_tofu_cpu_count();
+    }
+    if (threads > FOSSIL_TOFU_VECTOR_MAX_THREADS) {
+        threads = FOSSIL_TOFU_VECTOR_MAX_THREADS;
+    }
+    size_t by_grain = (size + FOSSIL_TOFU_VECTOR_GRAIN - 1) / FOSSIL_TOFU_VECTOR_GRAIN;
+    size_t count = threads < by_grain ? threads : by_grain;
+    if (count == 0) {
+        count = 1;
+    }
+    size_t chunk = ((size / count + 7) / 8) * 8;
+    size_t begin = 0;
+    size_t used = 0;
+    for (; used < count && begin < size; used++) {
+        size_t end = (used + 1 == count || begin + chunk > size) ? size : begin + chunk;
+        tasks[used].begin = begin;
+        tasks[used].end = end;
+        begin = end;
+    }
+    if (used == 0) {
+        tasks[0].begin = tasks[0].end = 0;
+        used = 1;
+    }
+    return used;
+}
+
+// Runs every task to completion on the shared worker pool. The calling
+// thread takes part, and everything runs inline when no workers exist.
+static void fossil_tofu_vector_fork_join(fossil_tofu_vector_task_t *tasks, size_t count) {
+    fossil_tofu_pool_run(fossil_tofu_vector_task_entry, tasks, sizeof(fossil_tofu_vector_task_t), count);
+}
+
+static void fossil_tofu_vector_run_each(fossil_tofu_vector_task_t *task) {
+    char buf[FOSSIL_TOFU_VECTOR_MAP_BUFFER];
+    for (size_t i = task->begin; i < task->end; i++) {
+        task->each(i, fossil_tofu_vector_element(task->vector, i, buf, sizeof(buf)), task->context);
+    }
+}
+
+static void fossil_tofu_vector_run_pred(fossil_tofu_vector_task_t *task) {
+    char buf[FOSSIL_TOFU_VECTOR_MAP_BUFFER];
+    for (size_t i = task->begin; i < task->end; i++) {
+        task->keep[i] = task->pred(fossil_tofu_vector_element(task->vector, i, buf, sizeof(buf)), task->context) ? 1 : 0;
+    }
+}
+
+static void fossil_tofu_vector_run_fold(fossil_tofu_vector_task_t *task) {
+    char buf[FOSSIL_TOFU_VECTOR_MAP_BUFFER];
+    for (size_t i = task->begin; i < task->end; i++) {
+        task->fold(task->accumulator, fossil_tofu_vector_element(task->vector, i, buf, sizeof(buf)), task->context);
+    }
+}
+
+// Writes mapped values straight into pre-sized slots of the target.
+static void fossil_tofu_vector_run_map(fossil_tofu_vector_task_t *task) {
+    char in[FOSSIL_TOFU_VECTOR_MAP_BUFFER];
+    char out[FOSSIL_TOFU_VECTOR_MAP_BUFFER];
+    fossil_tofu_vector_t *target = task->target;
+    for (size_t i = task->begin; i < task->end; i++) {
+        out[0] = '\0';
+        if (!task->map(fossil_tofu_vector_element(task->vector, i, in, sizeof(in)), out, sizeof(out), task->context)) {
+            task->failed = true;
+            return;
+        }
+        if (fossil_tofu_vector_is_columnar(target)) {
+            if (fossil_tofu_vector_column_store(target, i, out) != FOSSIL_TOFU_SUCCESS) {
+                task->failed = true;
+                return;
+            }
+        } else {
+            target->data[i] = fossil_tofu_create(target->type, out);
+        }
+    }
+}
+
+// Creates an empty vector of the given type able to hold `size` elements
+// without growing. Columnar sources map into columnar targets when the
+// target type has a packed representation.
+static fossil_tofu_vector_t *fossil_tofu_vector_create_target(const fossil_tofu_vector_t* source, char *type, size_t size) {
+    bool columnar = fossil_tofu_vector_is_columnar(source) &&
+                    fossil_tofu_vector_column_width(fossil_tofu_validate_type(type)) != 0;
+    fossil_tofu_vector_t *target = columnar ? fossil_tofu_vector_create_columnar(type)
+                                            : fossil_tofu_vector_create_container(type);
+    if (target == NULL || size <= target->capacity) {
+        return target;
+    }
+    if (columnar) {
+        void *column = fossil_tofu_realloc(target->column, size * target->element_size);
+        if (column == NULL) {
+            fossil_tofu_vector_destroy(target);
+            return NULL;
+        }
+        target->column = column;
+    } else {
+        fossil_tofu_t *data = (fossil_tofu_t*)fossil_tofu_realloc(target->data, size * sizeof(fossil_tofu_t));
+        if (data == NULL) {
+            fossil_tofu_vector_destroy(target);
+            return NULL;
+        }
+        target->data = data;
+    }
+    target->capacity = size;
+    return target;
+}
+
+static void fossil_tofu_vector_destroy_deep(fossil_tofu_vector_t* vector) {
+    if (vector != NULL && !fossil_tofu_vector_is_columnar(vector)) {
+        for (size_t i = 0; i < vector->size; i++) {
+            fossil_tofu_destroy(&vector->data[i]);
+        }
+    }
+    fossil_tofu_vector_destroy(vector);
+}
+
+// Moves kept elements to the front, destroying the rest. The keep mask is
+// consulted when present; otherwise the predicate is evaluated inline.
+static size_t fossil_tofu_vector_compact(fossil_tofu_vector_t* vector, const uint8_t *keep, fossil_tofu_vector_pred_fn pred, void *context) {
+    char buf[FOSSIL_TOFU_VECTOR_MAP_BUFFER];
+    bool columnar = fossil_tofu_vector_is_columnar(vector);
+    size_t kept = 0;
+    for (size_t i = 0; i < vector->size; i++) {
+        bool stay = keep != NULL ? keep[i] != 0
+                                 : pred(fossil_tofu_vector_element(vector, i, buf, sizeof(buf)), context);
+        if (!stay) {
+            if (!columnar) {
+                fossil_tofu_destroy(&vector->data[i]);
+            }
+            continue;
+        }
+        if (kept != i) {
+            if (columnar) {
+                memcpy(fossil_tofu_vector_column_slot(vector, kept), fossil_tofu_vector_column_slot(vector, i), vector->element_size);
+                fossil_tofu_vector_column_mark(vector, kept, fossil_tofu_vector_column_null(vector, i));
+            } else {
+                vector->data[kept] = vector->data[i];
+            }
+        }
+        kept++;
+    }
+    if (columnar && vector->nulls != NULL) {
+        for (size_t i = kept; i < vector->size; i++) {
+            fossil_tofu_vector_column_mark(vector, i, false);
+        }
+    }
+    size_t removed = vector->size - kept;
+    vector->size = kept;
+    return removed;
+}
+
+int32_t fossil_tofu_vector_for_each(const fossil_tofu_vector_t* vector, fossil_tofu_vector_each_fn each, void* context) {
+    if (vector == NULL || each == NULL) {
+        return FOSSIL_TOFU_ERROR_NULL_POINTER;
+    }
+    fossil_tofu_vector_task_t task = {0};
+    task.run = fossil_tofu_vector_run_each;
+    task.vector = vector;
+    task.end = vector->size;
+    task.each = each;
+    task.context = context;
+    task.run(&task);
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+fossil_tofu_vector_t* fossil_tofu_vector_map(const fossil_tofu_vector_t* vector, char *type, fossil_tofu_vector_map_fn map, void* context) {
+    return fossil_tofu_vector_parallel_map(vector, type, map, context, 1);
+}
+
+size_t fossil_tofu_vector_filter(fossil_tofu_vector_t* vector, fossil_tofu_vector_pred_fn pred, void* context) {
+    if (vector == NULL || pred == NULL) {
+        return 0;
+    }
+    return fossil_tofu_vector_compact(vector, NULL, pred, context);
+}
+
+int32_t fossil_tofu_vector_reduce(const fossil_tofu_vector_t* vector, void* accumulator, fossil_tofu_vector_fold_fn fold, void* context) {
+    if (vector == NULL || accumulator == NULL || fold == NULL) {
+        return FOSSIL_TOFU_ERROR_NULL_POINTER;
+    }
+    fossil_tofu_vector_task_t task = {0};
+    task.run = fossil_tofu_vector_run_fold;
+    task.vector = vector;
+    task.end = vector->size;
+    task.fold = fold;
+    task.accumulator = accumulator;
+    task.context = context;
+    task.run(&task);
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+int32_t fossil_tofu_vector_parallel_for_each(const fossil_tofu_vector_t* vector, fossil_tofu_vector_each_fn each, void* context, size_t threads) {
+    if (vector == NULL || each == NULL) {
+        return FOSSIL_TOFU_ERROR_NULL_POINTER;
+    }
+    fossil_tofu_vector_task_t tasks[FOSSIL_TOFU_VECTOR_MAX_THREADS] = {0};
+    size_t count = fossil_tofu_vector_split(tasks, vector->size, threads);
+    for (size_t i = 0; i < count; i++) {
+        tasks[i].run = fossil_tofu_vector_run_each;
+        tasks[i].vector = vector;
+        tasks[i].each = each;
+        tasks[i].context = context;
+    }
+    fossil_tofu_vector_fork_join(tasks, count);
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+fossil_tofu_vector_t* fossil_tofu_vector_parallel_map(const fossil_tofu_vector_t* vector, char *type, fossil_tofu_vector_map_fn map, void* context, size_t threads) {
+    if (vector == NULL || type == NULL || map == NULL) {
+        return NULL;
+    }
+    fossil_tofu_vector_t *target = fossil_tofu_vector_create_target(vector, type, vector->size);
+    if (target == NULL) {
+        return NULL;
+    }
+    if (fossil_tofu_vector_is_columnar(target) && vector->size > 0) {
+        // Allocated up front so workers never race to create it.
+        size_t bytes = (target->capacity + 7) / 8;
+        target->nulls = (uint8_t*)fossil_tofu_alloc(bytes);
+        if (target->nulls == NULL) {
+            fossil_tofu_vector_destroy(target);
+            return NULL;
+        }
+        memset(target->nulls, 0, bytes);
+    } else if (!fossil_tofu_vector_is_columnar(target)) {
+        memset(target->data, 0, target->capacity * sizeof(fossil_tofu_t));
+    }
+
+    fossil_tofu_vector_task_t tasks[FOSSIL_TOFU_VECTOR_MAX_THREADS] = {0};
+    size_t count = fossil_tofu_vector_split(tasks, vector->size, threads);
+    for (size_t i = 0; i < count; i++) {
+        tasks[i].run = fossil_tofu_vector_run_map;
+        tasks[i].vector = vector;
+        tasks[i].target = target;
+        tasks[i].map = map;
+        tasks[i].context = context;
+    }
+    fossil_tofu_vector_fork_join(tasks, count);
+    target->size = vector->size;
+
+    for (size_t i = 0; i < count; i++) {
+        if (tasks[i].failed) {
+            fossil_tofu_vector_destroy_deep(target);
+            return NULL;
+        }
+    }
+    if (target->nulls != NULL) {
+        bool any = false;
+        for (size_t i = 0; i < (target->capacity + 7) / 8 && !any; i++) {
+            any = target->nulls[i] != 0;
+        }
+        if (!any) {
+            fossil_tofu_free(target->nulls);
+            target->nulls = NULL;
+        }
+    }
+    return target;
+}
+
+size_t fossil_tofu_vector_parallel_filter(fossil_tofu_vector_t* vector, fossil_tofu_vector_pred_fn pred, void* context, size_t threads) {
+    if (vector == NULL || pred == NULL) {
+        return 0;
+    }
+    uint8_t *keep = (uint8_t*)fossil_tofu_alloc(vector->size ? vector->size : 1);
+    if (keep == NULL) {
+        return fossil_tofu_vector_compact(vector, NULL, pred, context);
+    }
+    fossil_tofu_vector_task_t tasks[FOSSIL_TOFU_VECTOR_MAX_THREADS] = {0};
+    size_t count = fossil_tofu_vector_split(tasks, vector->size, threads);
+    for (size_t i = 0; i < count; i++) {
+        tasks[i].run = fossil_tofu_vector_run_pred;
+        tasks[i].vector = vector;
+        tasks[i].pred = pred;
+        tasks[i].keep = keep;
+        tasks[i].context = context;
+    }
+    fossil_tofu_vector_fork_join(tasks, count);
+    size_t removed = fossil_tofu_vector_compact(vector, keep, NULL, NULL);
+    fossil_tofu_free(keep);
+    return removed;
+}
+
+int32_t fossil_tofu_vector_parallel_reduce(const fossil_tofu_vector_t* vector, void* accumulator, size_t size,
+                                           fossil_tofu_vector_fold_fn fold, fossil_tofu_vector_combine_fn combine,
+                                           void* context, size_t threads) {
+    if (vector == NULL || accumulator == NULL || fold == NULL || combine == NULL) {
+        return FOSSIL_TOFU_ERROR_NULL_POINTER;
+    }
+    if (size == 0) {
+        return FOSSIL_TOFU_ERROR_INVALID_ARGUMENT;
+    }
+    fossil_tofu_vector_task_t tasks[FOSSIL_TOFU_VECTOR_MAX_THREADS] = {0};
+    size_t count = fossil_tofu_vector_split(tasks, vector->size, threads);
+    if (count == 1) {
+        return fossil_tofu_vector_reduce(vector, accumulator, fold, context);
+    }
+    // Every worker folds into its own copy of the initial accumulator, which
+    // must therefore be an identity for combine. The partials are combined
+    // in index order on the calling thread.
+    uint8_t *partials = (uint8_t*)fossil_tofu_alloc(count * size);
+    if (partials == NULL) {
+        return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+    }
+    for (size_t i = 0; i < count; i++) {
+        memcpy(partials + i * size, accumulator, size);
+        tasks[i].run = fossil_tofu_vector_run_fold;
+        tasks[i].vector = vector;
+        tasks[i].fold = fold;
+        tasks[i].accumulator = partials + i * size;
+        tasks[i].context = context;
+    }
+    fossil_tofu_vector_fork_join(tasks, count);
+    memcpy(accumulator, partials, size);
+    for (size_t i = 1; i < count; i++) {
+        combine(accumulator, partials + i * size, context);
+    }
+    fossil_tofu_free(partials);
+    return FOSSIL_TOFU_SUCCESS;
 }
@@ -0,0 +1,273 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include "fossil/tofu/wsdeque.h"
+#include "fossil/tofu/atomics.h"
+
+// *****************************************************************************
+// Deque state
+// *****************************************************************************
+
+#define FOSSIL_TOFU_WSDEQUE_LINE 64     // Assumed cache line size
+#define FOSSIL_TOFU_WSDEQUE_DEFAULT 32  // Initial array size
+
+// Circular array of boxed tofus. Cells are atomic pointers so a thief can
+// read one while the owner writes another.
+typedef struct fossil_tofu_wsdeque_ring_t {
+    int64_t size;
+    int64_t mask;
+    struct fossil_tofu_wsdeque_ring_t* retired; // Older arrays, freed on destroy
+    fossil_tofu_atomic_ptr_t cells[];
+} fossil_tofu_wsdeque_ring_t;
+
+// 'top' is advanced by thieves (and by the owner for the last element),
+// 'bottom' only by the owner; they sit on separate cache lines.
+struct fossil_tofu_wsdeque_state_t {
+    char pad0[FOSSIL_TOFU_WSDEQUE_LINE];
+    fossil_tofu_atomic_i64_t top;
+    char pad1[FOSSIL_TOFU_WSDEQUE_LINE];
+    fossil_tofu_atomic_i64_t bottom;
+    fossil_tofu_atomic_ptr_t ring; // fossil_tofu_wsdeque_ring_t*
+    char pad2[FOSSIL_TOFU_WSDEQUE_LINE];
+};
+
+static fossil_tofu_wsdeque_ring_t* fossil_tofu_wsdeque_ring(int64_t size) {
+    fossil_tofu_wsdeque_ring_t* ring = (fossil_tofu_wsdeque_ring_t*)fossil_tofu_alloc(sizeof(fossil_tofu_wsdeque_ring_t) + (size_t)size * sizeof(fossil_tofu_atomic_ptr_t));
+    if (ring == NULL) {
+        return NULL;
+    }
+    ring->size = size;
+    ring->mask = size - 1;
+    ring->retired = NULL;
+    for (int64_t i = 0; i < size; i++) {
+        fossil_tofu_atomic_ptr_init(&ring->cells[i], NULL);
+    }
+    return ring;
+}
+
+// Double the array, copying the live range [top, bottom). Owner only.
+static fossil_tofu_wsdeque_ring_t* fossil_tofu_wsdeque_grow(fossil_tofu_wsdeque_state_t* state, fossil_tofu_wsdeque_ring_t* old, int64_t top, int64_t bottom) {
+    fossil_tofu_wsdeque_ring_t* ring = fossil_tofu_wsdeque_ring(old->size * 2);
+    if (ring == NULL) {
+        return NULL;
+    }
+    for (int64_t i = top; i < bottom; i++) {
+        fossil_tofu_t* box = (fossil_tofu_t*)fossil_tofu_atomic_ptr_load(&old->cells[i & old->mask], FOSSIL_TOFU_RELAXED);
+        fossil_tofu_atomic_ptr_store(&ring->cells[i & ring->mask], box, FOSSIL_TOFU_RELAXED);
+    }
+    ring->retired = old;
+    fossil_tofu_atomic_ptr_store(&state->ring, ring, FOSSIL_TOFU_RELEASE);
+    return ring;
+}
+
+// *****************************************************************************
+// Function prototypes
+// *****************************************************************************
+
+fossil_tofu_wsdeque_t* fossil_tofu_wsdeque_create_container(char* type, size_t capacity) {
+    if (type == NULL || capacity > ((size_t)INT64_MAX >> 4)) {
+        return NULL;
+    }
+    int64_t size = FOSSIL_TOFU_WSDEQUE_DEFAULT;
+    if (capacity > 0) {
+        size = 1;
+        while ((size_t)size < capacity) {
+            size <<= 1;
+        }
+    }
+    fossil_tofu_wsdeque_t* wsdeque = (fossil_tofu_wsdeque_t*)fossil_tofu_alloc(sizeof(fossil_tofu_wsdeque_t));
+    if (wsdeque == NULL) {
+        return NULL;
+    }
+    wsdeque->type = fossil_tofu_strdup(type);
+    wsdeque->state = (fossil_tofu_wsdeque_state_t*)fossil_tofu_alloc(sizeof(fossil_tofu_wsdeque_state_t));
+    fossil_tofu_wsdeque_ring_t* ring = fossil_tofu_wsdeque_ring(size);
+    if (wsdeque->type == NULL || wsdeque->state == NULL || ring == NULL) {
+        fossil_tofu_free(ring);
+        fossil_tofu_free(wsdeque->state);
+        fossil_tofu_free(wsdeque->type);
+        fossil_tofu_free(wsdeque);
+        return NULL;
+    }
+    fossil_tofu_atomic_i64_init(&wsdeque->state->top, 0);
+    fossil_tofu_atomic_i64_init(&wsdeque->state->bottom, 0);
+    fossil_tofu_atomic_ptr_init(&wsdeque->state->ring, ring);
+    return wsdeque;
+}
+
+void fossil_tofu_wsdeque_destroy(fossil_tofu_wsdeque_t* wsdeque) {
+    if (wsdeque == NULL) {
+        return;
+    }
+    fossil_tofu_wsdeque_state_t* state = wsdeque->state;
+    fossil_tofu_wsdeque_ring_t* ring = (fossil_tofu_wsdeque_ring_t*)fossil_tofu_atomic_ptr_load(&state->ring, FOSSIL_TOFU_RELAXED);
+    int64_t top = fossil_tofu_atomic_i64_load(&state->top, FOSSIL_TOFU_RELAXED);
+    int64_t bottom = fossil_tofu_atomic_i64_load(&state->bottom, FOSSIL_TOFU_RELAXED);
+    for (int64_t i = top; i < bottom; i++) {
+        fossil_tofu_t* box = (fossil_tofu_t*)fossil_tofu_atomic_ptr_load(&ring->cells[i & ring->mask], FOSSIL_TOFU_RELAXED);
+        fossil_tofu_destroy(box);
+        fossil_tofu_free(box);
+    }
+    while (ring != NULL) {
+        fossil_tofu_wsdeque_ring_t* retired = ring->retired;
+        fossil_tofu_free(ring);
+        ring = retired;
+    }
+    fossil_tofu_free(state);
+    fossil_tofu_free(wsdeque->type);
+    fossil_tofu_free(wsdeque);
+}
+
+// *****************************************************************************
+// Utility functions
+// *****************************************************************************
+
+int32_t fossil_tofu_wsdeque_push_tofu(fossil_tofu_wsdeque_t* wsdeque, fossil_tofu_t* tofu) {
+    if (wsdeque == NULL || tofu == NULL || tofu->value.data == NULL) {
+        return FOSSIL_TOFU_ERROR_INVALID_ARGUMENT;
+    }
+    fossil_tofu_wsdeque_state_t* state = wsdeque->state;
+    fossil_tofu_t* box = (fossil_tofu_t*)fossil_tofu_alloc(sizeof(fossil_tofu_t));
+    if (box == NULL) {
+        return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+    }
+    int64_t bottom = fossil_tofu_atomic_i64_load(&state->bottom, FOSSIL_TOFU_RELAXED);
+    int64_t top = fossil_tofu_atomic_i64_load(&state->top, FOSSIL_TOFU_ACQUIRE);
+    fossil_tofu_wsdeque_ring_t* ring = (fossil_tofu_wsdeque_ring_t*)fossil_tofu_atomic_ptr_load(&state->ring, FOSSIL_TOFU_RELAXED);
+    if (bottom - top > ring->size - 1) {
+        ring = fossil_tofu_wsdeque_grow(state, ring, top, bottom);
+        if (ring == NULL) {
+            fossil_tofu_free(box);
+            return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+        }
+    }
+    *box = *tofu;
+    memset(tofu, 0, sizeof(*tofu));
+    // Release on the cell and on bottom so a thief that wins this element
+    // also sees the box contents
+    fossil_tofu_atomic_ptr_store(&ring->cells[bottom & ring->mask], box, FOSSIL_TOFU_RELEASE);
+    fossil_tofu_atomic_i64_store(&state->bottom, bottom + 1, FOSSIL_TOFU_RELEASE);
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+int32_t fossil_tofu_wsdeque_push(fossil_tofu_wsdeque_t* wsdeque, char *data) {
+    if (wsdeque == NULL || data == NULL) {
+        return FOSSIL_TOFU_ERROR_INVALID_ARGUMENT;
+    }
+    fossil_tofu_t tofu = fossil_tofu_create(wsdeque->type, data);
+    if (tofu.value.data == NULL) {
+        return FOSSIL_TOFU_ERROR_MEMORY_ALLOCATION;
+    }
+    int32_t result = fossil_tofu_wsdeque_push_tofu(wsdeque, &tofu);
+    if (result != FOSSIL_TOFU_SUCCESS) {
+        fossil_tofu_destroy(&tofu);
+    }
+    return result;
+}
+
+int32_t fossil_tofu_wsdeque_pop(fossil_tofu_wsdeque_t* wsdeque, fossil_tofu_t* out) {
+    if (wsdeque == NULL || out == NULL) {
+        return FOSSIL_TOFU_ERROR_INVALID_ARGUMENT;
+    }
+    fossil_tofu_wsdeque_state_t* state = wsdeque->state;
+    int64_t bottom = fossil_tofu_atomic_i64_load(&state->bottom, FOSSIL_TOFU_RELAXED) - 1;
+    fossil_tofu_wsdeque_ring_t* ring = (fossil_tofu_wsdeque_ring_t*)fossil_tofu_atomic_ptr_load(&state->ring, FOSSIL_TOFU_RELAXED);
+    // Reserve the bottom element before looking at top; the fence orders
+    // this store against a concurrent thief's read of bottom
+    fossil_tofu_atomic_i64_store(&state->bottom, bottom, FOSSIL_TOFU_RELAXED);
+    fossil_tofu_atomic_fence();
+    int64_t top = fossil_tofu_atomic_i64_load(&state->top, FOSSIL_TOFU_RELAXED);
+
+    if (top > bottom) {
+        fossil_tofu_atomic_i64_store(&state->bottom, bottom + 1, FOSSIL_TOFU_RELAXED);
+        return FOSSIL_TOFU_FAILURE;  // Deque is empty
+    }
+    fossil_tofu_t* box = (fossil_tofu_t*)fossil_tofu_atomic_ptr_load(&ring->cells[bottom & ring->mask], FOSSIL_TOFU_RELAXED);
+    if (top == bottom) {
+        // Last element: race the thieves for it through top
+        bool won = fossil_tofu_atomic_i64_cas(&state->top, &top, top + 1, FOSSIL_TOFU_SEQ_CST);
+        fossil_tofu_atomic_i64_store(&state->bottom, bottom + 1, FOSSIL_TOFU_RELAXED);
+        if (!won) {
+            return FOSSIL_TOFU_FAILURE;  // A thief took it
+        }
+    }
+    *out = *box;
+    fossil_tofu_free(box);
+    return FOSSIL_TOFU_SUCCESS;
+}
+
+int32_t fossil_tofu_wsdeque_steal(fossil_tofu_wsdeque_t* wsdeque, fossil_tofu_t* out) {
+    if (wsdeque == NULL || out == NULL) {
+        return FOSSIL_TOFU_ERROR_INVALID_ARGUMENT;
+    }
+    fossil_tofu_wsdeque_state_t* state = wsdeque->state;
+    for (;;) {
+        int64_t top = fossil_tofu_atomic_i64_load(&state->top, FOSSIL_TOFU_ACQUIRE);
+        fossil_tofu_atomic_fence();
+        int64_t bottom = fossil_tofu_atomic_i64_load(&state->bottom, FOSSIL_TOFU_ACQUIRE);
+        if (top >= bottom) {
+            return FOSSIL_TOFU_FAILURE;  // Deque is empty
+        }
+        fossil_tofu_wsdeque_ring_t* ring = (fossil_tofu_wsdeque_ring_t*)fossil_tofu_atomic_ptr_load(&state->ring, FOSSIL_TOFU_ACQUIRE);
+        fossil_tofu_t* box = (fossil_tofu_t*)fossil_tofu_atomic_ptr_load(&ring->cells[top & ring->mask], FOSSIL_TOFU_ACQUIRE);
+        // The box is only dereferenced once the CAS makes it ours
+        if (fossil_tofu_atomic_i64_cas(&state->top, &top, top + 1, FOSSIL_TOFU_SEQ_CST)) {
+            *out = *box;
+            fossil_tofu_free(box);
+            return FOSSIL_TOFU_SUCCESS;
+        }
+    }
+}
+
+size_t fossil_tofu_wsdeque_size(const fossil_tofu_wsdeque_t* wsdeque) {
+    if (wsdeque == NULL) {
+        return 0;
+    }
+    int64_t top = fossil_tofu_atomic_i64_load(&wsdeque->state->top, FOSSIL_TOFU_ACQUIRE);
+    int64_t bottom = fossil_tofu_atomic_i64_load(&wsdeque->state->bottom, FOSSIL_TOFU_ACQUIRE);
+    return bottom > top ? (size_t)(bottom - top) : 0;
+}
+
+size_t fossil_tofu_wsdeque_capacity(const fossil_tofu_wsdeque_t* wsdeque) {
+    if (wsdeque == NULL) {
+        return 0;
+    }
+    return (size_t)((fossil_tofu_wsdeque_ring_t*)fossil_tofu_atomic_ptr_load(&wsdeque->state->ring, FOSSIL_TOFU_ACQUIRE))->size;
+}
+
+bool fossil_tofu_wsdeque_not_empty(const fossil_tofu_wsdeque_t* wsdeque) {
+    return fossil_tofu_wsdeque_size(wsdeque) > 0;
+}
+
+bool fossil_tofu_wsdeque_not_cnullptr(const fossil_tofu_wsdeque_t* wsdeque) {
+    return wsdeque != NULL;
+}
+
+bool fossil_tofu_wsdeque_is_empty(const fossil_tofu_wsdeque_t* wsdeque) {
+    return fossil_tofu_wsdeque_size(wsdeque) == 0;
+}
+
+bool fossil_tofu_wsdeque_is_cnullptr(const fossil_tofu_wsdeque_t* wsdeque) {
+    return wsdeque == NULL;
+}
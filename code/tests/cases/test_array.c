@@ -225,6 +225,36 @@ FOSSIL_TEST(c_test_array_pop_at_various_positions) {
     fossil_tofu_array_destroy(array);
 }
 
+FOSSIL_TEST(c_test_array_aggregate) {
+    fossil_tofu_array_t* array = fossil_tofu_array_create_container("f32");
+    fossil_tofu_array_push_back(array, "1.5");
+    fossil_tofu_array_push_back(array, "-2.5");
+    fossil_tofu_array_push_back(array, "4.0");
+    double out = 0.0;
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_array_sum(array, &out), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_F64(out, 3.0, 1e-9);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_array_min(array, &out), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_F64(out, -2.5, 1e-9);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_array_max(array, &out), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_F64(out, 4.0, 1e-9);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_array_mean(array, &out), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_F64(out, 1.0, 1e-9);
+    fossil_tofu_array_destroy(array);
+}
+
+FOSSIL_TEST(c_test_array_search) {
+    fossil_tofu_array_t* array = fossil_tofu_array_create_container("i32");
+    fossil_tofu_array_push_back(array, "7");
+    fossil_tofu_array_push_back(array, "11");
+    fossil_tofu_array_push_back(array, "7");
+    size_t index = 99;
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_array_index_of(array, "7", &index), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_SIZE(index, 0);
+    ASSUME_ITS_TRUE(fossil_tofu_array_contains(array, "11"));
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_array_index_of(array, "12", &index), FOSSIL_TOFU_ERROR_NOT_FOUND);
+    fossil_tofu_array_destroy(array);
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -244,6 +274,8 @@ FOSSIL_TEST_GROUP(c_array_tofu_tests) {
     FOSSIL_TEST_ADD(c_array_tofu_fixture, c_test_array_set_at_various_positions);
     FOSSIL_TEST_ADD(c_array_tofu_fixture, c_test_array_push_at_beginning_and_end);
     FOSSIL_TEST_ADD(c_array_tofu_fixture, c_test_array_pop_at_various_positions);
+    FOSSIL_TEST_ADD(c_array_tofu_fixture, c_test_array_aggregate);
+    FOSSIL_TEST_ADD(c_array_tofu_fixture, c_test_array_search);
 
     FOSSIL_TEST_REGISTER(c_array_tofu_fixture);
 } // end of tests
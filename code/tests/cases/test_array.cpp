@@ -201,6 +201,25 @@ FOSSIL_TEST(cpp_test_array_pop_at_various_positions) {
     ASSUME_ITS_EQUAL_I32(array.size(), 1);
 }
 
+FOSSIL_TEST(cpp_test_array_aggregate) {
+    Array array("i32");
+    array.push_back("3");
+    array.push_back("9");
+    ASSUME_ITS_EQUAL_F64(array.sum(), 12.0, 1e-9);
+    ASSUME_ITS_EQUAL_F64(array.mean(), 6.0, 1e-9);
+    ASSUME_ITS_EQUAL_F64(array.variance(), 9.0, 1e-9);
+}
+
+FOSSIL_TEST(cpp_test_array_search) {
+    Array array("i32");
+    array.push_back("4");
+    array.push_back("8");
+    size_t index = 0;
+    ASSUME_ITS_TRUE(array.index_of("8", index));
+    ASSUME_ITS_EQUAL_SIZE(index, 1);
+    ASSUME_ITS_FALSE(array.contains("16"));
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -219,6 +238,8 @@ FOSSIL_TEST_GROUP(cpp_array_tofu_tests) {
     FOSSIL_TEST_ADD(cpp_array_tofu_fixture, cpp_test_array_set_at_various_positions);
     FOSSIL_TEST_ADD(cpp_array_tofu_fixture, cpp_test_array_push_at_beginning_and_end);
     FOSSIL_TEST_ADD(cpp_array_tofu_fixture, cpp_test_array_pop_at_various_positions);
+    FOSSIL_TEST_ADD(cpp_array_tofu_fixture, cpp_test_array_aggregate);
+    FOSSIL_TEST_ADD(cpp_array_tofu_fixture, cpp_test_array_search);
 
     FOSSIL_TEST_REGISTER(cpp_array_tofu_fixture);
 } // end of tests
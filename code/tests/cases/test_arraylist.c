@@ -143,6 +143,19 @@ FOSSIL_TEST(c_test_arraylist_empty_and_null_checks) {
     fossil_tofu_arraylist_destroy(alist);
 }
 
+FOSSIL_TEST(c_test_arraylist_search) {
+    fossil_tofu_arraylist_t* alist = fossil_tofu_arraylist_create_container("cstr", 4);
+    fossil_tofu_arraylist_insert(alist, "alpha");
+    fossil_tofu_arraylist_insert(alist, "beta");
+    fossil_tofu_arraylist_insert(alist, "gamma");
+    size_t index = 0;
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_arraylist_index_of(alist, "gamma", &index), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_SIZE(index, 2);
+    ASSUME_ITS_TRUE(fossil_tofu_arraylist_contains(alist, "beta"));
+    ASSUME_ITS_FALSE(fossil_tofu_arraylist_contains(alist, "delta"));
+    fossil_tofu_arraylist_destroy(alist);
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -157,6 +170,7 @@ FOSSIL_TEST_GROUP(c_arraylist_tofu_tests) {
     FOSSIL_TEST_ADD(c_arraylist_tofu_fixture, c_test_arraylist_set_front_and_back);
     FOSSIL_TEST_ADD(c_arraylist_tofu_fixture, c_test_arraylist_copy_and_move);
     FOSSIL_TEST_ADD(c_arraylist_tofu_fixture, c_test_arraylist_empty_and_null_checks);
+    FOSSIL_TEST_ADD(c_arraylist_tofu_fixture, c_test_arraylist_search);
 
     // Register the test group
     FOSSIL_TEST_REGISTER(c_arraylist_tofu_fixture);
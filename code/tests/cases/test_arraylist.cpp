@@ -137,6 +137,16 @@ FOSSIL_TEST(cpp_test_arraylist_empty_and_null_checks) {
     ASSUME_ITS_TRUE(alist2.not_empty());
 }
 
+FOSSIL_TEST(cpp_test_arraylist_search) {
+    ArrayList alist("cstr", 4);
+    alist.insert("north");
+    alist.insert("south");
+    size_t index = 0;
+    ASSUME_ITS_TRUE(alist.index_of("south", index));
+    ASSUME_ITS_EQUAL_SIZE(index, 1);
+    ASSUME_ITS_FALSE(alist.contains("east"));
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -151,6 +161,7 @@ FOSSIL_TEST_GROUP(cpp_arraylist_tofu_tests) {
     FOSSIL_TEST_ADD(cpp_arraylist_tofu_fixture, cpp_test_arraylist_set_front_and_back);
     FOSSIL_TEST_ADD(cpp_arraylist_tofu_fixture, cpp_test_arraylist_copy_and_move);
     FOSSIL_TEST_ADD(cpp_arraylist_tofu_fixture, cpp_test_arraylist_empty_and_null_checks);
+    FOSSIL_TEST_ADD(cpp_arraylist_tofu_fixture, cpp_test_arraylist_search);
 
     // Register the test group
     FOSSIL_TEST_REGISTER(cpp_arraylist_tofu_fixture);
@@ -0,0 +1,139 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/pizza/framework.h>
+
+#include "fossil/tofu/framework.h"
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_SUITE(c_bag_tofu_fixture);
+
+FOSSIL_SETUP(c_bag_tofu_fixture) {
+    // Setup the test fixture
+}
+
+FOSSIL_TEARDOWN(c_bag_tofu_fixture) {
+    // Teardown the test fixture
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_TEST(c_test_bag_create_and_destroy) {
+    fossil_tofu_bag_t* bag = fossil_tofu_bag_create_container("cstr");
+    ASSUME_NOT_CNULL(bag);
+    ASSUME_ITS_TRUE(fossil_tofu_bag_is_empty(bag));
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_bag_distinct(bag), 0);
+    fossil_tofu_bag_destroy(bag);
+}
+
+FOSSIL_TEST(c_test_bag_add_and_count) {
+    fossil_tofu_bag_t* bag = fossil_tofu_bag_create_container("cstr");
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_bag_add(bag, "a"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_bag_add(bag, "a"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_bag_add(bag, "b"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_bag_add_count(bag, "c", 5), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_bag_count(bag, "a"), 2);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_bag_count(bag, "c"), 5);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_bag_count(bag, "z"), 0);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_bag_count_key(bag, "abc", 1), 2);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_bag_distinct(bag), 3);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_bag_size(bag), 8);
+    fossil_tofu_bag_destroy(bag);
+}
+
+FOSSIL_TEST(c_test_bag_remove) {
+    fossil_tofu_bag_t* bag = fossil_tofu_bag_create_container("i32");
+    fossil_tofu_bag_add_count(bag, "7", 2);
+    fossil_tofu_bag_add_count(bag, "8", 3);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_bag_remove(bag, "7"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_TRUE(fossil_tofu_bag_contains(bag, "7"));
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_bag_remove(bag, "7"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_FALSE(fossil_tofu_bag_contains(bag, "7"));
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_bag_remove(bag, "7"), FOSSIL_TOFU_ERROR_NOT_FOUND);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_bag_remove_all(bag, "8"), 3);
+    ASSUME_ITS_TRUE(fossil_tofu_bag_is_empty(bag));
+    fossil_tofu_bag_destroy(bag);
+}
+
+static bool c_bag_max_visit(const fossil_tofu_t* item, size_t count, void* context) {
+    size_t* best = (size_t*)context;
+    if (count > *best) *best = count;
+    return true;
+}
+
+FOSSIL_TEST(c_test_bag_frequency_copy_and_for_each) {
+    fossil_tofu_bag_t* bag = fossil_tofu_bag_create_container("i32");
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_bag_reserve(bag, 100), FOSSIL_TOFU_SUCCESS);
+    char text[16];
+    for (int i = 0; i < 1000; i++) {
+        snprintf(text, sizeof(text), "%d", i % 100);
+        fossil_tofu_bag_add(bag, text);
+    }
+    fossil_tofu_bag_add(bag, "42");
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_bag_distinct(bag), 100);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_bag_count(bag, "42"), 11);
+
+    size_t best = 0;
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_bag_for_each(bag, c_bag_max_visit, &best), 100);
+    ASSUME_ITS_EQUAL_SIZE(best, 11);
+
+    fossil_tofu_bag_t* copy = fossil_tofu_bag_create_copy(bag);
+    fossil_tofu_bag_remove_all(bag, "42");
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_bag_count(copy, "42"), 11);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_bag_size(copy), 1001);
+
+    fossil_tofu_bag_t* moved = fossil_tofu_bag_create_move(copy);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_bag_size(moved), 1001);
+    ASSUME_ITS_TRUE(fossil_tofu_bag_is_empty(copy));
+    fossil_tofu_bag_destroy(moved);
+    fossil_tofu_bag_destroy(copy);
+    fossil_tofu_bag_destroy(bag);
+}
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(c_bag_tofu_tests) {    
+    // Generic ToFu Fixture
+    FOSSIL_TEST_ADD(c_bag_tofu_fixture, c_test_bag_create_and_destroy);
+    FOSSIL_TEST_ADD(c_bag_tofu_fixture, c_test_bag_add_and_count);
+    FOSSIL_TEST_ADD(c_bag_tofu_fixture, c_test_bag_remove);
+    FOSSIL_TEST_ADD(c_bag_tofu_fixture, c_test_bag_frequency_copy_and_for_each);
+
+    // Register the test group
+    FOSSIL_TEST_REGISTER(c_bag_tofu_fixture);
+} // end of tests
@@ -0,0 +1,81 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/pizza/framework.h>
+
+#include "fossil/tofu/framework.h"
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_SUITE(cpp_bag_tofu_fixture);
+
+FOSSIL_SETUP(cpp_bag_tofu_fixture) {
+    // Setup the test fixture
+}
+
+FOSSIL_TEARDOWN(cpp_bag_tofu_fixture) {
+    // Teardown the test fixture
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+using fossil::tofu::Bag;
+
+FOSSIL_TEST(cpp_test_bag_basic) {
+    Bag bag("cstr");
+    bag.add("x");
+    bag.add("x", 4);
+    bag.add("y");
+    ASSUME_ITS_EQUAL_SIZE(bag.count("x"), 5);
+    ASSUME_ITS_EQUAL_SIZE(bag.size(), 6);
+    ASSUME_ITS_EQUAL_SIZE(bag.distinct(), 2);
+    bag.remove("x");
+    ASSUME_ITS_EQUAL_SIZE(bag.count("x"), 4);
+    ASSUME_ITS_EQUAL_SIZE(bag.remove_all("x"), 4);
+    ASSUME_ITS_FALSE(bag.contains("x"));
+    ASSUME_ITS_TRUE(bag.contains("y"));
+}
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(cpp_bag_tofu_tests) {    
+    // Generic ToFu Fixture
+    FOSSIL_TEST_ADD(cpp_bag_tofu_fixture, cpp_test_bag_basic);
+
+    // Register the test group
+    FOSSIL_TEST_REGISTER(cpp_bag_tofu_fixture);
+} // end of tests
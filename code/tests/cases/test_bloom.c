@@ -0,0 +1,136 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/pizza/framework.h>
+
+#include "fossil/tofu/framework.h"
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_SUITE(c_bloom_tofu_fixture);
+
+FOSSIL_SETUP(c_bloom_tofu_fixture) {
+    // Setup the test fixture
+}
+
+FOSSIL_TEARDOWN(c_bloom_tofu_fixture) {
+    // Teardown the test fixture
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_TEST(c_test_bloom_create_and_destroy) {
+    fossil_tofu_bloom_t* bloom = fossil_tofu_bloom_create(1000, 0);
+    ASSUME_NOT_CNULL(bloom);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_bloom_count(bloom), 0);
+    ASSUME_ITS_TRUE(fossil_tofu_bloom_bits(bloom) >= 1000 * FOSSIL_TOFU_BLOOM_BITS_PER_KEY);
+    ASSUME_ITS_FALSE(fossil_tofu_bloom_may_contain(bloom, "missing", 7));
+    fossil_tofu_bloom_destroy(bloom);
+}
+
+FOSSIL_TEST(c_test_bloom_no_false_negatives) {
+    fossil_tofu_bloom_t* bloom = fossil_tofu_bloom_create(1000, 0);
+    char key[16];
+    for (int i = 0; i < 1000; i++) {
+        int len = snprintf(key, sizeof(key), "key%d", i);
+        fossil_tofu_bloom_add(bloom, key, (size_t)len);
+    }
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_bloom_count(bloom), 1000);
+    for (int i = 0; i < 1000; i++) {
+        int len = snprintf(key, sizeof(key), "key%d", i);
+        ASSUME_ITS_TRUE(fossil_tofu_bloom_may_contain(bloom, key, (size_t)len));
+    }
+    fossil_tofu_bloom_destroy(bloom);
+}
+
+FOSSIL_TEST(c_test_bloom_false_positive_rate) {
+    fossil_tofu_bloom_t* bloom = fossil_tofu_bloom_create(1000, 10);
+    char key[16];
+    for (int i = 0; i < 1000; i++) {
+        int len = snprintf(key, sizeof(key), "in%d", i);
+        fossil_tofu_bloom_add(bloom, key, (size_t)len);
+    }
+    int hits = 0;
+    for (int i = 0; i < 10000; i++) {
+        int len = snprintf(key, sizeof(key), "out%d", i);
+        if (fossil_tofu_bloom_may_contain(bloom, key, (size_t)len)) hits++;
+    }
+    // About 1% expected at 10 bits per key; allow generous slack.
+    ASSUME_ITS_TRUE(hits < 500);
+    fossil_tofu_bloom_destroy(bloom);
+}
+
+FOSSIL_TEST(c_test_bloom_hash_matches_text) {
+    fossil_tofu_bloom_t* bloom = fossil_tofu_bloom_create(16, 0);
+    fossil_tofu_bloom_add_hash(bloom, fossil_tofu_hash64_seed("abc", 3, 0));
+    ASSUME_ITS_TRUE(fossil_tofu_bloom_may_contain(bloom, "abc", 3));
+    fossil_tofu_bloom_add(bloom, "xyz", 3);
+    ASSUME_ITS_TRUE(fossil_tofu_bloom_may_contain_hash(bloom, fossil_tofu_hash64_seed("xyz", 3, 0)));
+    fossil_tofu_bloom_destroy(bloom);
+}
+
+FOSSIL_TEST(c_test_bloom_copy_clear_reset) {
+    fossil_tofu_bloom_t* bloom = fossil_tofu_bloom_create(16, 0);
+    fossil_tofu_bloom_add(bloom, "abc", 3);
+    fossil_tofu_bloom_t* copy = fossil_tofu_bloom_create_copy(bloom);
+    ASSUME_ITS_TRUE(fossil_tofu_bloom_may_contain(copy, "abc", 3));
+
+    fossil_tofu_bloom_clear(bloom);
+    ASSUME_ITS_FALSE(fossil_tofu_bloom_may_contain(bloom, "abc", 3));
+    ASSUME_ITS_TRUE(fossil_tofu_bloom_may_contain(copy, "abc", 3));
+
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_bloom_reset(copy, 4096), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_TRUE(fossil_tofu_bloom_bits(copy) >= 4096 * FOSSIL_TOFU_BLOOM_BITS_PER_KEY);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_bloom_count(copy), 0);
+    ASSUME_ITS_FALSE(fossil_tofu_bloom_may_contain(copy, "abc", 3));
+    fossil_tofu_bloom_destroy(copy);
+    fossil_tofu_bloom_destroy(bloom);
+}
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(c_bloom_tofu_tests) {    
+    // Generic ToFu Fixture
+    FOSSIL_TEST_ADD(c_bloom_tofu_fixture, c_test_bloom_create_and_destroy);
+    FOSSIL_TEST_ADD(c_bloom_tofu_fixture, c_test_bloom_no_false_negatives);
+    FOSSIL_TEST_ADD(c_bloom_tofu_fixture, c_test_bloom_false_positive_rate);
+    FOSSIL_TEST_ADD(c_bloom_tofu_fixture, c_test_bloom_hash_matches_text);
+    FOSSIL_TEST_ADD(c_bloom_tofu_fixture, c_test_bloom_copy_clear_reset);
+
+    // Register the test group
+    FOSSIL_TEST_REGISTER(c_bloom_tofu_fixture);
+} // end of tests
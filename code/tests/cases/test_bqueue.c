@@ -0,0 +1,168 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/pizza/framework.h>
+
+#include "fossil/tofu/framework.h"
+#include "fossil/tofu/threads.h"
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_SUITE(c_bqueue_tofu_fixture);
+
+FOSSIL_SETUP(c_bqueue_tofu_fixture) {
+    // Setup the test fixture
+}
+
+FOSSIL_TEARDOWN(c_bqueue_tofu_fixture) {
+    // Teardown the test fixture
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_TEST(c_test_bqueue_put_and_take) {
+    fossil_tofu_bqueue_t* queue = fossil_tofu_bqueue_create_container("i32", 2);
+    ASSUME_NOT_CNULL(queue);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_bqueue_capacity(queue), 2);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_bqueue_put(queue, "1", FOSSIL_TOFU_BQUEUE_FOREVER), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_bqueue_put(queue, "2", 0), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_TRUE(fossil_tofu_bqueue_is_full(queue));
+
+    fossil_tofu_t out;
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_bqueue_take(queue, &out, 0), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&out), "1");
+    fossil_tofu_destroy(&out);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_bqueue_size(queue), 1);
+    fossil_tofu_bqueue_destroy(queue);
+}
+
+FOSSIL_TEST(c_test_bqueue_timeouts) {
+    fossil_tofu_bqueue_t* queue = fossil_tofu_bqueue_create_container("i32", 1);
+    fossil_tofu_t out;
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_bqueue_take(queue, &out, 0), FOSSIL_TOFU_FAILURE);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_bqueue_take(queue, &out, 20), FOSSIL_TOFU_FAILURE);
+    fossil_tofu_bqueue_put(queue, "1", 0);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_bqueue_put(queue, "2", 0), FOSSIL_TOFU_FAILURE);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_bqueue_put(queue, "2", 20), FOSSIL_TOFU_FAILURE);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_bqueue_size(queue), 1);
+    ASSUME_ITS_CNULL(fossil_tofu_bqueue_create_container("i32", 0));
+    fossil_tofu_bqueue_destroy(queue);
+}
+
+FOSSIL_TEST(c_test_bqueue_drain_to) {
+    fossil_tofu_bqueue_t* queue = fossil_tofu_bqueue_create_container("i32", 8);
+    fossil_tofu_vector_t* vector = fossil_tofu_vector_create_container("i32");
+    for (int i = 0; i < 5; i++) {
+        char value[8];
+        snprintf(value, sizeof(value), "%d", i);
+        fossil_tofu_bqueue_put(queue, value, 0);
+    }
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_bqueue_drain_to(queue, vector, 3), 3);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_vector_size(vector), 3);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_vector_get(vector, 0), "0");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_vector_get(vector, 2), "2");
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_bqueue_drain_to(queue, vector, 100), 2);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_vector_get(vector, 4), "4");
+    ASSUME_ITS_TRUE(fossil_tofu_bqueue_is_empty(queue));
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_bqueue_drain_to(queue, vector, 4), 0);
+    fossil_tofu_vector_destroy(vector);
+    fossil_tofu_bqueue_destroy(queue);
+}
+
+typedef struct {
+    fossil_tofu_bqueue_t* queue;
+    int count;
+} c_bqueue_producer_t;
+
+static void* c_bqueue_producer(void* arg) {
+    c_bqueue_producer_t* work = (c_bqueue_producer_t*)arg;
+    char value[16];
+    for (int i = 0; i < work->count; i++) {
+        snprintf(value, sizeof(value), "%d", i);
+        fossil_tofu_bqueue_put(work->queue, value, FOSSIL_TOFU_BQUEUE_FOREVER);
+    }
+    return NULL;
+}
+
+FOSSIL_TEST(c_test_bqueue_threaded_backpressure) {
+    fossil_tofu_bqueue_t* queue = fossil_tofu_bqueue_create_container("i32", 4);
+    c_bqueue_producer_t work = {queue, 2000};
+    fossil_tofu_thread_t producer;
+    bool started = fossil_tofu_thread_create(&producer, c_bqueue_producer, &work) == FOSSIL_TOFU_SUCCESS;
+    if (!started) {
+        // No threads on this platform: fill the queue inline instead.
+        work.count = 4;
+        c_bqueue_producer(&work);
+    }
+
+    int expected = 0;
+    bool ordered = true;
+    fossil_tofu_t out[4];
+    while (expected < work.count) {
+        size_t taken = fossil_tofu_bqueue_drain(queue, out, 4);
+        if (taken == 0 && fossil_tofu_bqueue_take(queue, &out[0], FOSSIL_TOFU_BQUEUE_FOREVER) == FOSSIL_TOFU_SUCCESS) {
+            taken = 1;
+        }
+        for (size_t i = 0; i < taken; i++) {
+            if (atoi(fossil_tofu_get_value(&out[i])) != expected) {
+                ordered = false;
+            }
+            expected++;
+            fossil_tofu_destroy(&out[i]);
+        }
+    }
+    if (started) {
+        fossil_tofu_thread_join(producer);
+    }
+
+    ASSUME_ITS_TRUE(ordered);
+    ASSUME_ITS_TRUE(fossil_tofu_bqueue_is_empty(queue));
+    fossil_tofu_bqueue_destroy(queue);
+}
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(c_bqueue_tofu_tests) {    
+    // Generic ToFu Fixture
+    FOSSIL_TEST_ADD(c_bqueue_tofu_fixture, c_test_bqueue_put_and_take);
+    FOSSIL_TEST_ADD(c_bqueue_tofu_fixture, c_test_bqueue_timeouts);
+    FOSSIL_TEST_ADD(c_bqueue_tofu_fixture, c_test_bqueue_drain_to);
+    FOSSIL_TEST_ADD(c_bqueue_tofu_fixture, c_test_bqueue_threaded_backpressure);
+
+    // Register the test group
+    FOSSIL_TEST_REGISTER(c_bqueue_tofu_fixture);
+} // end of tests
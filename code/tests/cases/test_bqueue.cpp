@@ -0,0 +1,107 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/pizza/framework.h>
+
+#include "fossil/tofu/framework.h"
+#include <string>
+#include <thread>
+#include <vector>
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_SUITE(cpp_bqueue_tofu_fixture);
+
+FOSSIL_SETUP(cpp_bqueue_tofu_fixture) {
+    // Setup the test fixture
+}
+
+FOSSIL_TEARDOWN(cpp_bqueue_tofu_fixture) {
+    // Teardown the test fixture
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+using fossil::tofu::BQueue;
+
+FOSSIL_TEST(cpp_test_bqueue_put_and_take) {
+    BQueue queue("i32", 1);
+    ASSUME_ITS_EQUAL_I32(queue.put("10"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(queue.put("20", 10), FOSSIL_TOFU_FAILURE);
+    std::string value;
+    ASSUME_ITS_TRUE(queue.take(value, 0));
+    ASSUME_ITS_EQUAL_CSTR(value.c_str(), "10");
+    ASSUME_ITS_FALSE(queue.take(value, 10));
+}
+
+FOSSIL_TEST(cpp_test_bqueue_threaded_drain_to) {
+    BQueue queue("i32", 8);
+    const int count = 2000;
+    std::thread producer([&queue, count]() {
+        for (int i = 0; i < count; i++) {
+            queue.put(std::to_string(i));
+        }
+    });
+
+    std::vector<std::string> received;
+    std::string value;
+    while (received.size() < static_cast<size_t>(count)) {
+        if (queue.drain_to(received, 16) == 0 && queue.take(value)) {
+            received.push_back(value);
+        }
+    }
+    producer.join();
+
+    bool ordered = true;
+    for (int i = 0; i < count; i++) {
+        if (received[i] != std::to_string(i)) {
+            ordered = false;
+        }
+    }
+    ASSUME_ITS_TRUE(ordered);
+}
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(cpp_bqueue_tofu_tests) {    
+    // Generic ToFu Fixture
+    FOSSIL_TEST_ADD(cpp_bqueue_tofu_fixture, cpp_test_bqueue_put_and_take);
+    FOSSIL_TEST_ADD(cpp_bqueue_tofu_fixture, cpp_test_bqueue_threaded_drain_to);
+
+    // Register the test group
+    FOSSIL_TEST_REGISTER(cpp_bqueue_tofu_fixture);
+} // end of tests
@@ -160,6 +160,41 @@ FOSSIL_TEST(c_test_clist_empty_and_null_checks) {
     fossil_tofu_clist_destroy(clist);
 }
 
+FOSSIL_TEST(c_test_clist_verify_tracks_mutations) {
+    fossil_tofu_clist_t* clist = fossil_tofu_clist_create_container("i32");
+    ASSUME_ITS_TRUE(fossil_tofu_clist_verify(clist));
+    fossil_tofu_clist_insert(clist, "1");
+    fossil_tofu_clist_insert(clist, "2");
+    fossil_tofu_clist_insert(clist, "3");
+    fossil_tofu_clist_reverse(clist);
+    ASSUME_ITS_TRUE(fossil_tofu_clist_verify(clist));
+    fossil_tofu_clist_remove(clist);
+    ASSUME_ITS_TRUE(fossil_tofu_clist_verify(clist));
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_clist_size(clist), 2);
+    fossil_tofu_clist_t* moved = fossil_tofu_clist_create_move(clist);
+    ASSUME_ITS_TRUE(fossil_tofu_clist_verify(moved));
+    ASSUME_ITS_TRUE(fossil_tofu_clist_is_empty(clist));
+    ASSUME_ITS_FALSE(fossil_tofu_clist_verify(NULL));
+    fossil_tofu_clist_destroy(moved);
+    fossil_tofu_clist_destroy(clist);
+}
+
+FOSSIL_TEST(c_test_clist_get_and_set_from_back) {
+    fossil_tofu_clist_t* clist = fossil_tofu_clist_create_container("i32");
+    fossil_tofu_clist_insert(clist, "0");
+    fossil_tofu_clist_insert(clist, "1");
+    fossil_tofu_clist_insert(clist, "2");
+    fossil_tofu_clist_insert(clist, "3");
+    fossil_tofu_clist_insert(clist, "4");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_clist_get(clist, 2), "2");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_clist_get(clist, 3), "3");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_clist_get(clist, 4), "4");
+    ASSUME_ITS_CNULL(fossil_tofu_clist_get(clist, 5));
+    fossil_tofu_clist_set(clist, 4, "44");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_clist_get_back(clist), "44");
+    fossil_tofu_clist_destroy(clist);
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -175,6 +210,8 @@ FOSSIL_TEST_GROUP(c_clist_tofu_tests) {
     FOSSIL_TEST_ADD(c_clist_tofu_fixture, c_test_clist_set_front_and_back);
     FOSSIL_TEST_ADD(c_clist_tofu_fixture, c_test_clist_copy_and_move);
     FOSSIL_TEST_ADD(c_clist_tofu_fixture, c_test_clist_empty_and_null_checks);
+    FOSSIL_TEST_ADD(c_clist_tofu_fixture, c_test_clist_verify_tracks_mutations);
+    FOSSIL_TEST_ADD(c_clist_tofu_fixture, c_test_clist_get_and_set_from_back);
 
     // Register the test group
     FOSSIL_TEST_REGISTER(c_clist_tofu_fixture);
@@ -158,6 +158,18 @@ FOSSIL_TEST(objcpp_test_clist_empty_and_null_checks) {
     ASSUME_ITS_TRUE(clist2.not_empty());
 }
 
+FOSSIL_TEST(objcpp_test_clist_verify) {
+    CList clist("i32");
+    clist.insert("1");
+    clist.insert("2");
+    clist.insert("3");
+    clist.reverse();
+    ASSUME_ITS_TRUE(clist.verify());
+    clist.remove();
+    ASSUME_ITS_TRUE(clist.verify());
+    ASSUME_ITS_EQUAL_I32(clist.size(), 2);
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -173,6 +185,7 @@ FOSSIL_TEST_GROUP(objcpp_clist_tofu_tests) {
     FOSSIL_TEST_ADD(objcpp_clist_tofu_fixture, objcpp_test_clist_set_front_and_back);
     FOSSIL_TEST_ADD(objcpp_clist_tofu_fixture, objcpp_test_clist_copy_and_move);
     FOSSIL_TEST_ADD(objcpp_clist_tofu_fixture, objcpp_test_clist_empty_and_null_checks);
+    FOSSIL_TEST_ADD(objcpp_clist_tofu_fixture, objcpp_test_clist_verify);
 
     // Register the test group
     FOSSIL_TEST_REGISTER(objcpp_clist_tofu_fixture);
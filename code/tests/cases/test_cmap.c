@@ -0,0 +1,213 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/pizza/framework.h>
+
+#include "fossil/tofu/framework.h"
+#include "fossil/tofu/threads.h"
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_SUITE(c_cmap_tofu_fixture);
+
+FOSSIL_SETUP(c_cmap_tofu_fixture) {
+    // Setup the test fixture
+}
+
+FOSSIL_TEARDOWN(c_cmap_tofu_fixture) {
+    // Teardown the test fixture
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_TEST(c_test_cmap_create_and_destroy) {
+    fossil_tofu_cmap_t* map = fossil_tofu_cmap_create_container("cstr", "i32");
+    ASSUME_NOT_CNULL(map);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_cmap_shard_count(map), FOSSIL_TOFU_CMAP_SHARDS);
+    ASSUME_ITS_TRUE(fossil_tofu_cmap_is_empty(map));
+    fossil_tofu_cmap_destroy(map);
+}
+
+FOSSIL_TEST(c_test_cmap_shard_rounding) {
+    fossil_tofu_cmap_t* map = fossil_tofu_cmap_create_sharded("cstr", "i32", 5);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_cmap_shard_count(map), 8);
+    fossil_tofu_cmap_destroy(map);
+
+    map = fossil_tofu_cmap_create_sharded("cstr", "i32", 1);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_cmap_shard_count(map), 1);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_cmap_insert(map, "one", "1"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_TRUE(fossil_tofu_cmap_contains(map, "one"));
+    fossil_tofu_cmap_destroy(map);
+}
+
+FOSSIL_TEST(c_test_cmap_insert_get_remove) {
+    fossil_tofu_cmap_t* map = fossil_tofu_cmap_create_container("cstr", "i32");
+    char key[16], value[16];
+    for (int i = 0; i < 100; i++) {
+        snprintf(key, sizeof(key), "k%d", i);
+        snprintf(value, sizeof(value), "%d", i);
+        ASSUME_ITS_EQUAL_I32(fossil_tofu_cmap_insert(map, key, value), FOSSIL_TOFU_SUCCESS);
+    }
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_cmap_size(map), 100);
+
+    fossil_tofu_t got = fossil_tofu_cmap_get(map, "k42");
+    ASSUME_ITS_EQUAL_CSTR(got.value.data, "42");
+    fossil_tofu_destroy(&got);
+
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_cmap_set(map, "k42", "-1"), FOSSIL_TOFU_SUCCESS);
+    got = fossil_tofu_cmap_get(map, "k42");
+    ASSUME_ITS_EQUAL_CSTR(got.value.data, "-1");
+    fossil_tofu_destroy(&got);
+
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_cmap_remove(map, "k42"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_FALSE(fossil_tofu_cmap_contains(map, "k42"));
+    got = fossil_tofu_cmap_get(map, "k42");
+    ASSUME_ITS_CNULL(got.value.data);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_cmap_size(map), 99);
+    fossil_tofu_cmap_destroy(map);
+}
+
+static bool c_cmap_count_visit(const fossil_tofu_t* key, const fossil_tofu_t* value, void* context) {
+    size_t* count = (size_t*)context;
+    return ++*count < 10;
+}
+
+FOSSIL_TEST(c_test_cmap_for_each_and_copy) {
+    fossil_tofu_cmap_t* map = fossil_tofu_cmap_create_sharded("cstr", "cstr", 4);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_cmap_reserve(map, 64), FOSSIL_TOFU_SUCCESS);
+    char key[16];
+    for (int i = 0; i < 50; i++) {
+        snprintf(key, sizeof(key), "k%d", i);
+        fossil_tofu_cmap_insert(map, key, key);
+    }
+
+    size_t count = 0;
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_cmap_for_each(map, c_cmap_count_visit, &count), 10);
+    ASSUME_ITS_EQUAL_SIZE(count, 10);
+
+    fossil_tofu_cmap_t* copy = fossil_tofu_cmap_create_copy(map);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_cmap_size(copy), 50);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_cmap_shard_count(copy), 4);
+    fossil_tofu_cmap_remove(map, "k7");
+    ASSUME_ITS_TRUE(fossil_tofu_cmap_contains(copy, "k7"));
+
+    fossil_tofu_cmap_t* moved = fossil_tofu_cmap_create_move(copy);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_cmap_size(moved), 50);
+    ASSUME_ITS_TRUE(fossil_tofu_cmap_is_empty(copy));
+    fossil_tofu_cmap_destroy(copy);
+    fossil_tofu_cmap_destroy(moved);
+    fossil_tofu_cmap_destroy(map);
+}
+
+FOSSIL_TEST(c_test_cmap_numeric_key_equality) {
+    fossil_tofu_cmap_t* map = fossil_tofu_cmap_create_container("i32", "cstr");
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_cmap_insert(map, "5", "five"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_TRUE(fossil_tofu_cmap_contains(map, "05"));
+    ASSUME_ITS_TRUE(fossil_tofu_cmap_contains(map, "+5"));
+    fossil_tofu_t got = fossil_tofu_cmap_get(map, "05");
+    ASSUME_ITS_EQUAL_CSTR(got.value.data, "five");
+    fossil_tofu_destroy(&got);
+
+    // "05" lands on the same shard and shadows the value stored under "5".
+    fossil_tofu_cmap_insert(map, "05", "again");
+    got = fossil_tofu_cmap_get(map, "5");
+    ASSUME_ITS_EQUAL_CSTR(got.value.data, "again");
+    fossil_tofu_destroy(&got);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_cmap_remove(map, "005"), FOSSIL_TOFU_SUCCESS);
+    got = fossil_tofu_cmap_get(map, "+5");
+    ASSUME_ITS_EQUAL_CSTR(got.value.data, "five");
+    fossil_tofu_destroy(&got);
+    fossil_tofu_cmap_destroy(map);
+}
+
+typedef struct {
+    fossil_tofu_cmap_t* map;
+    int base;
+} c_cmap_worker_t;
+
+static void* c_cmap_worker(void* arg) {
+    c_cmap_worker_t* work = (c_cmap_worker_t*)arg;
+    char key[16], value[16];
+    for (int i = 0; i < 500; i++) {
+        snprintf(key, sizeof(key), "k%d", work->base + i);
+        snprintf(value, sizeof(value), "%d", work->base + i);
+        fossil_tofu_cmap_insert(work->map, key, value);
+        fossil_tofu_cmap_contains(work->map, key);
+    }
+    return NULL;
+}
+
+FOSSIL_TEST(c_test_cmap_concurrent_insert) {
+    fossil_tofu_cmap_t* map = fossil_tofu_cmap_create_container("cstr", "i32");
+    fossil_tofu_thread_t threads[8];
+    bool started[8];
+    c_cmap_worker_t work[8];
+    for (int t = 0; t < 8; t++) {
+        work[t].map = map;
+        work[t].base = t * 500;
+        started[t] = fossil_tofu_thread_create(&threads[t], c_cmap_worker, &work[t]) == FOSSIL_TOFU_SUCCESS;
+        if (!started[t]) {
+            c_cmap_worker(&work[t]);
+        }
+    }
+    for (int t = 0; t < 8; t++) {
+        if (started[t]) {
+            fossil_tofu_thread_join(threads[t]);
+        }
+    }
+
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_cmap_size(map), 4000);
+    fossil_tofu_t got = fossil_tofu_cmap_get(map, "k3999");
+    ASSUME_ITS_EQUAL_CSTR(got.value.data, "3999");
+    fossil_tofu_destroy(&got);
+    fossil_tofu_cmap_destroy(map);
+}
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(c_cmap_tofu_tests) {    
+    // Generic ToFu Fixture
+    FOSSIL_TEST_ADD(c_cmap_tofu_fixture, c_test_cmap_create_and_destroy);
+    FOSSIL_TEST_ADD(c_cmap_tofu_fixture, c_test_cmap_shard_rounding);
+    FOSSIL_TEST_ADD(c_cmap_tofu_fixture, c_test_cmap_insert_get_remove);
+    FOSSIL_TEST_ADD(c_cmap_tofu_fixture, c_test_cmap_for_each_and_copy);
+    FOSSIL_TEST_ADD(c_cmap_tofu_fixture, c_test_cmap_numeric_key_equality);
+    FOSSIL_TEST_ADD(c_cmap_tofu_fixture, c_test_cmap_concurrent_insert);
+
+    // Register the test group
+    FOSSIL_TEST_REGISTER(c_cmap_tofu_fixture);
+} // end of tests
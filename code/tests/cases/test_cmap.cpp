@@ -0,0 +1,113 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/pizza/framework.h>
+
+#include "fossil/tofu/framework.h"
+#include <thread>
+#include <vector>
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_SUITE(cpp_cmap_tofu_fixture);
+
+FOSSIL_SETUP(cpp_cmap_tofu_fixture) {
+    // Setup the test fixture
+}
+
+FOSSIL_TEARDOWN(cpp_cmap_tofu_fixture) {
+    // Teardown the test fixture
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+using fossil::tofu::CMap;
+
+FOSSIL_TEST(cpp_test_cmap_basic) {
+    CMap map("cstr", "i32", 5);
+    ASSUME_ITS_EQUAL_SIZE(map.shard_count(), 8);
+    ASSUME_ITS_TRUE(map.is_empty());
+    map.insert("a", "1");
+    map.insert("b", "2");
+    ASSUME_ITS_EQUAL_SIZE(map.size(), 2);
+    ASSUME_ITS_TRUE(map.get("a") == "1");
+    map.set("a", "3");
+    ASSUME_ITS_TRUE(map.get("a") == "3");
+    map.remove("a");
+    ASSUME_ITS_FALSE(map.contains("a"));
+}
+
+FOSSIL_TEST(cpp_test_cmap_get_missing_throws) {
+    CMap map("cstr", "i32");
+    bool thrown = false;
+    try {
+        map.get("missing");
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    ASSUME_ITS_TRUE(thrown);
+}
+
+FOSSIL_TEST(cpp_test_cmap_concurrent_insert) {
+    CMap map("cstr", "i32");
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&map, t]() {
+            for (int i = 0; i < 250; i++) {
+                std::string key = "k" + std::to_string(t * 250 + i);
+                map.insert(key, std::to_string(i));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    ASSUME_ITS_EQUAL_SIZE(map.size(), 1000);
+    ASSUME_ITS_TRUE(map.get("k999") == "249");
+}
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(cpp_cmap_tofu_tests) {    
+    // Generic ToFu Fixture
+    FOSSIL_TEST_ADD(cpp_cmap_tofu_fixture, cpp_test_cmap_basic);
+    FOSSIL_TEST_ADD(cpp_cmap_tofu_fixture, cpp_test_cmap_get_missing_throws);
+    FOSSIL_TEST_ADD(cpp_cmap_tofu_fixture, cpp_test_cmap_concurrent_insert);
+
+    // Register the test group
+    FOSSIL_TEST_REGISTER(cpp_cmap_tofu_fixture);
+} // end of tests
@@ -170,6 +170,72 @@ FOSSIL_TEST(c_test_cqueue_size_consistency) {
     fossil_tofu_cqueue_destroy(queue);
 }
 
+FOSSIL_TEST(c_test_cqueue_wrap_around) {
+    fossil_tofu_cqueue_t* queue = fossil_tofu_cqueue_create_container("i32", 3);
+    fossil_tofu_cqueue_insert(queue, "1");
+    fossil_tofu_cqueue_insert(queue, "2");
+    fossil_tofu_cqueue_insert(queue, "3");
+    ASSUME_ITS_TRUE(fossil_tofu_cqueue_is_full(queue));
+    fossil_tofu_cqueue_remove(queue);
+    fossil_tofu_cqueue_remove(queue);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_cqueue_insert(queue, "4"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_cqueue_insert(queue, "55555"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_cqueue_size(queue), 3);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_cqueue_get_front(queue), "3");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_cqueue_get_at(queue, 1), "4");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_cqueue_get_rear(queue), "55555");
+    ASSUME_ITS_CNULL(fossil_tofu_cqueue_get_at(queue, 3));
+    fossil_tofu_cqueue_destroy(queue);
+}
+
+FOSSIL_TEST(c_test_cqueue_overwrite_mode) {
+    fossil_tofu_cqueue_t* queue = fossil_tofu_cqueue_create_mode("i32", 2, FOSSIL_TOFU_CQUEUE_OVERWRITE);
+    ASSUME_NOT_CNULL(queue);
+    ASSUME_ITS_TRUE(fossil_tofu_cqueue_get_mode(queue) == FOSSIL_TOFU_CQUEUE_OVERWRITE);
+    fossil_tofu_cqueue_insert(queue, "1");
+    fossil_tofu_cqueue_insert(queue, "2");
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_cqueue_insert(queue, "3"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_cqueue_insert(queue, "4"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_cqueue_size(queue), 2);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_cqueue_overwritten(queue), 2);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_cqueue_get_front(queue), "3");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_cqueue_get_rear(queue), "4");
+    fossil_tofu_cqueue_destroy(queue);
+}
+
+FOSSIL_TEST(c_test_cqueue_copy_after_wrap) {
+    fossil_tofu_cqueue_t* queue1 = fossil_tofu_cqueue_create_mode("i32", 3, FOSSIL_TOFU_CQUEUE_OVERWRITE);
+    for (int i = 0; i < 5; i++) {
+        char value[8];
+        snprintf(value, sizeof(value), "%d", i);
+        fossil_tofu_cqueue_insert(queue1, value);
+    }
+    fossil_tofu_cqueue_t* queue2 = fossil_tofu_cqueue_create_copy(queue1);
+    ASSUME_NOT_CNULL(queue2);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_cqueue_capacity(queue2), 3);
+    ASSUME_ITS_TRUE(fossil_tofu_cqueue_get_mode(queue2) == FOSSIL_TOFU_CQUEUE_OVERWRITE);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_cqueue_get_at(queue2, 0), "2");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_cqueue_get_at(queue2, 1), "3");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_cqueue_get_at(queue2, 2), "4");
+    fossil_tofu_cqueue_destroy(queue1);
+    fossil_tofu_cqueue_destroy(queue2);
+}
+
+FOSSIL_TEST(c_test_cqueue_take) {
+    fossil_tofu_cqueue_t* queue = fossil_tofu_cqueue_create_container("i32", 2);
+    fossil_tofu_t out;
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_cqueue_take(queue, &out), FOSSIL_TOFU_FAILURE);
+    fossil_tofu_cqueue_insert(queue, "7");
+    fossil_tofu_cqueue_insert(queue, "8");
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_cqueue_take(queue, &out), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&out), "7");
+    fossil_tofu_destroy(&out);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_cqueue_size(queue), 1);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_cqueue_insert(queue, "9"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_cqueue_get_rear(queue), "9");
+    fossil_tofu_cqueue_destroy(queue);
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -186,6 +252,10 @@ FOSSIL_TEST_GROUP(c_cqueue_tofu_tests) {
     FOSSIL_TEST_ADD(c_cqueue_tofu_fixture, c_test_cqueue_get_front_and_get_rear_empty);
     FOSSIL_TEST_ADD(c_cqueue_tofu_fixture, c_test_cqueue_remove_empty);
     FOSSIL_TEST_ADD(c_cqueue_tofu_fixture, c_test_cqueue_size_consistency);
+    FOSSIL_TEST_ADD(c_cqueue_tofu_fixture, c_test_cqueue_wrap_around);
+    FOSSIL_TEST_ADD(c_cqueue_tofu_fixture, c_test_cqueue_overwrite_mode);
+    FOSSIL_TEST_ADD(c_cqueue_tofu_fixture, c_test_cqueue_copy_after_wrap);
+    FOSSIL_TEST_ADD(c_cqueue_tofu_fixture, c_test_cqueue_take);
 
     // Register the test group
     FOSSIL_TEST_REGISTER(c_cqueue_tofu_fixture);
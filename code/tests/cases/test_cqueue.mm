@@ -156,6 +156,50 @@ FOSSIL_TEST(objcpp_test_cqueue_size_consistency) {
     ASSUME_ITS_EQUAL_I32(queue.size(), 0);
 }
 
+FOSSIL_TEST(objcpp_test_cqueue_wrap_around) {
+    CQueue queue("i32", 3);
+    queue.insert("1");
+    queue.insert("2");
+    queue.insert("3");
+    ASSUME_ITS_TRUE(queue.is_full());
+    queue.remove();
+    queue.remove();
+    ASSUME_ITS_EQUAL_I32(queue.insert("4"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(queue.insert("55555"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_CSTR(queue.get_front().c_str(), "3");
+    ASSUME_ITS_EQUAL_CSTR(queue.get_at(1).c_str(), "4");
+    ASSUME_ITS_EQUAL_CSTR(queue.get_rear().c_str(), "55555");
+    bool thrown = false;
+    try {
+        queue.get_at(3);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    ASSUME_ITS_TRUE(thrown);
+}
+
+FOSSIL_TEST(objcpp_test_cqueue_overwrite_mode) {
+    CQueue queue("i32", 2, FOSSIL_TOFU_CQUEUE_OVERWRITE);
+    ASSUME_ITS_TRUE(queue.mode() == FOSSIL_TOFU_CQUEUE_OVERWRITE);
+    queue.insert("1");
+    queue.insert("2");
+    ASSUME_ITS_EQUAL_I32(queue.insert("3"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(queue.size(), 2);
+    ASSUME_ITS_EQUAL_I32(queue.overwritten(), 1);
+    ASSUME_ITS_EQUAL_CSTR(queue.get_front().c_str(), "2");
+    ASSUME_ITS_EQUAL_CSTR(queue.get_rear().c_str(), "3");
+}
+
+FOSSIL_TEST(objcpp_test_cqueue_take) {
+    CQueue queue("i32", 2);
+    std::string value;
+    ASSUME_ITS_FALSE(queue.take(value));
+    queue.insert("7");
+    ASSUME_ITS_TRUE(queue.take(value));
+    ASSUME_ITS_EQUAL_CSTR(value.c_str(), "7");
+    ASSUME_ITS_TRUE(queue.is_empty());
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -172,6 +216,9 @@ FOSSIL_TEST_GROUP(objcpp_cqueue_tofu_tests) {
     FOSSIL_TEST_ADD(objcpp_cqueue_tofu_fixture, objcpp_test_cqueue_get_front_and_get_rear_empty);
     FOSSIL_TEST_ADD(objcpp_cqueue_tofu_fixture, objcpp_test_cqueue_remove_empty);
     FOSSIL_TEST_ADD(objcpp_cqueue_tofu_fixture, objcpp_test_cqueue_size_consistency);
+    FOSSIL_TEST_ADD(objcpp_cqueue_tofu_fixture, objcpp_test_cqueue_wrap_around);
+    FOSSIL_TEST_ADD(objcpp_cqueue_tofu_fixture, objcpp_test_cqueue_overwrite_mode);
+    FOSSIL_TEST_ADD(objcpp_cqueue_tofu_fixture, objcpp_test_cqueue_take);
 
     // Register the test group
     FOSSIL_TEST_REGISTER(objcpp_cqueue_tofu_fixture);
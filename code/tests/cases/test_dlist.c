@@ -175,6 +175,54 @@ FOSSIL_TEST(c_test_dlist_empty_and_null_checks) {
     fossil_tofu_dlist_destroy(dlist);
 }
 
+FOSSIL_TEST(c_test_dlist_verify_tracks_mutations) {
+    fossil_tofu_dlist_t* dlist = fossil_tofu_dlist_create_container("i32");
+    ASSUME_ITS_TRUE(fossil_tofu_dlist_verify(dlist));
+    fossil_tofu_dlist_insert(dlist, "1");
+    fossil_tofu_dlist_insert(dlist, "2");
+    fossil_tofu_dlist_insert(dlist, "3");
+    fossil_tofu_dlist_reverse_forward(dlist);
+    ASSUME_ITS_TRUE(fossil_tofu_dlist_verify(dlist));
+    fossil_tofu_dlist_reverse_backward(dlist);
+    ASSUME_ITS_TRUE(fossil_tofu_dlist_verify(dlist));
+    fossil_tofu_dlist_t* copy = fossil_tofu_dlist_create_copy(dlist);
+    ASSUME_ITS_TRUE(fossil_tofu_dlist_verify(copy));
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_dlist_size(copy), 3);
+    fossil_tofu_dlist_t* moved = fossil_tofu_dlist_create_move(copy);
+    ASSUME_ITS_TRUE(fossil_tofu_dlist_verify(moved));
+    ASSUME_ITS_TRUE(fossil_tofu_dlist_is_empty(copy));
+    ASSUME_ITS_FALSE(fossil_tofu_dlist_verify(NULL));
+    fossil_tofu_dlist_destroy(moved);
+    fossil_tofu_dlist_destroy(copy);
+    fossil_tofu_dlist_destroy(dlist);
+}
+
+FOSSIL_TEST(c_test_dlist_remove_last_clears_tail) {
+    fossil_tofu_dlist_t* dlist = fossil_tofu_dlist_create_container("i32");
+    fossil_tofu_dlist_insert(dlist, "1");
+    fossil_tofu_dlist_remove(dlist);
+    ASSUME_ITS_TRUE(fossil_tofu_dlist_verify(dlist));
+    fossil_tofu_dlist_insert(dlist, "2");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_dlist_get_front(dlist), "2");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_dlist_get_back(dlist), "2");
+    ASSUME_ITS_TRUE(fossil_tofu_dlist_verify(dlist));
+    fossil_tofu_dlist_destroy(dlist);
+}
+
+FOSSIL_TEST(c_test_dlist_get_and_set_from_back) {
+    fossil_tofu_dlist_t* dlist = fossil_tofu_dlist_create_container("i32");
+    fossil_tofu_dlist_insert(dlist, "0");
+    fossil_tofu_dlist_insert(dlist, "1");
+    fossil_tofu_dlist_insert(dlist, "2");
+    fossil_tofu_dlist_insert(dlist, "3");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_dlist_get(dlist, 2), "2");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_dlist_get(dlist, 3), "3");
+    ASSUME_ITS_CNULL(fossil_tofu_dlist_get(dlist, 4));
+    fossil_tofu_dlist_set(dlist, 2, "22");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_dlist_get(dlist, 2), "22");
+    fossil_tofu_dlist_destroy(dlist);
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -191,6 +239,9 @@ FOSSIL_TEST_GROUP(c_dlist_tofu_tests) {
     FOSSIL_TEST_ADD(c_dlist_tofu_fixture, c_test_dlist_set_front_and_back);
     FOSSIL_TEST_ADD(c_dlist_tofu_fixture, c_test_dlist_copy_and_move);
     FOSSIL_TEST_ADD(c_dlist_tofu_fixture, c_test_dlist_empty_and_null_checks);
+    FOSSIL_TEST_ADD(c_dlist_tofu_fixture, c_test_dlist_verify_tracks_mutations);
+    FOSSIL_TEST_ADD(c_dlist_tofu_fixture, c_test_dlist_remove_last_clears_tail);
+    FOSSIL_TEST_ADD(c_dlist_tofu_fixture, c_test_dlist_get_and_set_from_back);
 
     // Register the test group
     FOSSIL_TEST_REGISTER(c_dlist_tofu_fixture);
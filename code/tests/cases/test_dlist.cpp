@@ -164,6 +164,19 @@ FOSSIL_TEST(cpp_test_dlist_empty_and_null_checks) {
     ASSUME_ITS_TRUE(dlist2.not_empty());
 }
 
+FOSSIL_TEST(cpp_test_dlist_verify) {
+    DList dlist("i32");
+    dlist.insert((char*)"1");
+    dlist.insert((char*)"2");
+    dlist.insert((char*)"3");
+    dlist.reverse_forward();
+    ASSUME_ITS_TRUE(dlist.verify());
+    ASSUME_ITS_EQUAL_CSTR(dlist.get(2).c_str(), "1");
+    dlist.remove();
+    ASSUME_ITS_TRUE(dlist.verify());
+    ASSUME_ITS_EQUAL_I32(dlist.size(), 2);
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -180,6 +193,7 @@ FOSSIL_TEST_GROUP(cpp_dlist_tofu_tests) {
     FOSSIL_TEST_ADD(cpp_dlist_tofu_fixture, cpp_test_dlist_set_front_and_back);
     FOSSIL_TEST_ADD(cpp_dlist_tofu_fixture, cpp_test_dlist_copy_and_move);
     FOSSIL_TEST_ADD(cpp_dlist_tofu_fixture, cpp_test_dlist_empty_and_null_checks);
+    FOSSIL_TEST_ADD(cpp_dlist_tofu_fixture, cpp_test_dlist_verify);
 
     // Register the test group
     FOSSIL_TEST_REGISTER(cpp_dlist_tofu_fixture);
@@ -167,6 +167,42 @@ FOSSIL_TEST(objc_test_dqueue_size_consistency) {
     fossil_tofu_dqueue_destroy(dqueue);
 }
 
+FOSSIL_TEST(objc_test_dqueue_verify_tracks_mutations) {
+    fossil_tofu_dqueue_t* dqueue = fossil_tofu_dqueue_create_container("i32");
+    ASSUME_ITS_TRUE(fossil_tofu_dqueue_verify(dqueue));
+    fossil_tofu_dqueue_insert(dqueue, "1");
+    fossil_tofu_dqueue_insert(dqueue, "2");
+    fossil_tofu_dqueue_insert(dqueue, "3");
+    fossil_tofu_dqueue_remove(dqueue);
+    ASSUME_ITS_TRUE(fossil_tofu_dqueue_verify(dqueue));
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_dqueue_size(dqueue), 2);
+    fossil_tofu_dqueue_t* moved = fossil_tofu_dqueue_create_move(dqueue);
+    ASSUME_ITS_TRUE(fossil_tofu_dqueue_verify(moved));
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_dqueue_size(moved), 2);
+    ASSUME_ITS_TRUE(fossil_tofu_dqueue_is_empty(dqueue));
+    ASSUME_ITS_FALSE(fossil_tofu_dqueue_verify(NULL));
+    fossil_tofu_dqueue_destroy(moved);
+    fossil_tofu_dqueue_destroy(dqueue);
+}
+
+FOSSIL_TEST(objc_test_dqueue_get_and_set_by_index) {
+    fossil_tofu_dqueue_t* dqueue = fossil_tofu_dqueue_create_container("i32");
+    fossil_tofu_dqueue_insert(dqueue, "0");
+    fossil_tofu_dqueue_insert(dqueue, "1");
+    fossil_tofu_dqueue_insert(dqueue, "2");
+    fossil_tofu_dqueue_insert(dqueue, "3");
+    fossil_tofu_dqueue_insert(dqueue, "4");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_dqueue_get(dqueue, 1), "1");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_dqueue_get(dqueue, 3), "3");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_dqueue_get(dqueue, 4), "4");
+    ASSUME_ITS_CNULL(fossil_tofu_dqueue_get(dqueue, 5));
+    fossil_tofu_dqueue_set(dqueue, 3, "33");
+    fossil_tofu_dqueue_set(dqueue, 9, "99");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_dqueue_get(dqueue, 3), "33");
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_dqueue_size(dqueue), 5);
+    fossil_tofu_dqueue_destroy(dqueue);
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -183,6 +219,8 @@ FOSSIL_TEST_GROUP(objc_dqueue_tofu_tests) {
     FOSSIL_TEST_ADD(objc_dqueue_tofu_fixture, objc_test_dqueue_get_front_and_get_back_empty);
     FOSSIL_TEST_ADD(objc_dqueue_tofu_fixture, objc_test_dqueue_remove_empty);
     FOSSIL_TEST_ADD(objc_dqueue_tofu_fixture, objc_test_dqueue_size_consistency);
+    FOSSIL_TEST_ADD(objc_dqueue_tofu_fixture, objc_test_dqueue_verify_tracks_mutations);
+    FOSSIL_TEST_ADD(objc_dqueue_tofu_fixture, objc_test_dqueue_get_and_set_by_index);
 
     // Register the test group
     FOSSIL_TEST_REGISTER(objc_dqueue_tofu_fixture);
@@ -154,6 +154,18 @@ FOSSIL_TEST(objcpp_test_dqueue_size_consistency) {
     ASSUME_ITS_EQUAL_I32(dqueue.size(), 0);
 }
 
+FOSSIL_TEST(objcpp_test_dqueue_verify) {
+    DQueue dqueue("i32");
+    dqueue.insert("1");
+    dqueue.insert("2");
+    dqueue.insert("3");
+    ASSUME_ITS_TRUE(dqueue.verify());
+    ASSUME_ITS_EQUAL_CSTR(dqueue.get(2).c_str(), "3");
+    dqueue.remove();
+    ASSUME_ITS_TRUE(dqueue.verify());
+    ASSUME_ITS_EQUAL_I32(dqueue.size(), 2);
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -170,6 +182,7 @@ FOSSIL_TEST_GROUP(objcpp_dqueue_tofu_tests) {
     FOSSIL_TEST_ADD(objcpp_dqueue_tofu_fixture, objcpp_test_dqueue_get_front_and_get_back_empty);
     FOSSIL_TEST_ADD(objcpp_dqueue_tofu_fixture, objcpp_test_dqueue_remove_empty);
     FOSSIL_TEST_ADD(objcpp_dqueue_tofu_fixture, objcpp_test_dqueue_size_consistency);
+    FOSSIL_TEST_ADD(objcpp_dqueue_tofu_fixture, objcpp_test_dqueue_verify);
 
     // Register the test group
     FOSSIL_TEST_REGISTER(objcpp_dqueue_tofu_fixture);
@@ -174,6 +174,26 @@ FOSSIL_TEST(c_test_flist_empty_and_null_checks) {
     fossil_tofu_flist_destroy(flist);
 }
 
+FOSSIL_TEST(c_test_flist_verify_tracks_mutations) {
+    fossil_tofu_flist_t* flist = fossil_tofu_flist_create_container("i32");
+    ASSUME_ITS_TRUE(fossil_tofu_flist_verify(flist));
+    fossil_tofu_flist_insert(flist, "1");
+    fossil_tofu_flist_insert(flist, "2");
+    fossil_tofu_flist_insert(flist, "3");
+    fossil_tofu_flist_reverse_forward(flist);
+    fossil_tofu_flist_remove(flist);
+    ASSUME_ITS_TRUE(fossil_tofu_flist_verify(flist));
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_flist_size(flist), 2);
+    ASSUME_ITS_CNULL(fossil_tofu_flist_get(flist, 2));
+    fossil_tofu_flist_t* moved = fossil_tofu_flist_create_move(flist);
+    ASSUME_ITS_TRUE(fossil_tofu_flist_verify(moved));
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_flist_size(moved), 2);
+    ASSUME_ITS_TRUE(fossil_tofu_flist_is_empty(flist));
+    ASSUME_ITS_FALSE(fossil_tofu_flist_verify(NULL));
+    fossil_tofu_flist_destroy(moved);
+    fossil_tofu_flist_destroy(flist);
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -190,6 +210,7 @@ FOSSIL_TEST_GROUP(c_flist_tofu_tests) {
     FOSSIL_TEST_ADD(c_flist_tofu_fixture, c_test_flist_set_front_and_back);
     FOSSIL_TEST_ADD(c_flist_tofu_fixture, c_test_flist_copy_and_move);
     FOSSIL_TEST_ADD(c_flist_tofu_fixture, c_test_flist_empty_and_null_checks);
+    FOSSIL_TEST_ADD(c_flist_tofu_fixture, c_test_flist_verify_tracks_mutations);
 
     // Register the test group
     FOSSIL_TEST_REGISTER(c_flist_tofu_fixture);
@@ -171,6 +171,17 @@ FOSSIL_TEST(cpp_test_flist_empty_and_null_checks) {
     ASSUME_ITS_TRUE(flist2.not_empty());
 }
 
+FOSSIL_TEST(cpp_test_flist_verify) {
+    FList flist("i32");
+    flist.insert("1");
+    flist.insert("2");
+    flist.reverse_forward();
+    ASSUME_ITS_TRUE(flist.verify());
+    flist.remove();
+    ASSUME_ITS_TRUE(flist.verify());
+    ASSUME_ITS_EQUAL_I32(flist.size(), 1);
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -187,6 +198,7 @@ FOSSIL_TEST_GROUP(cpp_flist_tofu_tests) {
     FOSSIL_TEST_ADD(cpp_flist_tofu_fixture, cpp_test_flist_set_front_and_back);
     FOSSIL_TEST_ADD(cpp_flist_tofu_fixture, cpp_test_flist_copy_and_move);
     FOSSIL_TEST_ADD(cpp_flist_tofu_fixture, cpp_test_flist_empty_and_null_checks);
+    FOSSIL_TEST_ADD(cpp_flist_tofu_fixture, cpp_test_flist_verify);
 
     // Register the test group
     FOSSIL_TEST_REGISTER(cpp_flist_tofu_fixture);
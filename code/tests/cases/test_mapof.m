@@ -164,6 +164,432 @@ FOSSIL_TEST(objc_test_mapof_null_args) {
     ASSUME_ITS_TRUE(fossil_tofu_mapof_is_empty(NULL));
 }
 
+FOSSIL_TEST(objc_test_mapof_remove_uncovers_shadowed) {
+    fossil_tofu_mapof_t* map = fossil_tofu_mapof_create_container("i32", "cstr");
+    fossil_tofu_mapof_insert(map, "5", "old");
+    fossil_tofu_mapof_insert(map, "5", "new");
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_mapof_size(map), 2);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_mapof_remove(map, "5"), FOSSIL_TOFU_SUCCESS);
+    fossil_tofu_t value = fossil_tofu_mapof_get(map, "5");
+    ASSUME_ITS_EQUAL_CSTR(value.value.data, "old");
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_mapof_remove(map, "5"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_FALSE(fossil_tofu_mapof_contains(map, "5"));
+    ASSUME_ITS_TRUE(fossil_tofu_mapof_is_empty(map));
+    fossil_tofu_mapof_destroy(map);
+}
+
+FOSSIL_TEST(objc_test_mapof_grow_and_remove_many) {
+    fossil_tofu_mapof_t* map = fossil_tofu_mapof_create_container("i32", "i32");
+    char key[16];
+    for (int i = 0; i < 5000; i++) {
+        snprintf(key, sizeof(key), "%d", i);
+        ASSUME_ITS_EQUAL_I32(fossil_tofu_mapof_insert(map, key, key), FOSSIL_TOFU_SUCCESS);
+    }
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_mapof_size(map), 5000);
+    ASSUME_ITS_TRUE(fossil_tofu_mapof_capacity(map) * 7 >= 5000 * 8);
+    for (int i = 0; i < 5000; i += 2) {
+        snprintf(key, sizeof(key), "%d", i);
+        ASSUME_ITS_EQUAL_I32(fossil_tofu_mapof_remove(map, key), FOSSIL_TOFU_SUCCESS);
+    }
+    size_t found = 0;
+    for (int i = 0; i < 5000; i++) {
+        snprintf(key, sizeof(key), "%d", i);
+        if (fossil_tofu_mapof_contains(map, key)) {
+            found++;
+            ASSUME_ITS_TRUE(i % 2 == 1);
+            ASSUME_ITS_EQUAL_CSTR(fossil_tofu_mapof_get(map, key).value.data, key);
+        }
+    }
+    ASSUME_ITS_EQUAL_SIZE(found, 2500);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_mapof_size(map), 2500);
+    fossil_tofu_mapof_destroy(map);
+}
+
+FOSSIL_TEST(objc_test_mapof_reserve) {
+    fossil_tofu_mapof_t* map = fossil_tofu_mapof_create_container("cstr", "cstr");
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_mapof_capacity(map), 0);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_mapof_reserve(map, 1000), FOSSIL_TOFU_SUCCESS);
+    size_t capacity = fossil_tofu_mapof_capacity(map);
+    ASSUME_ITS_TRUE(capacity >= 1000);
+    char key[16];
+    for (int i = 0; i < 1000; i++) {
+        snprintf(key, sizeof(key), "k%d", i);
+        fossil_tofu_mapof_insert(map, key, "v");
+    }
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_mapof_capacity(map), capacity);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_mapof_reserve(NULL, 10), FOSSIL_TOFU_ERROR_NULL_POINTER);
+    fossil_tofu_mapof_destroy(map);
+}
+
+FOSSIL_TEST(objc_test_mapof_copy_keeps_shadowed) {
+    fossil_tofu_mapof_t* map = fossil_tofu_mapof_create_container("cstr", "cstr");
+    fossil_tofu_mapof_insert(map, "a", "1");
+    fossil_tofu_mapof_insert(map, "a", "2");
+    fossil_tofu_mapof_insert(map, "b", "3");
+    fossil_tofu_mapof_t* copy = fossil_tofu_mapof_create_copy(map);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_mapof_size(copy), 3);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_mapof_get(copy, "a").value.data, "2");
+    fossil_tofu_mapof_remove(copy, "a");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_mapof_get(copy, "a").value.data, "1");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_mapof_get(map, "a").value.data, "2");
+    fossil_tofu_mapof_destroy(copy);
+    fossil_tofu_mapof_destroy(map);
+}
+
+FOSSIL_TEST(objc_test_mapof_find_raw_key) {
+    fossil_tofu_mapof_t* map = fossil_tofu_mapof_create_container("i64", "cstr");
+    fossil_tofu_mapof_insert(map, "42", "answer");
+    fossil_tofu_mapof_insert(map, "-7", "negative");
+    const char* line = "42,-7";
+    const fossil_tofu_t* value = fossil_tofu_mapof_find(map, line, 2);
+    ASSUME_NOT_CNULL(value);
+    ASSUME_ITS_EQUAL_CSTR(value->value.data, "answer");
+    ASSUME_ITS_TRUE(fossil_tofu_mapof_contains_key(map, line + 3, 2));
+    ASSUME_ITS_FALSE(fossil_tofu_mapof_contains_key(map, line, 1));
+    ASSUME_ITS_CNULL(fossil_tofu_mapof_find(map, line, 5));
+    value = fossil_tofu_mapof_find_i64(map, -7);
+    ASSUME_NOT_CNULL(value);
+    ASSUME_ITS_EQUAL_CSTR(value->value.data, "negative");
+    ASSUME_ITS_CNULL(fossil_tofu_mapof_find_i64(map, 7));
+    ASSUME_ITS_CNULL(fossil_tofu_mapof_find(NULL, "42", 2));
+    fossil_tofu_mapof_destroy(map);
+}
+
+static bool objc_mapof_check_order(const fossil_tofu_t* key, const fossil_tofu_t* value, void* context) {
+    long* last = (long*)context;
+    long current = strtol(key->value.data, NULL, 10);
+    if (current <= *last) {
+        *last = -2;
+        return false;
+    }
+    *last = current;
+    return true;
+}
+
+FOSSIL_TEST(objc_test_mapof_ordered_insert_remove) {
+    fossil_tofu_mapof_t* map = fossil_tofu_mapof_create_ordered("i32", "i32");
+    ASSUME_ITS_TRUE(fossil_tofu_mapof_is_ordered(map));
+    char key[16];
+    // 7919 is prime, so i * 7919 % 5000 visits every key once in scrambled order.
+    for (int i = 0; i < 5000; i++) {
+        snprintf(key, sizeof(key), "%d", (i * 7919) % 5000);
+        ASSUME_ITS_EQUAL_I32(fossil_tofu_mapof_insert(map, key, key), FOSSIL_TOFU_SUCCESS);
+    }
+    long last = -1;
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_mapof_for_each(map, objc_mapof_check_order, &last), 5000);
+    ASSUME_ITS_EQUAL_I32(last, 4999);
+    for (int i = 0; i < 5000; i++) {
+        int k = (i * 7919) % 5000;
+        if (k % 4 == 0) continue;
+        snprintf(key, sizeof(key), "%d", k);
+        ASSUME_ITS_EQUAL_I32(fossil_tofu_mapof_remove(map, key), FOSSIL_TOFU_SUCCESS);
+    }
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_mapof_size(map), 1250);
+    last = -1;
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_mapof_for_each(map, objc_mapof_check_order, &last), 1250);
+    ASSUME_ITS_TRUE(fossil_tofu_mapof_contains(map, "4996"));
+    ASSUME_ITS_FALSE(fossil_tofu_mapof_contains(map, "4997"));
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_mapof_get(map, "400").value.data, "400");
+    fossil_tofu_mapof_destroy(map);
+}
+
+FOSSIL_TEST(objc_test_mapof_ordered_bounds) {
+    fossil_tofu_mapof_t* map = fossil_tofu_mapof_create_ordered("i32", "cstr");
+    char key[16];
+    for (int i = 100; i >= 10; i -= 10) {
+        snprintf(key, sizeof(key), "%d", i);
+        fossil_tofu_mapof_insert(map, key, "v");
+    }
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_mapof_first(map)->key.value.data, "10");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_mapof_last(map)->key.value.data, "100");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_mapof_lower_bound(map, "35")->key.value.data, "40");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_mapof_lower_bound(map, "40")->key.value.data, "40");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_mapof_ceiling(map, "5")->key.value.data, "10");
+    ASSUME_ITS_CNULL(fossil_tofu_mapof_ceiling(map, "101"));
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_mapof_floor(map, "35")->key.value.data, "30");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_mapof_floor(map, "1000")->key.value.data, "100");
+    ASSUME_ITS_CNULL(fossil_tofu_mapof_floor(map, "9"));
+    fossil_tofu_mapof_t* hashed = fossil_tofu_mapof_create_container("i32", "cstr");
+    fossil_tofu_mapof_insert(hashed, "1", "v");
+    ASSUME_ITS_CNULL(fossil_tofu_mapof_first(hashed));
+    ASSUME_ITS_CNULL(fossil_tofu_mapof_lower_bound(hashed, "1"));
+    fossil_tofu_mapof_destroy(hashed);
+    fossil_tofu_mapof_destroy(map);
+}
+
+static bool objc_mapof_count_visit(const fossil_tofu_t* key, const fossil_tofu_t* value, void* context) {
+    (*(size_t*)context)++;
+    return true;
+}
+
+FOSSIL_TEST(objc_test_mapof_ordered_range_datetime) {
+    fossil_tofu_mapof_t* map = fossil_tofu_mapof_create_ordered("datetime", "cstr");
+    fossil_tofu_mapof_insert(map, "2024-03-01T00:00:00Z", "march");
+    fossil_tofu_mapof_insert(map, "2024-01-01T00:00:00Z", "january");
+    fossil_tofu_mapof_insert(map, "2024-02-01T00:00:00Z", "february");
+    fossil_tofu_mapof_insert(map, "2024-04-01T00:00:00Z", "april");
+    size_t seen = 0;
+    size_t visited = fossil_tofu_mapof_range(map, "2024-01-15T00:00:00Z", "2024-04-01T00:00:00Z", objc_mapof_count_visit, &seen);
+    ASSUME_ITS_EQUAL_SIZE(visited, 2);
+    ASSUME_ITS_EQUAL_SIZE(seen, 2);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_mapof_first(map)->value.value.data, "january");
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_mapof_range(map, NULL, NULL, objc_mapof_count_visit, &seen), 4);
+    fossil_tofu_mapof_destroy(map);
+}
+
+FOSSIL_TEST(objc_test_mapof_ordered_copy_and_shadow) {
+    fossil_tofu_mapof_t* map = fossil_tofu_mapof_create_ordered("i32", "cstr");
+    char key[16];
+    for (int i = 0; i < 200; i++) {
+        snprintf(key, sizeof(key), "%d", i);
+        fossil_tofu_mapof_insert(map, key, "old");
+    }
+    fossil_tofu_mapof_insert(map, "7", "new");
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_mapof_size(map), 201);
+    fossil_tofu_mapof_t* copy = fossil_tofu_mapof_create_copy(map);
+    ASSUME_ITS_TRUE(fossil_tofu_mapof_is_ordered(copy));
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_mapof_size(copy), 201);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_mapof_get(copy, "7").value.data, "new");
+    fossil_tofu_mapof_remove(copy, "7");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_mapof_get(copy, "7").value.data, "old");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_mapof_last(copy)->key.value.data, "199");
+    fossil_tofu_mapof_destroy(copy);
+    fossil_tofu_mapof_destroy(map);
+}
+
+FOSSIL_TEST(objc_test_mapof_get_many) {
+    fossil_tofu_mapof_t* map = fossil_tofu_mapof_create_container("cstr", "i32");
+    char text[200][16];
+    char* keys[200];
+    for (int i = 0; i < 200; i++) {
+        snprintf(text[i], sizeof(text[i]), "%d", i);
+        keys[i] = text[i];
+        if (i % 2 == 0) fossil_tofu_mapof_insert(map, keys[i], keys[i]);
+    }
+    keys[199] = NULL;
+
+    fossil_tofu_t out[200];
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_mapof_get_many(map, keys, 200, out), 100);
+    ASSUME_ITS_EQUAL_CSTR(out[0].value.data, "0");
+    ASSUME_ITS_EQUAL_CSTR(out[150].value.data, "150");
+    ASSUME_ITS_CNULL(out[151].value.data);
+    ASSUME_ITS_CNULL(out[199].value.data);
+    fossil_tofu_mapof_destroy(map);
+}
+
+FOSSIL_TEST(objc_test_mapof_insert_many) {
+    fossil_tofu_mapof_t* map = fossil_tofu_mapof_create_container("cstr", "i32");
+    char* keys[] = {"a", "b", "c", "a"};
+    char* values[] = {"1", "2", "3", "4"};
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_mapof_insert_many(map, keys, values, 4), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_mapof_size(map), 4);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_mapof_get(map, "a").value.data, "4");
+    fossil_tofu_mapof_remove(map, "a");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_mapof_get(map, "a").value.data, "1");
+
+    fossil_tofu_mapof_t* ordered = fossil_tofu_mapof_create_ordered("i32", "i32");
+    char* numbers[] = {"3", "1", "2"};
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_mapof_insert_many(ordered, numbers, numbers, 3), FOSSIL_TOFU_SUCCESS);
+    fossil_tofu_t out[3];
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_mapof_get_many(ordered, numbers, 3, out), 3);
+    ASSUME_ITS_EQUAL_CSTR(out[1].value.data, "1");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_mapof_first(ordered)->key.value.data, "1");
+    fossil_tofu_mapof_destroy(ordered);
+    fossil_tofu_mapof_destroy(map);
+}
+
+FOSSIL_TEST(objc_test_mapof_insert_many_rejects_null_pair) {
+    fossil_tofu_mapof_t* maps[3] = {
+        fossil_tofu_mapof_create_container("i32", "i32"),
+        fossil_tofu_mapof_create_ordered("i32", "i32"),
+        fossil_tofu_mapof_create_insertion_ordered("i32", "i32")
+    };
+    // The missing value sits in the second prefetch batch of the hashed path.
+    char* keys[20];
+    char* values[20];
+    char text[20][8];
+    for (int i = 0; i < 20; i++) {
+        snprintf(text[i], sizeof(text[i]), "%d", i);
+        keys[i] = text[i];
+        values[i] = text[i];
+    }
+    values[18] = NULL;
+    for (size_t m = 0; m < 3; m++) {
+        ASSUME_ITS_EQUAL_I32(fossil_tofu_mapof_insert_many(maps[m], keys, values, 20), FOSSIL_TOFU_FAILURE);
+        ASSUME_ITS_TRUE(fossil_tofu_mapof_is_empty(maps[m]));
+        ASSUME_ITS_FALSE(fossil_tofu_mapof_contains(maps[m], "0"));
+        fossil_tofu_mapof_destroy(maps[m]);
+    }
+}
+
+FOSSIL_TEST(objc_test_mapof_filter) {
+    fossil_tofu_mapof_t* map = fossil_tofu_mapof_create_container("cstr", "i32");
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_mapof_attach_filter(map, 0), FOSSIL_TOFU_SUCCESS);
+    char key[16];
+    for (int i = 0; i < 300; i++) {
+        snprintf(key, sizeof(key), "k%d", i);
+        fossil_tofu_mapof_insert(map, key, "1");
+    }
+    for (int i = 0; i < 300; i++) {
+        snprintf(key, sizeof(key), "k%d", i);
+        ASSUME_ITS_TRUE(fossil_tofu_mapof_contains(map, key));
+    }
+    ASSUME_ITS_FALSE(fossil_tofu_mapof_contains(map, "k300"));
+    ASSUME_ITS_CNULL(fossil_tofu_mapof_find(map, "nope", 4));
+
+    fossil_tofu_mapof_t* moved = fossil_tofu_mapof_create_move(map);
+    ASSUME_ITS_TRUE(fossil_tofu_mapof_has_filter(moved));
+    ASSUME_ITS_FALSE(fossil_tofu_mapof_has_filter(map));
+    ASSUME_ITS_TRUE(fossil_tofu_mapof_contains(moved, "k123"));
+
+    fossil_tofu_mapof_t* ordered = fossil_tofu_mapof_create_ordered("i32", "i32");
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_mapof_attach_filter(ordered, 0), FOSSIL_TOFU_ERROR_UNSUPPORTED);
+    fossil_tofu_mapof_destroy(ordered);
+    fossil_tofu_mapof_destroy(moved);
+    fossil_tofu_mapof_destroy(map);
+}
+
+static bool objc_mapof_collect_keys(const fossil_tofu_t* key, const fossil_tofu_t* value, void* context) {
+    char* out = (char*)context;
+    strcat(out, key->value.data);
+    return true;
+}
+
+FOSSIL_TEST(objc_test_mapof_insertion_order) {
+    fossil_tofu_mapof_t* map = fossil_tofu_mapof_create_insertion_ordered("cstr", "i32");
+    ASSUME_ITS_TRUE(fossil_tofu_mapof_get_mode(map) == FOSSIL_TOFU_MAPOF_INSERTION);
+    ASSUME_ITS_FALSE(fossil_tofu_mapof_is_ordered(map));
+    fossil_tofu_mapof_insert(map, "c", "1");
+    fossil_tofu_mapof_insert(map, "a", "2");
+    fossil_tofu_mapof_insert(map, "d", "3");
+    fossil_tofu_mapof_insert(map, "b", "4");
+
+    char keys[16] = "";
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_mapof_for_each(map, objc_mapof_collect_keys, keys), 4);
+    ASSUME_ITS_EQUAL_CSTR(keys, "cadb");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_mapof_first(map)->key.value.data, "c");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_mapof_last(map)->key.value.data, "b");
+
+    // Re-inserting shadows in place; the key keeps its position.
+    fossil_tofu_mapof_insert(map, "a", "9");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_mapof_get(map, "a").value.data, "9");
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_mapof_size(map), 5);
+    fossil_tofu_mapof_remove(map, "a");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_mapof_get(map, "a").value.data, "2");
+
+    fossil_tofu_mapof_remove(map, "c");
+    fossil_tofu_mapof_insert(map, "c", "5");
+    keys[0] = '\0';
+    fossil_tofu_mapof_for_each(map, objc_mapof_collect_keys, keys);
+    ASSUME_ITS_EQUAL_CSTR(keys, "adbc");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_mapof_first(map)->key.value.data, "a");
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_mapof_remove(map, "zz"), FOSSIL_TOFU_FAILURE);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_mapof_attach_filter(map, 0), FOSSIL_TOFU_ERROR_UNSUPPORTED);
+    fossil_tofu_mapof_destroy(map);
+}
+
+FOSSIL_TEST(objc_test_mapof_insertion_growth_and_copy) {
+    fossil_tofu_mapof_t* map = fossil_tofu_mapof_create_insertion_ordered("i32", "i32");
+    char text[16];
+    for (int i = 0; i < 1000; i++) {
+        snprintf(text, sizeof(text), "%d", i);
+        fossil_tofu_mapof_insert(map, text, text);
+    }
+    for (int i = 0; i < 1000; i += 2) {
+        snprintf(text, sizeof(text), "%d", i);
+        fossil_tofu_mapof_remove(map, text);
+    }
+    for (int i = 1000; i < 1200; i++) {
+        snprintf(text, sizeof(text), "%d", i);
+        fossil_tofu_mapof_insert(map, text, text);
+    }
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_mapof_size(map), 700);
+    ASSUME_ITS_TRUE(fossil_tofu_mapof_contains(map, "999"));
+    ASSUME_ITS_FALSE(fossil_tofu_mapof_contains(map, "998"));
+    ASSUME_NOT_CNULL(fossil_tofu_mapof_find_i64(map, 1199));
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_mapof_first(map)->key.value.data, "1");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_mapof_last(map)->key.value.data, "1199");
+
+    fossil_tofu_mapof_t* copy = fossil_tofu_mapof_create_copy(map);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_mapof_size(copy), 700);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_mapof_first(copy)->key.value.data, "1");
+    fossil_tofu_mapof_set(copy, "1", "-1");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_mapof_get(map, "1").value.data, "1");
+
+    fossil_tofu_mapof_t* moved = fossil_tofu_mapof_create_move(copy);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_mapof_get(moved, "1").value.data, "-1");
+    ASSUME_ITS_TRUE(fossil_tofu_mapof_is_empty(copy));
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_mapof_reserve(moved, 5000), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_TRUE(fossil_tofu_mapof_capacity(moved) >= 5000);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_mapof_last(moved)->key.value.data, "1199");
+    fossil_tofu_mapof_destroy(moved);
+    fossil_tofu_mapof_destroy(copy);
+    fossil_tofu_mapof_destroy(map);
+}
+
+FOSSIL_TEST(objc_test_mapof_numeric_key_equality) {
+    fossil_tofu_mapof_t* maps[3] = {
+        fossil_tofu_mapof_create_container("i32", "cstr"),
+        fossil_tofu_mapof_create_ordered("i32", "cstr"),
+        fossil_tofu_mapof_create_insertion_ordered("i32", "cstr")
+    };
+    for (size_t m = 0; m < 3; m++) {
+        fossil_tofu_mapof_insert(maps[m], "5", "five");
+        ASSUME_ITS_TRUE(fossil_tofu_mapof_contains(maps[m], "05"));
+        ASSUME_ITS_TRUE(fossil_tofu_mapof_contains_key(maps[m], "+5x", 2));
+        ASSUME_ITS_EQUAL_CSTR(fossil_tofu_mapof_get(maps[m], "05").value.data, "five");
+        ASSUME_ITS_EQUAL_I32(fossil_tofu_mapof_remove(maps[m], "005"), FOSSIL_TOFU_SUCCESS);
+        ASSUME_ITS_FALSE(fossil_tofu_mapof_contains(maps[m], "5"));
+        fossil_tofu_mapof_destroy(maps[m]);
+    }
+
+    fossil_tofu_mapof_t* real = fossil_tofu_mapof_create_container("f64", "cstr");
+    fossil_tofu_mapof_insert(real, "1.5", "x");
+    fossil_tofu_mapof_insert(real, "0", "zero");
+    ASSUME_ITS_TRUE(fossil_tofu_mapof_contains(real, "1.50"));
+    ASSUME_ITS_TRUE(fossil_tofu_mapof_contains(real, "-0.0"));
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_mapof_size(real), 2);
+    fossil_tofu_mapof_destroy(real);
+
+    fossil_tofu_mapof_t* text = fossil_tofu_mapof_create_container("cstr", "cstr");
+    fossil_tofu_mapof_insert(text, "5", "five");
+    ASSUME_ITS_FALSE(fossil_tofu_mapof_contains(text, "05"));
+    fossil_tofu_mapof_destroy(text);
+}
+
+FOSSIL_TEST(objc_test_mapof_find_long_keys) {
+    char key[101];
+    memset(key, 'k', 100);
+    key[100] = '\0';
+    fossil_tofu_mapof_t* maps[3] = {
+        fossil_tofu_mapof_create_container("cstr", "cstr"),
+        fossil_tofu_mapof_create_ordered("cstr", "cstr"),
+        fossil_tofu_mapof_create_insertion_ordered("cstr", "cstr")
+    };
+    for (size_t m = 0; m < 3; m++) {
+        fossil_tofu_mapof_insert(maps[m], key, "long");
+        fossil_tofu_mapof_insert(maps[m], "k", "short");
+        ASSUME_ITS_EQUAL_CSTR(fossil_tofu_mapof_find(maps[m], key, 100)->value.data, "long");
+        ASSUME_ITS_EQUAL_CSTR(fossil_tofu_mapof_find(maps[m], key, 1)->value.data, "short");
+        ASSUME_ITS_CNULL(fossil_tofu_mapof_find(maps[m], key, 99));
+        fossil_tofu_mapof_destroy(maps[m]);
+    }
+
+    // Numeric text this long is not parsed, so it only matches itself.
+    char padded[FOSSIL_TOFU_KEY_TEXT_MAX + 2];
+    memset(padded, '0', FOSSIL_TOFU_KEY_TEXT_MAX);
+    padded[FOSSIL_TOFU_KEY_TEXT_MAX] = '5';
+    padded[FOSSIL_TOFU_KEY_TEXT_MAX + 1] = '\0';
+    fossil_tofu_mapof_t* numbers = fossil_tofu_mapof_create_container("i32", "cstr");
+    fossil_tofu_mapof_insert(numbers, "5", "five");
+    ASSUME_ITS_CNULL(fossil_tofu_mapof_find(numbers, padded, sizeof(padded) - 1));
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_mapof_find(numbers, padded + 2, FOSSIL_TOFU_KEY_TEXT_MAX - 1)->value.data, "five");
+    fossil_tofu_mapof_insert(numbers, padded, "padded");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_mapof_find(numbers, padded, sizeof(padded) - 1)->value.data, "padded");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_mapof_find(numbers, "5", 1)->value.data, "five");
+    fossil_tofu_mapof_destroy(numbers);
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -179,6 +605,23 @@ FOSSIL_TEST_GROUP(objc_mapof_tofu_tests) {
     FOSSIL_TEST_ADD(objc_mapof_tofu_fixture, objc_test_mapof_insert_duplicate);
     FOSSIL_TEST_ADD(objc_mapof_tofu_fixture, objc_test_mapof_remove_nonexistent);
     FOSSIL_TEST_ADD(objc_mapof_tofu_fixture, objc_test_mapof_null_args);
+    FOSSIL_TEST_ADD(objc_mapof_tofu_fixture, objc_test_mapof_remove_uncovers_shadowed);
+    FOSSIL_TEST_ADD(objc_mapof_tofu_fixture, objc_test_mapof_grow_and_remove_many);
+    FOSSIL_TEST_ADD(objc_mapof_tofu_fixture, objc_test_mapof_reserve);
+    FOSSIL_TEST_ADD(objc_mapof_tofu_fixture, objc_test_mapof_copy_keeps_shadowed);
+    FOSSIL_TEST_ADD(objc_mapof_tofu_fixture, objc_test_mapof_find_raw_key);
+    FOSSIL_TEST_ADD(objc_mapof_tofu_fixture, objc_test_mapof_ordered_insert_remove);
+    FOSSIL_TEST_ADD(objc_mapof_tofu_fixture, objc_test_mapof_ordered_bounds);
+    FOSSIL_TEST_ADD(objc_mapof_tofu_fixture, objc_test_mapof_ordered_range_datetime);
+    FOSSIL_TEST_ADD(objc_mapof_tofu_fixture, objc_test_mapof_ordered_copy_and_shadow);
+    FOSSIL_TEST_ADD(objc_mapof_tofu_fixture, objc_test_mapof_get_many);
+    FOSSIL_TEST_ADD(objc_mapof_tofu_fixture, objc_test_mapof_insert_many);
+    FOSSIL_TEST_ADD(objc_mapof_tofu_fixture, objc_test_mapof_insert_many_rejects_null_pair);
+    FOSSIL_TEST_ADD(objc_mapof_tofu_fixture, objc_test_mapof_filter);
+    FOSSIL_TEST_ADD(objc_mapof_tofu_fixture, objc_test_mapof_insertion_order);
+    FOSSIL_TEST_ADD(objc_mapof_tofu_fixture, objc_test_mapof_insertion_growth_and_copy);
+    FOSSIL_TEST_ADD(objc_mapof_tofu_fixture, objc_test_mapof_numeric_key_equality);
+    FOSSIL_TEST_ADD(objc_mapof_tofu_fixture, objc_test_mapof_find_long_keys);
 
     // Register the test group
     FOSSIL_TEST_REGISTER(objc_mapof_tofu_fixture);
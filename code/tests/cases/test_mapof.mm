@@ -142,6 +142,97 @@ FOSSIL_TEST(objcpp_test_mapof_remove_nonexistent) {
 
 // Null argument tests are not applicable for C++ class usage, as null pointers are not passed.
 
+FOSSIL_TEST(objcpp_test_mapof_reserve_and_lookup) {
+    MapOf map("cstr", "i32");
+    map.reserve(2000);
+    size_t capacity = map.capacity();
+    for (int i = 0; i < 2000; i++) {
+        map.insert("key" + std::to_string(i), std::to_string(i));
+    }
+    ASSUME_ITS_EQUAL_SIZE(map.capacity(), capacity);
+    ASSUME_ITS_EQUAL_SIZE(map.size(), 2000);
+    ASSUME_ITS_TRUE(map.contains("key1999"));
+    ASSUME_ITS_FALSE(map.contains("key2000"));
+    ASSUME_ITS_EQUAL_CSTR(map.get("key42").value.data, "42");
+}
+
+FOSSIL_TEST(objcpp_test_mapof_find) {
+    MapOf map("i32", "cstr");
+    map.insert("12", "twelve");
+    const fossil_tofu_t* value = map.find(std::string("12"));
+    ASSUME_NOT_CNULL(value);
+    ASSUME_ITS_EQUAL_CSTR(value->value.data, "twelve");
+    ASSUME_NOT_CNULL(map.find(int64_t(12)));
+    ASSUME_ITS_CNULL(map.find(int64_t(13)));
+}
+
+FOSSIL_TEST(objcpp_test_mapof_ordered) {
+    MapOf map = MapOf::ordered("i32", "cstr");
+    for (int i = 50; i > 0; i--) {
+        map.insert(std::to_string(i), "v" + std::to_string(i));
+    }
+    ASSUME_ITS_TRUE(map.is_ordered());
+    ASSUME_ITS_EQUAL_CSTR(map.first()->key.value.data, "1");
+    ASSUME_ITS_EQUAL_CSTR(map.last()->key.value.data, "50");
+    ASSUME_ITS_EQUAL_CSTR(map.floor("0") == nullptr ? "none" : "some", "none");
+    long previous = 0;
+    bool sorted = true;
+    size_t visited = map.range("10", "20", [&](const fossil_tofu_t& key, const fossil_tofu_t&) {
+        long current = std::stol(key.value.data);
+        sorted = sorted && current > previous;
+        previous = current;
+    });
+    ASSUME_ITS_EQUAL_SIZE(visited, 10);
+    ASSUME_ITS_TRUE(sorted);
+    ASSUME_ITS_EQUAL_I32(previous, 19);
+}
+
+FOSSIL_TEST(objcpp_test_mapof_batched) {
+    MapOf map("cstr", "cstr");
+    ASSUME_ITS_EQUAL_I32(map.insert_many({{"x", "1"}, {"y", "2"}}), FOSSIL_TOFU_SUCCESS);
+    std::vector<fossil_tofu_t> out = map.get_many({"y", "z", "x"});
+    ASSUME_ITS_EQUAL_SIZE(out.size(), 3);
+    ASSUME_ITS_EQUAL_CSTR(out[0].value.data, "2");
+    ASSUME_ITS_CNULL(out[1].value.data);
+    ASSUME_ITS_EQUAL_CSTR(out[2].value.data, "1");
+}
+
+FOSSIL_TEST(objcpp_test_mapof_filter) {
+    MapOf map("cstr", "cstr");
+    map.attach_filter(16);
+    map.insert("a", "1");
+    ASSUME_ITS_TRUE(map.has_filter());
+    ASSUME_ITS_TRUE(map.contains("a"));
+    ASSUME_ITS_TRUE(map.find("b") == nullptr);
+    map.detach_filter();
+    ASSUME_ITS_FALSE(map.has_filter());
+}
+
+FOSSIL_TEST(objcpp_test_mapof_insertion_ordered) {
+    MapOf map = MapOf::insertion_ordered("cstr", "cstr");
+    ASSUME_ITS_TRUE(map.mode() == FOSSIL_TOFU_MAPOF_INSERTION);
+    map.insert("zeta", "1");
+    map.insert("alpha", "2");
+    map.insert("mid", "3");
+    std::string keys;
+    map.for_each([&keys](const fossil_tofu_t& key, const fossil_tofu_t&) {
+        keys += key.value.data;
+        keys += ",";
+        return true;
+    });
+    ASSUME_ITS_TRUE(keys == "zeta,alpha,mid,");
+    ASSUME_ITS_EQUAL_CSTR(map.last()->key.value.data, "mid");
+}
+
+FOSSIL_TEST(objcpp_test_mapof_numeric_key_equality) {
+    MapOf map("u64", "cstr");
+    map.insert("42", "answer");
+    ASSUME_ITS_TRUE(map.contains("0042"));
+    MapOf dense = MapOf::insertion_ordered("u64", "cstr");
+    dense.insert("42", "answer");
+    ASSUME_ITS_TRUE(dense.contains("0042"));
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -156,6 +247,13 @@ FOSSIL_TEST_GROUP(objcpp_mapof_tofu_tests) {
     FOSSIL_TEST_ADD(objcpp_mapof_tofu_fixture, objcpp_test_mapof_is_empty_and_not_empty);
     FOSSIL_TEST_ADD(objcpp_mapof_tofu_fixture, objcpp_test_mapof_insert_duplicate);
     FOSSIL_TEST_ADD(objcpp_mapof_tofu_fixture, objcpp_test_mapof_remove_nonexistent);
+    FOSSIL_TEST_ADD(objcpp_mapof_tofu_fixture, objcpp_test_mapof_reserve_and_lookup);
+    FOSSIL_TEST_ADD(objcpp_mapof_tofu_fixture, objcpp_test_mapof_find);
+    FOSSIL_TEST_ADD(objcpp_mapof_tofu_fixture, objcpp_test_mapof_ordered);
+    FOSSIL_TEST_ADD(objcpp_mapof_tofu_fixture, objcpp_test_mapof_batched);
+    FOSSIL_TEST_ADD(objcpp_mapof_tofu_fixture, objcpp_test_mapof_filter);
+    FOSSIL_TEST_ADD(objcpp_mapof_tofu_fixture, objcpp_test_mapof_insertion_ordered);
+    FOSSIL_TEST_ADD(objcpp_mapof_tofu_fixture, objcpp_test_mapof_numeric_key_equality);
 
     // Register the test group
     FOSSIL_TEST_REGISTER(objcpp_mapof_tofu_fixture);
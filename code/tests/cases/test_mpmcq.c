@@ -0,0 +1,208 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/pizza/framework.h>
+
+#include "fossil/tofu/framework.h"
+#include "fossil/tofu/threads.h"
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_SUITE(c_mpmcq_tofu_fixture);
+
+FOSSIL_SETUP(c_mpmcq_tofu_fixture) {
+    // Setup the test fixture
+}
+
+FOSSIL_TEARDOWN(c_mpmcq_tofu_fixture) {
+    // Teardown the test fixture
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_TEST(c_test_mpmcq_insert_and_take) {
+    fossil_tofu_mpmcq_t* queue = fossil_tofu_mpmcq_create_container("i32", 3);
+    ASSUME_NOT_CNULL(queue);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_mpmcq_capacity(queue), 4);
+    ASSUME_ITS_TRUE(fossil_tofu_mpmcq_is_empty(queue));
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_mpmcq_insert(queue, "1"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_mpmcq_try_insert(queue, "2"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_mpmcq_try_insert(queue, "3"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_mpmcq_try_insert(queue, "4"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_mpmcq_try_insert(queue, "5"), FOSSIL_TOFU_FAILURE);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_mpmcq_size(queue), 4);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_mpmcq_get_front(queue), "1");
+
+    fossil_tofu_t out;
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_mpmcq_take(queue, &out), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&out), "1");
+    fossil_tofu_destroy(&out);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_mpmcq_remove(queue), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_mpmcq_try_take(queue, &out), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&out), "3");
+    fossil_tofu_destroy(&out);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_mpmcq_size(queue), 1);
+    fossil_tofu_mpmcq_destroy(queue);
+}
+
+FOSSIL_TEST(c_test_mpmcq_empty) {
+    fossil_tofu_mpmcq_t* queue = fossil_tofu_mpmcq_create_container("i32", 2);
+    fossil_tofu_t out;
+    ASSUME_ITS_CNULL(fossil_tofu_mpmcq_get_front(queue));
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_mpmcq_try_take(queue, &out), FOSSIL_TOFU_FAILURE);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_mpmcq_remove(queue), FOSSIL_TOFU_FAILURE);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_mpmcq_take_batch(queue, &out, 1), 0);
+    ASSUME_ITS_CNULL(fossil_tofu_mpmcq_create_container("i32", 0));
+    fossil_tofu_mpmcq_destroy(queue);
+}
+
+FOSSIL_TEST(c_test_mpmcq_batch) {
+    fossil_tofu_mpmcq_t* queue = fossil_tofu_mpmcq_create_container("i32", 4);
+    char* values[] = {"1", "2", "3", "4", "5", "6"};
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_mpmcq_insert_batch(queue, values, 6), 4);
+
+    fossil_tofu_t out[8];
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_mpmcq_take_batch(queue, out, 3), 3);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&out[0]), "1");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&out[2]), "3");
+    for (int i = 0; i < 3; i++) {
+        fossil_tofu_destroy(&out[i]);
+    }
+
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_mpmcq_insert_batch(queue, values + 4, 2), 2);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_mpmcq_take_batch(queue, out, 8), 3);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&out[0]), "4");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&out[2]), "6");
+    for (int i = 0; i < 3; i++) {
+        fossil_tofu_destroy(&out[i]);
+    }
+    fossil_tofu_mpmcq_destroy(queue);
+}
+
+#define C_MPMCQ_THREADS 4
+#define C_MPMCQ_PER_PRODUCER 1000
+
+typedef struct {
+    fossil_tofu_mpmcq_t* queue;
+    int id;
+    int* seen;
+} c_mpmcq_worker_t;
+
+static void* c_mpmcq_producer(void* arg) {
+    c_mpmcq_worker_t* work = (c_mpmcq_worker_t*)arg;
+    char value[16];
+    for (int i = 0; i < C_MPMCQ_PER_PRODUCER; i++) {
+        snprintf(value, sizeof(value), "%d", work->id * C_MPMCQ_PER_PRODUCER + i);
+        fossil_tofu_mpmcq_insert(work->queue, value);
+    }
+    return NULL;
+}
+
+static void* c_mpmcq_consumer(void* arg) {
+    c_mpmcq_worker_t* work = (c_mpmcq_worker_t*)arg;
+    fossil_tofu_t out[8];
+    for (int taken = 0; taken < C_MPMCQ_PER_PRODUCER;) {
+        size_t want = (size_t)(C_MPMCQ_PER_PRODUCER - taken) < 8 ? (size_t)(C_MPMCQ_PER_PRODUCER - taken) : 8;
+        size_t count = fossil_tofu_mpmcq_take_batch(work->queue, out, want);
+        if (count == 0) {
+            fossil_tofu_thread_yield();
+        }
+        for (size_t i = 0; i < count; i++) {
+            work->seen[atoi(fossil_tofu_get_value(&out[i]))]++;
+            fossil_tofu_destroy(&out[i]);
+        }
+        taken += (int)count;
+    }
+    return NULL;
+}
+
+FOSSIL_TEST(c_test_mpmcq_threaded_fan_in) {
+    fossil_tofu_mpmcq_t* queue = fossil_tofu_mpmcq_create_container("i32", 16);
+    static int seen[C_MPMCQ_THREADS][C_MPMCQ_THREADS * C_MPMCQ_PER_PRODUCER];
+    memset(seen, 0, sizeof(seen));
+    fossil_tofu_thread_t threads[2 * C_MPMCQ_THREADS];
+    bool started[2 * C_MPMCQ_THREADS] = {false};
+    c_mpmcq_worker_t work[2 * C_MPMCQ_THREADS];
+    for (int t = 0; t < C_MPMCQ_THREADS; t++) {
+        work[t] = (c_mpmcq_worker_t){queue, t, NULL};
+        work[C_MPMCQ_THREADS + t] = (c_mpmcq_worker_t){queue, t, seen[t]};
+        // A producer without a running consumer could block forever, so a
+        // pair only runs once its consumer is up; a producer that fails to
+        // start runs inline against it instead.
+        started[C_MPMCQ_THREADS + t] = fossil_tofu_thread_create(&threads[C_MPMCQ_THREADS + t], c_mpmcq_consumer, &work[C_MPMCQ_THREADS + t]) == FOSSIL_TOFU_SUCCESS;
+        if (!started[C_MPMCQ_THREADS + t]) {
+            continue;
+        }
+        started[t] = fossil_tofu_thread_create(&threads[t], c_mpmcq_producer, &work[t]) == FOSSIL_TOFU_SUCCESS;
+        if (!started[t]) {
+            c_mpmcq_producer(&work[t]);
+        }
+    }
+    for (int t = 0; t < 2 * C_MPMCQ_THREADS; t++) {
+        if (started[t]) {
+            fossil_tofu_thread_join(threads[t]);
+        }
+    }
+
+    bool exactly_once = true;
+    for (int v = 0; v < C_MPMCQ_THREADS * C_MPMCQ_PER_PRODUCER; v++) {
+        int total = 0;
+        for (int t = 0; t < C_MPMCQ_THREADS; t++) {
+            total += seen[t][v];
+        }
+        int expected = started[C_MPMCQ_THREADS + v / C_MPMCQ_PER_PRODUCER] ? 1 : 0;
+        if (total != expected) {
+            exactly_once = false;
+        }
+    }
+    ASSUME_ITS_TRUE(exactly_once);
+    ASSUME_ITS_TRUE(fossil_tofu_mpmcq_is_empty(queue));
+    fossil_tofu_mpmcq_destroy(queue);
+}
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(c_mpmcq_tofu_tests) {    
+    // Generic ToFu Fixture
+    FOSSIL_TEST_ADD(c_mpmcq_tofu_fixture, c_test_mpmcq_insert_and_take);
+    FOSSIL_TEST_ADD(c_mpmcq_tofu_fixture, c_test_mpmcq_empty);
+    FOSSIL_TEST_ADD(c_mpmcq_tofu_fixture, c_test_mpmcq_batch);
+    FOSSIL_TEST_ADD(c_mpmcq_tofu_fixture, c_test_mpmcq_threaded_fan_in);
+
+    // Register the test group
+    FOSSIL_TEST_REGISTER(c_mpmcq_tofu_fixture);
+} // end of tests
@@ -0,0 +1,129 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/pizza/framework.h>
+
+#include "fossil/tofu/framework.h"
+#include <string>
+#include <thread>
+#include <vector>
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_SUITE(cpp_mpmcq_tofu_fixture);
+
+FOSSIL_SETUP(cpp_mpmcq_tofu_fixture) {
+    // Setup the test fixture
+}
+
+FOSSIL_TEARDOWN(cpp_mpmcq_tofu_fixture) {
+    // Teardown the test fixture
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+using fossil::tofu::MPMCQueue;
+
+FOSSIL_TEST(cpp_test_mpmcq_insert_and_take) {
+    MPMCQueue queue("i32", 2);
+    ASSUME_ITS_EQUAL_SIZE(queue.capacity(), 2);
+    ASSUME_ITS_EQUAL_I32(queue.insert("10"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(queue.try_insert("20"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(queue.try_insert("30"), FOSSIL_TOFU_FAILURE);
+    ASSUME_ITS_EQUAL_CSTR(queue.get_front().c_str(), "10");
+    ASSUME_ITS_EQUAL_CSTR(queue.take().c_str(), "10");
+
+    std::string value;
+    ASSUME_ITS_TRUE(queue.try_take(value));
+    ASSUME_ITS_EQUAL_CSTR(value.c_str(), "20");
+    ASSUME_ITS_FALSE(queue.try_take(value));
+    ASSUME_ITS_TRUE(queue.is_empty());
+}
+
+FOSSIL_TEST(cpp_test_mpmcq_threaded_batch) {
+    MPMCQueue queue("i32", 16);
+    const int producers = 4;
+    const int per_producer = 500;
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; p++) {
+        threads.emplace_back([&queue, p, per_producer]() {
+            std::vector<std::string> batch;
+            for (int i = 0; i < per_producer; i++) {
+                batch.push_back(std::to_string(p * per_producer + i));
+            }
+            size_t sent = 0;
+            while (sent < batch.size()) {
+                std::vector<std::string> rest(batch.begin() + sent, batch.end());
+                sent += queue.insert_batch(rest);
+                std::this_thread::yield();
+            }
+        });
+    }
+
+    std::vector<std::string> received;
+    while (received.size() < static_cast<size_t>(producers * per_producer)) {
+        if (queue.take_batch(received, 8) == 0) {
+            std::this_thread::yield();
+        }
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    std::vector<int> seen(producers * per_producer, 0);
+    for (const std::string& value : received) {
+        seen[std::stoi(value)]++;
+    }
+    bool exactly_once = true;
+    for (int count : seen) {
+        if (count != 1) {
+            exactly_once = false;
+        }
+    }
+    ASSUME_ITS_TRUE(exactly_once);
+}
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(cpp_mpmcq_tofu_tests) {    
+    // Generic ToFu Fixture
+    FOSSIL_TEST_ADD(cpp_mpmcq_tofu_fixture, cpp_test_mpmcq_insert_and_take);
+    FOSSIL_TEST_ADD(cpp_mpmcq_tofu_fixture, cpp_test_mpmcq_threaded_batch);
+
+    // Register the test group
+    FOSSIL_TEST_REGISTER(cpp_mpmcq_tofu_fixture);
+} // end of tests
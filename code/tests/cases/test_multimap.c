@@ -0,0 +1,155 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/pizza/framework.h>
+
+#include "fossil/tofu/framework.h"
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_SUITE(c_multimap_tofu_fixture);
+
+FOSSIL_SETUP(c_multimap_tofu_fixture) {
+    // Setup the test fixture
+}
+
+FOSSIL_TEARDOWN(c_multimap_tofu_fixture) {
+    // Teardown the test fixture
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_TEST(c_test_multimap_create_and_destroy) {
+    fossil_tofu_multimap_t* map = fossil_tofu_multimap_create_container("cstr", "i32");
+    ASSUME_NOT_CNULL(map);
+    ASSUME_ITS_TRUE(fossil_tofu_multimap_is_empty(map));
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_multimap_key_count(map), 0);
+    fossil_tofu_multimap_destroy(map);
+}
+
+FOSSIL_TEST(c_test_multimap_insert_and_get_all) {
+    fossil_tofu_multimap_t* map = fossil_tofu_multimap_create_container("cstr", "i32");
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_multimap_insert(map, "a", "1"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_multimap_insert(map, "b", "2"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_multimap_insert(map, "a", "3"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_multimap_insert(map, "a", "5"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_multimap_size(map), 4);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_multimap_key_count(map), 2);
+
+    size_t count = 0;
+    const fossil_tofu_t* values = fossil_tofu_multimap_get_all(map, "a", &count);
+    ASSUME_ITS_EQUAL_SIZE(count, 3);
+    ASSUME_ITS_EQUAL_CSTR(values[0].value.data, "1");
+    ASSUME_ITS_EQUAL_CSTR(values[1].value.data, "3");
+    ASSUME_ITS_EQUAL_CSTR(values[2].value.data, "5");
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_multimap_count(map, "b"), 1);
+    ASSUME_ITS_CNULL(fossil_tofu_multimap_get_all(map, "c", &count));
+    ASSUME_ITS_EQUAL_SIZE(count, 0);
+    ASSUME_NOT_CNULL(fossil_tofu_multimap_find(map, "abc", 1, &count));
+    ASSUME_ITS_EQUAL_SIZE(count, 3);
+    fossil_tofu_multimap_destroy(map);
+}
+
+FOSSIL_TEST(c_test_multimap_remove) {
+    fossil_tofu_multimap_t* map = fossil_tofu_multimap_create_container("cstr", "cstr");
+    fossil_tofu_multimap_insert(map, "k", "x");
+    fossil_tofu_multimap_insert(map, "k", "y");
+    fossil_tofu_multimap_insert(map, "k", "z");
+    fossil_tofu_multimap_insert(map, "j", "x");
+
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_multimap_remove_value(map, "k", "y"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_multimap_remove_value(map, "k", "q"), FOSSIL_TOFU_ERROR_NOT_FOUND);
+    size_t count = 0;
+    const fossil_tofu_t* values = fossil_tofu_multimap_get_all(map, "k", &count);
+    ASSUME_ITS_EQUAL_SIZE(count, 2);
+    ASSUME_ITS_EQUAL_CSTR(values[0].value.data, "x");
+    ASSUME_ITS_EQUAL_CSTR(values[1].value.data, "z");
+
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_multimap_remove_value(map, "j", "x"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_FALSE(fossil_tofu_multimap_contains(map, "j"));
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_multimap_remove(map, "k"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_multimap_remove(map, "k"), FOSSIL_TOFU_ERROR_NOT_FOUND);
+    ASSUME_ITS_TRUE(fossil_tofu_multimap_is_empty(map));
+    fossil_tofu_multimap_destroy(map);
+}
+
+static bool c_multimap_sum_visit(const fossil_tofu_t* key, const fossil_tofu_t* values, size_t count, void* context) {
+    size_t* total = (size_t*)context;
+    *total += count;
+    return true;
+}
+
+FOSSIL_TEST(c_test_multimap_group_by_copy_and_for_each) {
+    fossil_tofu_multimap_t* map = fossil_tofu_multimap_create_container("cstr", "i32");
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_multimap_reserve(map, 10), FOSSIL_TOFU_SUCCESS);
+    char key[8], value[16];
+    for (int i = 0; i < 200; i++) {
+        snprintf(key, sizeof(key), "g%d", i % 10);
+        snprintf(value, sizeof(value), "%d", i);
+        fossil_tofu_multimap_insert(map, key, value);
+    }
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_multimap_key_count(map), 10);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_multimap_count(map, "g3"), 20);
+
+    fossil_tofu_multimap_t* copy = fossil_tofu_multimap_create_copy(map);
+    fossil_tofu_multimap_remove(map, "g3");
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_multimap_count(copy, "g3"), 20);
+
+    size_t total = 0;
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_multimap_for_each(copy, c_multimap_sum_visit, &total), 10);
+    ASSUME_ITS_EQUAL_SIZE(total, 200);
+
+    fossil_tofu_multimap_t* moved = fossil_tofu_multimap_create_move(copy);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_multimap_size(moved), 200);
+    ASSUME_ITS_TRUE(fossil_tofu_multimap_is_empty(copy));
+    fossil_tofu_multimap_destroy(moved);
+    fossil_tofu_multimap_destroy(copy);
+    fossil_tofu_multimap_destroy(map);
+}
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(c_multimap_tofu_tests) {    
+    // Generic ToFu Fixture
+    FOSSIL_TEST_ADD(c_multimap_tofu_fixture, c_test_multimap_create_and_destroy);
+    FOSSIL_TEST_ADD(c_multimap_tofu_fixture, c_test_multimap_insert_and_get_all);
+    FOSSIL_TEST_ADD(c_multimap_tofu_fixture, c_test_multimap_remove);
+    FOSSIL_TEST_ADD(c_multimap_tofu_fixture, c_test_multimap_group_by_copy_and_for_each);
+
+    // Register the test group
+    FOSSIL_TEST_REGISTER(c_multimap_tofu_fixture);
+} // end of tests
@@ -167,6 +167,156 @@ FOSSIL_TEST(objc_test_pqueue_size_consistency) {
     fossil_tofu_pqueue_destroy(pqueue);
 }
 
+FOSSIL_TEST(objc_test_pqueue_equal_priorities_fifo) {
+    fossil_tofu_pqueue_t* pqueue = fossil_tofu_pqueue_create_container("cstr");
+    fossil_tofu_pqueue_insert(pqueue, "a", 5);
+    fossil_tofu_pqueue_insert(pqueue, "b", 5);
+    fossil_tofu_pqueue_insert(pqueue, "urgent", 1);
+    fossil_tofu_pqueue_insert(pqueue, "c", 5);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_pqueue_get_front(pqueue), "urgent");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_pqueue_get_back(pqueue), "c");
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_pqueue_pop(pqueue), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_pqueue_get_front(pqueue), "a");
+    fossil_tofu_pqueue_pop(pqueue);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_pqueue_get_front(pqueue), "b");
+    fossil_tofu_pqueue_pop(pqueue);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_pqueue_get_front(pqueue), "c");
+    fossil_tofu_pqueue_pop(pqueue);
+    ASSUME_ITS_TRUE(fossil_tofu_pqueue_is_empty(pqueue));
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_pqueue_pop(pqueue), FOSSIL_TOFU_FAILURE);
+    fossil_tofu_pqueue_destroy(pqueue);
+}
+
+FOSSIL_TEST(objc_test_pqueue_heapify) {
+    fossil_tofu_pqueue_t* pqueue = fossil_tofu_pqueue_create_container("cstr");
+    char* data[] = {"e", "b", "d", "a", "c", "b2"};
+    int32_t priorities[] = {5, 2, 4, 1, 3, 2};
+    fossil_tofu_pqueue_insert(pqueue, "z", 9);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_pqueue_heapify(pqueue, data, priorities, 6), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_pqueue_size(pqueue), 7);
+    const char* expected[] = {"a", "b", "b2", "c", "d", "e", "z"};
+    for (size_t i = 0; i < 7; i++) {
+        ASSUME_ITS_EQUAL_CSTR(fossil_tofu_pqueue_get_front(pqueue), expected[i]);
+        fossil_tofu_pqueue_pop(pqueue);
+    }
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_pqueue_heapify(NULL, data, priorities, 6), FOSSIL_TOFU_ERROR_INVALID_ARGUMENT);
+    fossil_tofu_pqueue_destroy(pqueue);
+}
+
+FOSSIL_TEST(objc_test_pqueue_arity_ordering) {
+    size_t arities[] = {2, 3, 4, 8};
+    ASSUME_ITS_CNULL(fossil_tofu_pqueue_create_arity("i32", 1));
+    for (size_t a = 0; a < 4; a++) {
+        fossil_tofu_pqueue_t* pqueue = fossil_tofu_pqueue_create_arity("i32", arities[a]);
+        ASSUME_NOT_CNULL(pqueue);
+        ASSUME_ITS_EQUAL_I32(fossil_tofu_pqueue_reserve(pqueue, 500), FOSSIL_TOFU_SUCCESS);
+        uint32_t x = 12345;
+        char buffer[16];
+        for (int i = 0; i < 500; i++) {
+            x = x * 1103515245u + 12345u;
+            snprintf(buffer, sizeof(buffer), "%d", i);
+            fossil_tofu_pqueue_insert(pqueue, buffer, (int32_t)((x >> 16) % 100));
+        }
+        fossil_tofu_pqueue_remove(pqueue, 50);
+        int32_t previous = INT32_MIN;
+        int32_t priority = 0;
+        size_t popped = 0;
+        while (fossil_tofu_pqueue_front_priority(pqueue, &priority) == FOSSIL_TOFU_SUCCESS) {
+            ASSUME_ITS_TRUE(priority >= previous);
+            previous = priority;
+            fossil_tofu_pqueue_pop(pqueue);
+            popped++;
+        }
+        ASSUME_ITS_EQUAL_I32(popped, 499);
+        fossil_tofu_pqueue_destroy(pqueue);
+    }
+}
+
+FOSSIL_TEST(objc_test_pqueue_remove_and_set_at_middle) {
+    fossil_tofu_pqueue_t* pqueue = fossil_tofu_pqueue_create_container("cstr");
+    fossil_tofu_pqueue_insert(pqueue, "one", 1);
+    fossil_tofu_pqueue_insert(pqueue, "three", 3);
+    fossil_tofu_pqueue_insert(pqueue, "two", 2);
+    fossil_tofu_pqueue_insert(pqueue, "two-again", 2);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_pqueue_get_at(pqueue, 2), "two");
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_pqueue_remove(pqueue, 2), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_pqueue_get_at(pqueue, 2), "two-again");
+    fossil_tofu_pqueue_set_at(pqueue, 3, "THREE");
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_pqueue_remove(pqueue, 7), FOSSIL_TOFU_FAILURE);
+    fossil_tofu_pqueue_pop(pqueue);
+    fossil_tofu_pqueue_pop(pqueue);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_pqueue_get_front(pqueue), "THREE");
+    fossil_tofu_pqueue_destroy(pqueue);
+}
+
+FOSSIL_TEST(objc_test_pqueue_update_priority) {
+    fossil_tofu_pqueue_t* pqueue = fossil_tofu_pqueue_create_container("cstr");
+    fossil_tofu_pqueue_handle_t a, b, c;
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_pqueue_insert_handle(pqueue, "a", 10, &a), FOSSIL_TOFU_SUCCESS);
+    fossil_tofu_pqueue_insert_handle(pqueue, "b", 20, &b);
+    fossil_tofu_pqueue_insert_handle(pqueue, "c", 30, &c);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_pqueue_update_priority(pqueue, c, 5), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_pqueue_get_front(pqueue), "c");
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_pqueue_update_priority(pqueue, c, 25), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_pqueue_get_front(pqueue), "a");
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_pqueue_update_priority(pqueue, a, 20), FOSSIL_TOFU_SUCCESS);
+    int32_t priority = 0;
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_pqueue_get_handle(pqueue, a, &priority), "a");
+    ASSUME_ITS_EQUAL_I32(priority, 20);
+    // a was re-prioritized after b already held 20, so b leaves first.
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_pqueue_get_front(pqueue), "b");
+    fossil_tofu_pqueue_pop(pqueue);
+    ASSUME_ITS_FALSE(fossil_tofu_pqueue_contains_handle(pqueue, b));
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_pqueue_update_priority(pqueue, b, 1), FOSSIL_TOFU_ERROR_NOT_FOUND);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_pqueue_get_front(pqueue), "a");
+    fossil_tofu_pqueue_destroy(pqueue);
+}
+
+FOSSIL_TEST(objc_test_pqueue_remove_handle) {
+    fossil_tofu_pqueue_t* pqueue = fossil_tofu_pqueue_create_arity("i32", 2);
+    fossil_tofu_pqueue_handle_t handles[64];
+    char buffer[16];
+    for (int i = 0; i < 64; i++) {
+        snprintf(buffer, sizeof(buffer), "%d", i);
+        fossil_tofu_pqueue_insert_handle(pqueue, buffer, (i * 37) % 64, &handles[i]);
+    }
+    for (int i = 0; i < 64; i += 2) {
+        ASSUME_ITS_EQUAL_I32(fossil_tofu_pqueue_remove_handle(pqueue, handles[i]), FOSSIL_TOFU_SUCCESS);
+    }
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_pqueue_size(pqueue), 32);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_pqueue_remove_handle(pqueue, handles[0]), FOSSIL_TOFU_ERROR_NOT_FOUND);
+    ASSUME_ITS_TRUE(fossil_tofu_pqueue_contains_handle(pqueue, handles[1]));
+
+    // A freed slot is reused, but the stale handle to it stays rejected.
+    fossil_tofu_pqueue_handle_t reused;
+    fossil_tofu_pqueue_insert_handle(pqueue, "new", 100, &reused);
+    ASSUME_ITS_FALSE(fossil_tofu_pqueue_contains_handle(pqueue, handles[62]));
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_pqueue_get_handle(pqueue, reused, NULL), "new");
+
+    int32_t previous = INT32_MIN;
+    int32_t priority = 0;
+    while (fossil_tofu_pqueue_front_priority(pqueue, &priority) == FOSSIL_TOFU_SUCCESS) {
+        ASSUME_ITS_TRUE(priority >= previous);
+        ASSUME_ITS_TRUE(priority % 2 == 1 || priority == 100);
+        previous = priority;
+        fossil_tofu_pqueue_pop(pqueue);
+    }
+    fossil_tofu_pqueue_destroy(pqueue);
+}
+
+FOSSIL_TEST(objc_test_pqueue_handles_survive_copy) {
+    fossil_tofu_pqueue_t* pqueue1 = fossil_tofu_pqueue_create_container("cstr");
+    fossil_tofu_pqueue_handle_t x, y;
+    fossil_tofu_pqueue_insert_handle(pqueue1, "x", 1, &x);
+    fossil_tofu_pqueue_insert_handle(pqueue1, "y", 2, &y);
+    fossil_tofu_pqueue_t* pqueue2 = fossil_tofu_pqueue_create_copy(pqueue1);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_pqueue_update_priority(pqueue2, y, 0), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_pqueue_get_front(pqueue2), "y");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_pqueue_get_front(pqueue1), "x");
+    fossil_tofu_pqueue_destroy(pqueue1);
+    fossil_tofu_pqueue_destroy(pqueue2);
+}
+
 
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
@@ -184,6 +334,13 @@ FOSSIL_TEST_GROUP(objc_pqueue_tofu_tests) {
     FOSSIL_TEST_ADD(objc_pqueue_tofu_fixture, objc_test_pqueue_get_front_and_get_back_empty);
     FOSSIL_TEST_ADD(objc_pqueue_tofu_fixture, objc_test_pqueue_remove_empty);
     FOSSIL_TEST_ADD(objc_pqueue_tofu_fixture, objc_test_pqueue_size_consistency);
+    FOSSIL_TEST_ADD(objc_pqueue_tofu_fixture, objc_test_pqueue_equal_priorities_fifo);
+    FOSSIL_TEST_ADD(objc_pqueue_tofu_fixture, objc_test_pqueue_heapify);
+    FOSSIL_TEST_ADD(objc_pqueue_tofu_fixture, objc_test_pqueue_arity_ordering);
+    FOSSIL_TEST_ADD(objc_pqueue_tofu_fixture, objc_test_pqueue_remove_and_set_at_middle);
+    FOSSIL_TEST_ADD(objc_pqueue_tofu_fixture, objc_test_pqueue_update_priority);
+    FOSSIL_TEST_ADD(objc_pqueue_tofu_fixture, objc_test_pqueue_remove_handle);
+    FOSSIL_TEST_ADD(objc_pqueue_tofu_fixture, objc_test_pqueue_handles_survive_copy);
 
     // Register the test group
     FOSSIL_TEST_REGISTER(objc_pqueue_tofu_fixture);
@@ -149,6 +149,55 @@ FOSSIL_TEST(objcpp_test_pqueue_size_consistency) {
     ASSUME_ITS_EQUAL_U32(pqueue.size(), 0u);
 }
 
+FOSSIL_TEST(objcpp_test_pqueue_heapify_and_pop) {
+    PQueue pqueue("cstr", 2);
+    pqueue.heapify({{"low", 9}, {"first", 1}, {"mid", 4}, {"first-tie", 1}});
+    ASSUME_ITS_EQUAL_U32(pqueue.size(), 4u);
+    ASSUME_ITS_EQUAL_I32(pqueue.front_priority(), 1);
+    ASSUME_ITS_EQUAL_CSTR(pqueue.get_front().c_str(), "first");
+    ASSUME_ITS_EQUAL_CSTR(pqueue.get_back().c_str(), "low");
+    pqueue.pop();
+    ASSUME_ITS_EQUAL_CSTR(pqueue.get_front().c_str(), "first-tie");
+    pqueue.pop();
+    ASSUME_ITS_EQUAL_CSTR(pqueue.get_front().c_str(), "mid");
+}
+
+FOSSIL_TEST(objcpp_test_pqueue_invalid_arity_and_empty_priority) {
+    bool thrown = false;
+    try {
+        PQueue bad("i32", 1);
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    ASSUME_ITS_TRUE(thrown);
+    PQueue pqueue("i32");
+    thrown = false;
+    try {
+        pqueue.front_priority();
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    ASSUME_ITS_TRUE(thrown);
+}
+
+FOSSIL_TEST(objcpp_test_pqueue_handles) {
+    PQueue pqueue("cstr");
+    fossil_tofu_pqueue_handle_t far = pqueue.insert_handle("far", 50);
+    fossil_tofu_pqueue_handle_t near = pqueue.insert_handle("near", 10);
+    pqueue.update_priority(far, 1);
+    ASSUME_ITS_EQUAL_CSTR(pqueue.get_front().c_str(), "far");
+    pqueue.remove_handle(far);
+    ASSUME_ITS_FALSE(pqueue.contains_handle(far));
+    ASSUME_ITS_EQUAL_CSTR(pqueue.get_handle(near).c_str(), "near");
+    bool thrown = false;
+    try {
+        pqueue.update_priority(far, 0);
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    ASSUME_ITS_TRUE(thrown);
+}
+
 
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
@@ -165,6 +214,9 @@ FOSSIL_TEST_GROUP(objcpp_pqueue_tofu_tests) {
     FOSSIL_TEST_ADD(objcpp_pqueue_tofu_fixture, objcpp_test_pqueue_get_front_and_get_back_empty);
     FOSSIL_TEST_ADD(objcpp_pqueue_tofu_fixture, objcpp_test_pqueue_remove_empty);
     FOSSIL_TEST_ADD(objcpp_pqueue_tofu_fixture, objcpp_test_pqueue_size_consistency);
+    FOSSIL_TEST_ADD(objcpp_pqueue_tofu_fixture, objcpp_test_pqueue_heapify_and_pop);
+    FOSSIL_TEST_ADD(objcpp_pqueue_tofu_fixture, objcpp_test_pqueue_invalid_arity_and_empty_priority);
+    FOSSIL_TEST_ADD(objcpp_pqueue_tofu_fixture, objcpp_test_pqueue_handles);
 
     // Register the test group
     FOSSIL_TEST_REGISTER(objcpp_pqueue_tofu_fixture);
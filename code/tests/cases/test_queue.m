@@ -166,6 +166,39 @@ FOSSIL_TEST(objc_test_queue_size_consistency) {
     fossil_tofu_queue_destroy(queue);
 }
 
+FOSSIL_TEST(objc_test_queue_verify_tracks_mutations) {
+    fossil_tofu_queue_t* queue = fossil_tofu_queue_create_container("i32");
+    ASSUME_ITS_TRUE(fossil_tofu_queue_verify(queue));
+    fossil_tofu_queue_insert(queue, "1");
+    fossil_tofu_queue_insert(queue, "2");
+    fossil_tofu_queue_insert(queue, "3");
+    ASSUME_ITS_TRUE(fossil_tofu_queue_verify(queue));
+    fossil_tofu_queue_t* copy = fossil_tofu_queue_create_copy(queue);
+    ASSUME_ITS_TRUE(fossil_tofu_queue_verify(copy));
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_queue_size(copy), 3);
+    fossil_tofu_queue_t* moved = fossil_tofu_queue_create_move(copy);
+    ASSUME_ITS_TRUE(fossil_tofu_queue_verify(moved));
+    ASSUME_ITS_TRUE(fossil_tofu_queue_verify(copy));
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_queue_size(copy), 0);
+    ASSUME_ITS_FALSE(fossil_tofu_queue_verify(NULL));
+    fossil_tofu_queue_destroy(moved);
+    fossil_tofu_queue_destroy(copy);
+    fossil_tofu_queue_destroy(queue);
+}
+
+FOSSIL_TEST(objc_test_queue_remove_last_clears_rear) {
+    fossil_tofu_queue_t* queue = fossil_tofu_queue_create_container("i32");
+    fossil_tofu_queue_insert(queue, "1");
+    fossil_tofu_queue_remove(queue);
+    ASSUME_ITS_CNULL(fossil_tofu_queue_get_rear(queue));
+    ASSUME_ITS_TRUE(fossil_tofu_queue_verify(queue));
+    fossil_tofu_queue_insert(queue, "2");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_queue_get_front(queue), "2");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_queue_get_rear(queue), "2");
+    ASSUME_ITS_TRUE(fossil_tofu_queue_verify(queue));
+    fossil_tofu_queue_destroy(queue);
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -182,6 +215,8 @@ FOSSIL_TEST_GROUP(objc_queue_tofu_tests) {
     FOSSIL_TEST_ADD(objc_queue_tofu_fixture, objc_test_queue_get_front_and_get_rear_empty);
     FOSSIL_TEST_ADD(objc_queue_tofu_fixture, objc_test_queue_remove_empty);
     FOSSIL_TEST_ADD(objc_queue_tofu_fixture, objc_test_queue_size_consistency);
+    FOSSIL_TEST_ADD(objc_queue_tofu_fixture, objc_test_queue_verify_tracks_mutations);
+    FOSSIL_TEST_ADD(objc_queue_tofu_fixture, objc_test_queue_remove_last_clears_rear);
 
     // Register the test group
     FOSSIL_TEST_REGISTER(objc_queue_tofu_fixture);
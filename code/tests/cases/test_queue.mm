@@ -153,6 +153,19 @@ FOSSIL_TEST(objcpp_test_queue_size_consistency) {
     ASSUME_ITS_EQUAL_I32(queue.size(), 0);
 }
 
+FOSSIL_TEST(objcpp_test_queue_verify) {
+    Queue queue("i32");
+    queue.insert("1");
+    queue.insert("2");
+    queue.remove();
+    queue.remove();
+    ASSUME_ITS_TRUE(queue.verify());
+    ASSUME_ITS_TRUE(queue.get_rear().empty());
+    queue.insert("3");
+    ASSUME_ITS_TRUE(queue.verify());
+    ASSUME_ITS_EQUAL_I32(queue.size(), 1);
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -169,6 +182,7 @@ FOSSIL_TEST_GROUP(objcpp_queue_tofu_tests) {
     FOSSIL_TEST_ADD(objcpp_queue_tofu_fixture, objcpp_test_queue_get_front_and_get_rear_empty);
     FOSSIL_TEST_ADD(objcpp_queue_tofu_fixture, objcpp_test_queue_remove_empty);
     FOSSIL_TEST_ADD(objcpp_queue_tofu_fixture, objcpp_test_queue_size_consistency);
+    FOSSIL_TEST_ADD(objcpp_queue_tofu_fixture, objcpp_test_queue_verify);
 
     // Register the test group
     FOSSIL_TEST_REGISTER(objcpp_queue_tofu_fixture);
@@ -0,0 +1,147 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/pizza/framework.h>
+
+#include "fossil/tofu/framework.h"
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_SUITE(c_segvector_tofu_fixture);
+
+FOSSIL_SETUP(c_segvector_tofu_fixture) {
+    // Setup the test fixture
+}
+
+FOSSIL_TEARDOWN(c_segvector_tofu_fixture) {
+    // Teardown the test fixture
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_TEST(c_test_segvector_create_and_destroy) {
+    fossil_tofu_segvector_t* vector = fossil_tofu_segvector_create_container("i32");
+    ASSUME_NOT_CNULL(vector);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_segvector_size(vector), 0);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_segvector_capacity(vector), 0);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_segvector_chunk_size(vector), FOSSIL_TOFU_SEGVECTOR_CHUNK);
+    fossil_tofu_segvector_destroy(vector);
+}
+
+FOSSIL_TEST(c_test_segvector_push_and_get) {
+    fossil_tofu_segvector_t* vector = fossil_tofu_segvector_create_chunked("i32", 4);
+    for (int i = 0; i < 10; i++) {
+        char buf[8];
+        snprintf(buf, sizeof(buf), "%d", i * 10);
+        ASSUME_ITS_EQUAL_I32(fossil_tofu_segvector_push_back(vector, buf), FOSSIL_TOFU_SUCCESS);
+    }
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_segvector_size(vector), 10);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_segvector_capacity(vector), 12);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_segvector_get(vector, 5), "50");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_segvector_get_front(vector), "0");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_segvector_get_back(vector), "90");
+    ASSUME_ITS_CNULL(fossil_tofu_segvector_get(vector, 10));
+    fossil_tofu_segvector_destroy(vector);
+}
+
+FOSSIL_TEST(c_test_segvector_rejects_oversized_chunks) {
+    ASSUME_ITS_CNULL(fossil_tofu_segvector_create_chunked("i32", 0));
+    ASSUME_ITS_CNULL(fossil_tofu_segvector_create_chunked("i32", SIZE_MAX));
+    ASSUME_ITS_CNULL(fossil_tofu_segvector_create_chunked("i32", SIZE_MAX / 2 + 2));
+    ASSUME_ITS_CNULL(fossil_tofu_segvector_create_chunked("i32", SIZE_MAX / sizeof(fossil_tofu_t) + 1));
+}
+
+FOSSIL_TEST(c_test_segvector_stable_addresses) {
+    fossil_tofu_segvector_t* vector = fossil_tofu_segvector_create_chunked("cstr", 2);
+    fossil_tofu_segvector_push_back(vector, "first");
+    fossil_tofu_t* first = fossil_tofu_segvector_at(vector, 0);
+    for (int i = 0; i < 1000; i++) {
+        fossil_tofu_segvector_push_back(vector, "more");
+    }
+    ASSUME_ITS_TRUE(first == fossil_tofu_segvector_at(vector, 0));
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(first), "first");
+    fossil_tofu_segvector_destroy(vector);
+}
+
+FOSSIL_TEST(c_test_segvector_set_pop_and_reserve) {
+    fossil_tofu_segvector_t* vector = fossil_tofu_segvector_create_chunked("i32", 3);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_segvector_chunk_size(vector), 4);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_segvector_reserve(vector, 9), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_segvector_capacity(vector), 12);
+    fossil_tofu_segvector_push_back(vector, "1");
+    fossil_tofu_segvector_push_back(vector, "2");
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_segvector_set(vector, 0, "7"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_segvector_get(vector, 0), "7");
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_segvector_set(vector, 5, "7"), FOSSIL_TOFU_ERROR_NOT_FOUND);
+    fossil_tofu_segvector_pop_back(vector);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_segvector_size(vector), 1);
+    fossil_tofu_segvector_erase(vector);
+    ASSUME_ITS_TRUE(fossil_tofu_segvector_is_empty(vector));
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_segvector_capacity(vector), 12);
+    fossil_tofu_segvector_destroy(vector);
+}
+
+FOSSIL_TEST(c_test_segvector_copy_and_move) {
+    fossil_tofu_segvector_t* vector = fossil_tofu_segvector_create_chunked("i32", 2);
+    fossil_tofu_segvector_push_back(vector, "1");
+    fossil_tofu_segvector_push_back(vector, "2");
+    fossil_tofu_segvector_push_back(vector, "3");
+    fossil_tofu_segvector_t* copy = fossil_tofu_segvector_create_copy(vector);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_segvector_size(copy), 3);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_segvector_get(copy, 2), "3");
+    fossil_tofu_segvector_t* moved = fossil_tofu_segvector_create_move(vector);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_segvector_size(moved), 3);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_segvector_size(vector), 0);
+    fossil_tofu_segvector_destroy(copy);
+    fossil_tofu_segvector_destroy(moved);
+    fossil_tofu_segvector_destroy(vector);
+}
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(c_segvector_tofu_tests) {    
+    // Generic ToFu Fixture
+    FOSSIL_TEST_ADD(c_segvector_tofu_fixture, c_test_segvector_create_and_destroy);
+    FOSSIL_TEST_ADD(c_segvector_tofu_fixture, c_test_segvector_push_and_get);
+    FOSSIL_TEST_ADD(c_segvector_tofu_fixture, c_test_segvector_rejects_oversized_chunks);
+    FOSSIL_TEST_ADD(c_segvector_tofu_fixture, c_test_segvector_stable_addresses);
+    FOSSIL_TEST_ADD(c_segvector_tofu_fixture, c_test_segvector_set_pop_and_reserve);
+    FOSSIL_TEST_ADD(c_segvector_tofu_fixture, c_test_segvector_copy_and_move);
+
+    // Register the test group
+    FOSSIL_TEST_REGISTER(c_segvector_tofu_fixture);
+} // end of tests
@@ -0,0 +1,89 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/pizza/framework.h>
+
+#include "fossil/tofu/framework.h"
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_SUITE(cpp_segvector_tofu_fixture);
+
+FOSSIL_SETUP(cpp_segvector_tofu_fixture) {
+    // Setup the test fixture
+}
+
+FOSSIL_TEARDOWN(cpp_segvector_tofu_fixture) {
+    // Teardown the test fixture
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+using fossil::tofu::SegVector;
+
+FOSSIL_TEST(cpp_test_segvector_push_and_get) {
+    SegVector vector("i32", 8);
+    for (int i = 0; i < 20; i++) {
+        vector.push_back(std::to_string(i));
+    }
+    ASSUME_ITS_EQUAL_SIZE(vector.size(), 20);
+    ASSUME_ITS_EQUAL_CSTR(vector.get(17).c_str(), "17");
+    vector.set(17, "99");
+    ASSUME_ITS_EQUAL_CSTR(vector.get(17).c_str(), "99");
+}
+
+FOSSIL_TEST(cpp_test_segvector_stable_addresses) {
+    SegVector vector("cstr", 4);
+    vector.push_back("anchor");
+    fossil_tofu_t* anchor = vector.at(0);
+    for (int i = 0; i < 100; i++) {
+        vector.push_back("filler");
+    }
+    ASSUME_ITS_TRUE(anchor == vector.at(0));
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(anchor), "anchor");
+}
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(cpp_segvector_tofu_tests) {    
+    // Generic ToFu Fixture
+    FOSSIL_TEST_ADD(cpp_segvector_tofu_fixture, cpp_test_segvector_push_and_get);
+    FOSSIL_TEST_ADD(cpp_segvector_tofu_fixture, cpp_test_segvector_stable_addresses);
+
+    // Register the test group
+    FOSSIL_TEST_REGISTER(cpp_segvector_tofu_fixture);
+} // end of tests
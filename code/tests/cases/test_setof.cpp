@@ -88,9 +88,9 @@ FOSSIL_TEST(cpp_test_setof_insert_duplicate) {
     SetOf set("i32");
     set.insert("55");
     size_t size_before = set.size();
-    set.insert("55"); // Should allow duplicate, as per current implementation
+    set.insert("55"); // Duplicate is ignored, elements are unique
     size_t size_after = set.size();
-    ASSUME_ITS_EQUAL_I32(size_after, size_before + 1);
+    ASSUME_ITS_EQUAL_I32(size_after, size_before);
 }
 
 FOSSIL_TEST(cpp_test_setof_remove_nonexistent) {
@@ -104,6 +104,72 @@ FOSSIL_TEST(cpp_test_setof_remove_nonexistent) {
     }
 }
 
+FOSSIL_TEST(cpp_test_setof_add_and_reserve) {
+    SetOf set("cstr");
+    set.reserve(500);
+    size_t capacity = set.capacity();
+    size_t fresh = 0;
+    for (int i = 0; i < 1000; i++) {
+        if (set.add("id" + std::to_string(i % 500))) {
+            fresh++;
+        }
+    }
+    ASSUME_ITS_EQUAL_SIZE(fresh, 500);
+    ASSUME_ITS_EQUAL_SIZE(set.size(), 500);
+    ASSUME_ITS_EQUAL_SIZE(set.capacity(), capacity);
+    set.max_load_factor(0.5f);
+    ASSUME_ITS_TRUE(set.load_factor() <= 0.5f);
+}
+
+FOSSIL_TEST(cpp_test_setof_algebra) {
+    SetOf a("i32");
+    SetOf b("i32");
+    for (int i = 0; i < 10; i++) {
+        a.insert(std::to_string(i));
+        b.insert(std::to_string(i + 5));
+    }
+    a.intersect_with(b);
+    ASSUME_ITS_EQUAL_SIZE(a.size(), 5);
+    ASSUME_ITS_TRUE(a.is_subset_of(b));
+    a.symmetric_difference_with(b);
+    ASSUME_ITS_EQUAL_SIZE(a.size(), 5);
+    ASSUME_ITS_TRUE(a.contains("14"));
+    ASSUME_ITS_FALSE(a.contains("5"));
+    a.union_with(b);
+    ASSUME_ITS_EQUAL_SIZE(a.size(), 10);
+    a.difference_with(b);
+    ASSUME_ITS_TRUE(a.is_empty());
+}
+
+FOSSIL_TEST(cpp_test_setof_contains_integer) {
+    SetOf set("i64");
+    set.insert("-5");
+    ASSUME_ITS_TRUE(set.contains(int64_t(-5)));
+    ASSUME_ITS_FALSE(set.contains(int64_t(5)));
+    ASSUME_ITS_TRUE(set.contains("-5"));
+}
+
+FOSSIL_TEST(cpp_test_setof_filter) {
+    SetOf set("cstr");
+    set.insert("a");
+    set.attach_filter();
+    set.insert("b");
+    ASSUME_ITS_TRUE(set.has_filter());
+    ASSUME_ITS_TRUE(set.contains("a"));
+    ASSUME_ITS_TRUE(set.contains("b"));
+    ASSUME_ITS_FALSE(set.contains("c"));
+    set.detach_filter();
+    ASSUME_ITS_FALSE(set.has_filter());
+}
+
+FOSSIL_TEST(cpp_test_setof_numeric_equality) {
+    SetOf set("u16");
+    set.insert("7");
+    set.insert("007");
+    ASSUME_ITS_EQUAL_SIZE(set.size(), 1);
+    ASSUME_ITS_TRUE(set.contains("07"));
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -115,6 +181,11 @@ FOSSIL_TEST_GROUP(cpp_setof_tofu_tests) {
     FOSSIL_TEST_ADD(cpp_setof_tofu_fixture, cpp_test_setof_is_empty_and_not_empty);
     FOSSIL_TEST_ADD(cpp_setof_tofu_fixture, cpp_test_setof_insert_duplicate);
     FOSSIL_TEST_ADD(cpp_setof_tofu_fixture, cpp_test_setof_remove_nonexistent);
+    FOSSIL_TEST_ADD(cpp_setof_tofu_fixture, cpp_test_setof_add_and_reserve);
+    FOSSIL_TEST_ADD(cpp_setof_tofu_fixture, cpp_test_setof_algebra);
+    FOSSIL_TEST_ADD(cpp_setof_tofu_fixture, cpp_test_setof_contains_integer);
+    FOSSIL_TEST_ADD(cpp_setof_tofu_fixture, cpp_test_setof_filter);
+    FOSSIL_TEST_ADD(cpp_setof_tofu_fixture, cpp_test_setof_numeric_equality);
 
     // Register the test group
     FOSSIL_TEST_REGISTER(cpp_setof_tofu_fixture);
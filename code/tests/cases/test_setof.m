@@ -127,9 +127,9 @@ FOSSIL_TEST(objc_test_setof_insert_duplicate) {
     fossil_tofu_setof_t* set = fossil_tofu_setof_create_container("i32");
     fossil_tofu_setof_insert(set, "55");
     size_t size_before = fossil_tofu_setof_size(set);
-    fossil_tofu_setof_insert(set, "55"); // Should allow duplicate, as per current implementation
+    fossil_tofu_setof_insert(set, "55"); // Duplicate is ignored, elements are unique
     size_t size_after = fossil_tofu_setof_size(set);
-    ASSUME_ITS_EQUAL_I32(size_after, size_before + 1);
+    ASSUME_ITS_EQUAL_I32(size_after, size_before);
     fossil_tofu_setof_destroy(set);
 }
 
@@ -153,6 +153,195 @@ FOSSIL_TEST(objc_test_setof_null_args) {
     ASSUME_ITS_TRUE(fossil_tofu_setof_is_empty(NULL));
 }
 
+FOSSIL_TEST(objc_test_setof_add_reports_new) {
+    fossil_tofu_setof_t* set = fossil_tofu_setof_create_container("cstr");
+    bool added = false;
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_setof_add(set, "evt-1", &added), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_TRUE(added);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_setof_add(set, "evt-1", &added), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_FALSE(added);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_setof_size(set), 1);
+    fossil_tofu_setof_destroy(set);
+}
+
+FOSSIL_TEST(objc_test_setof_grow_and_remove_many) {
+    fossil_tofu_setof_t* set = fossil_tofu_setof_create_container("i64");
+    char buf[24];
+    for (int i = 0; i < 4000; i++) {
+        snprintf(buf, sizeof(buf), "%d", i % 2000);
+        fossil_tofu_setof_insert(set, buf);
+    }
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_setof_size(set), 2000);
+    ASSUME_ITS_TRUE(fossil_tofu_setof_load_factor(set) <= FOSSIL_TOFU_SETOF_MAX_LOAD);
+    for (int i = 0; i < 2000; i += 3) {
+        snprintf(buf, sizeof(buf), "%d", i);
+        ASSUME_ITS_EQUAL_I32(fossil_tofu_setof_remove(set, buf), FOSSIL_TOFU_SUCCESS);
+    }
+    for (int i = 0; i < 2000; i++) {
+        snprintf(buf, sizeof(buf), "%d", i);
+        ASSUME_ITS_EQUAL_I32(fossil_tofu_setof_contains(set, buf), i % 3 != 0);
+    }
+    fossil_tofu_setof_destroy(set);
+}
+
+FOSSIL_TEST(objc_test_setof_reserve_and_load_factor) {
+    fossil_tofu_setof_t* set = fossil_tofu_setof_create_container("i32");
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_setof_set_max_load(set, 0.5f), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_setof_set_max_load(set, 1.5f), FOSSIL_TOFU_ERROR_INVALID_ARGUMENT);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_setof_reserve(set, 100), FOSSIL_TOFU_SUCCESS);
+    size_t capacity = fossil_tofu_setof_capacity(set);
+    ASSUME_ITS_TRUE(capacity >= 200);
+    char buf[16];
+    for (int i = 0; i < 100; i++) {
+        snprintf(buf, sizeof(buf), "%d", i);
+        fossil_tofu_setof_insert(set, buf);
+    }
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_setof_capacity(set), capacity);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_setof_set_max_load(set, 0.25f), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_TRUE(fossil_tofu_setof_load_factor(set) <= 0.25f);
+    ASSUME_ITS_TRUE(fossil_tofu_setof_contains(set, "99"));
+    fossil_tofu_setof_destroy(set);
+}
+
+static fossil_tofu_setof_t* objc_setof_range(int begin, int end) {
+    fossil_tofu_setof_t* set = fossil_tofu_setof_create_container("i32");
+    char buf[16];
+    for (int i = begin; i < end; i++) {
+        snprintf(buf, sizeof(buf), "%d", i);
+        fossil_tofu_setof_insert(set, buf);
+    }
+    return set;
+}
+
+FOSSIL_TEST(objc_test_setof_union_and_intersection) {
+    fossil_tofu_setof_t* a = objc_setof_range(0, 600);
+    fossil_tofu_setof_t* b = objc_setof_range(400, 1000);
+    fossil_tofu_setof_t* u = fossil_tofu_setof_union(a, b);
+    fossil_tofu_setof_t* n = fossil_tofu_setof_intersection(a, b);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_setof_size(u), 1000);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_setof_size(n), 200);
+    ASSUME_ITS_TRUE(fossil_tofu_setof_contains(n, "400"));
+    ASSUME_ITS_FALSE(fossil_tofu_setof_contains(n, "399"));
+    ASSUME_ITS_TRUE(fossil_tofu_setof_is_subset(n, a));
+    ASSUME_ITS_TRUE(fossil_tofu_setof_is_subset(a, u));
+    ASSUME_ITS_FALSE(fossil_tofu_setof_is_subset(a, b));
+    fossil_tofu_setof_destroy(u);
+    fossil_tofu_setof_destroy(n);
+    fossil_tofu_setof_destroy(a);
+    fossil_tofu_setof_destroy(b);
+}
+
+FOSSIL_TEST(objc_test_setof_difference_and_symmetric) {
+    fossil_tofu_setof_t* a = objc_setof_range(0, 600);
+    fossil_tofu_setof_t* b = objc_setof_range(400, 1000);
+    fossil_tofu_setof_t* d = fossil_tofu_setof_difference(a, b);
+    fossil_tofu_setof_t* x = fossil_tofu_setof_symmetric_difference(a, b);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_setof_size(d), 400);
+    ASSUME_ITS_TRUE(fossil_tofu_setof_contains(d, "399"));
+    ASSUME_ITS_FALSE(fossil_tofu_setof_contains(d, "400"));
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_setof_size(x), 800);
+    ASSUME_ITS_FALSE(fossil_tofu_setof_contains(x, "500"));
+    ASSUME_ITS_TRUE(fossil_tofu_setof_contains(x, "999"));
+    fossil_tofu_setof_destroy(d);
+    fossil_tofu_setof_destroy(x);
+    fossil_tofu_setof_destroy(a);
+    fossil_tofu_setof_destroy(b);
+}
+
+FOSSIL_TEST(objc_test_setof_in_place_algebra) {
+    fossil_tofu_setof_t* a = objc_setof_range(0, 600);
+    fossil_tofu_setof_t* b = objc_setof_range(400, 1000);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_setof_intersect_with(a, b), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_setof_size(a), 200);
+    for (int i = 400; i < 600; i++) {
+        char buf[16];
+        snprintf(buf, sizeof(buf), "%d", i);
+        ASSUME_ITS_TRUE(fossil_tofu_setof_contains(a, buf));
+    }
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_setof_symmetric_difference_with(a, b), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_setof_size(a), 400);
+    ASSUME_ITS_TRUE(fossil_tofu_setof_contains(a, "600"));
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_setof_union_with(a, b), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_setof_size(a), 600);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_setof_difference_with(a, b), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_TRUE(fossil_tofu_setof_is_empty(a));
+    fossil_tofu_setof_t* s = fossil_tofu_setof_create_container("cstr");
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_setof_union_with(s, b), FOSSIL_TOFU_ERROR_TYPE_MISMATCH);
+    ASSUME_ITS_CNULL(fossil_tofu_setof_union(s, b));
+    fossil_tofu_setof_destroy(s);
+    fossil_tofu_setof_destroy(a);
+    fossil_tofu_setof_destroy(b);
+}
+
+FOSSIL_TEST(objc_test_setof_contains_raw_key) {
+    fossil_tofu_setof_t* set = fossil_tofu_setof_create_container("u32");
+    fossil_tofu_setof_insert(set, "1001");
+    fossil_tofu_setof_insert(set, "2002");
+    const char* ids = "1001|2002|3003";
+    ASSUME_ITS_TRUE(fossil_tofu_setof_contains_key(set, ids, 4));
+    ASSUME_ITS_TRUE(fossil_tofu_setof_contains_key(set, ids + 5, 4));
+    ASSUME_ITS_FALSE(fossil_tofu_setof_contains_key(set, ids + 10, 4));
+    ASSUME_ITS_FALSE(fossil_tofu_setof_contains_key(set, ids, 3));
+    ASSUME_ITS_TRUE(fossil_tofu_setof_contains_i64(set, 2002));
+    ASSUME_ITS_FALSE(fossil_tofu_setof_contains_i64(set, 3003));
+    ASSUME_ITS_FALSE(fossil_tofu_setof_contains_key(NULL, ids, 4));
+    fossil_tofu_setof_destroy(set);
+}
+
+FOSSIL_TEST(objc_test_setof_filter) {
+    fossil_tofu_setof_t* set = fossil_tofu_setof_create_container("i32");
+    fossil_tofu_setof_insert(set, "1");
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_setof_attach_filter(set, 0), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_TRUE(fossil_tofu_setof_has_filter(set));
+    ASSUME_ITS_TRUE(fossil_tofu_setof_contains(set, "1"));
+
+    char text[16];
+    for (int i = 2; i < 500; i++) {
+        snprintf(text, sizeof(text), "%d", i);
+        fossil_tofu_setof_insert(set, text);
+    }
+    for (int i = 1; i < 500; i++) {
+        snprintf(text, sizeof(text), "%d", i);
+        ASSUME_ITS_TRUE(fossil_tofu_setof_contains(set, text));
+    }
+    ASSUME_ITS_FALSE(fossil_tofu_setof_contains(set, "500"));
+    fossil_tofu_setof_remove(set, "7");
+    ASSUME_ITS_FALSE(fossil_tofu_setof_contains(set, "7"));
+
+    fossil_tofu_setof_t* copy = fossil_tofu_setof_create_copy(set);
+    ASSUME_ITS_TRUE(fossil_tofu_setof_has_filter(copy));
+    ASSUME_ITS_TRUE(fossil_tofu_setof_contains(copy, "499"));
+    fossil_tofu_setof_detach_filter(set);
+    ASSUME_ITS_FALSE(fossil_tofu_setof_has_filter(set));
+    ASSUME_ITS_TRUE(fossil_tofu_setof_contains(set, "499"));
+    fossil_tofu_setof_destroy(copy);
+    fossil_tofu_setof_destroy(set);
+}
+
+FOSSIL_TEST(objc_test_setof_numeric_equality) {
+    fossil_tofu_setof_t* set = fossil_tofu_setof_create_container("i32");
+    fossil_tofu_setof_insert(set, "5");
+    fossil_tofu_setof_insert(set, "05");
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_setof_size(set), 1);
+    ASSUME_ITS_TRUE(fossil_tofu_setof_contains(set, "+5"));
+    ASSUME_ITS_TRUE(fossil_tofu_setof_contains_i64(set, 5));
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_setof_remove(set, "005"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_setof_size(set), 0);
+    fossil_tofu_setof_destroy(set);
+
+    fossil_tofu_setof_t* real = fossil_tofu_setof_create_container("f64");
+    fossil_tofu_setof_insert(real, "1");
+    fossil_tofu_setof_insert(real, "1.0");
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_setof_size(real), 1);
+    fossil_tofu_setof_destroy(real);
+
+    fossil_tofu_setof_t* text = fossil_tofu_setof_create_container("cstr");
+    fossil_tofu_setof_insert(text, "5");
+    fossil_tofu_setof_insert(text, "05");
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_setof_size(text), 2);
+    fossil_tofu_setof_destroy(text);
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -168,6 +357,15 @@ FOSSIL_TEST_GROUP(objc_setof_tofu_tests) {
     FOSSIL_TEST_ADD(objc_setof_tofu_fixture, objc_test_setof_insert_duplicate);
     FOSSIL_TEST_ADD(objc_setof_tofu_fixture, objc_test_setof_remove_nonexistent);
     FOSSIL_TEST_ADD(objc_setof_tofu_fixture, objc_test_setof_null_args);
+    FOSSIL_TEST_ADD(objc_setof_tofu_fixture, objc_test_setof_add_reports_new);
+    FOSSIL_TEST_ADD(objc_setof_tofu_fixture, objc_test_setof_grow_and_remove_many);
+    FOSSIL_TEST_ADD(objc_setof_tofu_fixture, objc_test_setof_reserve_and_load_factor);
+    FOSSIL_TEST_ADD(objc_setof_tofu_fixture, objc_test_setof_union_and_intersection);
+    FOSSIL_TEST_ADD(objc_setof_tofu_fixture, objc_test_setof_difference_and_symmetric);
+    FOSSIL_TEST_ADD(objc_setof_tofu_fixture, objc_test_setof_in_place_algebra);
+    FOSSIL_TEST_ADD(objc_setof_tofu_fixture, objc_test_setof_contains_raw_key);
+    FOSSIL_TEST_ADD(objc_setof_tofu_fixture, objc_test_setof_filter);
+    FOSSIL_TEST_ADD(objc_setof_tofu_fixture, objc_test_setof_numeric_equality);
 
     // Register the test group
     FOSSIL_TEST_REGISTER(objc_setof_tofu_fixture);
@@ -0,0 +1,193 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/pizza/framework.h>
+
+#include "fossil/tofu/framework.h"
+#include "fossil/tofu/threads.h"
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_SUITE(c_spscq_tofu_fixture);
+
+FOSSIL_SETUP(c_spscq_tofu_fixture) {
+    // Setup the test fixture
+}
+
+FOSSIL_TEARDOWN(c_spscq_tofu_fixture) {
+    // Teardown the test fixture
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_TEST(c_test_spscq_insert_and_take) {
+    fossil_tofu_spscq_t* queue = fossil_tofu_spscq_create_container("i32", 3);
+    ASSUME_NOT_CNULL(queue);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_spscq_capacity(queue), 4);
+    ASSUME_ITS_TRUE(fossil_tofu_spscq_is_empty(queue));
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_spscq_insert(queue, "1"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_spscq_insert(queue, "2"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_spscq_insert(queue, "3"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_spscq_insert(queue, "4"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_TRUE(fossil_tofu_spscq_is_full(queue));
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_spscq_insert(queue, "5"), FOSSIL_TOFU_FAILURE);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_spscq_get_front(queue), "1");
+
+    fossil_tofu_t out;
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_spscq_take(queue, &out), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&out), "1");
+    fossil_tofu_destroy(&out);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_spscq_remove(queue), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_spscq_size(queue), 2);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_spscq_get_front(queue), "3");
+    fossil_tofu_spscq_destroy(queue);
+}
+
+FOSSIL_TEST(c_test_spscq_empty) {
+    fossil_tofu_spscq_t* queue = fossil_tofu_spscq_create_container("i32", 2);
+    fossil_tofu_t out;
+    ASSUME_ITS_CNULL(fossil_tofu_spscq_get_front(queue));
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_spscq_take(queue, &out), FOSSIL_TOFU_FAILURE);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_spscq_remove(queue), FOSSIL_TOFU_FAILURE);
+    ASSUME_ITS_CNULL(fossil_tofu_spscq_create_container("i32", 0));
+    fossil_tofu_spscq_destroy(queue);
+}
+
+FOSSIL_TEST(c_test_spscq_batch) {
+    fossil_tofu_spscq_t* queue = fossil_tofu_spscq_create_container("i32", 4);
+    char* values[] = {"1", "2", "3", "4", "5", "6"};
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_spscq_insert_batch(queue, values, 6), 4);
+
+    fossil_tofu_t out[8];
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_spscq_take_batch(queue, out, 3), 3);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&out[0]), "1");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&out[2]), "3");
+    for (int i = 0; i < 3; i++) {
+        fossil_tofu_destroy(&out[i]);
+    }
+
+    // The ring wraps; the batch continues where the last one stopped
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_spscq_insert_batch(queue, values + 4, 2), 2);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_spscq_take_batch(queue, out, 8), 3);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&out[0]), "4");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&out[2]), "6");
+    for (int i = 0; i < 3; i++) {
+        fossil_tofu_destroy(&out[i]);
+    }
+    fossil_tofu_spscq_destroy(queue);
+}
+
+FOSSIL_TEST(c_test_spscq_insert_tofu) {
+    fossil_tofu_spscq_t* queue = fossil_tofu_spscq_create_container("cstr", 2);
+    fossil_tofu_t tofu = fossil_tofu_create("cstr", "payload");
+    char* data = tofu.value.data;
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_spscq_insert_tofu(queue, &tofu), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_CNULL(tofu.value.data);
+
+    fossil_tofu_t out;
+    fossil_tofu_spscq_take(queue, &out);
+    ASSUME_ITS_TRUE(out.value.data == data);
+    fossil_tofu_destroy(&out);
+    fossil_tofu_spscq_destroy(queue);
+}
+
+typedef struct {
+    fossil_tofu_spscq_t* queue;
+    int count;
+} c_spscq_producer_t;
+
+static void* c_spscq_producer(void* arg) {
+    c_spscq_producer_t* work = (c_spscq_producer_t*)arg;
+    char value[16];
+    for (int i = 0; i < work->count; i++) {
+        snprintf(value, sizeof(value), "%d", i);
+        while (fossil_tofu_spscq_insert(work->queue, value) != FOSSIL_TOFU_SUCCESS) {
+            fossil_tofu_thread_yield(); // Full; let the consumer catch up
+        }
+    }
+    return NULL;
+}
+
+FOSSIL_TEST(c_test_spscq_threaded_handoff) {
+    fossil_tofu_spscq_t* queue = fossil_tofu_spscq_create_container("i32", 64);
+    c_spscq_producer_t work = {queue, 20000};
+    fossil_tofu_thread_t producer;
+    bool started = fossil_tofu_thread_create(&producer, c_spscq_producer, &work) == FOSSIL_TOFU_SUCCESS;
+    if (!started) {
+        // No threads on this platform: hand over one ring's worth inline.
+        work.count = 64;
+        c_spscq_producer(&work);
+    }
+
+    int expected = 0;
+    bool ordered = true;
+    fossil_tofu_t out[16];
+    while (expected < work.count) {
+        size_t taken = fossil_tofu_spscq_take_batch(queue, out, 16);
+        if (taken == 0) {
+            fossil_tofu_thread_yield();
+        }
+        for (size_t i = 0; i < taken; i++) {
+            if (atoi(fossil_tofu_get_value(&out[i])) != expected) {
+                ordered = false;
+            }
+            expected++;
+            fossil_tofu_destroy(&out[i]);
+        }
+    }
+    if (started) {
+        fossil_tofu_thread_join(producer);
+    }
+
+    ASSUME_ITS_TRUE(ordered);
+    ASSUME_ITS_TRUE(fossil_tofu_spscq_is_empty(queue));
+    fossil_tofu_spscq_destroy(queue);
+}
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(c_spscq_tofu_tests) {    
+    // Generic ToFu Fixture
+    FOSSIL_TEST_ADD(c_spscq_tofu_fixture, c_test_spscq_insert_and_take);
+    FOSSIL_TEST_ADD(c_spscq_tofu_fixture, c_test_spscq_empty);
+    FOSSIL_TEST_ADD(c_spscq_tofu_fixture, c_test_spscq_batch);
+    FOSSIL_TEST_ADD(c_spscq_tofu_fixture, c_test_spscq_insert_tofu);
+    FOSSIL_TEST_ADD(c_spscq_tofu_fixture, c_test_spscq_threaded_handoff);
+
+    // Register the test group
+    FOSSIL_TEST_REGISTER(c_spscq_tofu_fixture);
+} // end of tests
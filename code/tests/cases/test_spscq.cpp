@@ -0,0 +1,123 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/pizza/framework.h>
+
+#include "fossil/tofu/framework.h"
+#include <string>
+#include <thread>
+#include <vector>
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_SUITE(cpp_spscq_tofu_fixture);
+
+FOSSIL_SETUP(cpp_spscq_tofu_fixture) {
+    // Setup the test fixture
+}
+
+FOSSIL_TEARDOWN(cpp_spscq_tofu_fixture) {
+    // Teardown the test fixture
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+using fossil::tofu::SPSCQueue;
+
+FOSSIL_TEST(cpp_test_spscq_insert_and_take) {
+    SPSCQueue queue("i32", 2);
+    ASSUME_ITS_EQUAL_SIZE(queue.capacity(), 2);
+    ASSUME_ITS_EQUAL_I32(queue.insert("10"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(queue.insert("20"), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(queue.insert("30"), FOSSIL_TOFU_FAILURE);
+    ASSUME_ITS_TRUE(queue.is_full());
+    ASSUME_ITS_EQUAL_CSTR(queue.get_front().c_str(), "10");
+
+    std::string value;
+    ASSUME_ITS_TRUE(queue.take(value));
+    ASSUME_ITS_EQUAL_CSTR(value.c_str(), "10");
+    ASSUME_ITS_EQUAL_I32(queue.remove(), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_FALSE(queue.take(value));
+    ASSUME_ITS_TRUE(queue.is_empty());
+}
+
+FOSSIL_TEST(cpp_test_spscq_threaded_batch) {
+    SPSCQueue queue("i32", 32);
+    const int count = 10000;
+    std::thread producer([&queue, count]() {
+        std::vector<std::string> batch;
+        for (int i = 0; i < count; i += 8) {
+            batch.clear();
+            for (int j = i; j < i + 8 && j < count; j++) {
+                batch.push_back(std::to_string(j));
+            }
+            size_t sent = 0;
+            while (sent < batch.size()) {
+                std::vector<std::string> rest(batch.begin() + sent, batch.end());
+                sent += queue.insert_batch(rest);
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    std::vector<std::string> received;
+    while (received.size() < static_cast<size_t>(count)) {
+        if (queue.take_batch(received, 16) == 0) {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+
+    bool ordered = true;
+    for (int i = 0; i < count; i++) {
+        if (received[i] != std::to_string(i)) {
+            ordered = false;
+        }
+    }
+    ASSUME_ITS_TRUE(ordered);
+}
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(cpp_spscq_tofu_tests) {    
+    // Generic ToFu Fixture
+    FOSSIL_TEST_ADD(cpp_spscq_tofu_fixture, cpp_test_spscq_insert_and_take);
+    FOSSIL_TEST_ADD(cpp_spscq_tofu_fixture, cpp_test_spscq_threaded_batch);
+
+    // Register the test group
+    FOSSIL_TEST_REGISTER(cpp_spscq_tofu_fixture);
+} // end of tests
@@ -192,6 +192,113 @@ FOSSIL_TEST(objc_test_stack_set_out_of_bounds) {
     fossil_tofu_stack_destroy(stack);
 }
 
+FOSSIL_TEST(objc_test_stack_verify_tracks_mutations) {
+    fossil_tofu_stack_t* stack = fossil_tofu_stack_create_container("i32");
+    ASSUME_ITS_TRUE(fossil_tofu_stack_verify(stack));
+    fossil_tofu_stack_insert(stack, "1");
+    fossil_tofu_stack_insert(stack, "2");
+    fossil_tofu_stack_insert(stack, "3");
+    fossil_tofu_stack_remove(stack);
+    ASSUME_ITS_TRUE(fossil_tofu_stack_verify(stack));
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_stack_size(stack), 2);
+    fossil_tofu_stack_t* copy = fossil_tofu_stack_create_copy(stack);
+    ASSUME_ITS_TRUE(fossil_tofu_stack_verify(copy));
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_stack_size(copy), 2);
+    fossil_tofu_stack_t* moved = fossil_tofu_stack_create_move(copy);
+    ASSUME_ITS_TRUE(fossil_tofu_stack_verify(moved));
+    ASSUME_ITS_TRUE(fossil_tofu_stack_is_empty(copy));
+    ASSUME_ITS_FALSE(fossil_tofu_stack_verify(NULL));
+    fossil_tofu_stack_destroy(moved);
+    fossil_tofu_stack_destroy(copy);
+    fossil_tofu_stack_destroy(stack);
+}
+
+FOSSIL_TEST(objc_test_stack_reserve_and_capacity) {
+    fossil_tofu_stack_t* stack = fossil_tofu_stack_create_container("i32");
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_stack_reserve(stack, 64), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_TRUE(fossil_tofu_stack_capacity(stack) >= 64);
+    size_t capacity = fossil_tofu_stack_capacity(stack);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_stack_reserve(stack, 8), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_stack_capacity(stack), capacity);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_stack_size(stack), 0);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_stack_reserve(NULL, 8), FOSSIL_TOFU_ERROR_NULL_POINTER);
+    fossil_tofu_stack_destroy(stack);
+}
+
+FOSSIL_TEST(objc_test_stack_get_from_top_after_growth) {
+    fossil_tofu_stack_t* stack = fossil_tofu_stack_create_container("i32");
+    char value[16];
+    for (int i = 0; i < 100; i++) {
+        snprintf(value, sizeof(value), "%d", i);
+        fossil_tofu_stack_insert(stack, value);
+    }
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_stack_size(stack), 100);
+    fossil_tofu_t top = fossil_tofu_stack_get(stack, 0);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&top), "99");
+    fossil_tofu_t bottom = fossil_tofu_stack_get(stack, 99);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&bottom), "0");
+    fossil_tofu_t replacement = fossil_tofu_create("i32", "-1");
+    fossil_tofu_stack_set(stack, 99, replacement);
+    fossil_tofu_destroy(&replacement);
+    bottom = fossil_tofu_stack_get(stack, 99);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&bottom), "-1");
+    fossil_tofu_stack_destroy(stack);
+}
+
+FOSSIL_TEST(objc_test_stack_set_from_own_element) {
+    fossil_tofu_stack_t* stack = fossil_tofu_stack_create_container("i32");
+    fossil_tofu_stack_insert(stack, "1");
+    fossil_tofu_stack_insert(stack, "2");
+    fossil_tofu_stack_set(stack, 0, fossil_tofu_stack_top(stack));
+    fossil_tofu_stack_set(stack, 1, fossil_tofu_stack_get(stack, 1));
+    fossil_tofu_t top = fossil_tofu_stack_top(stack);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&top), "2");
+    fossil_tofu_t bottom = fossil_tofu_stack_get(stack, 1);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&bottom), "1");
+    fossil_tofu_stack_set(stack, 1, fossil_tofu_stack_top(stack));
+    bottom = fossil_tofu_stack_get(stack, 1);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&bottom), "2");
+    ASSUME_ITS_TRUE(fossil_tofu_stack_verify(stack));
+    fossil_tofu_stack_destroy(stack);
+}
+
+FOSSIL_TEST(objc_test_stack_push_many_and_pop_many) {
+    fossil_tofu_stack_t* stack = fossil_tofu_stack_create_container("i32");
+    char* values[] = {"1", "2", "3", "4"};
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_stack_push_many(stack, values, 4), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_stack_size(stack), 4);
+    fossil_tofu_t top = fossil_tofu_stack_top(stack);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&top), "4");
+    fossil_tofu_vector_t* out = fossil_tofu_vector_create_container("i32");
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_stack_pop_many(stack, out, 3), 3);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_vector_size(out), 3);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_vector_get(out, 0), "4");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_vector_get(out, 2), "2");
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_stack_pop_many(stack, NULL, 10), 1);
+    ASSUME_ITS_TRUE(fossil_tofu_stack_is_empty(stack));
+    fossil_tofu_vector_destroy(out);
+    fossil_tofu_stack_destroy(stack);
+}
+
+FOSSIL_TEST(objc_test_stack_push_many_rejects_null_element) {
+    fossil_tofu_stack_t* stack = fossil_tofu_stack_create_container("i32");
+    char* values[] = {"1", NULL, "3"};
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_stack_push_many(stack, values, 3), FOSSIL_TOFU_FAILURE);
+    ASSUME_ITS_TRUE(fossil_tofu_stack_is_empty(stack));
+    fossil_tofu_stack_destroy(stack);
+}
+
+FOSSIL_TEST(objc_test_stack_copy_preserves_order) {
+    fossil_tofu_stack_t* stack1 = fossil_tofu_stack_create_container("i32");
+    fossil_tofu_stack_insert(stack1, "1");
+    fossil_tofu_stack_insert(stack1, "2");
+    fossil_tofu_stack_t* stack2 = fossil_tofu_stack_create_copy(stack1);
+    fossil_tofu_t top = fossil_tofu_stack_top(stack2);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&top), "2");
+    fossil_tofu_stack_destroy(stack1);
+    fossil_tofu_stack_destroy(stack2);
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -213,6 +320,13 @@ FOSSIL_TEST_GROUP(objc_stack_tofu_tests) {
     FOSSIL_TEST_ADD(objc_stack_tofu_fixture, objc_test_stack_top_empty_stack);
     FOSSIL_TEST_ADD(objc_stack_tofu_fixture, objc_test_stack_get_out_of_bounds);
     FOSSIL_TEST_ADD(objc_stack_tofu_fixture, objc_test_stack_set_out_of_bounds);
+    FOSSIL_TEST_ADD(objc_stack_tofu_fixture, objc_test_stack_verify_tracks_mutations);
+    FOSSIL_TEST_ADD(objc_stack_tofu_fixture, objc_test_stack_reserve_and_capacity);
+    FOSSIL_TEST_ADD(objc_stack_tofu_fixture, objc_test_stack_get_from_top_after_growth);
+    FOSSIL_TEST_ADD(objc_stack_tofu_fixture, objc_test_stack_set_from_own_element);
+    FOSSIL_TEST_ADD(objc_stack_tofu_fixture, objc_test_stack_push_many_and_pop_many);
+    FOSSIL_TEST_ADD(objc_stack_tofu_fixture, objc_test_stack_push_many_rejects_null_element);
+    FOSSIL_TEST_ADD(objc_stack_tofu_fixture, objc_test_stack_copy_preserves_order);
 
     // Register the test group
     FOSSIL_TEST_REGISTER(objc_stack_tofu_fixture);
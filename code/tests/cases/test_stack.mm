@@ -178,6 +178,30 @@ FOSSIL_TEST(objcpp_test_stack_set_out_of_bounds) {
     ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&elem), "1");
 }
 
+FOSSIL_TEST(objcpp_test_stack_verify) {
+    Stack stack("i32");
+    stack.insert("1");
+    stack.insert("2");
+    ASSUME_ITS_TRUE(stack.verify());
+    stack.remove();
+    ASSUME_ITS_TRUE(stack.verify());
+    ASSUME_ITS_EQUAL_I32(stack.size(), 1);
+}
+
+FOSSIL_TEST(objcpp_test_stack_push_many_and_pop_many) {
+    Stack stack("i32");
+    stack.reserve(32);
+    ASSUME_ITS_TRUE(stack.capacity() >= 32);
+    ASSUME_ITS_EQUAL_I32(stack.push_many({"1", "2", "3"}), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(stack.size(), 3);
+    std::vector<std::string> out;
+    ASSUME_ITS_EQUAL_I32(stack.pop_many(out, 5), 3);
+    ASSUME_ITS_EQUAL_I32(out.size(), 3);
+    ASSUME_ITS_EQUAL_CSTR(out[0].c_str(), "3");
+    ASSUME_ITS_EQUAL_CSTR(out[2].c_str(), "1");
+    ASSUME_ITS_TRUE(stack.is_empty());
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -199,6 +223,8 @@ FOSSIL_TEST_GROUP(objcpp_stack_tofu_tests) {
     FOSSIL_TEST_ADD(objcpp_stack_tofu_fixture, objcpp_test_stack_top_empty_stack);
     FOSSIL_TEST_ADD(objcpp_stack_tofu_fixture, objcpp_test_stack_get_out_of_bounds);
     FOSSIL_TEST_ADD(objcpp_stack_tofu_fixture, objcpp_test_stack_set_out_of_bounds);
+    FOSSIL_TEST_ADD(objcpp_stack_tofu_fixture, objcpp_test_stack_verify);
+    FOSSIL_TEST_ADD(objcpp_stack_tofu_fixture, objcpp_test_stack_push_many_and_pop_many);
 
     // Register the test group
     FOSSIL_TEST_REGISTER(objcpp_stack_tofu_fixture);
@@ -0,0 +1,216 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/pizza/framework.h>
+
+#include "fossil/tofu/framework.h"
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_SUITE(c_timerq_tofu_fixture);
+
+FOSSIL_SETUP(c_timerq_tofu_fixture) {
+    // Setup the test fixture
+}
+
+FOSSIL_TEARDOWN(c_timerq_tofu_fixture) {
+    // Teardown the test fixture
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+typedef struct {
+    char fired[8][16];
+    uint64_t at[8];
+    size_t count;
+    fossil_tofu_timerq_t* timerq;
+} c_timerq_log_t;
+
+static void c_timerq_record(fossil_tofu_timerq_handle_t handle, const fossil_tofu_t* payload, void* context) {
+    (void)handle;
+    c_timerq_log_t* log = (c_timerq_log_t*)context;
+    if (log->count < 8) {
+        snprintf(log->fired[log->count], sizeof(log->fired[0]), "%s", payload->value.data);
+        log->at[log->count] = fossil_tofu_timerq_now(log->timerq);
+        log->count++;
+    }
+}
+
+FOSSIL_TEST(c_test_timerq_create_and_destroy) {
+    fossil_tofu_timerq_t* timerq = fossil_tofu_timerq_create_container("cstr");
+    ASSUME_NOT_CNULL(timerq);
+    ASSUME_ITS_TRUE(fossil_tofu_timerq_is_empty(timerq));
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_timerq_size(timerq), 0);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_timerq_now(timerq), 0);
+    uint64_t deadline;
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_timerq_next_deadline(timerq, &deadline), FOSSIL_TOFU_ERROR_NOT_FOUND);
+    fossil_tofu_timerq_destroy(timerq);
+}
+
+FOSSIL_TEST(c_test_timerq_fires_in_expiry_order) {
+    fossil_tofu_timerq_t* timerq = fossil_tofu_timerq_create_container("cstr");
+    c_timerq_log_t log = {0};
+    log.timerq = timerq;
+    fossil_tofu_timerq_advance(timerq, 1000, NULL, NULL);
+    fossil_tofu_timerq_schedule_at_ms(timerq, "far", 1000 + 70000, NULL);
+    fossil_tofu_timerq_schedule_at_ms(timerq, "near", 1005, NULL);
+    fossil_tofu_timerq_schedule_at_ms(timerq, "mid", 1300, NULL);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_timerq_size(timerq), 3);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_timerq_advance(timerq, 1004, c_timerq_record, &log), 0);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_timerq_advance(timerq, 2000, c_timerq_record, &log), 2);
+    ASSUME_ITS_EQUAL_CSTR(log.fired[0], "near");
+    ASSUME_ITS_EQUAL_I32(log.at[0], 1005);
+    ASSUME_ITS_EQUAL_CSTR(log.fired[1], "mid");
+    ASSUME_ITS_EQUAL_I32(log.at[1], 1300);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_timerq_now(timerq), 2000);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_timerq_advance(timerq, 1000 + 70000, c_timerq_record, &log), 1);
+    ASSUME_ITS_EQUAL_CSTR(log.fired[2], "far");
+    ASSUME_ITS_EQUAL_I32(log.at[2], 71000);
+    ASSUME_ITS_TRUE(fossil_tofu_timerq_is_empty(timerq));
+    fossil_tofu_timerq_destroy(timerq);
+}
+
+FOSSIL_TEST(c_test_timerq_cancel) {
+    fossil_tofu_timerq_t* timerq = fossil_tofu_timerq_create_container("cstr");
+    fossil_tofu_timerq_handle_t keep, drop;
+    fossil_tofu_timerq_schedule_at_ms(timerq, "keep", 500, &keep);
+    fossil_tofu_timerq_schedule_at_ms(timerq, "drop", 400, &drop);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_timerq_cancel(timerq, drop), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_timerq_cancel(timerq, drop), FOSSIL_TOFU_ERROR_NOT_FOUND);
+    ASSUME_ITS_FALSE(fossil_tofu_timerq_contains(timerq, drop));
+    uint64_t expiry = 0;
+    const fossil_tofu_t* payload = fossil_tofu_timerq_get(timerq, keep, &expiry);
+    ASSUME_NOT_CNULL(payload);
+    ASSUME_ITS_EQUAL_CSTR(payload->value.data, "keep");
+    ASSUME_ITS_EQUAL_I32(expiry, 500);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_timerq_advance(timerq, 1000, NULL, NULL), 1);
+    ASSUME_ITS_FALSE(fossil_tofu_timerq_contains(timerq, keep));
+    fossil_tofu_timerq_destroy(timerq);
+}
+
+FOSSIL_TEST(c_test_timerq_parse_datetime_and_duration) {
+    uint64_t ms = 0;
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_timerq_parse_datetime("1970-01-01T00:00:00Z", &ms), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(ms, 0);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_timerq_parse_datetime("2024-06-01T12:34:56Z", &ms), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_TRUE(ms == 1717245296000ULL);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_timerq_parse_datetime("2024-06-01T14:34:56.250+02:00", &ms), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_TRUE(ms == 1717245296250ULL);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_timerq_parse_datetime("2024-13-01", &ms), FOSSIL_TOFU_ERROR_PARSE);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_timerq_parse_duration("1h30m", &ms), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(ms, 5400000);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_timerq_parse_duration("250ms", &ms), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(ms, 250);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_timerq_parse_duration("30", &ms), FOSSIL_TOFU_ERROR_PARSE);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_timerq_parse_duration("5y", &ms), FOSSIL_TOFU_ERROR_PARSE);
+}
+
+FOSSIL_TEST(c_test_timerq_schedule_tofu_times) {
+    fossil_tofu_timerq_t* timerq = fossil_tofu_timerq_create_container("cstr");
+    c_timerq_log_t log = {0};
+    log.timerq = timerq;
+    fossil_tofu_timerq_advance(timerq, 1717245296000ULL, NULL, NULL);
+    fossil_tofu_t at = fossil_tofu_from_datetime("2024-06-01T12:35:00Z");
+    fossil_tofu_t in = fossil_tofu_from_duration("2s");
+    fossil_tofu_t other = fossil_tofu_create("i32", "5");
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_timerq_schedule(timerq, "at", &at, NULL), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_timerq_schedule(timerq, "in", &in, NULL), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_timerq_schedule(timerq, "x", &other, NULL), FOSSIL_TOFU_ERROR_TYPE_MISMATCH);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_timerq_advance(timerq, 1717245300000ULL, c_timerq_record, &log), 2);
+    ASSUME_ITS_EQUAL_CSTR(log.fired[0], "in");
+    ASSUME_ITS_EQUAL_CSTR(log.fired[1], "at");
+    fossil_tofu_destroy(&at);
+    fossil_tofu_destroy(&in);
+    fossil_tofu_destroy(&other);
+    fossil_tofu_timerq_destroy(timerq);
+}
+
+FOSSIL_TEST(c_test_timerq_late_and_long_timers) {
+    fossil_tofu_timerq_t* timerq = fossil_tofu_timerq_create_container("cstr");
+    c_timerq_log_t log = {0};
+    log.timerq = timerq;
+    fossil_tofu_timerq_advance(timerq, 10000, NULL, NULL);
+    fossil_tofu_timerq_schedule_at_ms(timerq, "late", 50, NULL);
+    // Beyond the 2^32 ms span of the wheel.
+    uint64_t far = 10000 + 6000000000ULL;
+    fossil_tofu_timerq_schedule_at_ms(timerq, "far", far, NULL);
+    uint64_t deadline = 0;
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_timerq_next_deadline(timerq, &deadline), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I32(deadline, 10000);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_timerq_advance(timerq, 10000, c_timerq_record, &log), 1);
+    ASSUME_ITS_EQUAL_CSTR(log.fired[0], "late");
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_timerq_advance(timerq, far - 1, c_timerq_record, &log), 0);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_timerq_advance(timerq, far + 5, c_timerq_record, &log), 1);
+    ASSUME_ITS_TRUE(log.at[1] == far);
+    fossil_tofu_timerq_destroy(timerq);
+}
+
+FOSSIL_TEST(c_test_timerq_copy_and_move) {
+    fossil_tofu_timerq_t* timerq = fossil_tofu_timerq_create_container("cstr");
+    fossil_tofu_timerq_handle_t a, b;
+    fossil_tofu_timerq_schedule_at_ms(timerq, "a", 100, &a);
+    fossil_tofu_timerq_schedule_at_ms(timerq, "b", 200, &b);
+    fossil_tofu_timerq_cancel(timerq, a);
+    fossil_tofu_timerq_t* copy = fossil_tofu_timerq_create_copy(timerq);
+    ASSUME_NOT_CNULL(copy);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_timerq_size(copy), 1);
+    ASSUME_ITS_TRUE(fossil_tofu_timerq_contains(copy, b));
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_timerq_cancel(copy, b), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_TRUE(fossil_tofu_timerq_contains(timerq, b));
+    fossil_tofu_timerq_t* moved = fossil_tofu_timerq_create_move(timerq);
+    ASSUME_ITS_TRUE(fossil_tofu_timerq_is_empty(timerq));
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_timerq_advance(moved, 300, NULL, NULL), 1);
+    fossil_tofu_timerq_destroy(copy);
+    fossil_tofu_timerq_destroy(moved);
+    fossil_tofu_timerq_destroy(timerq);
+}
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(c_timerq_tofu_tests) {    
+    // Generic ToFu Fixture
+    FOSSIL_TEST_ADD(c_timerq_tofu_fixture, c_test_timerq_create_and_destroy);
+    FOSSIL_TEST_ADD(c_timerq_tofu_fixture, c_test_timerq_fires_in_expiry_order);
+    FOSSIL_TEST_ADD(c_timerq_tofu_fixture, c_test_timerq_cancel);
+    FOSSIL_TEST_ADD(c_timerq_tofu_fixture, c_test_timerq_parse_datetime_and_duration);
+    FOSSIL_TEST_ADD(c_timerq_tofu_fixture, c_test_timerq_schedule_tofu_times);
+    FOSSIL_TEST_ADD(c_timerq_tofu_fixture, c_test_timerq_late_and_long_timers);
+    FOSSIL_TEST_ADD(c_timerq_tofu_fixture, c_test_timerq_copy_and_move);
+
+    // Register the test group
+    FOSSIL_TEST_REGISTER(c_timerq_tofu_fixture);
+} // end of tests
@@ -0,0 +1,102 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/pizza/framework.h>
+
+#include "fossil/tofu/framework.h"
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_SUITE(cpp_timerq_tofu_fixture);
+
+FOSSIL_SETUP(cpp_timerq_tofu_fixture) {
+    // Setup the test fixture
+}
+
+FOSSIL_TEARDOWN(cpp_timerq_tofu_fixture) {
+    // Teardown the test fixture
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+#include <string>
+#include <stdexcept>
+#include <vector>
+using fossil::tofu::TimerQ;
+
+FOSSIL_TEST(cpp_test_timerq_schedule_and_advance) {
+    TimerQ timerq("cstr");
+    timerq.advance(1000);
+    fossil_tofu_timerq_handle_t second = timerq.schedule_in("second", "1s");
+    timerq.schedule_at_ms("first", 1500);
+    std::vector<std::string> fired;
+    size_t count = timerq.advance(3000, [&](fossil_tofu_timerq_handle_t, const fossil_tofu_t& payload) {
+        fired.push_back(payload.value.data);
+    });
+    ASSUME_ITS_EQUAL_U32(count, 2u);
+    ASSUME_ITS_EQUAL_CSTR(fired[0].c_str(), "first");
+    ASSUME_ITS_EQUAL_CSTR(fired[1].c_str(), "second");
+    ASSUME_ITS_FALSE(timerq.contains(second));
+    ASSUME_ITS_TRUE(timerq.is_empty());
+}
+
+FOSSIL_TEST(cpp_test_timerq_cancel_and_errors) {
+    TimerQ timerq("cstr");
+    fossil_tofu_timerq_handle_t handle = timerq.schedule_at("job", "1970-01-01T00:00:01Z");
+    ASSUME_ITS_EQUAL_U32(timerq.size(), 1u);
+    ASSUME_ITS_TRUE(timerq.cancel(handle));
+    ASSUME_ITS_FALSE(timerq.cancel(handle));
+    bool thrown = false;
+    try {
+        timerq.schedule_in("bad", "soon");
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    ASSUME_ITS_TRUE(thrown);
+    ASSUME_ITS_EQUAL_U32(timerq.advance(5000), 0u);
+}
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(cpp_timerq_tofu_tests) {    
+    // Generic ToFu Fixture
+    FOSSIL_TEST_ADD(cpp_timerq_tofu_fixture, cpp_test_timerq_schedule_and_advance);
+    FOSSIL_TEST_ADD(cpp_timerq_tofu_fixture, cpp_test_timerq_cancel_and_errors);
+
+    // Register the test group
+    FOSSIL_TEST_REGISTER(cpp_timerq_tofu_fixture);
+} // end of tests
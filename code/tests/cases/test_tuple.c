@@ -162,6 +162,21 @@ FOSSIL_TEST(c_test_tuple_move_constructor) {
     fossil_tofu_tuple_destroy(tuple2);
 }
 
+FOSSIL_TEST(c_test_tuple_aggregate) {
+    fossil_tofu_tuple_t* tuple = fossil_tofu_tuple_create("i32");
+    fossil_tofu_tuple_add(tuple, "2");
+    fossil_tofu_tuple_add(tuple, "4");
+    fossil_tofu_tuple_add(tuple, "6");
+    double out = 0.0;
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_tuple_sum(tuple, &out), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_F64(out, 12.0, 1e-9);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_tuple_mean(tuple, &out), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_F64(out, 4.0, 1e-9);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_tuple_variance(tuple, &out), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_F64(out, 8.0 / 3.0, 1e-9);
+    fossil_tofu_tuple_destroy(tuple);
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -177,6 +192,7 @@ FOSSIL_TEST_GROUP(c_tuple_tofu_tests) {
     FOSSIL_TEST_ADD(c_tuple_tofu_fixture, c_test_tuple_capacity_growth);
     FOSSIL_TEST_ADD(c_tuple_tofu_fixture, c_test_tuple_copy_constructor);
     FOSSIL_TEST_ADD(c_tuple_tofu_fixture, c_test_tuple_move_constructor);
+    FOSSIL_TEST_ADD(c_tuple_tofu_fixture, c_test_tuple_aggregate);
 
     // Register the test group
     FOSSIL_TEST_REGISTER(c_tuple_tofu_fixture);
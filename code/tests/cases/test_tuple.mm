@@ -150,6 +150,15 @@ FOSSIL_TEST(objcpp_test_tuple_move_constructor) {
     ASSUME_ITS_EQUAL_I32(tuple1.size(), 0);
 }
 
+FOSSIL_TEST(objcpp_test_tuple_aggregate) {
+    Tuple tuple("i32");
+    tuple.add("5");
+    tuple.add("-5");
+    ASSUME_ITS_EQUAL_F64(tuple.sum(), 0.0, 1e-9);
+    ASSUME_ITS_EQUAL_F64(tuple.min(), -5.0, 1e-9);
+    ASSUME_ITS_EQUAL_F64(tuple.max(), 5.0, 1e-9);
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -165,6 +174,7 @@ FOSSIL_TEST_GROUP(objcpp_tuple_tofu_tests) {
     FOSSIL_TEST_ADD(objcpp_tuple_tofu_fixture, objcpp_test_tuple_capacity_growth);
     FOSSIL_TEST_ADD(objcpp_tuple_tofu_fixture, objcpp_test_tuple_copy_constructor);
     FOSSIL_TEST_ADD(objcpp_tuple_tofu_fixture, objcpp_test_tuple_move_constructor);
+    FOSSIL_TEST_ADD(objcpp_tuple_tofu_fixture, objcpp_test_tuple_aggregate);
 
     // Register the test group
     FOSSIL_TEST_REGISTER(objcpp_tuple_tofu_fixture);
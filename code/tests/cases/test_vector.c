@@ -235,6 +235,288 @@ FOSSIL_TEST(c_test_vector_pop_at_various_positions) {
     fossil_tofu_vector_destroy(vector);
 }
 
+FOSSIL_TEST(c_test_vector_columnar_push_and_get) {
+    fossil_tofu_vector_t* vector = fossil_tofu_vector_create_columnar("i32");
+    ASSUME_NOT_CNULL(vector);
+    ASSUME_ITS_TRUE(fossil_tofu_vector_is_columnar(vector));
+    for (int i = 0; i < INITIAL_CAPACITY + 5; ++i) {
+        char buf[16];
+        snprintf(buf, sizeof(buf), "%d", i * 10);
+        fossil_tofu_vector_push_back(vector, buf);
+    }
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_vector_size(vector), INITIAL_CAPACITY + 5);
+    char value[FOSSIL_TOFU_VECTOR_VALUE_BUFFER];
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_vector_get_into(vector, 3, value, sizeof(value)), "30");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_vector_get_into(vector, INITIAL_CAPACITY + 4, value, sizeof(value)), "140");
+    const int32_t* span = fossil_tofu_vector_span_i32(vector);
+    ASSUME_NOT_CNULL(span);
+    ASSUME_ITS_EQUAL_I32(span[12], 120);
+    ASSUME_ITS_CNULL(fossil_tofu_vector_span_f64(vector));
+    fossil_tofu_vector_destroy(vector);
+}
+
+FOSSIL_TEST(c_test_vector_columnar_rejects_non_numeric) {
+    ASSUME_ITS_CNULL(fossil_tofu_vector_create_columnar("cstr"));
+    ASSUME_ITS_CNULL(fossil_tofu_vector_create_columnar("datetime"));
+    fossil_tofu_vector_t* vector = fossil_tofu_vector_create_container("i32");
+    ASSUME_ITS_FALSE(fossil_tofu_vector_is_columnar(vector));
+    ASSUME_ITS_CNULL(fossil_tofu_vector_span_i32(vector));
+    fossil_tofu_vector_destroy(vector);
+}
+
+FOSSIL_TEST(c_test_vector_columnar_nulls) {
+    fossil_tofu_vector_t* vector = fossil_tofu_vector_create_columnar("f64");
+    fossil_tofu_vector_push_back(vector, "1.5");
+    fossil_tofu_vector_push_back(vector, NULL);
+    fossil_tofu_vector_push_back(vector, "0.1");
+    ASSUME_ITS_FALSE(fossil_tofu_vector_is_null(vector, 0));
+    ASSUME_ITS_TRUE(fossil_tofu_vector_is_null(vector, 1));
+    char value[FOSSIL_TOFU_VECTOR_VALUE_BUFFER];
+    ASSUME_ITS_CNULL(fossil_tofu_vector_get_into(vector, 1, value, sizeof(value)));
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_vector_get_into(vector, 2, value, sizeof(value)), "0.1");
+    fossil_tofu_vector_pop_front(vector);
+    ASSUME_ITS_TRUE(fossil_tofu_vector_is_null(vector, 0));
+    fossil_tofu_vector_set_front(vector, "2.25");
+    ASSUME_ITS_FALSE(fossil_tofu_vector_is_null(vector, 0));
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_vector_get_into(vector, 0, value, sizeof(value)), "2.25");
+    ASSUME_ITS_EQUAL_F64(fossil_tofu_vector_span_f64(vector)[0], 2.25, 1e-12);
+    fossil_tofu_vector_destroy(vector);
+}
+
+FOSSIL_TEST(c_test_vector_columnar_copy_and_move) {
+    fossil_tofu_vector_t* vector1 = fossil_tofu_vector_create_columnar("u8");
+    fossil_tofu_vector_push_back(vector1, "7");
+    fossil_tofu_vector_push_front(vector1, "3");
+    fossil_tofu_vector_push_at(vector1, 1, NULL);
+    fossil_tofu_vector_t* vector2 = fossil_tofu_vector_create_copy(vector1);
+    ASSUME_ITS_TRUE(fossil_tofu_vector_is_columnar(vector2));
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_vector_size(vector2), 3);
+    char value[FOSSIL_TOFU_VECTOR_VALUE_BUFFER];
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_vector_get_into(vector2, 0, value, sizeof(value)), "3");
+    ASSUME_ITS_TRUE(fossil_tofu_vector_is_null(vector2, 1));
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_vector_get_into(vector2, 2, value, sizeof(value)), "7");
+    fossil_tofu_vector_t* vector3 = fossil_tofu_vector_create_move(vector2);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_vector_size(vector3), 3);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_vector_span_u8(vector3)[2], 7);
+    fossil_tofu_vector_destroy(vector1);
+    fossil_tofu_vector_destroy(vector2);
+    fossil_tofu_vector_destroy(vector3);
+}
+
+static bool c_vector_is_above_two(double value, void *context) {
+    (void)context;
+    return value > 2.0;
+}
+
+FOSSIL_TEST(c_test_vector_aggregate_boxed) {
+    fossil_tofu_vector_t* vector = fossil_tofu_vector_create_container("i32");
+    fossil_tofu_vector_push_back(vector, "4");
+    fossil_tofu_vector_push_back(vector, "1");
+    fossil_tofu_vector_push_back(vector, "3");
+    fossil_tofu_vector_push_back(vector, "2");
+    double out = 0.0;
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_vector_sum(vector, &out), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_F64(out, 10.0, 1e-9);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_vector_min(vector, &out), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_F64(out, 1.0, 1e-9);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_vector_max(vector, &out), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_F64(out, 4.0, 1e-9);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_vector_mean(vector, &out), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_F64(out, 2.5, 1e-9);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_vector_variance(vector, &out), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_F64(out, 1.25, 1e-9);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_vector_count_if(vector, c_vector_is_above_two, NULL), 2);
+    fossil_tofu_vector_destroy(vector);
+}
+
+FOSSIL_TEST(c_test_vector_aggregate_columnar) {
+    fossil_tofu_vector_t* vector = fossil_tofu_vector_create_columnar("f64");
+    double expected = 0.0;
+    for (int i = 1; i <= 1000; i++) {
+        char buf[16];
+        snprintf(buf, sizeof(buf), "%d", i);
+        fossil_tofu_vector_push_back(vector, buf);
+        expected += i;
+    }
+    fossil_tofu_vector_push_back(vector, NULL);
+    double out = 0.0;
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_vector_sum(vector, &out), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_F64(out, expected, 1e-6);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_vector_min(vector, &out), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_F64(out, 1.0, 1e-9);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_vector_max(vector, &out), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_F64(out, 1000.0, 1e-9);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_vector_mean(vector, &out), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_F64(out, 500.5, 1e-9);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_vector_variance(vector, &out), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_F64(out, 83333.25, 1e-6);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_vector_count_if(vector, c_vector_is_above_two, NULL), 998);
+    fossil_tofu_vector_destroy(vector);
+}
+
+FOSSIL_TEST(c_test_vector_aggregate_errors) {
+    fossil_tofu_vector_t* vector = fossil_tofu_vector_create_columnar("i16");
+    double out = 0.0;
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_vector_sum(vector, &out), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_F64(out, 0.0, 1e-9);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_vector_min(vector, &out), FOSSIL_TOFU_ERROR_NOT_FOUND);
+    fossil_tofu_vector_destroy(vector);
+
+    vector = fossil_tofu_vector_create_container("cstr");
+    fossil_tofu_vector_push_back(vector, "hello");
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_vector_sum(vector, &out), FOSSIL_TOFU_ERROR_TYPE_MISMATCH);
+    fossil_tofu_vector_destroy(vector);
+}
+
+FOSSIL_TEST(c_test_vector_search_boxed) {
+    fossil_tofu_vector_t* vector = fossil_tofu_vector_create_container("cstr");
+    for (int i = 0; i < 37; i++) {
+        char buf[16];
+        snprintf(buf, sizeof(buf), "item-%d", i);
+        fossil_tofu_vector_push_back(vector, buf);
+    }
+    size_t index = 0;
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_vector_index_of(vector, "item-33", &index), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_SIZE(index, 33);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_vector_find(vector, "item-2"), "item-2");
+    ASSUME_ITS_TRUE(fossil_tofu_vector_contains(vector, "item-0"));
+    ASSUME_ITS_FALSE(fossil_tofu_vector_contains(vector, "item-37"));
+    ASSUME_ITS_CNULL(fossil_tofu_vector_find(vector, "missing"));
+
+    // Overwritten values must be found under their new contents
+    fossil_tofu_vector_set(vector, 5, "replaced");
+    ASSUME_ITS_TRUE(fossil_tofu_vector_contains(vector, "replaced"));
+    ASSUME_ITS_FALSE(fossil_tofu_vector_contains(vector, "item-5"));
+    fossil_tofu_vector_destroy(vector);
+}
+
+FOSSIL_TEST(c_test_vector_search_columnar) {
+    fossil_tofu_vector_t* vector = fossil_tofu_vector_create_columnar("f64");
+    fossil_tofu_vector_push_back(vector, "1.5");
+    fossil_tofu_vector_push_back(vector, NULL);
+    fossil_tofu_vector_push_back(vector, "0");
+    fossil_tofu_vector_push_back(vector, "2.25");
+    size_t index = 0;
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_vector_index_of(vector, "2.250", &index), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_SIZE(index, 3);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_vector_index_of(vector, "0", &index), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_SIZE(index, 2);
+    ASSUME_ITS_FALSE(fossil_tofu_vector_contains(vector, "3"));
+    ASSUME_ITS_FALSE(fossil_tofu_vector_contains(vector, "abc"));
+    fossil_tofu_vector_destroy(vector);
+}
+
+static void c_vector_sum_each(size_t index, const char *element, void *context) {
+    (void)index;
+    *(long *)context += element ? atol(element) : 0;
+}
+
+static bool c_vector_double_it(const char *element, char *out, size_t size, void *context) {
+    (void)context;
+    snprintf(out, size, "%ld", element ? atol(element) * 2 : 0);
+    return true;
+}
+
+static bool c_vector_is_even(const char *element, void *context) {
+    (void)context;
+    return element != NULL && atol(element) % 2 == 0;
+}
+
+static void c_vector_fold_sum(void *accumulator, const char *element, void *context) {
+    (void)context;
+    *(long *)accumulator += element ? atol(element) : 0;
+}
+
+static void c_vector_combine_sum(void *accumulator, const void *partial, void *context) {
+    (void)context;
+    *(long *)accumulator += *(const long *)partial;
+}
+
+FOSSIL_TEST(c_test_vector_bulk_transforms) {
+    fossil_tofu_vector_t* vector = fossil_tofu_vector_create_container("i32");
+    fossil_tofu_vector_push_back(vector, "1");
+    fossil_tofu_vector_push_back(vector, "2");
+    fossil_tofu_vector_push_back(vector, "3");
+    fossil_tofu_vector_push_back(vector, "4");
+
+    long total = 0;
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_vector_for_each(vector, c_vector_sum_each, &total), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I64(total, 10);
+
+    fossil_tofu_vector_t* doubled = fossil_tofu_vector_map(vector, "i64", c_vector_double_it, NULL);
+    ASSUME_NOT_CNULL(doubled);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_vector_size(doubled), 4);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_vector_get(doubled, 3), "8");
+
+    long folded = 0;
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_vector_reduce(doubled, &folded, c_vector_fold_sum, NULL), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I64(folded, 20);
+
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_vector_filter(vector, c_vector_is_even, NULL), 2);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_vector_size(vector), 2);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_vector_get(vector, 0), "2");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_vector_get(vector, 1), "4");
+
+    fossil_tofu_vector_destroy(doubled);
+    fossil_tofu_vector_destroy(vector);
+}
+
+FOSSIL_TEST(c_test_vector_parallel_transforms) {
+    fossil_tofu_vector_t* vector = fossil_tofu_vector_create_columnar("i64");
+    for (int i = 0; i < 10000; i++) {
+        char buf[16];
+        snprintf(buf, sizeof(buf), "%d", i);
+        fossil_tofu_vector_push_back(vector, i == 4321 ? NULL : buf);
+    }
+
+    fossil_tofu_vector_t* doubled = fossil_tofu_vector_parallel_map(vector, "i64", c_vector_double_it, NULL, 4);
+    ASSUME_NOT_CNULL(doubled);
+    ASSUME_ITS_TRUE(fossil_tofu_vector_is_columnar(doubled));
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_vector_size(doubled), 10000);
+    char value[FOSSIL_TOFU_VECTOR_VALUE_BUFFER];
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_vector_get_into(doubled, 9999, value, sizeof(value)), "19998");
+
+    long sequential = 0;
+    long parallel = 0;
+    fossil_tofu_vector_reduce(doubled, &sequential, c_vector_fold_sum, NULL);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_vector_parallel_reduce(doubled, &parallel, sizeof(parallel),
+                         c_vector_fold_sum, c_vector_combine_sum, NULL, 4), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_I64(parallel, sequential);
+    ASSUME_ITS_EQUAL_I64(parallel, 99990000L - 8642L);
+
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_vector_parallel_filter(vector, c_vector_is_even, NULL, 4), 5000);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_vector_size(vector), 5000);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_vector_get_into(vector, 4999, value, sizeof(value)), "9998");
+    ASSUME_ITS_TRUE(fossil_tofu_vector_contains(vector, "4320"));
+    ASSUME_ITS_FALSE(fossil_tofu_vector_contains(vector, "4321"));
+
+    fossil_tofu_vector_destroy(doubled);
+    fossil_tofu_vector_destroy(vector);
+}
+
+FOSSIL_TEST(c_test_vector_columnar_get_into) {
+    fossil_tofu_vector_t* vector = fossil_tofu_vector_create_columnar("i32");
+    fossil_tofu_vector_push_back(vector, "7");
+    fossil_tofu_vector_push_back(vector, "-12");
+    char first[FOSSIL_TOFU_VECTOR_VALUE_BUFFER];
+    char second[FOSSIL_TOFU_VECTOR_VALUE_BUFFER];
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_vector_get_into(vector, 0, first, sizeof(first)), "7");
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_vector_get_into(vector, 1, second, sizeof(second)), "-12");
+    ASSUME_ITS_EQUAL_CSTR(first, "7");
+    ASSUME_ITS_CNULL(fossil_tofu_vector_get_into(vector, 2, first, sizeof(first)));
+    ASSUME_ITS_CNULL(fossil_tofu_vector_get_into(vector, 0, first, 0));
+    ASSUME_ITS_CNULL(fossil_tofu_vector_get(vector, 0));
+    fossil_tofu_vector_destroy(vector);
+}
+
+FOSSIL_TEST(c_test_vector_get_into_boxed_truncates) {
+    fossil_tofu_vector_t* vector = fossil_tofu_vector_create_container("cstr");
+    fossil_tofu_vector_push_back(vector, "abcdef");
+    char buf[4];
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_vector_get_into(vector, 0, buf, sizeof(buf)), "abc");
+    fossil_tofu_vector_destroy(vector);
+}
+
 
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
@@ -256,6 +538,19 @@ FOSSIL_TEST_GROUP(c_vector_tofu_tests) {
     FOSSIL_TEST_ADD(c_vector_tofu_fixture, c_test_vector_set_at_various_positions);
     FOSSIL_TEST_ADD(c_vector_tofu_fixture, c_test_vector_push_at_beginning_and_end);
     FOSSIL_TEST_ADD(c_vector_tofu_fixture, c_test_vector_pop_at_various_positions);
+    FOSSIL_TEST_ADD(c_vector_tofu_fixture, c_test_vector_columnar_push_and_get);
+    FOSSIL_TEST_ADD(c_vector_tofu_fixture, c_test_vector_columnar_rejects_non_numeric);
+    FOSSIL_TEST_ADD(c_vector_tofu_fixture, c_test_vector_columnar_nulls);
+    FOSSIL_TEST_ADD(c_vector_tofu_fixture, c_test_vector_columnar_copy_and_move);
+    FOSSIL_TEST_ADD(c_vector_tofu_fixture, c_test_vector_aggregate_boxed);
+    FOSSIL_TEST_ADD(c_vector_tofu_fixture, c_test_vector_aggregate_columnar);
+    FOSSIL_TEST_ADD(c_vector_tofu_fixture, c_test_vector_aggregate_errors);
+    FOSSIL_TEST_ADD(c_vector_tofu_fixture, c_test_vector_search_boxed);
+    FOSSIL_TEST_ADD(c_vector_tofu_fixture, c_test_vector_search_columnar);
+    FOSSIL_TEST_ADD(c_vector_tofu_fixture, c_test_vector_bulk_transforms);
+    FOSSIL_TEST_ADD(c_vector_tofu_fixture, c_test_vector_parallel_transforms);
+    FOSSIL_TEST_ADD(c_vector_tofu_fixture, c_test_vector_columnar_get_into);
+    FOSSIL_TEST_ADD(c_vector_tofu_fixture, c_test_vector_get_into_boxed_truncates);
 
     // Register the test group
     FOSSIL_TEST_REGISTER(c_vector_tofu_fixture);
@@ -213,6 +213,67 @@ FOSSIL_TEST(objcpp_test_vector_pop_at_various_positions) {
     ASSUME_ITS_EQUAL_I32(vector.size(), 1);
 }
 
+FOSSIL_TEST(objcpp_test_vector_columnar) {
+    Vector vector = Vector::columnar("i64");
+    ASSUME_ITS_TRUE(vector.is_columnar());
+    vector.push_back("-5");
+    vector.push_back("9000000000");
+    ASSUME_ITS_EQUAL_I32(vector.size(), 2);
+    ASSUME_ITS_EQUAL_CSTR(vector.get(0).c_str(), "-5");
+    ASSUME_ITS_EQUAL_CSTR(vector.get(1).c_str(), "9000000000");
+    ASSUME_ITS_FALSE(vector.is_null(1));
+}
+
+FOSSIL_TEST(objcpp_test_vector_aggregate) {
+    Vector vector = Vector::columnar("i64");
+    vector.push_back("10");
+    vector.push_back("20");
+    vector.push_back("30");
+    ASSUME_ITS_EQUAL_F64(vector.sum(), 60.0, 1e-9);
+    ASSUME_ITS_EQUAL_F64(vector.min(), 10.0, 1e-9);
+    ASSUME_ITS_EQUAL_F64(vector.max(), 30.0, 1e-9);
+    ASSUME_ITS_EQUAL_F64(vector.mean(), 20.0, 1e-9);
+}
+
+FOSSIL_TEST(objcpp_test_vector_search) {
+    Vector vector("cstr");
+    vector.push_back("red");
+    vector.push_back("green");
+    size_t index = 0;
+    ASSUME_ITS_TRUE(vector.index_of("green", index));
+    ASSUME_ITS_EQUAL_SIZE(index, 1);
+    ASSUME_ITS_TRUE(vector.contains("red"));
+    ASSUME_ITS_FALSE(vector.contains("blue"));
+}
+
+FOSSIL_TEST(objcpp_test_vector_for_each_and_filter) {
+    Vector vector("i32");
+    for (int i = 0; i < 6; i++) {
+        vector.push_back(std::to_string(i));
+    }
+    long total = 0;
+    vector.for_each([&total](size_t, const char* element) { total += std::atol(element); });
+    ASSUME_ITS_EQUAL_I64(total, 15);
+    size_t removed = vector.filter([](const char* element) { return std::atol(element) >= 3; });
+    ASSUME_ITS_EQUAL_SIZE(removed, 3);
+    ASSUME_ITS_EQUAL_CSTR(vector.get(0).c_str(), "3");
+}
+
+FOSSIL_TEST(objcpp_test_vector_parallel_for_each) {
+    Vector vector("i32");
+    static long seen[4096];
+    for (int i = 0; i < 4096; i++) {
+        vector.push_back(std::to_string(i));
+        seen[i] = -1;
+    }
+    vector.parallel_for_each([](size_t index, const char* element) { seen[index] = std::atol(element); }, 4);
+    long mismatches = 0;
+    for (int i = 0; i < 4096; i++) {
+        mismatches += seen[i] != i;
+    }
+    ASSUME_ITS_EQUAL_I64(mismatches, 0);
+}
+
 
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
@@ -234,6 +295,11 @@ FOSSIL_TEST_GROUP(objcpp_vector_tofu_tests) {
     FOSSIL_TEST_ADD(objcpp_vector_tofu_fixture, objcpp_test_vector_set_at_various_positions);
     FOSSIL_TEST_ADD(objcpp_vector_tofu_fixture, objcpp_test_vector_push_at_beginning_and_end);
     FOSSIL_TEST_ADD(objcpp_vector_tofu_fixture, objcpp_test_vector_pop_at_various_positions);
+    FOSSIL_TEST_ADD(objcpp_vector_tofu_fixture, objcpp_test_vector_columnar);
+    FOSSIL_TEST_ADD(objcpp_vector_tofu_fixture, objcpp_test_vector_aggregate);
+    FOSSIL_TEST_ADD(objcpp_vector_tofu_fixture, objcpp_test_vector_search);
+    FOSSIL_TEST_ADD(objcpp_vector_tofu_fixture, objcpp_test_vector_for_each_and_filter);
+    FOSSIL_TEST_ADD(objcpp_vector_tofu_fixture, objcpp_test_vector_parallel_for_each);
 
     // Register the test group
     FOSSIL_TEST_REGISTER(objcpp_vector_tofu_fixture);
@@ -0,0 +1,209 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/pizza/framework.h>
+
+#include "fossil/tofu/framework.h"
+#include "fossil/tofu/atomics.h"
+#include "fossil/tofu/threads.h"
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_SUITE(c_wsdeque_tofu_fixture);
+
+FOSSIL_SETUP(c_wsdeque_tofu_fixture) {
+    // Setup the test fixture
+}
+
+FOSSIL_TEARDOWN(c_wsdeque_tofu_fixture) {
+    // Teardown the test fixture
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_TEST(c_test_wsdeque_push_pop_and_steal) {
+    fossil_tofu_wsdeque_t* wsdeque = fossil_tofu_wsdeque_create_container("i32", 0);
+    ASSUME_NOT_CNULL(wsdeque);
+    ASSUME_ITS_TRUE(fossil_tofu_wsdeque_is_empty(wsdeque));
+    fossil_tofu_wsdeque_push(wsdeque, "1");
+    fossil_tofu_wsdeque_push(wsdeque, "2");
+    fossil_tofu_wsdeque_push(wsdeque, "3");
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_wsdeque_size(wsdeque), 3);
+
+    // The owner sees LIFO order, thieves take the oldest element
+    fossil_tofu_t out;
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_wsdeque_pop(wsdeque, &out), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&out), "3");
+    fossil_tofu_destroy(&out);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_wsdeque_steal(wsdeque, &out), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&out), "1");
+    fossil_tofu_destroy(&out);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_wsdeque_pop(wsdeque, &out), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&out), "2");
+    fossil_tofu_destroy(&out);
+
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_wsdeque_pop(wsdeque, &out), FOSSIL_TOFU_FAILURE);
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_wsdeque_steal(wsdeque, &out), FOSSIL_TOFU_FAILURE);
+    ASSUME_ITS_TRUE(fossil_tofu_wsdeque_is_empty(wsdeque));
+    fossil_tofu_wsdeque_destroy(wsdeque);
+}
+
+FOSSIL_TEST(c_test_wsdeque_grow) {
+    fossil_tofu_wsdeque_t* wsdeque = fossil_tofu_wsdeque_create_container("i32", 3);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_wsdeque_capacity(wsdeque), 4);
+    fossil_tofu_t out;
+    fossil_tofu_wsdeque_push(wsdeque, "0");
+    fossil_tofu_wsdeque_steal(wsdeque, &out);
+    fossil_tofu_destroy(&out);
+    for (int i = 1; i <= 20; i++) {
+        char value[8];
+        snprintf(value, sizeof(value), "%d", i);
+        ASSUME_ITS_EQUAL_I32(fossil_tofu_wsdeque_push(wsdeque, value), FOSSIL_TOFU_SUCCESS);
+    }
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_wsdeque_size(wsdeque), 20);
+    ASSUME_ITS_EQUAL_SIZE(fossil_tofu_wsdeque_capacity(wsdeque), 32);
+
+    fossil_tofu_wsdeque_steal(wsdeque, &out);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&out), "1");
+    fossil_tofu_destroy(&out);
+    fossil_tofu_wsdeque_pop(wsdeque, &out);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&out), "20");
+    fossil_tofu_destroy(&out);
+    fossil_tofu_wsdeque_destroy(wsdeque);
+}
+
+FOSSIL_TEST(c_test_wsdeque_push_tofu) {
+    fossil_tofu_wsdeque_t* wsdeque = fossil_tofu_wsdeque_create_container("cstr", 0);
+    fossil_tofu_t tofu = fossil_tofu_create("cstr", "task");
+    ASSUME_ITS_EQUAL_I32(fossil_tofu_wsdeque_push_tofu(wsdeque, &tofu), FOSSIL_TOFU_SUCCESS);
+    ASSUME_ITS_CNULL(tofu.value.data);
+    fossil_tofu_t out;
+    fossil_tofu_wsdeque_pop(wsdeque, &out);
+    ASSUME_ITS_EQUAL_CSTR(fossil_tofu_get_value(&out), "task");
+    fossil_tofu_destroy(&out);
+    fossil_tofu_wsdeque_destroy(wsdeque);
+}
+
+#define C_WSDEQUE_THIEVES 3
+#define C_WSDEQUE_TASKS 4000
+
+typedef struct {
+    fossil_tofu_wsdeque_t* wsdeque;
+    fossil_tofu_atomic_size_t* done;
+    int* seen;
+} c_wsdeque_thief_t;
+
+static void* c_wsdeque_thief(void* arg) {
+    c_wsdeque_thief_t* work = (c_wsdeque_thief_t*)arg;
+    fossil_tofu_t out;
+    for (;;) {
+        if (fossil_tofu_wsdeque_steal(work->wsdeque, &out) == FOSSIL_TOFU_SUCCESS) {
+            work->seen[atoi(fossil_tofu_get_value(&out))]++;
+            fossil_tofu_destroy(&out);
+        } else if (fossil_tofu_atomic_size_load(work->done, FOSSIL_TOFU_ACQUIRE)) {
+            break;
+        } else {
+            fossil_tofu_thread_yield();
+        }
+    }
+    return NULL;
+}
+
+FOSSIL_TEST(c_test_wsdeque_threaded_steal) {
+    fossil_tofu_wsdeque_t* wsdeque = fossil_tofu_wsdeque_create_container("i32", 4);
+    static int seen[C_WSDEQUE_THIEVES + 1][C_WSDEQUE_TASKS];
+    memset(seen, 0, sizeof(seen));
+    fossil_tofu_atomic_size_t done;
+    fossil_tofu_atomic_size_init(&done, 0);
+    fossil_tofu_thread_t threads[C_WSDEQUE_THIEVES];
+    bool started[C_WSDEQUE_THIEVES];
+    c_wsdeque_thief_t work[C_WSDEQUE_THIEVES];
+    for (int t = 0; t < C_WSDEQUE_THIEVES; t++) {
+        work[t] = (c_wsdeque_thief_t){wsdeque, &done, seen[t + 1]};
+        // A thief that cannot start just leaves more for the owner to pop
+        started[t] = fossil_tofu_thread_create(&threads[t], c_wsdeque_thief, &work[t]) == FOSSIL_TOFU_SUCCESS;
+    }
+
+    // The owner pushes work in bursts and pops some of it back itself
+    fossil_tofu_t out;
+    char value[16];
+    for (int i = 0; i < C_WSDEQUE_TASKS; i++) {
+        snprintf(value, sizeof(value), "%d", i);
+        fossil_tofu_wsdeque_push(wsdeque, value);
+        if (i % 3 == 0 && fossil_tofu_wsdeque_pop(wsdeque, &out) == FOSSIL_TOFU_SUCCESS) {
+            seen[0][atoi(fossil_tofu_get_value(&out))]++;
+            fossil_tofu_destroy(&out);
+        }
+    }
+    while (fossil_tofu_wsdeque_pop(wsdeque, &out) == FOSSIL_TOFU_SUCCESS) {
+        seen[0][atoi(fossil_tofu_get_value(&out))]++;
+        fossil_tofu_destroy(&out);
+    }
+    fossil_tofu_atomic_size_store(&done, 1, FOSSIL_TOFU_RELEASE);
+    for (int t = 0; t < C_WSDEQUE_THIEVES; t++) {
+        if (started[t]) {
+            fossil_tofu_thread_join(threads[t]);
+        }
+    }
+
+    bool exactly_once = true;
+    for (int v = 0; v < C_WSDEQUE_TASKS; v++) {
+        int total = 0;
+        for (int t = 0; t <= C_WSDEQUE_THIEVES; t++) {
+            total += seen[t][v];
+        }
+        if (total != 1) {
+            exactly_once = false;
+        }
+    }
+    ASSUME_ITS_TRUE(exactly_once);
+    ASSUME_ITS_TRUE(fossil_tofu_wsdeque_is_empty(wsdeque));
+    fossil_tofu_wsdeque_destroy(wsdeque);
+}
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(c_wsdeque_tofu_tests) {    
+    // Generic ToFu Fixture
+    FOSSIL_TEST_ADD(c_wsdeque_tofu_fixture, c_test_wsdeque_push_pop_and_steal);
+    FOSSIL_TEST_ADD(c_wsdeque_tofu_fixture, c_test_wsdeque_grow);
+    FOSSIL_TEST_ADD(c_wsdeque_tofu_fixture, c_test_wsdeque_push_tofu);
+    FOSSIL_TEST_ADD(c_wsdeque_tofu_fixture, c_test_wsdeque_threaded_steal);
+
+    // Register the test group
+    FOSSIL_TEST_REGISTER(c_wsdeque_tofu_fixture);
+} // end of tests
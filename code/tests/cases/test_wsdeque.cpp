@@ -0,0 +1,142 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/pizza/framework.h>
+
+#include "fossil/tofu/framework.h"
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_SUITE(cpp_wsdeque_tofu_fixture);
+
+FOSSIL_SETUP(cpp_wsdeque_tofu_fixture) {
+    // Setup the test fixture
+}
+
+FOSSIL_TEARDOWN(cpp_wsdeque_tofu_fixture) {
+    // Teardown the test fixture
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Cases
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// The test cases below are provided as samples, inspired
+// by the Meson build system's approach of using test cases
+// as samples for library usage.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+using fossil::tofu::WSDeque;
+
+FOSSIL_TEST(cpp_test_wsdeque_push_pop_and_steal) {
+    WSDeque wsdeque("i32");
+    wsdeque.push("10");
+    wsdeque.push("20");
+    wsdeque.push("30");
+    ASSUME_ITS_EQUAL_SIZE(wsdeque.size(), 3);
+    std::string value;
+    ASSUME_ITS_TRUE(wsdeque.pop(value));
+    ASSUME_ITS_EQUAL_CSTR(value.c_str(), "30");
+    ASSUME_ITS_TRUE(wsdeque.steal(value));
+    ASSUME_ITS_EQUAL_CSTR(value.c_str(), "10");
+    ASSUME_ITS_TRUE(wsdeque.pop(value));
+    ASSUME_ITS_FALSE(wsdeque.steal(value));
+    ASSUME_ITS_TRUE(wsdeque.is_empty());
+}
+
+FOSSIL_TEST(cpp_test_wsdeque_threaded_steal) {
+    WSDeque wsdeque("i32", 4);
+    const int tasks = 2000;
+    std::atomic<bool> done(false);
+    std::vector<std::vector<std::string>> stolen(2);
+    std::vector<std::thread> thieves;
+    for (size_t t = 0; t < stolen.size(); t++) {
+        thieves.emplace_back([&wsdeque, &done, &stolen, t]() {
+            std::string value;
+            while (true) {
+                if (wsdeque.steal(value)) {
+                    stolen[t].push_back(value);
+                } else if (done.load()) {
+                    break;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::vector<std::string> popped;
+    std::string value;
+    for (int i = 0; i < tasks; i++) {
+        wsdeque.push(std::to_string(i));
+        if (i % 2 == 0 && wsdeque.pop(value)) {
+            popped.push_back(value);
+        }
+    }
+    while (wsdeque.pop(value)) {
+        popped.push_back(value);
+    }
+    done.store(true);
+    for (std::thread& thief : thieves) {
+        thief.join();
+    }
+
+    std::vector<int> seen(tasks, 0);
+    for (const std::string& item : popped) {
+        seen[std::stoi(item)]++;
+    }
+    for (const std::vector<std::string>& list : stolen) {
+        for (const std::string& item : list) {
+            seen[std::stoi(item)]++;
+        }
+    }
+    bool exactly_once = true;
+    for (int count : seen) {
+        if (count != 1) {
+            exactly_once = false;
+        }
+    }
+    ASSUME_ITS_TRUE(exactly_once);
+}
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(cpp_wsdeque_tofu_tests) {    
+    // Generic ToFu Fixture
+    FOSSIL_TEST_ADD(cpp_wsdeque_tofu_fixture, cpp_test_wsdeque_push_pop_and_steal);
+    FOSSIL_TEST_ADD(cpp_wsdeque_tofu_fixture, cpp_test_wsdeque_threaded_steal);
+
+    // Register the test group
+    FOSSIL_TEST_REGISTER(cpp_wsdeque_tofu_fixture);
+} // end of tests